@@ -0,0 +1,46 @@
+PREFIX ?=
+
+CPP=$(PREFIX)g++
+
+# Host tests of a library, included from lib-<name>/test/Makefile
+#
+# TESTS          : the test programs, each built from <test>.cpp
+# SOURCES        : the library sources under test, relative to the test directory
+# SOURCES_<test> : the additional sources of one test
+# DEFINES        : without -D
+# EXTRA_INCLUDES : without -I, searched first, for the stubs of the hardware
+#
+# make       builds and runs all the tests, the first failure stops the run
+# make clean
+
+$(info [${CURDIR}])
+
+DEFINES:=$(addprefix -D,$(DEFINES))
+
+INCLUDES:=$(addprefix -I,$(EXTRA_INCLUDES))
+INCLUDES+=-I../include -I../../firmware-template-linux/test/include -I../../lib-hal/include
+
+COPS=$(DEFINES) $(INCLUDES)
+COPS+=-g -O2 -Wall -Werror -Wextra
+COPS+=-fstack-protector-all
+
+CCPOPS=-fno-rtti -fno-exceptions -std=c++20
+
+BUILD=build_linux/
+
+TARGETS=$(addprefix $(BUILD),$(TESTS))
+
+all : run
+
+.PHONY: run clean
+
+run: $(TARGETS)
+	@for t in $(TARGETS); do echo "[$$t]"; ./$$t || exit 1; done
+
+clean:
+	rm -rf $(BUILD)
+
+.SECONDEXPANSION:
+$(BUILD)%: %.cpp $(SOURCES) $$(SOURCES_$$*) $(wildcard *.h) Makefile
+	@mkdir -p $(BUILD)
+	$(CPP) $(COPS) $(CCPOPS) $< $(SOURCES) $(SOURCES_$*) -o $@ $(LDLIBS)
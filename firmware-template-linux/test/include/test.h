@@ -0,0 +1,72 @@
+/**
+ * @file test.h
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef TEST_H_
+#define TEST_H_
+
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+
+/**
+ * Minimal support for the host tests, see firmware-template-linux/test/Rules.mk
+ *
+ * A failed CHECK is reported with its location and the test continues,
+ * main() returns test::result().
+ */
+
+namespace test {
+inline uint32_t g_nChecks;
+inline uint32_t g_nFailed;
+
+inline bool check(const bool bCondition, const char *pExpression, const char *pFile, const int nLine) {
+	g_nChecks++;
+
+	if (!bCondition) {
+		g_nFailed++;
+		printf("%s:%d: CHECK(%s) failed\n", pFile, nLine, pExpression);
+	}
+
+	return bCondition;
+}
+
+/**
+ * Monotonic time, for the benchmarks
+ */
+inline uint64_t nanos() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return static_cast<uint64_t>(ts.tv_sec) * 1000000000U + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+inline int result() {
+	printf("%u checks, %u failed\n", static_cast<unsigned int>(g_nChecks), static_cast<unsigned int>(g_nFailed));
+	return g_nFailed == 0 ? 0 : 1;
+}
+}  // namespace test
+
+#define CHECK(x)	test::check((x), #x, __FILE__, __LINE__)
+
+#endif /* TEST_H_ */
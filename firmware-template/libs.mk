@@ -150,6 +150,7 @@ endif
 LIBS+=configstore
 
 ifdef LINUX 
+	LIBS+=flashcodeinstall flashcode
 else
 	LIBS+=flashcodeinstall flashcode flash
 endif	
@@ -16,6 +16,10 @@ ifneq ($(MAKE_FLAGS),)
 		EXTRA_INCLUDES+=../lib-rdm/include ../lib-dmx/include
 	endif
 	
+	ifeq ($(findstring ARTNET_ENABLE_RDM_CACHE,$(MAKE_FLAGS)), ARTNET_ENABLE_RDM_CACHE)
+		EXTRA_SRCDIR+=src/node/rdm/cache
+	endif
+	
 	ifeq ($(findstring RDM_RESPONDER,$(MAKE_FLAGS)), RDM_RESPONDER)
 		EXTRA_SRCDIR+=src/node/rdm
 		EXTRA_SRCDIR+=src/node/rdm/responder
@@ -48,7 +52,7 @@ ifneq ($(MAKE_FLAGS),)
 		EXTRA_INCLUDES+=../lib-flashcode/include
 	endif
 else
-	EXTRA_SRCDIR+=src/node src/node/failsafe src/node/dmxin src/node/rdm src/node/rdm/controller src/node/timecode
+	EXTRA_SRCDIR+=src/node src/node/failsafe src/node/dmxin src/node/rdm src/node/rdm/controller src/node/rdm/cache src/node/timecode
 	EXTRA_SRCDIR+=src/node/4
 	EXTRA_INCLUDES+=src/node/failsafe
 	EXTRA_INCLUDES+=../lib-e131/include
@@ -61,6 +65,7 @@ else
 	DEFINES+=OUTPUT_DMX_SEND
 	DEFINES+=ARTNET_ENABLE_SENDDIAG
 	DEFINES+=RDM_CONTROLLER
+	DEFINES+=ARTNET_ENABLE_RDM_CACHE
 	DEFINES+=ARTNET_VERSION=4
 	DEFINES+=LIGHTSET_PORTS=1
 	DEFINES+=NODE_SHOWFILE 
@@ -5,7 +5,7 @@
 /**
  * Art-Net Designed by and Copyright Artistic Licence Holdings Ltd.
  */
-/* Copyright (C) 2016-2024 by Arjan van Vught mailto:info@gd32-dmx.org
+/* Copyright (C) 2016-2025 by Arjan van Vught mailto:info@gd32-dmx.org
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -60,6 +60,9 @@
 #include "artnettrigger.h"
 #if defined (RDM_CONTROLLER)
 # include "artnetrdmcontroller.h"
+# if defined (ARTNET_ENABLE_RDM_CACHE)
+#  include "artnetrdmcache.h"
+# endif
 #endif
 #if defined (RDM_RESPONDER)
 # include "artnetrdmresponder.h"
@@ -110,8 +113,8 @@ struct State {
 	uint8_t DiagPriority;				///< ArtPoll : Field 6 : The lowest priority of diagnostics message that should be sent.
 	struct {
 		uint32_t nDiscoveryMillis;
-		uint32_t nDiscoveryPortIndex;
 		bool IsDiscoveryRunning;
+		bool IsDiscoveryStarted;
 		bool IsEnabled;
 	} rdm;
 };
@@ -316,23 +319,26 @@ public:
 
 				if (!m_State.rdm.IsDiscoveryRunning) {
 					DEBUG_PUTS("RDM Discovery -> DONE");
-					m_State.rdm.nDiscoveryPortIndex = 0;
+					m_State.rdm.IsDiscoveryStarted = false;
 					m_State.rdm.nDiscoveryMillis = m_nCurrentPacketMillis;
 				}
-			} else {
-				uint32_t nPortIndex;
-				bool bIsIncremental;
-				if (m_pArtNetRdmController->IsFinished(nPortIndex, bIsIncremental)) {
-					SendTod(nPortIndex);
-
-					DEBUG_PRINTF("TOD sent -> %u", static_cast<unsigned int>(nPortIndex));
-
-					if (m_OutputPort[nPortIndex].IsTransmitting) {
-						DEBUG_PUTS("m_pLightSet->Stop/Start");
-						m_pLightSet->Stop(nPortIndex);
-						m_pLightSet->Start(nPortIndex);
-					}
+			}
+
+			uint32_t nPortIndex;
+			bool bIsIncremental;
+
+			if (m_pArtNetRdmController->IsFinished(nPortIndex, bIsIncremental)) {
+				SendTod(nPortIndex);
+
+				DEBUG_PRINTF("TOD sent -> %u", static_cast<unsigned int>(nPortIndex));
+
+				if (m_OutputPort[nPortIndex].IsTransmitting) {
+					DEBUG_PUTS("m_pLightSet->Stop/Start");
+					m_pLightSet->Stop(nPortIndex);
+					m_pLightSet->Start(nPortIndex);
 				}
+
+				m_OutputPort[nPortIndex].GoodOutputB |= artnet::GoodOutputB::DISCOVERY_NOT_RUNNING;
 			}
 		}
 #endif
@@ -430,27 +436,33 @@ public:
 		return 0;
 	}
 
-	uint32_t RdmCopyTod(const uint32_t nPortIndex, char *pOutBuffer, const uint32_t nOutBufferSize) {
+	bool RdmCopyTodEntry(const uint32_t nPortIndex, const uint32_t nIndex, uint8_t uid[RDM_UID_SIZE]) {
 		if (m_pArtNetRdmController != nullptr) {
-			return m_pArtNetRdmController->CopyTod(nPortIndex, pOutBuffer, nOutBufferSize);
+			return m_pArtNetRdmController->CopyTodEntry(nPortIndex, nIndex, uid);
 		}
 
-		return 0;
+		return false;
 	}
 
 	bool RdmIsRunning(const uint32_t nPortIndex, bool& bIsIncremental) {
-		uint32_t nRdmnPortIndex;
-		if (m_pArtNetRdmController->IsRunning(nRdmnPortIndex, bIsIncremental)) {
-			const auto isRunning = (nRdmnPortIndex == nPortIndex);
-			if (isRunning) {
-				assert(!((m_OutputPort[nPortIndex].GoodOutputB & artnet::GoodOutputB::DISCOVERY_NOT_RUNNING) == artnet::GoodOutputB::DISCOVERY_NOT_RUNNING));
-			}
-			return isRunning;
+		if (m_pArtNetRdmController->IsRunning(nPortIndex, bIsIncremental)) {
+			assert(!((m_OutputPort[nPortIndex].GoodOutputB & artnet::GoodOutputB::DISCOVERY_NOT_RUNNING) == artnet::GoodOutputB::DISCOVERY_NOT_RUNNING));
+			return true;
 		}
 
 		return false;
 	}
 
+# if defined (ARTNET_ENABLE_RDM_CACHE)
+	const artnetrdmcache::Statistics& RdmGetCacheStatistics(const uint32_t nPortIndex) const {
+		return m_RdmCache.GetStatistics(nPortIndex);
+	}
+
+	uint32_t RdmGetCacheEntries(const uint32_t nPortIndex) const {
+		return m_RdmCache.GetEntries(nPortIndex);
+	}
+# endif
+
 #endif
 
 #if defined (RDM_RESPONDER)
@@ -625,44 +637,25 @@ private:
 	}
 
 #if defined (RDM_CONTROLLER)
+	/**
+	 * The incremental discovery is started on all ports at once,
+	 * the discovery state machines are running interleaved.
+	 */
 	bool RdmDiscoveryRun() {
-		if ((GetPortDirection(m_State.rdm.nDiscoveryPortIndex) == lightset::PortDir::OUTPUT)
-				&& (GetRdm(m_State.rdm.nDiscoveryPortIndex))
-				&& (GetRdmDiscovery(m_State.rdm.nDiscoveryPortIndex)))
-		{
-			uint32_t nPortIndex;
-			bool bIsIncremental;
-
-			if (m_pArtNetRdmController->IsFinished(nPortIndex, bIsIncremental)) {
-				assert(m_State.rdm.nDiscoveryPortIndex == nPortIndex);
-
-				SendTod(nPortIndex);
-
-				DEBUG_PUTS("TOD sent");
-
-				if (m_OutputPort[nPortIndex].IsTransmitting) {
-					DEBUG_PUTS("m_pLightSet->Stop/Start");
-					m_pLightSet->Stop(nPortIndex);
-					m_pLightSet->Start(nPortIndex);
+		if (!m_State.rdm.IsDiscoveryStarted) {
+			m_State.rdm.IsDiscoveryStarted = true;
+
+			for (uint32_t nPortIndex = 0; nPortIndex < artnetnode::MAX_PORTS; nPortIndex++) {
+				if ((GetPortDirection(nPortIndex) == lightset::PortDir::OUTPUT) && GetRdm(nPortIndex) && GetRdmDiscovery(nPortIndex)) {
+					if (m_pArtNetRdmController->Incremental(nPortIndex)) {
+						DEBUG_PRINTF("RDM Discovery Incremental -> %u", static_cast<unsigned int>(nPortIndex));
+						m_OutputPort[nPortIndex].GoodOutputB &= static_cast<uint8_t>(~artnet::GoodOutputB::DISCOVERY_NOT_RUNNING);
+					}
 				}
-
-				m_OutputPort[m_State.rdm.nDiscoveryPortIndex].GoodOutputB |= artnet::GoodOutputB::DISCOVERY_NOT_RUNNING;
-
-				m_State.rdm.nDiscoveryPortIndex++;
-				return (m_State.rdm.nDiscoveryPortIndex != artnetnode::MAX_PORTS);
-			}
-
-			if (!m_pArtNetRdmController->IsRunning(nPortIndex, bIsIncremental)) {
-				DEBUG_PRINTF("RDM Discovery Incremental -> %u", static_cast<unsigned int>(m_State.rdm.nDiscoveryPortIndex));
-				m_pArtNetRdmController->Incremental(m_State.rdm.nDiscoveryPortIndex);
-				m_OutputPort[m_State.rdm.nDiscoveryPortIndex].GoodOutputB &= static_cast<uint8_t>(~artnet::GoodOutputB::DISCOVERY_NOT_RUNNING);
 			}
-
-			return true;
 		}
 
-		m_State.rdm.nDiscoveryPortIndex++;
-		return (m_State.rdm.nDiscoveryPortIndex != artnetnode::MAX_PORTS);
+		return m_pArtNetRdmController->IsRunning();
 	}
 #endif
 
@@ -696,6 +689,9 @@ private:
 	UArtTodPacket m_ArtTodPacket;
 # if defined (RDM_CONTROLLER)
 	ArtNetRdmController *m_pArtNetRdmController;
+#  if defined (ARTNET_ENABLE_RDM_CACHE)
+	ArtNetRdmCache m_RdmCache;
+#  endif
 # endif
 # if defined (RDM_RESPONDER)
 	ArtNetRdmResponder *m_pArtNetRdmResponder;
@@ -0,0 +1,128 @@
+/**
+ * @file artnetrdmcache.h
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef ARTNETRDMCACHE_H_
+#define ARTNETRDMCACHE_H_
+
+#include <cstdint>
+
+#include "artnetnode_ports.h"
+
+#include "rdmconst.h"
+
+/**
+ * Response cache for the ArtRdm GET commands, enabled with ARTNET_ENABLE_RDM_CACHE.
+ *
+ * When more controllers are polling the same fixtures, the repeated GET
+ * commands are answered from RAM instead of being sent on the DMX line.
+ * The key is (UID, sub-device, PID, parameter data). Only the PIDs with a
+ * time to live in the table are cached, and only ACK responses with
+ * message count 0.
+ *
+ * An entry is invalidated when:
+ * - the time to live has expired;
+ * - a SET command is sent to the UID;
+ * - a response from the UID has queued messages, or a GET QUEUED_MESSAGE
+ *   is sent to the UID;
+ * - the ToD of the port is flushed.
+ */
+
+#if !defined (CONFIG_ARTNET_RDM_CACHE_ENTRIES)
+# define CONFIG_ARTNET_RDM_CACHE_ENTRIES	32
+#endif
+
+namespace artnetrdmcache {
+static constexpr uint32_t ENTRIES = CONFIG_ARTNET_RDM_CACHE_ENTRIES;	///< Per port
+static constexpr uint32_t PARAM_DATA_MAX = 4;		///< Requests with more parameter data are not cached
+static constexpr uint32_t RESPONSE_DATA_MAX = 32;	///< Larger responses are not cached
+
+struct Statistics {
+	uint32_t nHits;
+	uint32_t nMisses;		///< Cacheable GET commands sent on the line
+	uint32_t nInvalidated;
+};
+
+/**
+ * @brief The time to live in milliseconds, 0 when the PID is not cached.
+ */
+uint32_t get_ttl(const uint16_t nParamId);
+}  // namespace artnetrdmcache
+
+class ArtNetRdmCache {
+public:
+	ArtNetRdmCache();
+
+	/**
+	 * @brief To be called for every RDM command received for the output port.
+	 * @param pRdmMessage The command, starting with the start code.
+	 * @return true when answered from the cache, pRdmMessage is replaced by the response.
+	 */
+	bool HandleCommand(const uint32_t nPortIndex, struct TRdmMessage *pRdmMessage);
+
+	/**
+	 * @brief To be called for every RDM response received on the output port.
+	 */
+	void HandleResponse(const uint32_t nPortIndex, const struct TRdmMessage *pRdmMessage);
+
+	void Invalidate(const uint32_t nPortIndex);
+
+	const artnetrdmcache::Statistics& GetStatistics(const uint32_t nPortIndex) const {
+		return s_Port[nPortIndex].statistics;
+	}
+
+	uint32_t GetEntries(const uint32_t nPortIndex) const;
+
+private:
+	void Invalidate(const uint32_t nPortIndex, const uint8_t *pUid);
+
+private:
+	struct Key {
+		uint8_t Uid[RDM_UID_SIZE];
+		uint8_t SubDevice[2];
+		uint8_t ParamId[2];
+		uint8_t nParamDataLength;
+		uint8_t ParamData[artnetrdmcache::PARAM_DATA_MAX];
+	};
+
+	struct Entry {
+		uint32_t nMillis;		///< Time the response was stored
+		uint32_t nTtl;			///< 0 is unused
+		Key key;
+		uint8_t nResponseDataLength;
+		uint8_t ResponseData[artnetrdmcache::RESPONSE_DATA_MAX];
+	};
+
+	struct Port {
+		Entry entries[artnetrdmcache::ENTRIES];
+		Key pending;			///< The GET command sent on the line, waiting for the response
+		uint8_t nPendingTransactionNumber;
+		bool bPending;
+		artnetrdmcache::Statistics statistics;
+	};
+
+	static inline Port s_Port[artnetnode::MAX_PORTS];
+};
+
+#endif /* ARTNETRDMCACHE_H_ */
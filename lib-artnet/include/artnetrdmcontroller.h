@@ -47,30 +47,26 @@ public:
 
 	// Discovery
 
-	void Full(const uint32_t nPortIndex) {
+	bool Full(const uint32_t nPortIndex) {
 		DEBUG_ENTRY
 		assert(nPortIndex < artnetnode::MAX_PORTS);
-		RDMDiscovery::Full(nPortIndex, &m_pRDMTod[nPortIndex]);
+		const auto b = RDMDiscovery::Full(nPortIndex, &m_pRDMTod[nPortIndex]);
 		DEBUG_EXIT
+		return b;
 	}
 
-	void Incremental(const uint32_t nPortIndex) {
+	bool Incremental(const uint32_t nPortIndex) {
 		DEBUG_ENTRY
 		assert(nPortIndex < artnetnode::MAX_PORTS);
-		RDMDiscovery::Incremental(nPortIndex, &m_pRDMTod[nPortIndex]);
+		const auto b = RDMDiscovery::Incremental(nPortIndex, &m_pRDMTod[nPortIndex]);
 		DEBUG_EXIT
+		return b;
 	}
 
 	void Stop(const uint32_t nPortIndex) {
 		DEBUG_ENTRY
 		assert(nPortIndex < artnetnode::MAX_PORTS);
-		bool bIsIncremental;
-		uint32_t _nPortIndex;
-		if (IsRunning(_nPortIndex, bIsIncremental)) {
-			if (_nPortIndex == nPortIndex) {
-				RDMDiscovery::Stop();
-			}
-		}
+		RDMDiscovery::Stop(nPortIndex);
 		DEBUG_EXIT
 	}
 
@@ -86,14 +82,27 @@ public:
 		DEBUG_EXIT
 	}
 
+	uint32_t TodCopy(const uint32_t nPortIndex, uint8_t *pTod, const uint32_t nIndex, const uint32_t nCount) {
+		assert(nPortIndex < artnetnode::MAX_PORTS);
+		return m_pRDMTod[nPortIndex].Copy(pTod, nIndex, nCount);
+	}
+
 	void Run() {
 		RDMDiscovery::Run();
 	}
 
-	bool IsRunning(uint32_t& nPortIndex, bool& bIsIncremental) {
+	bool IsRunning(const uint32_t nPortIndex, bool& bIsIncremental) const {
 		return RDMDiscovery::IsRunning(nPortIndex, bIsIncremental);
 	}
 
+	bool IsRunning() const {
+		return RDMDiscovery::IsRunning();
+	}
+
+	const rdmdiscovery::Statistics& GetStatistics(const uint32_t nPortIndex) const {
+		return RDMDiscovery::GetStatistics(nPortIndex);
+	}
+
 	bool IsFinished(uint32_t& nPortIndex, bool& bIsIncremental) {
 		return RDMDiscovery::IsFinished(nPortIndex, bIsIncremental);
 	}
@@ -102,32 +111,6 @@ public:
 		return RDMDiscovery::CopyWorkingQueue(pOutBuffer, nOutBufferSize);
 	}
 
-	uint32_t CopyTod(const uint32_t nPortIndex, char *pOutBuffer, const uint32_t nOutBufferSize) {
-		assert(nPortIndex < artnetnode::MAX_PORTS);
-
-		const auto nSize = static_cast<int32_t>(nOutBufferSize);
-		int32_t nLength = 0;
-
-		for (uint32_t nCount = 0; nCount < m_pRDMTod[nPortIndex].GetUidCount(); nCount++) {
-			uint8_t uid[RDM_UID_SIZE];
-
-			m_pRDMTod[nPortIndex].CopyUidEntry(nCount, uid);
-
-			nLength += snprintf(&pOutBuffer[nLength], static_cast<size_t>(nSize - nLength),
-					"\"%.2x%.2x:%.2x%.2x%.2x%.2x\",",
-					uid[0], uid[1], uid[2], uid[3], uid[4], uid[5]);
-		}
-
-		if (nLength == 0) {
-			return 0;
-		}
-
-		pOutBuffer[nLength - 1] = '\0';
-
-		return static_cast<uint32_t>(nLength - 1);
-
-	}
-
 	// Gateway
 
 	bool RdmReceive(const uint32_t nPortIndex, const uint8_t *pRdmData);
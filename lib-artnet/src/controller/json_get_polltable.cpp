@@ -24,70 +24,81 @@
  */
 
 #include <cstdint>
-#include <cstdio>
+#include <cstring>
 #include <cassert>
 
 #include "artnetcontroller.h"
 #include "artnet.h"
-#include "network.h"
+#include "jsonwriter.h"
 
+namespace remoteconfig::artnet::controller {
+static constexpr char HEX_DIGITS[] = "0123456789abcdef";
 
+static uint32_t format_ip(char *pOut, const uint32_t nIp) {
+	auto *p = pOut;
 
-namespace remoteconfig::artnet::controller {
-static uint32_t get_port(const struct ::artnet::NodeEntryUniverse *pArtNetNodeEntryUniverse, char *pOutBuffer, const uint32_t nOutBufferSize) {
-	const auto nLength = static_cast<uint32_t>(snprintf(pOutBuffer, nOutBufferSize,
-			"{\"name\":\"%s\",\"universe\":%u},",
-			pArtNetNodeEntryUniverse->ShortName, pArtNetNodeEntryUniverse->nUniverse));
+	for (uint32_t i = 0; i < 4; i++) {
+		const auto nOctet = (nIp >> (i * 8)) & 0xFF;
+
+		if (nOctet >= 100) {
+			*p++ = static_cast<char>('0' + (nOctet / 100));
+		}
+		if (nOctet >= 10) {
+			*p++ = static_cast<char>('0' + ((nOctet / 10) % 10));
+		}
+		*p++ = static_cast<char>('0' + (nOctet % 10));
 
-	if (nLength <= nOutBufferSize) {
-		return nLength;
+		if (i != 3) {
+			*p++ = '.';
+		}
 	}
 
-	return 0;
+	return static_cast<uint32_t>(p - pOut);
 }
 
-static uint32_t get_entry(const uint32_t nIndex, char *pOutBuffer, const uint32_t nOutBufferSize) {
-	const auto *pPollTable = ArtNetController::Get()->GetPollTable();
-	auto nLength = static_cast<uint32_t>(snprintf(pOutBuffer, nOutBufferSize,
-			"{\"name\":\"%s\",\"ip\":\"" IPSTR "\",\"mac\":\"" MACSTR "\",\"ports\":[",
-			pPollTable[nIndex].LongName, IP2STR(pPollTable[nIndex].IPAddress), MAC2STR(pPollTable[nIndex].Mac)));
+static void add_entry(JsonWriter& jsonWriter, const struct ::artnet::NodeEntry& entry) {
+	char ip[sizeof("255.255.255.255")];
+	char mac[(::artnet::MAC_SIZE * 3) - 1];
 
-	for (uint32_t nUniverse = 0; nUniverse < pPollTable[nIndex].nUniversesCount; nUniverse++) {
-		const auto *pArtNetNodeEntryUniverse = &pPollTable[nIndex].Universe[nUniverse];
-		nLength += get_port(pArtNetNodeEntryUniverse, &pOutBuffer[nLength], nLength);
+	for (uint32_t i = 0; i < ::artnet::MAC_SIZE; i++) {
+		mac[i * 3] = HEX_DIGITS[entry.Mac[i] >> 4];
+		mac[i * 3 + 1] = HEX_DIGITS[entry.Mac[i] & 0xF];
+		if (i != (::artnet::MAC_SIZE - 1)) {
+			mac[i * 3 + 2] = ':';
+		}
 	}
 
-	nLength--;
-	nLength += static_cast<uint32_t>(snprintf(&pOutBuffer[nLength], nOutBufferSize - nLength, "]},"));
+	const auto *pLongName = reinterpret_cast<const char *>(entry.LongName);
+
+	jsonWriter.ObjectStart();
+	jsonWriter.Add("name", pLongName, static_cast<uint32_t>(strnlen(pLongName, sizeof(entry.LongName))));
+	jsonWriter.Add("ip", ip, format_ip(ip, entry.IPAddress));
+	jsonWriter.Add("mac", mac, sizeof(mac));
+	jsonWriter.ArrayStart("ports");
+
+	for (uint32_t nUniverse = 0; nUniverse < entry.nUniversesCount; nUniverse++) {
+		const auto& universe = entry.Universe[nUniverse];
+		const auto *pShortName = reinterpret_cast<const char *>(universe.ShortName);
 
-	if (nLength <= nOutBufferSize) {
-		return nLength;
+		jsonWriter.ObjectStart();
+		jsonWriter.Add("name", pShortName, static_cast<uint32_t>(strnlen(pShortName, sizeof(universe.ShortName))));
+		jsonWriter.Add("universe", static_cast<uint32_t>(universe.nUniverse));
+		jsonWriter.ObjectEnd();
 	}
 
-	return 0;
+	jsonWriter.ArrayEnd();
+	jsonWriter.ObjectEnd();
 }
 
-uint32_t json_get_polltable(char *pOutBuffer, const uint32_t nOutBufferSize) {
-	const auto nBufferSize = nOutBufferSize - 2U;
-	pOutBuffer[0] = '[';
-
-	auto nLength = 1U;
+void json_get_polltable(JsonWriter& jsonWriter) {
+	const auto *pPollTable = ArtNetController::Get()->GetPollTable();
 
-	for (uint32_t nIndex = 0; (nIndex < ArtNetController::Get()->GetPollTableEntries()) && (nLength < nOutBufferSize); nIndex++) {
-		const auto nSize = nBufferSize - nLength;
-		nLength += get_entry(nIndex, &pOutBuffer[nLength], nSize);
-	}
+	jsonWriter.ArrayStart();
 
-	if (nLength != 1) {
-		pOutBuffer[nLength - 1] = ']';
-	} else {
-		pOutBuffer[1] = ']';
-		nLength = 2;
+	for (uint32_t nIndex = 0; nIndex < ArtNetController::Get()->GetPollTableEntries(); nIndex++) {
+		add_entry(jsonWriter, pPollTable[nIndex]);
 	}
 
-	assert(nLength <= nOutBufferSize);
-	return nLength;
+	jsonWriter.ArrayEnd();
 }
 } // namespace remoteconfig::artnet::controller
-
-
@@ -45,6 +45,12 @@
 
 #include "debug.h"
 
+#if defined (ARTNET_SHOWFILE)
+namespace showfile {
+void record(const struct artnet::ArtDmx *pArtDmx, const uint32_t nMillis);
+}  // namespace showfile
+#endif
+
 static uint32_t s_ReceivingMask = 0;
 
 void ArtNetNode::HandleDmxIn() {
@@ -78,6 +84,15 @@ void ArtNetNode::HandleDmxIn() {
 
 				SendDiag(artnet::PriorityCodes::DIAG_LOW, "%u: Input DMX sent", nPortIndex);
 
+#if defined (ARTNET_SHOWFILE)
+				/*
+				 * Only the changed frames, the keep alive frames below are not recorded
+				 */
+				if (m_State.DoRecord) {
+					showfile::record(&m_ArtDmx, Hardware::Get()->Millis());
+				}
+#endif
+
 				if (m_Node.Port[nPortIndex].bLocalMerge) {
 					m_pReceiveBuffer = reinterpret_cast<uint8_t *>(&m_ArtDmx);
 					m_nIpAddressFrom = net::IPADDR_LOOPBACK;
@@ -2,7 +2,7 @@
  * @file failsafe.cpp
  *
  */
-/* Copyright (C) 2022 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2022-2025 by Arjan van Vught mailto:info@gd32-dmx.org
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -30,6 +30,9 @@
 #include "artnetnodefailsafe.h"
 
 #include "../lib-flashcode/include/flashcode.h"
+#if defined (CONFIG_STORE_USE_LOG)
+# include "../lib-configstore/include/configstorelog.h"
+#endif
 
 #include "debug.h"
 
@@ -54,9 +57,18 @@ static bool is_detected() {
 
 		DEBUG_PRINTF("KB_NEEDED=%u, nEraseSize=%u, nPages=%u", failsafe::BYTES_NEEDED, nEraseSize, nPages);
 
-		assert(((nPages + 1) * nEraseSize) <= FlashCode::Get()->GetSize());
+		/*
+		 * Below the config store
+		 */
+#if defined (CONFIG_STORE_USE_LOG)
+		const auto nConfigStoreSize = configstore::log::get_reserved_size(nEraseSize);
+#else
+		const auto nConfigStoreSize = nEraseSize;
+#endif
 
-		nOffsetBase = FlashCode::Get()->GetSize() - ((nPages + 1) * nEraseSize);
+		assert(((nPages * nEraseSize) + nConfigStoreSize) <= FlashCode::Get()->GetSize());
+
+		nOffsetBase = FlashCode::Get()->GetSize() - (nPages * nEraseSize) - nConfigStoreSize;
 
 		DEBUG_PRINTF("nOffsetBase=%p", nOffsetBase);
 	}
@@ -0,0 +1,309 @@
+/**
+ * @file artnetrdmcache.cpp
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#if defined (DEBUG_ARTNET_RDMCACHE)
+# undef NDEBUG
+#endif
+
+#if defined(__GNUC__) && !defined(__clang__)
+# pragma GCC push_options
+# pragma GCC optimize ("O2")
+# pragma GCC optimize ("no-tree-loop-distribute-patterns")
+#endif
+
+#include <cstdint>
+#include <cstring>
+#include <cassert>
+
+#include "artnetrdmcache.h"
+
+#include "rdmconst.h"
+#include "rdm_e120.h"
+
+#include "hardware.h"
+
+#include "debug.h"
+
+namespace artnetrdmcache {
+struct Ttl {
+	uint16_t nParamId;
+	uint16_t nMillis;
+};
+
+/*
+ * The values that are changed by the fixture itself have a short time to live
+ */
+static constexpr Ttl TTL[] = {
+		{ E120_SENSOR_VALUE, 500 },
+		{ E120_STATUS_MESSAGES, 500 },
+		{ E120_DEVICE_INFO, 2000 },
+		{ E120_DMX_START_ADDRESS, 2000 },
+		{ E120_DMX_PERSONALITY, 2000 },
+		{ E120_DEVICE_LABEL, 5000 },
+		{ E120_SUPPORTED_PARAMETERS, 30000 },
+		{ E120_PARAMETER_DESCRIPTION, 30000 },
+		{ E120_DEVICE_MODEL_DESCRIPTION, 30000 },
+		{ E120_MANUFACTURER_LABEL, 30000 },
+		{ E120_SOFTWARE_VERSION_LABEL, 30000 },
+		{ E120_DMX_PERSONALITY_DESCRIPTION, 30000 },
+		{ E120_SLOT_INFO, 30000 },
+		{ E120_SENSOR_DEFINITION, 30000 }
+};
+
+uint32_t get_ttl(const uint16_t nParamId) {
+	for (const auto& ttl : TTL) {
+		if (ttl.nParamId == nParamId) {
+			return ttl.nMillis;
+		}
+	}
+
+	return 0;
+}
+}  // namespace artnetrdmcache
+
+using namespace artnetrdmcache;
+
+static uint16_t get_param_id(const struct TRdmMessage *pRdmMessage) {
+	return static_cast<uint16_t>((pRdmMessage->param_id[0] << 8) + pRdmMessage->param_id[1]);
+}
+
+static bool is_unicast(const uint8_t *pUid) {
+	return !((pUid[2] == 0xFF) && (pUid[3] == 0xFF) && (pUid[4] == 0xFF) && (pUid[5] == 0xFF));
+}
+
+ArtNetRdmCache::ArtNetRdmCache() {
+	DEBUG_ENTRY
+
+	memset(s_Port, 0, sizeof(s_Port));
+
+	DEBUG_EXIT
+}
+
+bool ArtNetRdmCache::HandleCommand(const uint32_t nPortIndex, struct TRdmMessage *pRdmMessage) {
+	assert(nPortIndex < artnetnode::MAX_PORTS);
+	assert(pRdmMessage != nullptr);
+
+	auto& port = s_Port[nPortIndex];
+	port.bPending = false;
+
+	const auto nParamId = get_param_id(pRdmMessage);
+
+	if (pRdmMessage->command_class == E120_SET_COMMAND) {
+		if (is_unicast(pRdmMessage->destination_uid)) {
+			Invalidate(nPortIndex, pRdmMessage->destination_uid);
+		} else {
+			Invalidate(nPortIndex);
+		}
+		return false;
+	}
+
+	if (pRdmMessage->command_class != E120_GET_COMMAND) {
+		return false;
+	}
+
+	if (nParamId == E120_QUEUED_MESSAGE) {
+		Invalidate(nPortIndex, pRdmMessage->destination_uid);
+		return false;
+	}
+
+	const auto nTtl = get_ttl(nParamId);
+
+	if ((nTtl == 0) || !is_unicast(pRdmMessage->destination_uid) || (pRdmMessage->param_data_length > PARAM_DATA_MAX)) {
+		return false;
+	}
+
+	if ((pRdmMessage->sub_device[0] == 0xFF) && (pRdmMessage->sub_device[1] == 0xFF)) {
+		return false;
+	}
+
+	Key key;
+	memset(&key, 0, sizeof(struct Key));
+	memcpy(key.Uid, pRdmMessage->destination_uid, RDM_UID_SIZE);
+	memcpy(key.SubDevice, pRdmMessage->sub_device, 2);
+	memcpy(key.ParamId, pRdmMessage->param_id, 2);
+	key.nParamDataLength = pRdmMessage->param_data_length;
+	memcpy(key.ParamData, pRdmMessage->param_data, pRdmMessage->param_data_length);
+
+	const auto nMillis = Hardware::Get()->Millis();
+
+	for (auto& entry : port.entries) {
+		if ((entry.nTtl == 0) || (memcmp(&entry.key, &key, sizeof(struct Key)) != 0)) {
+			continue;
+		}
+
+		if ((nMillis - entry.nMillis) >= entry.nTtl) {
+			entry.nTtl = 0;
+			break;
+		}
+
+		/*
+		 * The response, built in place of the command
+		 */
+		uint8_t Controller[RDM_UID_SIZE];
+		memcpy(Controller, pRdmMessage->source_uid, RDM_UID_SIZE);
+		memcpy(pRdmMessage->source_uid, pRdmMessage->destination_uid, RDM_UID_SIZE);
+		memcpy(pRdmMessage->destination_uid, Controller, RDM_UID_SIZE);
+
+		pRdmMessage->slot16.response_type = E120_RESPONSE_TYPE_ACK;
+		pRdmMessage->message_count = 0;
+		pRdmMessage->command_class = E120_GET_COMMAND_RESPONSE;
+		pRdmMessage->param_data_length = entry.nResponseDataLength;
+		memcpy(pRdmMessage->param_data, entry.ResponseData, entry.nResponseDataLength);
+		pRdmMessage->message_length = static_cast<uint8_t>(RDM_MESSAGE_MINIMUM_SIZE + entry.nResponseDataLength);
+
+		auto *pRdmData = reinterpret_cast<uint8_t *>(pRdmMessage);
+		uint16_t nChecksum = 0;
+		uint32_t i;
+
+		for (i = 0; i < pRdmMessage->message_length; i++) {
+			nChecksum = static_cast<uint16_t>(nChecksum + pRdmData[i]);
+		}
+
+		pRdmData[i++] = static_cast<uint8_t>(nChecksum >> 8);
+		pRdmData[i] = static_cast<uint8_t>(nChecksum & 0xFF);
+
+		port.statistics.nHits++;
+		return true;
+	}
+
+	memcpy(&port.pending, &key, sizeof(struct Key));
+	port.nPendingTransactionNumber = pRdmMessage->transaction_number;
+	port.bPending = true;
+	port.statistics.nMisses++;
+
+	return false;
+}
+
+void ArtNetRdmCache::HandleResponse(const uint32_t nPortIndex, const struct TRdmMessage *pRdmMessage) {
+	assert(nPortIndex < artnetnode::MAX_PORTS);
+	assert(pRdmMessage != nullptr);
+
+	auto& port = s_Port[nPortIndex];
+
+	if (pRdmMessage->start_code != E120_SC_RDM) {
+		port.bPending = false;
+		return;
+	}
+
+	if (pRdmMessage->message_count != 0) {
+		port.bPending = false;
+		Invalidate(nPortIndex, pRdmMessage->source_uid);
+		return;
+	}
+
+	if (!port.bPending) {
+		return;
+	}
+
+	port.bPending = false;
+
+	if ((pRdmMessage->command_class != E120_GET_COMMAND_RESPONSE)
+			|| (pRdmMessage->slot16.response_type != E120_RESPONSE_TYPE_ACK)
+			|| (pRdmMessage->transaction_number != port.nPendingTransactionNumber)
+			|| (pRdmMessage->param_data_length > RESPONSE_DATA_MAX)
+			|| (memcmp(pRdmMessage->source_uid, port.pending.Uid, RDM_UID_SIZE) != 0)
+			|| (memcmp(pRdmMessage->param_id, port.pending.ParamId, 2) != 0)) {
+		return;
+	}
+
+	const auto nMillis = Hardware::Get()->Millis();
+	Entry *pEntry = nullptr;
+	Entry *pFree = nullptr;
+	auto *pOldest = &port.entries[0];
+
+	/*
+	 * The same key, else a free entry, else the oldest entry
+	 */
+	for (auto& entry : port.entries) {
+		const auto nAge = nMillis - entry.nMillis;
+
+		if ((entry.nTtl == 0) || (nAge >= entry.nTtl)) {
+			if (pFree == nullptr) {
+				pFree = &entry;
+			}
+			continue;
+		}
+
+		if (memcmp(&entry.key, &port.pending, sizeof(struct Key)) == 0) {
+			pEntry = &entry;
+			break;
+		}
+
+		if (nAge > (nMillis - pOldest->nMillis)) {
+			pOldest = &entry;
+		}
+	}
+
+	if (pEntry == nullptr) {
+		pEntry = (pFree != nullptr) ? pFree : pOldest;
+	}
+
+	pEntry->nMillis = nMillis;
+	pEntry->nTtl = get_ttl(get_param_id(pRdmMessage));
+	memcpy(&pEntry->key, &port.pending, sizeof(struct Key));
+	pEntry->nResponseDataLength = pRdmMessage->param_data_length;
+	memcpy(pEntry->ResponseData, pRdmMessage->param_data, pRdmMessage->param_data_length);
+}
+
+void ArtNetRdmCache::Invalidate(const uint32_t nPortIndex, const uint8_t *pUid) {
+	auto& port = s_Port[nPortIndex];
+
+	for (auto& entry : port.entries) {
+		if ((entry.nTtl != 0) && (memcmp(entry.key.Uid, pUid, RDM_UID_SIZE) == 0)) {
+			entry.nTtl = 0;
+			port.statistics.nInvalidated++;
+		}
+	}
+}
+
+void ArtNetRdmCache::Invalidate(const uint32_t nPortIndex) {
+	assert(nPortIndex < artnetnode::MAX_PORTS);
+
+	auto& port = s_Port[nPortIndex];
+
+	for (auto& entry : port.entries) {
+		if (entry.nTtl != 0) {
+			entry.nTtl = 0;
+			port.statistics.nInvalidated++;
+		}
+	}
+
+	port.bPending = false;
+}
+
+uint32_t ArtNetRdmCache::GetEntries(const uint32_t nPortIndex) const {
+	assert(nPortIndex < artnetnode::MAX_PORTS);
+
+	const auto nMillis = Hardware::Get()->Millis();
+	uint32_t nEntries = 0;
+
+	for (const auto& entry : s_Port[nPortIndex].entries) {
+		if ((entry.nTtl != 0) && ((nMillis - entry.nMillis) < entry.nTtl)) {
+			nEntries++;
+		}
+	}
+
+	return nEntries;
+}
@@ -5,7 +5,7 @@
 /**
  * Art-Net Designed by and Copyright Artistic Licence Holdings Ltd.
  */
-/* Copyright (C) 2017-2024 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2017-2025 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -62,6 +62,9 @@ void ArtNetNode::HandleTodControl() {
 				((m_OutputPort[nPortIndex].GoodOutputB & artnet::GoodOutputB::RDM_DISABLED) != artnet::GoodOutputB::RDM_DISABLED)) {
 			switch (pArtTodControl->Command) {
 			case artnet::TodControlCommand::ATC_FLUSH:
+#if defined (ARTNET_ENABLE_RDM_CACHE)
+				m_RdmCache.Invalidate(nPortIndex);
+#endif
 				m_pArtNetRdmController->Full(nPortIndex);
 				m_OutputPort[nPortIndex].GoodOutputB &= static_cast<uint8_t>(~artnet::GoodOutputB::DISCOVERY_NOT_RUNNING);
 				break;
@@ -135,7 +138,8 @@ void ArtNetNode::SendTod(uint32_t nPortIndex) {
 	pTodData->ProtVerLo = artnet::PROTOCOL_REVISION;
 	pTodData->RdmVer = 0x01; // Devices that support RDM STANDARD V1.0 set field to 0x01.
 
-	const auto nDiscovered = static_cast<uint8_t>(m_pArtNetRdmController->GetUidCount(nPortIndex));
+	const auto nDiscovered = m_pArtNetRdmController->GetUidCount(nPortIndex);
+	constexpr auto UIDS_PER_PACKET = sizeof(pTodData->Tod) / sizeof(pTodData->Tod[0]);
 
 	/**
 	 * Physical Port = (BindIndex-1) * ArtPollReply- >NumPortsLo + ArtTodData->Port
@@ -153,16 +157,27 @@ void ArtNetNode::SendTod(uint32_t nPortIndex) {
 	pTodData->Net = m_Node.Port[nPage].NetSwitch;
 	pTodData->CommandResponse = 0; 							///< The packet contains the entire TOD or is the first packet in a sequence of packets that contains the entire TOD.
 	pTodData->Address = m_Node.Port[nPortIndex].DefaultAddress;
-	pTodData->UidTotalHi = 0;
-	pTodData->UidTotalLo = nDiscovered;
-	pTodData->BlockCount = 0;
-	pTodData->UidCount = nDiscovered;
+	pTodData->UidTotalHi = static_cast<uint8_t>(nDiscovered >> 8);
+	pTodData->UidTotalLo = static_cast<uint8_t>(nDiscovered);
+
+	/**
+	 * When UidTotal exceeds 200, multiple ArtTodData packets are used, in UID order.
+	 */
+	uint32_t nIndex = 0;
+	uint32_t nBlockCount = 0;
+
+	do {
+		const auto nCount = m_pArtNetRdmController->TodCopy(nPortIndex, reinterpret_cast<uint8_t*>(pTodData->Tod), nIndex, UIDS_PER_PACKET);
+
+		pTodData->BlockCount = static_cast<uint8_t>(nBlockCount++);
+		pTodData->UidCount = static_cast<uint8_t>(nCount);
 
-	m_pArtNetRdmController->TodCopy(nPortIndex, reinterpret_cast<uint8_t*>(pTodData->Tod));
+		const auto nLength = sizeof(struct artnet::ArtTodData) - (sizeof(pTodData->Tod)) + (nCount * 6U);
 
-	const auto nLength = sizeof(struct artnet::ArtTodData) - (sizeof(pTodData->Tod)) + (nDiscovered * 6U);
+		Network::Get()->SendTo(m_nHandle, pTodData, static_cast<uint16_t>(nLength), Network::Get()->GetBroadcastIp(), artnet::UDP_PORT);
 
-	Network::Get()->SendTo(m_nHandle, pTodData, static_cast<uint16_t>(nLength), Network::Get()->GetBroadcastIp(), artnet::UDP_PORT);
+		nIndex += nCount;
+	} while (nIndex < nDiscovered);
 
 	DEBUG_EXIT
 }
@@ -216,6 +231,19 @@ void ArtNetNode::HandleRdm() {
 
 		if ((m_Node.Port[nPortIndex].direction == lightset::PortDir::OUTPUT) &&
 		   ((m_OutputPort[nPortIndex].GoodOutputB & artnet::GoodOutputB::RDM_DISABLED) != artnet::GoodOutputB::RDM_DISABLED)) {
+#if defined (ARTNET_ENABLE_RDM_CACHE)
+			pArtRdm->Address = E120_SC_RDM;
+
+			if (m_RdmCache.HandleCommand(nPortIndex, reinterpret_cast<TRdmMessage *>(&pArtRdm->Address))) {
+				const auto *pRdmMessage = reinterpret_cast<const TRdmMessage *>(&pArtRdm->Address);
+
+				pArtRdm->Command = 0;
+				pArtRdm->Address = m_Node.Port[nPortIndex].DefaultAddress;
+
+				Network::Get()->SendTo(m_nHandle, pArtRdm, static_cast<uint16_t>(((sizeof(struct artnet::ArtRdm)) - 256) + pRdmMessage->message_length + 1U), m_nIpAddressFrom, artnet::UDP_PORT);
+				return;
+			}
+#endif
 # if (ARTNET_VERSION >= 4)
 			if (m_Node.Port[nPortIndex].protocol == artnet::PortProtocol::SACN) {
 				constexpr auto nMask = artnet::GoodOutput::OUTPUT_IS_MERGING | artnet::GoodOutput::DATA_IS_BEING_TRANSMITTED | artnet::GoodOutput::OUTPUT_IS_SACN;
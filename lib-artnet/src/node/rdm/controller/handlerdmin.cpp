@@ -5,7 +5,7 @@
 /**
  * Art-Net Designed by and Copyright Artistic Licence Holdings Ltd.
  */
-/* Copyright (C) 2023-2024 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2023-2025 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -86,6 +86,9 @@ void ArtNetNode::HandleRdmIn() {
 					pArtRdm->Address = m_Node.Port[nPortIndex].DefaultAddress;
 
 					auto *pMessage = reinterpret_cast<const struct TRdmMessage *>(pRdmData);
+#if defined (ARTNET_ENABLE_RDM_CACHE)
+					m_RdmCache.HandleResponse(nPortIndex, pMessage);
+#endif
 					memcpy(pArtRdm->RdmPacket, &pRdmData[1], pMessage->message_length + 1U);
 
 					const auto *pRdmMessage = reinterpret_cast<const struct TRdmMessageNoSc *>(pArtRdm->RdmPacket);
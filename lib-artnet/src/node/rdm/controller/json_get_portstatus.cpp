@@ -2,7 +2,7 @@
  * @file json_get_portstatus.cpp
  *
  */
-/* Copyright (C) 2023-2024 by Arjan van Vught mailto:info@gd32-dmx.org
+/* Copyright (C) 2023-2025 by Arjan van Vught mailto:info@gd32-dmx.org
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -60,6 +60,24 @@ static uint32_t get_portstatus(const uint32_t nPortIndex, char *pOutBuffer, cons
 		return 0;
 	}
 
+#if defined (ARTNET_ENABLE_RDM_CACHE)
+	if (direction == lightset::PortDir::OUTPUT) {
+		const auto& statistics = ArtNetNode::Get()->RdmGetCacheStatistics(nPortIndex);
+
+		auto nLength = static_cast<uint32_t>(snprintf(pOutBuffer, nOutBufferSize,
+				"{\"port\":\"%c\",\"direction\":\"%s\",\"status\":\"%s\",\"cache\":{\"entries\":%u,\"hits\":%u,\"misses\":%u,\"invalidated\":%u}},",
+				static_cast<char>('A' + nPortIndex),
+				lightset::get_direction(direction),
+				status,
+				static_cast<unsigned int>(ArtNetNode::Get()->RdmGetCacheEntries(nPortIndex)),
+				static_cast<unsigned int>(statistics.nHits),
+				static_cast<unsigned int>(statistics.nMisses),
+				static_cast<unsigned int>(statistics.nInvalidated)));
+
+		return nLength;
+	}
+#endif
+
 	auto nLength = static_cast<uint32_t>(snprintf(pOutBuffer, nOutBufferSize,
 			"{\"port\":\"%c\",\"direction\":\"%s\",\"status\":\"%s\"},",
 			static_cast<char>('A' + nPortIndex),
@@ -24,30 +24,48 @@
  */
 
 #include <cstdint>
-#include <cstdio>
 #include <cassert>
 
 #include "artnetnode.h"
-
+#include "jsonwriter.h"
 
 namespace remoteconfig::rdm {
-uint32_t json_get_tod(const char cPort, char *pOutBuffer, const uint32_t nOutBufferSize) {
+static constexpr char HEX_DIGITS[] = "0123456789abcdef";
+
+bool json_get_tod(const char cPort, JsonWriter& jsonWriter) {
 	const uint32_t nPortIndex = (cPort | 0x20) - 'a';
 
-	if (nPortIndex < artnetnode::MAX_PORTS) {
-		const auto nBufferSize = nOutBufferSize - 2U;
-		auto nLength = static_cast<uint32_t>(snprintf(pOutBuffer, nBufferSize, "{\"port\":\"%c\",\"tod\":[" , static_cast<char>(nPortIndex + 'A')));
+	if (nPortIndex >= artnetnode::MAX_PORTS) {
+		return false;
+	}
+
+	const char port[1] = { static_cast<char>(nPortIndex + 'A') };
 
-		nLength += ArtNetNode::Get()->RdmCopyTod(nPortIndex, &pOutBuffer[nLength], nBufferSize - nLength);
+	jsonWriter.ObjectStart();
+	jsonWriter.Add("port", port, 1);
+	jsonWriter.ArrayStart("tod");
 
-		pOutBuffer[nLength++] = ']';
-		pOutBuffer[nLength++] = '}';
+	uint8_t uid[RDM_UID_SIZE];
 
-		assert(nLength <= nOutBufferSize);
-		return nLength;
+	for (uint32_t nIndex = 0; ArtNetNode::Get()->RdmCopyTodEntry(nPortIndex, nIndex, uid); nIndex++) {
+		// "mmmm:dddddddd"
+		char uidString[(RDM_UID_SIZE * 2) + 1];
+		auto *p = uidString;
+
+		for (uint32_t i = 0; i < RDM_UID_SIZE; i++) {
+			if (i == 2) {
+				*p++ = ':';
+			}
+			*p++ = HEX_DIGITS[uid[i] >> 4];
+			*p++ = HEX_DIGITS[uid[i] & 0xF];
+		}
+
+		jsonWriter.Add(nullptr, uidString, sizeof(uidString));
 	}
 
-	return 0;
+	jsonWriter.ArrayEnd();
+	jsonWriter.ObjectEnd();
+
+	return true;
 }
 } // namespace remoteconfig::rdm
-
@@ -0,0 +1,380 @@
+/**
+ * @file test_artnetrdmcache.cpp
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * The cache sits between the ArtRdm commands and the DMX line: a GET command
+ * that misses is sent on the line, the response is stored, the next equal
+ * GET command is answered in place. Checked are the response built from the
+ * cache, the time to live, the invalidation by a SET command and by queued
+ * messages, and the key match on the sub-device and the parameter data.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include "artnetrdmcache.h"
+
+#include "rdmconst.h"
+#include "rdm_e120.h"
+
+#include "hardware.h"
+
+#include "test.h"
+
+namespace {
+constexpr uint8_t CONTROLLER[RDM_UID_SIZE] = { 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x01 };
+constexpr uint8_t UID_A[RDM_UID_SIZE] = { 0x12, 0x34, 0x00, 0x00, 0x00, 0x01 };
+constexpr uint8_t UID_B[RDM_UID_SIZE] = { 0x12, 0x34, 0x00, 0x00, 0x00, 0x02 };
+
+ArtNetRdmCache s_RdmCache;
+uint8_t s_nTransactionNumber;
+
+void advance(const uint32_t nMillis) {
+	test::g_nMicros += static_cast<uint64_t>(nMillis) * 1000U;
+}
+
+void set_checksum(TRdmMessage& message) {
+	const auto *pData = reinterpret_cast<const uint8_t *>(&message);
+	uint16_t nChecksum = 0;
+
+	for (uint32_t i = 0; i < message.message_length; i++) {
+		nChecksum = static_cast<uint16_t>(nChecksum + pData[i]);
+	}
+
+	auto *pChecksum = const_cast<uint8_t *>(&pData[message.message_length]);
+	pChecksum[0] = static_cast<uint8_t>(nChecksum >> 8);
+	pChecksum[1] = static_cast<uint8_t>(nChecksum & 0xFF);
+}
+
+bool is_checksum_valid(const TRdmMessage& message) {
+	const auto *pData = reinterpret_cast<const uint8_t *>(&message);
+	uint16_t nChecksum = 0;
+
+	for (uint32_t i = 0; i < message.message_length; i++) {
+		nChecksum = static_cast<uint16_t>(nChecksum + pData[i]);
+	}
+
+	return (pData[message.message_length] == (nChecksum >> 8)) && (pData[message.message_length + 1] == (nChecksum & 0xFF));
+}
+
+TRdmMessage command(const uint8_t nCommandClass, const uint8_t *pUid, const uint16_t nParamId, const uint8_t *pParamData = nullptr, const uint8_t nLength = 0, const uint16_t nSubDevice = 0) {
+	TRdmMessage message;
+	memset(&message, 0, sizeof(message));
+
+	message.start_code = E120_SC_RDM;
+	message.sub_start_code = E120_SC_SUB_MESSAGE;
+	message.message_length = static_cast<uint8_t>(RDM_MESSAGE_MINIMUM_SIZE + nLength);
+	memcpy(message.destination_uid, pUid, RDM_UID_SIZE);
+	memcpy(message.source_uid, CONTROLLER, RDM_UID_SIZE);
+	message.transaction_number = ++s_nTransactionNumber;
+	message.slot16.port_id = 1;
+	message.sub_device[0] = static_cast<uint8_t>(nSubDevice >> 8);
+	message.sub_device[1] = static_cast<uint8_t>(nSubDevice);
+	message.command_class = nCommandClass;
+	message.param_id[0] = static_cast<uint8_t>(nParamId >> 8);
+	message.param_id[1] = static_cast<uint8_t>(nParamId);
+	message.param_data_length = nLength;
+
+	if (nLength != 0) {
+		memcpy(message.param_data, pParamData, nLength);
+	}
+
+	set_checksum(message);
+	return message;
+}
+
+/*
+ * The response of the fixture to the command sent on the line
+ */
+TRdmMessage response(const TRdmMessage& request, const uint8_t *pParamData, const uint8_t nLength, const uint8_t nMessageCount = 0) {
+	TRdmMessage message;
+	memcpy(&message, &request, sizeof(message));
+
+	memcpy(message.destination_uid, request.source_uid, RDM_UID_SIZE);
+	memcpy(message.source_uid, request.destination_uid, RDM_UID_SIZE);
+	message.slot16.response_type = E120_RESPONSE_TYPE_ACK;
+	message.message_count = nMessageCount;
+	message.command_class = static_cast<uint8_t>(request.command_class + 1);
+	message.param_data_length = nLength;
+	memcpy(message.param_data, pParamData, nLength);
+	message.message_length = static_cast<uint8_t>(RDM_MESSAGE_MINIMUM_SIZE + nLength);
+
+	set_checksum(message);
+	return message;
+}
+
+/*
+ * A GET command, answered by the fixture when not answered from the cache.
+ * Returns true when answered from the cache.
+ */
+bool get(const uint32_t nPortIndex, const uint8_t *pUid, const uint16_t nParamId, const uint8_t *pResponseData, const uint8_t nResponseLength, const uint8_t *pParamData = nullptr, const uint8_t nLength = 0, const uint16_t nSubDevice = 0) {
+	auto message = command(E120_GET_COMMAND, pUid, nParamId, pParamData, nLength, nSubDevice);
+	const auto request = message;
+
+	if (s_RdmCache.HandleCommand(nPortIndex, &message)) {
+		CHECK(memcmp(message.destination_uid, CONTROLLER, RDM_UID_SIZE) == 0);
+		CHECK(memcmp(message.source_uid, pUid, RDM_UID_SIZE) == 0);
+		CHECK(message.transaction_number == request.transaction_number);
+		CHECK(message.command_class == E120_GET_COMMAND_RESPONSE);
+		CHECK(message.slot16.response_type == E120_RESPONSE_TYPE_ACK);
+		CHECK(message.message_count == 0);
+		CHECK(memcmp(message.param_id, request.param_id, 2) == 0);
+		CHECK(message.param_data_length == nResponseLength);
+		CHECK(memcmp(message.param_data, pResponseData, nResponseLength) == 0);
+		CHECK(message.message_length == RDM_MESSAGE_MINIMUM_SIZE + nResponseLength);
+		CHECK(is_checksum_valid(message));
+		return true;
+	}
+
+	CHECK(memcmp(&message, &request, sizeof(message)) == 0);
+
+	const auto reply = response(request, pResponseData, nResponseLength);
+	s_RdmCache.HandleResponse(nPortIndex, &reply);
+
+	return false;
+}
+
+void set(const uint32_t nPortIndex, const uint8_t *pUid, const uint16_t nParamId) {
+	const uint8_t data[] = { 0x00, 0x01 };
+	auto message = command(E120_SET_COMMAND, pUid, nParamId, data, sizeof(data));
+
+	CHECK(!s_RdmCache.HandleCommand(nPortIndex, &message));
+
+	const auto reply = response(message, nullptr, 0);
+	s_RdmCache.HandleResponse(nPortIndex, &reply);
+}
+
+void reset() {
+	s_RdmCache.Invalidate(0);
+	s_RdmCache.Invalidate(1);
+}
+
+constexpr uint8_t DEVICE_INFO[] = { 0x01, 0x00, 0x12, 0x34, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00 };
+constexpr uint8_t START_ADDRESS[] = { 0x00, 0x01 };
+constexpr uint8_t LABEL[] = { 'P', 'a', 'r', ' ', '6', '4' };
+
+void test_hit() {
+	reset();
+
+	const auto nMisses = s_RdmCache.GetStatistics(0).nMisses;
+	const auto nHits = s_RdmCache.GetStatistics(0).nHits;
+
+	CHECK(!get(0, UID_A, E120_DEVICE_INFO, DEVICE_INFO, sizeof(DEVICE_INFO)));
+	CHECK(get(0, UID_A, E120_DEVICE_INFO, DEVICE_INFO, sizeof(DEVICE_INFO)));
+	CHECK(get(0, UID_A, E120_DEVICE_INFO, DEVICE_INFO, sizeof(DEVICE_INFO)));
+
+	CHECK(s_RdmCache.GetStatistics(0).nMisses == nMisses + 1);
+	CHECK(s_RdmCache.GetStatistics(0).nHits == nHits + 2);
+	CHECK(s_RdmCache.GetEntries(0) == 1);
+
+	// The ports have their own cache
+	CHECK(!get(1, UID_A, E120_DEVICE_INFO, DEVICE_INFO, sizeof(DEVICE_INFO)));
+
+	// Not in the table, never cached
+	CHECK(!get(0, UID_A, E120_IDENTIFY_DEVICE, START_ADDRESS, 1));
+	CHECK(!get(0, UID_A, E120_IDENTIFY_DEVICE, START_ADDRESS, 1));
+
+	// Broadcast and all the sub-devices are not cached
+	CHECK(!get(0, UID_ALL, E120_DEVICE_LABEL, LABEL, sizeof(LABEL)));
+	CHECK(!get(0, UID_ALL, E120_DEVICE_LABEL, LABEL, sizeof(LABEL)));
+	CHECK(!get(0, UID_A, E120_DEVICE_LABEL, LABEL, sizeof(LABEL), nullptr, 0, 0xFFFF));
+	CHECK(!get(0, UID_A, E120_DEVICE_LABEL, LABEL, sizeof(LABEL), nullptr, 0, 0xFFFF));
+
+	CHECK(s_RdmCache.GetEntries(0) == 1);
+}
+
+void test_response_mismatch() {
+	reset();
+
+	// A NACK, another transaction number or a response that is too large is not stored
+	auto message = command(E120_GET_COMMAND, UID_A, E120_DEVICE_LABEL);
+	CHECK(!s_RdmCache.HandleCommand(0, &message));
+	auto reply = response(message, LABEL, sizeof(LABEL));
+	reply.slot16.response_type = E120_RESPONSE_TYPE_NACK_REASON;
+	s_RdmCache.HandleResponse(0, &reply);
+	CHECK(s_RdmCache.GetEntries(0) == 0);
+
+	message = command(E120_GET_COMMAND, UID_A, E120_DEVICE_LABEL);
+	CHECK(!s_RdmCache.HandleCommand(0, &message));
+	reply = response(message, LABEL, sizeof(LABEL));
+	reply.transaction_number++;
+	s_RdmCache.HandleResponse(0, &reply);
+	CHECK(s_RdmCache.GetEntries(0) == 0);
+
+	uint8_t large[artnetrdmcache::RESPONSE_DATA_MAX + 1];
+	memset(large, 'x', sizeof(large));
+	CHECK(!get(0, UID_A, E120_DEVICE_LABEL, large, sizeof(large)));
+	CHECK(!get(0, UID_A, E120_DEVICE_LABEL, large, sizeof(large)));
+	CHECK(s_RdmCache.GetEntries(0) == 0);
+}
+
+void test_ttl() {
+	reset();
+
+	const auto nTtl = artnetrdmcache::get_ttl(E120_DMX_START_ADDRESS);
+	CHECK(nTtl != 0);
+	CHECK(artnetrdmcache::get_ttl(E120_SENSOR_VALUE) < nTtl);
+
+	CHECK(!get(0, UID_A, E120_DMX_START_ADDRESS, START_ADDRESS, sizeof(START_ADDRESS)));
+	advance(nTtl - 1);
+	CHECK(get(0, UID_A, E120_DMX_START_ADDRESS, START_ADDRESS, sizeof(START_ADDRESS)));
+	CHECK(s_RdmCache.GetEntries(0) == 1);
+
+	// A hit does not extend the time to live
+	advance(1);
+	CHECK(s_RdmCache.GetEntries(0) == 0);
+	CHECK(!get(0, UID_A, E120_DMX_START_ADDRESS, START_ADDRESS, sizeof(START_ADDRESS)));
+	CHECK(get(0, UID_A, E120_DMX_START_ADDRESS, START_ADDRESS, sizeof(START_ADDRESS)));
+
+	// The entry is refreshed with the new response
+	const uint8_t address[] = { 0x01, 0x00 };
+	advance(nTtl);
+	CHECK(!get(0, UID_A, E120_DMX_START_ADDRESS, address, sizeof(address)));
+	CHECK(get(0, UID_A, E120_DMX_START_ADDRESS, address, sizeof(address)));
+	CHECK(s_RdmCache.GetEntries(0) == 1);
+}
+
+void test_set() {
+	reset();
+
+	CHECK(!get(0, UID_A, E120_DMX_START_ADDRESS, START_ADDRESS, sizeof(START_ADDRESS)));
+	CHECK(!get(0, UID_A, E120_DEVICE_LABEL, LABEL, sizeof(LABEL)));
+	CHECK(!get(0, UID_B, E120_DEVICE_LABEL, LABEL, sizeof(LABEL)));
+	CHECK(s_RdmCache.GetEntries(0) == 3);
+
+	const auto nInvalidated = s_RdmCache.GetStatistics(0).nInvalidated;
+
+	// All the entries of the UID, not only the PID that is set
+	set(0, UID_A, E120_DMX_START_ADDRESS);
+	CHECK(s_RdmCache.GetStatistics(0).nInvalidated == nInvalidated + 2);
+	CHECK(s_RdmCache.GetEntries(0) == 1);
+	CHECK(!get(0, UID_A, E120_DEVICE_LABEL, LABEL, sizeof(LABEL)));
+	CHECK(get(0, UID_B, E120_DEVICE_LABEL, LABEL, sizeof(LABEL)));
+
+	// A SET on another port
+	set(1, UID_A, E120_DEVICE_LABEL);
+	CHECK(get(0, UID_A, E120_DEVICE_LABEL, LABEL, sizeof(LABEL)));
+
+	// Broadcast
+	set(0, UID_ALL, E120_DMX_START_ADDRESS);
+	CHECK(s_RdmCache.GetEntries(0) == 0);
+	CHECK(!get(0, UID_B, E120_DEVICE_LABEL, LABEL, sizeof(LABEL)));
+}
+
+void test_queued() {
+	reset();
+
+	CHECK(!get(0, UID_A, E120_DEVICE_LABEL, LABEL, sizeof(LABEL)));
+	CHECK(!get(0, UID_B, E120_DEVICE_LABEL, LABEL, sizeof(LABEL)));
+
+	// A response with queued messages, for a PID that is not cached
+	auto message = command(E120_GET_COMMAND, UID_A, E120_IDENTIFY_DEVICE);
+	CHECK(!s_RdmCache.HandleCommand(0, &message));
+	const uint8_t identify[] = { 0x00 };
+	const auto reply = response(message, identify, sizeof(identify), 1);
+	s_RdmCache.HandleResponse(0, &reply);
+
+	CHECK(s_RdmCache.GetEntries(0) == 1);
+	CHECK(!get(0, UID_A, E120_DEVICE_LABEL, LABEL, sizeof(LABEL)));
+	CHECK(get(0, UID_B, E120_DEVICE_LABEL, LABEL, sizeof(LABEL)));
+
+	// A cacheable response with queued messages is not stored
+	message = command(E120_GET_COMMAND, UID_B, E120_DMX_START_ADDRESS);
+	CHECK(!s_RdmCache.HandleCommand(0, &message));
+	const auto queued = response(message, START_ADDRESS, sizeof(START_ADDRESS), 2);
+	s_RdmCache.HandleResponse(0, &queued);
+	CHECK(!get(0, UID_B, E120_DEVICE_LABEL, LABEL, sizeof(LABEL)));
+
+	// GET QUEUED_MESSAGE
+	CHECK(get(0, UID_A, E120_DEVICE_LABEL, LABEL, sizeof(LABEL)));
+	const uint8_t status[] = { E120_STATUS_ERROR };
+	CHECK(!get(0, UID_A, E120_QUEUED_MESSAGE, nullptr, 0, status, sizeof(status)));
+	CHECK(!get(0, UID_A, E120_DEVICE_LABEL, LABEL, sizeof(LABEL)));
+	CHECK(get(0, UID_B, E120_DEVICE_LABEL, LABEL, sizeof(LABEL)));
+}
+
+void test_key() {
+	reset();
+
+	const uint8_t sensor0[] = { 0x00 };
+	const uint8_t sensor1[] = { 0x01 };
+	const uint8_t value0[] = { 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x30, 0x00 };
+	const uint8_t value1[] = { 0x01, 0x00, 0x40, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x60, 0x00, 0x00 };
+
+	CHECK(!get(0, UID_A, E120_SENSOR_VALUE, value0, sizeof(value0), sensor0, sizeof(sensor0)));
+	CHECK(!get(0, UID_A, E120_SENSOR_VALUE, value1, sizeof(value1), sensor1, sizeof(sensor1)));
+	CHECK(get(0, UID_A, E120_SENSOR_VALUE, value0, sizeof(value0), sensor0, sizeof(sensor0)));
+	CHECK(get(0, UID_A, E120_SENSOR_VALUE, value1, sizeof(value1), sensor1, sizeof(sensor1)));
+
+	// Without parameter data is another key
+	CHECK(!get(0, UID_A, E120_SENSOR_VALUE, value0, sizeof(value0)));
+
+	// The sub-device is part of the key
+	CHECK(!get(0, UID_A, E120_SENSOR_VALUE, value1, sizeof(value1), sensor0, sizeof(sensor0), 1));
+	CHECK(get(0, UID_A, E120_SENSOR_VALUE, value1, sizeof(value1), sensor0, sizeof(sensor0), 1));
+	CHECK(get(0, UID_A, E120_SENSOR_VALUE, value0, sizeof(value0), sensor0, sizeof(sensor0)));
+
+	// More parameter data than the key holds is not cached
+	uint8_t large[artnetrdmcache::PARAM_DATA_MAX + 1];
+	memset(large, 0, sizeof(large));
+	CHECK(!get(0, UID_A, E120_SENSOR_VALUE, value0, sizeof(value0), large, sizeof(large)));
+	CHECK(!get(0, UID_A, E120_SENSOR_VALUE, value0, sizeof(value0), large, sizeof(large)));
+
+	CHECK(s_RdmCache.GetEntries(0) == 4);
+}
+
+void test_full() {
+	reset();
+
+	// The oldest entry is replaced
+	for (uint32_t i = 0; i <= artnetrdmcache::ENTRIES; i++) {
+		const auto nSensor = static_cast<uint8_t>(i);
+		CHECK(!get(0, UID_A, E120_SENSOR_DEFINITION, LABEL, sizeof(LABEL), &nSensor, 1));
+		advance(1);
+	}
+
+	CHECK(s_RdmCache.GetEntries(0) == artnetrdmcache::ENTRIES);
+
+	const uint8_t nFirst = 0;
+	const uint8_t nSecond = 1;
+	CHECK(get(0, UID_A, E120_SENSOR_DEFINITION, LABEL, sizeof(LABEL), &nSecond, 1));
+	CHECK(!get(0, UID_A, E120_SENSOR_DEFINITION, LABEL, sizeof(LABEL), &nFirst, 1));
+}
+}  // namespace
+
+int main() {
+	test::g_nMicros = 1000000;
+
+	test_hit();
+	test_response_mismatch();
+	test_ttl();
+	test_set();
+	test_queued();
+	test_key();
+	test_full();
+
+	return test::result();
+}
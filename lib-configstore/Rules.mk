@@ -2,6 +2,10 @@ $(info $$MAKE_FLAGS [${MAKE_FLAGS}])
 
 EXTRA_INCLUDES+=../lib-properties/include
 
+ifneq (,$(findstring CONFIG_STORE_USE_LOG,$(MAKE_FLAGS)))
+	EXTRA_SRCDIR+=src/log
+endif
+
 ifneq ($(MAKE_FLAGS),)
 	ifneq (,$(findstring CONFIG_STORE_USE_FILE,$(MAKE_FLAGS)))
 		EXTRA_SRCDIR+=device/file
@@ -204,7 +204,25 @@ bool StoreDevice::Write(uint32_t nOffset, uint32_t nLength, const uint8_t *pBuff
 			nBlockWriteLength = BLOCK_WRITE_LENGTH;
 		}
 
-		if (fwrite(&pBuffer[s_nIndex], 1, nBlockWriteLength, pFile) != nBlockWriteLength) {
+		/*
+		 * NOR flash: programming can only clear bits
+		 */
+		uint8_t block[BLOCK_WRITE_LENGTH];
+		const auto nPosition = static_cast<long int>(nOffset + s_nIndex);
+
+		if ((fseek(pFile, nPosition, SEEK_SET) != 0) || (fread(block, 1, nBlockWriteLength, pFile) != nBlockWriteLength) || (fseek(pFile, nPosition, SEEK_SET) != 0)) {
+			s_State = State::ERROR;
+			nResult = result::ERROR;
+			perror("fseek/fread");
+			DEBUG_EXIT
+			return true;
+		}
+
+		for (uint32_t i = 0; i < nBlockWriteLength; i++) {
+			block[i] &= pBuffer[s_nIndex + i];
+		}
+
+		if (fwrite(block, 1, nBlockWriteLength, pFile) != nBlockWriteLength) {
 			s_State = State::ERROR;
 			nResult = result::ERROR;
 			perror("fwrite");
@@ -31,6 +31,9 @@
 #include <cassert>
 
 #include "configstoredevice.h"
+#if defined (CONFIG_STORE_USE_LOG)
+# include "configstorelog.h"
+#endif
 
 #include "utc.h"
 
@@ -131,6 +134,7 @@ public:
 
 			if (p->nUtcOffset != nUtcOffset) {
 				p->nUtcOffset = nUtcOffset;
+				SetDirty(StoreConfiguration::SIGNATURE_SIZE, sizeof(p->nUtcOffset));
 				s_State = configstore::State::CHANGED;
 			}
 
@@ -164,6 +168,12 @@ public:
 		return p->nUtcOffset;
 	}
 
+#if defined (CONFIG_STORE_USE_LOG)
+	const struct configstore::log::Statistics& GetLogStatistics() const {
+		return s_LogStatistics;
+	}
+#endif
+
 	static ConfigStore *Get() {
 		return s_pThis;
 	}
@@ -172,6 +182,42 @@ private:
 	uint32_t GetStoreOffset(configstore::Store store);
 	bool Flash();
 
+	void SetDirty([[maybe_unused]] const uint32_t nOffset, [[maybe_unused]] const uint32_t nLength) {
+#if defined (CONFIG_STORE_USE_LOG)
+		assert(nLength != 0);
+		const auto nLast = (nOffset + nLength - 1) / configstore::log::CHUNK_SIZE;
+
+		for (auto nChunk = nOffset / configstore::log::CHUNK_SIZE; nChunk <= nLast; nChunk++) {
+			s_LogDirty[nChunk / 32] |= (1U << (nChunk % 32));
+		}
+#endif
+	}
+
+#if defined (CONFIG_STORE_USE_LOG)
+	bool LogIsSupported();
+	bool LogInit();
+	bool LogFlash();
+	bool LogReplay(const uint32_t nSector, uint32_t& nWriteOffset);
+	uint32_t LogPad(const uint32_t nSector, const uint32_t nOffset);
+	bool LogIsErased(const uint32_t nSector);
+	bool LogMarkLive(const uint32_t nSector);
+	bool LogIsLive(const uint32_t nSector) const;
+	void LogMarkImage();
+	void LogStartSector();
+	void LogLocate(const uint32_t nOffset, uint32_t& nStore, uint32_t& nStoreOffset, uint32_t& nStoreEnd);
+	uint32_t LogFirstDirty() const;
+	uint32_t LogSectorAddress(const uint32_t nSector) const {
+		return s_nLogStartAddress + nSector * s_nLogSectorSize;
+	}
+	/**
+	 * @return The sector nIndex positions after the active sector in the ring.
+	 */
+	uint32_t LogNextSector(const uint32_t nIndex) const {
+		const auto nFirst = (s_nLogActive == configstore::log::SECTOR_NONE) ? 0U : s_nLogActive + 1U;
+		return (nFirst + nIndex) % configstore::log::SECTORS;
+	}
+#endif
+
 private:
 	struct Env {
 		int32_t nUtcOffset;
@@ -197,7 +243,31 @@ private:
 
 	static inline uint8_t s_ConfigStoreData[StoreConfiguration::SIZE] SECTION_CONFIGSTORE;
 
+#if defined (CONFIG_STORE_USE_LOG)
+	static constexpr uint32_t LOG_CHUNKS = StoreConfiguration::SIZE / configstore::log::CHUNK_SIZE;
+
+	static inline uint32_t s_nLogStartAddress;
+	static inline uint32_t s_nLogSectorSize;
+	static inline uint32_t s_nLogSequence;
+	static inline uint32_t s_nLogWriteOffset;
+	static inline uint32_t s_nLogWriteLength;
+	static inline uint8_t s_nLogActive;
+	static inline uint8_t s_nLogFree;	///< Number of erased sectors after the active sector
+	static inline uint8_t s_nLogErase;
+	static inline bool s_bLogUsed;
+	static inline bool s_bLogWriteRunning;
+	static inline bool s_bLogEraseRunning;
+
+	static inline uint32_t s_LogDirty[LOG_CHUNKS / 32];
+	static inline uint8_t s_LogChunkSector[LOG_CHUNKS];	///< Sector with the latest copy of the chunk
+	static inline uint8_t s_LogBuffer[sizeof(struct configstore::log::RecordHeader) + configstore::log::RECORD_DATA_MAX];
+
+	static inline struct configstore::log::Statistics s_LogStatistics;
+#endif
+
 	static inline ConfigStore *s_pThis;
+
+	friend class ConfigStoreTest;	///< lib-configstore/test
 };
 
 #endif /* CONFIGSTORE_H_ */
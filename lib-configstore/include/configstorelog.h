@@ -0,0 +1,102 @@
+/**
+ * @file configstorelog.h
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef CONFIGSTORELOG_H_
+#define CONFIGSTORELOG_H_
+
+#include <cstdint>
+
+/**
+ * Log-structured backend, enabled with CONFIG_STORE_USE_LOG.
+ *
+ * The RAM image is tracked in chunks. A commit appends the changed chunks
+ * as records to the active sector of a ring of sectors at the end of the device.
+ * When the active sector is full, the log continues in the next (erased) sector.
+ * The compaction copies the live chunks of the oldest sector to the active sector,
+ * and erases the oldest sector only when none of its chunks is live anymore.
+ * It runs until FREE_SECTORS sectors are erased, which is room for the records
+ * of one commit. At boot the RAM image is rebuilt by replaying the sectors
+ * in sequence order. An invalid record, left by a power loss, is padded with zeros.
+ *
+ * The log region is the last SECTORS sectors of the device, see get_reserved_size().
+ * Other users of the device are located below it.
+ * A device which is too small for the log uses the single image backend.
+ */
+
+#if !defined (CONFIG_STORE_LOG_SECTORS)
+# define CONFIG_STORE_LOG_SECTORS	4
+#endif
+
+namespace configstore::log {
+static constexpr uint32_t SECTORS = CONFIG_STORE_LOG_SECTORS;
+static constexpr uint32_t FREE_SECTORS = 2;
+static constexpr uint32_t MAGIC = 0x4C567641;		///< "AvVL"
+static constexpr uint32_t CHUNK_SIZE = 16;
+static constexpr uint32_t RECORD_DATA_MAX = 256;
+static constexpr uint8_t SECTOR_NONE = 0xFF;
+static constexpr uint8_t STORE_HEADER = 0xFE;		///< Signature and environment
+static constexpr uint8_t STORE_ERASED = 0xFF;
+
+static_assert(SECTORS > FREE_SECTORS);
+static_assert(SECTORS < SECTOR_NONE);
+
+struct SectorHeader {
+	uint32_t nMagic;
+	uint32_t nSequence;
+	uint32_t nSequenceInverted;
+	uint32_t nReserved;
+};
+
+struct RecordHeader {
+	uint8_t nStore;
+	uint8_t nReserved;
+	uint16_t nOffset;		///< Offset within the store
+	uint16_t nLength;
+	uint16_t nCrc;			///< CRC-16/CCITT of the fields above and the data
+};
+
+static_assert(sizeof(struct SectorHeader) == 16);
+static_assert(sizeof(struct RecordHeader) == 8);
+
+struct Statistics {
+	uint32_t nCommits;
+	uint32_t nRecords;
+	uint32_t nBytesData;	///< Record data, copies included
+	uint32_t nBytesCopied;	///< Record data copied forward by the compaction
+	uint32_t nBytesWritten;	///< Total bytes programmed, headers included
+	uint32_t nErases;
+	uint32_t nReplayed;		///< Records replayed at boot
+	uint32_t nTorn;			///< Sectors with an invalid record at boot
+};
+
+/**
+ * @return The bytes at the end of the store device which are reserved for the log.
+ */
+inline uint32_t get_reserved_size(const uint32_t nSectorSize) {
+	return SECTORS * nSectorSize;
+}
+}  // namespace configstore::log
+
+#endif /* CONFIGSTORELOG_H_ */
@@ -94,10 +94,26 @@ ConfigStore::ConfigStore() {
 
 	DEBUG_PRINTF("s_nStartAddress=%p", reinterpret_cast<void *>(s_nStartAddress));
 
+#if defined (CONFIG_STORE_USE_LOG)
+	auto bLogMigrate = false;
+#endif
+
+#if defined (CONFIG_STORE_USE_LOG)
+	s_bLogUsed = s_bHaveDevice && LogIsSupported();
+#endif
+
 	if (s_bHaveDevice) {
-		storedevice::result result;
-		StoreDevice::Read(s_nStartAddress, StoreConfiguration::SIZE, reinterpret_cast<uint8_t *>(&s_ConfigStoreData), result);
-		assert(result == storedevice::result::OK);
+#if defined (CONFIG_STORE_USE_LOG)
+		if (!(s_bLogUsed && LogInit()))
+#endif
+		{
+			storedevice::result result;
+			StoreDevice::Read(s_nStartAddress, StoreConfiguration::SIZE, reinterpret_cast<uint8_t *>(&s_ConfigStoreData), result);
+			assert(result == storedevice::result::OK);
+#if defined (CONFIG_STORE_USE_LOG)
+			bLogMigrate = s_bLogUsed;
+#endif
+		}
 	}
 
 	bool bSignatureOK = true;
@@ -113,7 +129,9 @@ ConfigStore::ConfigStore() {
 		DEBUG_PUTS("No signature");
 		memset(&s_ConfigStoreData[StoreConfiguration::SIGNATURE_SIZE], 0, StoreConfiguration::SIZE - StoreConfiguration::SIGNATURE_SIZE);
 		s_State = State::CHANGED;
-		timer_start();
+#if defined (CONFIG_STORE_USE_LOG)
+		bLogMigrate = s_bLogUsed;
+#endif
 	}
 
 	s_nStoresSize = StoreConfiguration::OFFSET_STORES;
@@ -138,6 +156,17 @@ ConfigStore::ConfigStore() {
 		p->nUtcOffset = 0;
 	}
 
+#if defined (CONFIG_STORE_USE_LOG)
+	if (bLogMigrate) {
+		LogMarkImage();
+		s_State = State::CHANGED;
+	}
+#endif
+
+	if (s_State == State::CHANGED) {
+		timer_start();
+	}
+
 	DEBUG_PUTS("");
 	debug_dump(s_ConfigStoreData, StoreConfiguration::SIZE);
 
@@ -168,6 +197,8 @@ void ConfigStore::ResetSetList(Store store) {
 	*pbSetList++ = 0x00;
 	*pbSetList = 0x00;
 
+	SetDirty(GetStoreOffset(store), sizeof(uint32_t));
+
 	s_State = State::CHANGED;
 	timer_start();
 }
@@ -188,18 +219,30 @@ void ConfigStore::Update(Store store, uint32_t nOffset, const void *pData, uint3
 
 	DEBUG_PRINTF("pSrc=%p [pData], pDst=%p", reinterpret_cast<const void *>(pSrc), reinterpret_cast<void *>(pDst));
 
+	uint32_t nFirst = nDataLength;
+	uint32_t nLast = 0;
+
 	for (uint32_t i = 0; i < nDataLength; i++) {
 		if (*pSrc != *pDst) {
 			bIsChanged = true;
 			*pDst = *pSrc;
+
+			if (nFirst == nDataLength) {
+				nFirst = i;
+			}
+
+			nLast = i;
 		}
 		pDst++;
 		pSrc++;
 	}
 
 	if (bIsChanged){
+		SetDirty(nBase + nFirst, 1 + nLast - nFirst);
+
 		auto *pSet = reinterpret_cast<uint32_t *>((&s_ConfigStoreData[GetStoreOffset(store)] + nOffsetSetList));
 		*pSet |= nSetList;
+		SetDirty(GetStoreOffset(store) + nOffsetSetList, sizeof(uint32_t));
 	}
 
 	if (bIsChanged) {
@@ -256,12 +299,22 @@ bool ConfigStore::Flash() {
 		return false;
 	}
 
+#if defined (CONFIG_STORE_USE_LOG)
+	if (s_bLogUsed && ((s_State == State::ERASING) || (s_State == State::WRITING))) {
+		return LogFlash();
+	}
+#endif
+
 	switch (s_State) {
 	case State::CHANGED:
 		s_State = State::CHANGED_WAITING;
 		return true;
 	case State::CHANGED_WAITING:
+#if defined (CONFIG_STORE_USE_LOG)
+		s_State = s_bLogUsed ? State::WRITING : State::ERASING;
+#else
 		s_State = State::ERASING;
+#endif
 		return true;
 		break;
 	case State::ERASING: {
@@ -332,5 +385,20 @@ void ConfigStore::Dump() {
 	}
 
 	printf("m_tState=%d\n", static_cast<uint32_t>(s_State));
+
+#if defined (CONFIG_STORE_USE_LOG)
+	if (!s_bLogUsed) {
+		return;
+	}
+
+	const auto nBytesChanged = s_LogStatistics.nBytesData - s_LogStatistics.nBytesCopied;
+	printf("Log sector %u, offset %u, sequence %u\n", static_cast<unsigned int>(s_nLogActive), static_cast<unsigned int>(s_nLogWriteOffset), static_cast<unsigned int>(s_nLogSequence));
+	printf(" Commits %u, records %u, replayed %u, torn %u\n", static_cast<unsigned int>(s_LogStatistics.nCommits), static_cast<unsigned int>(s_LogStatistics.nRecords), static_cast<unsigned int>(s_LogStatistics.nReplayed), static_cast<unsigned int>(s_LogStatistics.nTorn));
+	printf(" Changed %u, copied %u, written %u bytes, erases %u\n", static_cast<unsigned int>(nBytesChanged), static_cast<unsigned int>(s_LogStatistics.nBytesCopied), static_cast<unsigned int>(s_LogStatistics.nBytesWritten), static_cast<unsigned int>(s_LogStatistics.nErases));
+	if (nBytesChanged != 0) {
+		const auto nRatio = (s_LogStatistics.nBytesWritten * 100U) / nBytesChanged;
+		printf(" Write amplification %u.%02u\n", static_cast<unsigned int>(nRatio / 100U), static_cast<unsigned int>(nRatio % 100U));
+	}
+#endif
 #endif
 }
@@ -0,0 +1,592 @@
+/**
+ * @file configstorelog.cpp
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#if defined (DEBUG_CONFIGSTORE)
+# undef NDEBUG
+#endif
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <cassert>
+
+#include "configstore.h"
+#include "configstorelog.h"
+
+#include "debug.h"
+
+using namespace configstore;
+using namespace configstore::log;
+
+namespace configstore::log {
+static uint16_t crc16(uint16_t nCrc, const uint8_t *pData, uint32_t nLength) {
+	while (nLength-- != 0) {
+		nCrc = static_cast<uint16_t>(nCrc ^ (*pData++ << 8));
+
+		for (uint32_t i = 0; i < 8; i++) {
+			if (nCrc & 0x8000) {
+				nCrc = static_cast<uint16_t>((nCrc << 1) ^ 0x1021);
+			} else {
+				nCrc = static_cast<uint16_t>(nCrc << 1);
+			}
+		}
+	}
+
+	return nCrc;
+}
+
+static uint16_t record_crc(const struct RecordHeader *pHeader, const uint8_t *pData) {
+	const auto nCrc = crc16(0xFFFF, reinterpret_cast<const uint8_t *>(pHeader), offsetof(struct RecordHeader, nCrc));
+	return crc16(nCrc, pData, pHeader->nLength);
+}
+
+static bool is_zero(const uint8_t *pData, uint32_t nLength) {
+	while (nLength-- != 0) {
+		if (*pData++ != 0) {
+			return false;
+		}
+	}
+
+	return true;
+}
+}  // namespace configstore::log
+
+/**
+ * The log region must fit on the device, and the records of one commit,
+ * each chunk in its own record in the worst case, must fit in FREE_SECTORS sectors.
+ * @return false when the device is too small for the log.
+ */
+bool ConfigStore::LogIsSupported() {
+	DEBUG_ENTRY
+
+	s_nLogSectorSize = StoreDevice::GetSectorSize();
+
+	const auto nReserved = get_reserved_size(s_nLogSectorSize);
+	const auto nRecordMax = static_cast<uint32_t>(sizeof(s_LogBuffer));
+	const auto nCommitMax = LOG_CHUNKS * static_cast<uint32_t>(CHUNK_SIZE + sizeof(struct RecordHeader));
+
+	if ((nReserved > StoreDevice::GetSize()) || ((sizeof(struct SectorHeader) + nRecordMax) > s_nLogSectorSize)
+			|| ((FREE_SECTORS * (s_nLogSectorSize - sizeof(struct SectorHeader) - nRecordMax)) < nCommitMax)) {
+		DEBUG_PRINTF("Device too small for the log: %u sectors of %u bytes", SECTORS, s_nLogSectorSize);
+		DEBUG_EXIT
+		return false;
+	}
+
+	s_nLogStartAddress = StoreDevice::GetSize() - nReserved;
+
+	DEBUG_PRINTF("s_nLogStartAddress=%x", s_nLogStartAddress);
+	DEBUG_EXIT
+	return true;
+}
+
+/**
+ * Rebuilds the RAM image from the log.
+ * @return false when there is no log on the device.
+ */
+bool ConfigStore::LogInit() {
+	DEBUG_ENTRY
+
+	s_nLogActive = SECTOR_NONE;
+	s_nLogFree = 0;
+
+	memset(s_LogChunkSector, SECTOR_NONE, sizeof(s_LogChunkSector));
+
+	uint32_t nSequence[SECTORS];
+	uint32_t nValid = 0;
+
+	for (uint32_t nSector = 0; nSector < SECTORS; nSector++) {
+		struct SectorHeader header;
+		storedevice::result result;
+
+		StoreDevice::Read(LogSectorAddress(nSector), sizeof(struct SectorHeader), reinterpret_cast<uint8_t *>(&header), result);
+		assert(result == storedevice::result::OK);
+
+		if ((header.nMagic == MAGIC) && (header.nSequence == ~header.nSequenceInverted)) {
+			nSequence[nSector] = header.nSequence;
+			nValid |= (1U << nSector);
+		}
+	}
+
+	DEBUG_PRINTF("nValid=%x", nValid);
+
+	if (nValid == 0) {
+		DEBUG_EXIT
+		return false;
+	}
+
+	memset(s_ConfigStoreData, 0, sizeof(s_ConfigStoreData));
+
+	/*
+	 * Replay from the oldest to the newest sector
+	 */
+
+	auto nPending = nValid;
+	auto bIsClean = true;
+
+	while (nPending != 0) {
+		uint32_t nOldest = SECTOR_NONE;
+
+		for (uint32_t nSector = 0; nSector < SECTORS; nSector++) {
+			if ((nPending & (1U << nSector)) && ((nOldest == SECTOR_NONE) || (nSequence[nSector] < nSequence[nOldest]))) {
+				nOldest = nSector;
+			}
+		}
+
+		nPending &= ~(1U << nOldest);
+
+		uint32_t nWriteOffset;
+		bIsClean = LogReplay(nOldest, nWriteOffset);
+
+		if (!bIsClean) {
+			s_LogStatistics.nTorn++;
+		}
+
+		s_nLogActive = static_cast<uint8_t>(nOldest);
+		s_nLogSequence = nSequence[nOldest];
+		s_nLogWriteOffset = nWriteOffset;
+	}
+
+	/*
+	 * A power loss during a write leaves an invalid record in the active sector.
+	 * It is padded, so the log continues after it.
+	 */
+	if (!bIsClean) {
+		s_nLogWriteOffset = LogPad(s_nLogActive, s_nLogWriteOffset);
+	}
+
+	/*
+	 * The erased sectors after the active sector are free.
+	 * The compaction erases the others, after copying their live chunks.
+	 */
+	while ((s_nLogFree < (SECTORS - 1)) && ((nValid & (1U << LogNextSector(s_nLogFree))) == 0) && LogIsErased(LogNextSector(s_nLogFree))) {
+		s_nLogFree++;
+	}
+
+	if (s_nLogFree < FREE_SECTORS) {
+		s_State = State::CHANGED;	// Run the compaction
+	}
+
+	DEBUG_PRINTF("s_nLogActive=%u, s_nLogWriteOffset=%u, s_nLogFree=%u", s_nLogActive, s_nLogWriteOffset, s_nLogFree);
+	DEBUG_EXIT
+	return true;
+}
+
+/**
+ * @return false when an invalid record is found.
+ */
+bool ConfigStore::LogReplay(const uint32_t nSector, uint32_t& nWriteOffset) {
+	const auto nAddress = LogSectorAddress(nSector);
+	nWriteOffset = sizeof(struct SectorHeader);
+
+	while ((nWriteOffset + sizeof(struct RecordHeader)) <= s_nLogSectorSize) {
+		auto *pHeader = reinterpret_cast<struct RecordHeader *>(s_LogBuffer);
+		auto *pData = &s_LogBuffer[sizeof(struct RecordHeader)];
+		storedevice::result result;
+
+		StoreDevice::Read(nAddress + nWriteOffset, sizeof(struct RecordHeader), s_LogBuffer, result);
+		assert(result == storedevice::result::OK);
+
+		if ((pHeader->nStore == STORE_ERASED) && (pHeader->nLength == 0xFFFF)) {
+			return true;
+		}
+
+		if (is_zero(s_LogBuffer, sizeof(struct RecordHeader))) {
+			nWriteOffset += static_cast<uint32_t>(sizeof(struct RecordHeader));	// Padding, see LogPad()
+			continue;
+		}
+
+		uint32_t nBase;
+		uint32_t nSize;
+
+		if (pHeader->nStore == STORE_HEADER) {
+			nBase = 0;
+			nSize = StoreConfiguration::OFFSET_STORES;
+		} else if (pHeader->nStore < static_cast<uint32_t>(Store::LAST)) {
+			nBase = GetStoreOffset(static_cast<Store>(pHeader->nStore));
+			nSize = STORE_SIZE[pHeader->nStore];
+		} else {
+			DEBUG_PRINTF("Invalid store %u", pHeader->nStore);
+			return false;
+		}
+
+		const uint32_t nLength = pHeader->nLength;
+		const uint32_t nOffset = nBase + pHeader->nOffset;
+
+		if ((nLength == 0) || (nLength > RECORD_DATA_MAX) || ((pHeader->nOffset + nLength) > nSize)
+				|| ((nOffset % CHUNK_SIZE) != 0) || ((nLength % CHUNK_SIZE) != 0)
+				|| ((nWriteOffset + sizeof(struct RecordHeader) + nLength) > s_nLogSectorSize)) {
+			DEBUG_PRINTF("Invalid record at %u", nWriteOffset);
+			return false;
+		}
+
+		StoreDevice::Read(nAddress + nWriteOffset + static_cast<uint32_t>(sizeof(struct RecordHeader)), nLength, pData, result);
+		assert(result == storedevice::result::OK);
+
+		if (record_crc(pHeader, pData) != pHeader->nCrc) {
+			DEBUG_PRINTF("CRC error at %u", nWriteOffset);
+			return false;
+		}
+
+		memcpy(&s_ConfigStoreData[nOffset], pData, nLength);
+		memset(&s_LogChunkSector[nOffset / CHUNK_SIZE], static_cast<int>(nSector), nLength / CHUNK_SIZE);
+
+		s_LogStatistics.nReplayed++;
+		nWriteOffset += static_cast<uint32_t>(sizeof(struct RecordHeader)) + nLength;
+	}
+
+	return true;
+}
+
+/**
+ * Programs zeros from the invalid record up to the last programmed byte of the sector.
+ * NOR flash can always clear bits, and the replay skips the zeros.
+ * @return the write offset after the padding.
+ */
+uint32_t ConfigStore::LogPad(const uint32_t nSector, const uint32_t nOffset) {
+	DEBUG_ENTRY
+	const auto nAddress = LogSectorAddress(nSector);
+	auto nEnd = nOffset;
+
+	for (uint32_t nReadOffset = nOffset; nReadOffset < s_nLogSectorSize; nReadOffset += sizeof(s_LogBuffer)) {
+		auto nLength = s_nLogSectorSize - nReadOffset;
+
+		if (nLength > sizeof(s_LogBuffer)) {
+			nLength = sizeof(s_LogBuffer);
+		}
+
+		storedevice::result result;
+		StoreDevice::Read(nAddress + nReadOffset, nLength, s_LogBuffer, result);
+		assert(result == storedevice::result::OK);
+
+		for (uint32_t i = 0; i < nLength; i++) {
+			if (s_LogBuffer[i] != 0xFF) {
+				nEnd = nReadOffset + i + 1;
+			}
+		}
+	}
+
+	nEnd = (nEnd + sizeof(struct RecordHeader) - 1) & ~static_cast<uint32_t>(sizeof(struct RecordHeader) - 1);
+
+	if (nEnd > s_nLogSectorSize) {
+		nEnd = s_nLogSectorSize;
+	}
+
+	memset(s_LogBuffer, 0, sizeof(s_LogBuffer));
+
+	for (auto nWriteOffset = nOffset; nWriteOffset < nEnd; nWriteOffset += sizeof(s_LogBuffer)) {
+		auto nLength = nEnd - nWriteOffset;
+
+		if (nLength > sizeof(s_LogBuffer)) {
+			nLength = sizeof(s_LogBuffer);
+		}
+
+		storedevice::result result;
+		while (!StoreDevice::Write(nAddress + nWriteOffset, nLength, s_LogBuffer, result))
+			;
+		assert(result == storedevice::result::OK);
+	}
+
+	DEBUG_PRINTF("nOffset=%u, nEnd=%u", nOffset, nEnd);
+	DEBUG_EXIT
+	return nEnd;
+}
+
+bool ConfigStore::LogIsErased(const uint32_t nSector) {
+	const auto nAddress = LogSectorAddress(nSector);
+
+	for (uint32_t nOffset = 0; nOffset < s_nLogSectorSize; nOffset += sizeof(s_LogBuffer)) {
+		auto nLength = s_nLogSectorSize - nOffset;
+
+		if (nLength > sizeof(s_LogBuffer)) {
+			nLength = sizeof(s_LogBuffer);
+		}
+
+		storedevice::result result;
+		StoreDevice::Read(nAddress + nOffset, nLength, s_LogBuffer, result);
+		assert(result == storedevice::result::OK);
+
+		for (uint32_t i = 0; i < nLength; i++) {
+			if (s_LogBuffer[i] != 0xFF) {
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+/**
+ * The chunks with only zero bytes are not written, as these are the default after the replay.
+ */
+void ConfigStore::LogMarkImage() {
+	for (uint32_t nOffset = 0; nOffset < s_nStoresSize; nOffset += CHUNK_SIZE) {
+		if (!is_zero(&s_ConfigStoreData[nOffset], CHUNK_SIZE)) {
+			SetDirty(nOffset, CHUNK_SIZE);
+		}
+	}
+}
+
+/**
+ * Marks the live chunks of the sector to be copied forward.
+ * @return true when chunks are marked.
+ */
+bool ConfigStore::LogMarkLive(const uint32_t nSector) {
+	auto bIsMarked = false;
+
+	for (uint32_t nChunk = 0; nChunk < LOG_CHUNKS; nChunk++) {
+		if ((s_LogChunkSector[nChunk] == nSector) && !is_zero(&s_ConfigStoreData[nChunk * CHUNK_SIZE], CHUNK_SIZE)) {
+			SetDirty(nChunk * CHUNK_SIZE, CHUNK_SIZE);
+			s_LogStatistics.nBytesCopied += CHUNK_SIZE;
+			bIsMarked = true;
+		}
+	}
+
+	DEBUG_PRINTF("nSector=%u, bIsMarked=%d", nSector, bIsMarked);
+	return bIsMarked;
+}
+
+/**
+ * A chunk with only zero bytes is not live in the oldest sector, as zero is the
+ * default after the replay.
+ * @return true when the sector has the latest copy of a chunk.
+ */
+bool ConfigStore::LogIsLive(const uint32_t nSector) const {
+	for (uint32_t nChunk = 0; nChunk < LOG_CHUNKS; nChunk++) {
+		if ((s_LogChunkSector[nChunk] == nSector) && !is_zero(&s_ConfigStoreData[nChunk * CHUNK_SIZE], CHUNK_SIZE)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void ConfigStore::LogStartSector() {
+	assert(s_nLogFree != 0);
+
+	s_nLogActive = static_cast<uint8_t>(LogNextSector(0));
+	s_nLogFree--;
+	s_nLogSequence++;
+
+	auto *pHeader = reinterpret_cast<struct SectorHeader *>(s_LogBuffer);
+	pHeader->nMagic = MAGIC;
+	pHeader->nSequence = s_nLogSequence;
+	pHeader->nSequenceInverted = ~s_nLogSequence;
+	pHeader->nReserved = UINT32_MAX;
+
+	s_nLogWriteOffset = 0;
+	s_nLogWriteLength = sizeof(struct SectorHeader);
+	s_bLogWriteRunning = true;
+
+	DEBUG_PRINTF("s_nLogActive=%u, s_nLogSequence=%u", s_nLogActive, s_nLogSequence);
+}
+
+void ConfigStore::LogLocate(const uint32_t nOffset, uint32_t& nStore, uint32_t& nStoreOffset, uint32_t& nStoreEnd) {
+	if (nOffset < StoreConfiguration::OFFSET_STORES) {
+		nStore = STORE_HEADER;
+		nStoreOffset = 0;
+		nStoreEnd = StoreConfiguration::OFFSET_STORES;
+		return;
+	}
+
+	nStoreOffset = StoreConfiguration::OFFSET_STORES;
+
+	for (nStore = 0; nStore < static_cast<uint32_t>(Store::LAST); nStore++) {
+		nStoreEnd = nStoreOffset + STORE_SIZE[nStore];
+
+		if (nOffset < nStoreEnd) {
+			return;
+		}
+
+		nStoreOffset = nStoreEnd;
+	}
+
+	assert(0);
+}
+
+uint32_t ConfigStore::LogFirstDirty() const {
+	for (uint32_t i = 0; i < (LOG_CHUNKS / 32); i++) {
+		if (s_LogDirty[i] != 0) {
+			return (i * 32) + static_cast<uint32_t>(__builtin_ctz(s_LogDirty[i]));
+		}
+	}
+
+	return LOG_CHUNKS;
+}
+
+/**
+ * One step of the commit, called from Flash() in the states ERASING and WRITING.
+ * Each step is at most one device operation.
+ */
+bool ConfigStore::LogFlash() {
+	if (!s_bHaveDevice) {
+		memset(s_LogDirty, 0, sizeof(s_LogDirty));
+		s_State = State::IDLE;
+		return false;
+	}
+
+	storedevice::result result;
+
+	if (s_State == State::ERASING) {
+		assert(s_nLogErase != SECTOR_NONE);
+
+		if (!StoreDevice::Erase(LogSectorAddress(s_nLogErase), s_nLogSectorSize, result)) {
+			s_bLogEraseRunning = true;
+			return true;
+		}
+
+		assert(result == storedevice::result::OK);
+
+		s_bLogEraseRunning = false;
+		s_LogStatistics.nErases++;
+
+		/*
+		 * Only chunks with zero bytes can be left, these are the default after the replay.
+		 */
+		for (uint32_t nChunk = 0; nChunk < LOG_CHUNKS; nChunk++) {
+			if (s_LogChunkSector[nChunk] == s_nLogErase) {
+				s_LogChunkSector[nChunk] = SECTOR_NONE;
+			}
+		}
+
+		assert(s_nLogErase == LogNextSector(s_nLogFree));
+		s_nLogFree++;
+		s_nLogErase = SECTOR_NONE;
+		s_State = State::WRITING;
+		return true;
+	}
+
+	assert(s_State == State::WRITING);
+
+	if (s_bLogEraseRunning) {
+		s_State = State::ERASING;
+		return true;
+	}
+
+	if (s_bLogWriteRunning) {
+		if (!StoreDevice::Write(LogSectorAddress(s_nLogActive) + s_nLogWriteOffset, s_nLogWriteLength, s_LogBuffer, result)) {
+			return true;
+		}
+
+		assert(result == storedevice::result::OK);
+
+		s_bLogWriteRunning = false;
+		s_nLogWriteOffset += s_nLogWriteLength;
+		s_LogStatistics.nBytesWritten += s_nLogWriteLength;
+		return true;
+	}
+
+	const auto nChunk = LogFirstDirty();
+
+	if (nChunk == LOG_CHUNKS) {
+		const auto nOldest = LogNextSector(s_nLogFree);
+
+		if ((s_nLogFree < FREE_SECTORS) && (nOldest != s_nLogActive)) {
+			/*
+			 * Compaction: copy the live chunks of the oldest sector to the active sector,
+			 * the oldest sector is erased when none of its chunks is live anymore.
+			 */
+			if (!LogMarkLive(nOldest)) {
+				s_nLogErase = static_cast<uint8_t>(nOldest);
+				s_State = State::ERASING;
+			}
+
+			return true;
+		}
+
+		s_LogStatistics.nCommits++;
+		s_State = State::IDLE;
+		return false;
+	}
+
+	const auto nOffset = nChunk * CHUNK_SIZE;
+
+	uint32_t nStore;
+	uint32_t nStoreOffset;
+	uint32_t nStoreEnd;
+
+	LogLocate(nOffset, nStore, nStoreOffset, nStoreEnd);
+
+	auto nLength = CHUNK_SIZE;
+
+	while (((nOffset + nLength) < nStoreEnd) && (nLength < RECORD_DATA_MAX)) {
+		const auto nNext = (nOffset + nLength) / CHUNK_SIZE;
+
+		if ((s_LogDirty[nNext / 32] & (1U << (nNext % 32))) == 0) {
+			break;
+		}
+
+		nLength += CHUNK_SIZE;
+	}
+
+	const auto nRecordSize = static_cast<uint32_t>(sizeof(struct RecordHeader)) + nLength;
+
+	if ((s_nLogActive == SECTOR_NONE) || ((s_nLogWriteOffset + nRecordSize) > s_nLogSectorSize)) {
+		if (s_nLogFree == 0) {
+			/*
+			 * Only at the first commit, or after a torn sector at boot.
+			 * A sector with live chunks is never erased, see LogIsSupported().
+			 */
+			const auto nSector = LogNextSector(0);
+
+			if (LogIsLive(nSector)) {
+				DEBUG_PUTS("No free sector");
+				assert(0);
+				s_State = State::IDLE;
+				return false;
+			}
+
+			s_nLogErase = static_cast<uint8_t>(nSector);
+			s_State = State::ERASING;
+			return true;
+		}
+
+		LogStartSector();
+		return true;
+	}
+
+	auto *pHeader = reinterpret_cast<struct RecordHeader *>(s_LogBuffer);
+	auto *pData = &s_LogBuffer[sizeof(struct RecordHeader)];
+
+	pHeader->nStore = static_cast<uint8_t>(nStore);
+	pHeader->nReserved = 0xFF;
+	pHeader->nOffset = static_cast<uint16_t>(nOffset - nStoreOffset);
+	pHeader->nLength = static_cast<uint16_t>(nLength);
+
+	memcpy(pData, &s_ConfigStoreData[nOffset], nLength);
+
+	pHeader->nCrc = record_crc(pHeader, pData);
+
+	for (auto i = nChunk; i < (nChunk + (nLength / CHUNK_SIZE)); i++) {
+		s_LogDirty[i / 32] &= ~(1U << (i % 32));
+		s_LogChunkSector[i] = s_nLogActive;
+	}
+
+	s_LogStatistics.nRecords++;
+	s_LogStatistics.nBytesData += nLength;
+
+	s_nLogWriteLength = nRecordSize;
+	s_bLogWriteRunning = true;
+	return true;
+}
@@ -0,0 +1,343 @@
+/**
+ * @file test_configstorelog.cpp
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * The store device is a simulated NOR flash: an erase sets the bytes to 0xFF,
+ * a write can only clear bits. A power loss is injected at every device
+ * operation of a series of commits. The operation in progress is done
+ * partially, and the RAM image is rebuilt from the device as at boot.
+ * Each chunk must then have its value before or after the commit.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <new>
+
+#include "configstore.h"
+#include "softwaretimers.h"
+
+#include "test.h"
+
+namespace global {
+int32_t *gp_nUtcOffset;
+}  // namespace global
+
+TimerHandle_t SoftwareTimerAdd(const uint32_t, const TimerCallbackFunction_t) {
+	return 0;
+}
+
+bool SoftwareTimerDelete(TimerHandle_t& nId) {
+	nId = TIMER_ID_NONE;
+	return true;
+}
+
+namespace flash {
+static constexpr uint32_t SECTOR_SIZE = 4096;
+static constexpr uint32_t DEVICE_SIZE = 16 * SECTOR_SIZE;
+
+uint8_t s_Data[DEVICE_SIZE];
+uint32_t s_nSize = DEVICE_SIZE;
+uint32_t s_nOperations;
+uint32_t s_nEraseAt;	///< The first erase operation
+uint32_t s_nPowerLossAt;	///< 0 is no power loss
+bool s_bPowerLost;
+
+/**
+ * @return The number of bytes of the operation done, all when there is no power loss.
+ */
+uint32_t operation(const uint32_t nLength) {
+	if (s_bPowerLost) {
+		return 0;
+	}
+
+	if (++s_nOperations == s_nPowerLossAt) {
+		s_bPowerLost = true;
+		return (nLength * (s_nOperations % 4)) / 4;
+	}
+
+	return nLength;
+}
+}  // namespace flash
+
+StoreDevice::StoreDevice() : m_IsDetected(true) {}
+StoreDevice::~StoreDevice() {}
+
+uint32_t StoreDevice::GetSectorSize() const {
+	return flash::SECTOR_SIZE;
+}
+
+uint32_t StoreDevice::GetSize() const {
+	return flash::s_nSize;
+}
+
+bool StoreDevice::Read(uint32_t nOffset, uint32_t nLength, uint8_t *pBuffer, storedevice::result& nResult) {
+	memcpy(pBuffer, &flash::s_Data[nOffset], nLength);
+	nResult = storedevice::result::OK;
+	return true;
+}
+
+bool StoreDevice::Erase(uint32_t nOffset, uint32_t nLength, storedevice::result& nResult) {
+	if ((flash::s_nEraseAt == 0) && !flash::s_bPowerLost) {
+		flash::s_nEraseAt = flash::s_nOperations + 1;
+	}
+
+	memset(&flash::s_Data[nOffset], 0xFF, flash::operation(nLength));
+	nResult = storedevice::result::OK;
+	return true;
+}
+
+bool StoreDevice::Write(uint32_t nOffset, uint32_t nLength, const uint8_t *pBuffer, storedevice::result& nResult) {
+	const auto nDone = flash::operation(nLength);
+
+	for (uint32_t i = 0; i < nDone; i++) {
+		flash::s_Data[nOffset + i] &= pBuffer[i];
+	}
+
+	nResult = storedevice::result::OK;
+	return true;
+}
+
+/*
+ * The internal state of the store, ConfigStore has this class as friend
+ */
+class ConfigStoreTest {
+public:
+	static constexpr auto SIZE = ConfigStore::StoreConfiguration::SIZE;
+
+	static constexpr auto& s_ConfigStoreData = ConfigStore::s_ConfigStoreData;
+	static constexpr auto& s_LogDirty = ConfigStore::s_LogDirty;
+	static constexpr auto& s_LogStatistics = ConfigStore::s_LogStatistics;
+	static constexpr auto& s_State = ConfigStore::s_State;
+	static constexpr auto& s_bLogEraseRunning = ConfigStore::s_bLogEraseRunning;
+	static constexpr auto& s_bLogUsed = ConfigStore::s_bLogUsed;
+	static constexpr auto& s_bLogWriteRunning = ConfigStore::s_bLogWriteRunning;
+	static constexpr auto& s_nLogFree = ConfigStore::s_nLogFree;
+	static constexpr auto& s_nStoresSize = ConfigStore::s_nStoresSize;
+	static constexpr auto& s_pThis = ConfigStore::s_pThis;
+
+	static void SetDirty(const uint32_t nOffset, const uint32_t nLength) {
+		ConfigStore::Get()->SetDirty(nOffset, nLength);
+	}
+};
+
+namespace {
+static constexpr auto SIZE = ConfigStoreTest::SIZE;
+static constexpr auto CHUNK_SIZE = configstore::log::CHUNK_SIZE;
+
+uint32_t s_nSeed = 1;
+
+uint32_t random() {
+	s_nSeed = s_nSeed * 1664525U + 1013904223U;	// LCG
+	return s_nSeed >> 8;
+}
+
+/**
+ * Boot: the RAM image is rebuilt from the device.
+ */
+void boot() {
+	memset(ConfigStoreTest::s_ConfigStoreData, 0, sizeof(ConfigStoreTest::s_ConfigStoreData));
+	memset(ConfigStoreTest::s_LogDirty, 0, sizeof(ConfigStoreTest::s_LogDirty));
+	memset(&ConfigStoreTest::s_LogStatistics, 0, sizeof(ConfigStoreTest::s_LogStatistics));
+	ConfigStoreTest::s_State = configstore::State::IDLE;
+	ConfigStoreTest::s_bLogWriteRunning = false;
+	ConfigStoreTest::s_bLogEraseRunning = false;
+	ConfigStoreTest::s_pThis = nullptr;
+
+	flash::s_bPowerLost = false;
+	flash::s_nPowerLossAt = 0;
+
+	alignas(ConfigStore) static uint8_t storage[sizeof(ConfigStore)];
+	new (storage) ConfigStore;
+}
+
+void commit() {
+	while (ConfigStore::Get()->Commit())
+		;
+}
+
+/**
+ * Changes a few random bytes in random stores, some are set to zero.
+ */
+void change() {
+	const auto nChanges = 1 + random() % 8;
+
+	for (uint32_t i = 0; i < nChanges; i++) {
+		const auto store = static_cast<configstore::Store>(random() % static_cast<uint32_t>(configstore::Store::LAST));
+		const auto nSize = configstore::STORE_SIZE[static_cast<uint32_t>(store)];
+		const auto nOffset = 4 + random() % (nSize - 4);
+		uint8_t data[24];
+		const auto nLength = (nOffset + sizeof(data) > nSize) ? nSize - nOffset : static_cast<uint32_t>(sizeof(data));
+
+		for (uint32_t j = 0; j < nLength; j++) {
+			data[j] = ((random() % 4) == 0) ? 0 : static_cast<uint8_t>(random());
+		}
+
+		ConfigStore::Get()->Update(store, nOffset, data, nLength);
+	}
+}
+
+bool is_chunk_equal(const uint8_t *pA, const uint8_t *pB, const uint32_t nChunk) {
+	return memcmp(&pA[nChunk * CHUNK_SIZE], &pB[nChunk * CHUNK_SIZE], CHUNK_SIZE) == 0;
+}
+
+void test_commits() {
+	memset(flash::s_Data, 0xFF, sizeof(flash::s_Data));
+	flash::s_nSize = flash::DEVICE_SIZE;
+
+	boot();
+	CHECK(ConfigStoreTest::s_bLogUsed);
+	commit();
+
+	static uint8_t image[SIZE];
+
+	for (uint32_t i = 0; i < 2000; i++) {
+		change();
+		commit();
+	}
+
+	memcpy(image, ConfigStoreTest::s_ConfigStoreData, SIZE);
+	boot();
+
+	CHECK(memcmp(image, ConfigStoreTest::s_ConfigStoreData, SIZE) == 0);
+	CHECK(ConfigStoreTest::s_State == configstore::State::IDLE);
+	CHECK(ConfigStoreTest::s_nLogFree >= configstore::log::FREE_SECTORS);
+}
+
+/**
+ * The RAM image is set to the intended image, with the chunks which differ
+ * from the image rebuilt at boot marked dirty. Then the random changes follow.
+ */
+void prepare(const uint8_t *pIntended, const uint32_t nSeed) {
+	for (uint32_t nChunk = 0; nChunk < (SIZE / CHUNK_SIZE); nChunk++) {
+		if (!is_chunk_equal(ConfigStoreTest::s_ConfigStoreData, pIntended, nChunk)) {
+			ConfigStoreTest::SetDirty(nChunk * CHUNK_SIZE, CHUNK_SIZE);
+			ConfigStoreTest::s_State = configstore::State::CHANGED;
+		}
+	}
+
+	memcpy(ConfigStoreTest::s_ConfigStoreData, pIntended, SIZE);
+
+	s_nSeed = nSeed;
+	change();
+}
+
+void test_power_loss() {
+	static uint8_t intended[SIZE];
+	static uint8_t before[SIZE];
+	static uint8_t after[SIZE];
+	static uint8_t saved[flash::DEVICE_SIZE];
+
+	uint32_t nPowerLosses = 0;
+	uint32_t nErases = 0;
+	uint32_t nBad = 0;
+
+	memcpy(intended, ConfigStoreTest::s_ConfigStoreData, SIZE);
+
+	for (uint32_t i = 0; i < 3000; i++) {
+		memcpy(before, ConfigStoreTest::s_ConfigStoreData, SIZE);
+		memcpy(saved, flash::s_Data, sizeof(saved));
+		const auto nSeed = s_nSeed;
+
+		// The commit without power loss, for the device operations
+		prepare(intended, nSeed);
+		memcpy(after, ConfigStoreTest::s_ConfigStoreData, SIZE);
+
+		flash::s_nOperations = 0;
+		flash::s_nEraseAt = 0;
+		commit();
+
+		const auto nOperations = flash::s_nOperations;
+		const auto nEraseAt = flash::s_nEraseAt;
+
+		if (nOperations == 0) {
+			memcpy(intended, after, SIZE);
+			continue;
+		}
+
+		// The same commit with a power loss, during or just before an erase when there is one
+		memcpy(flash::s_Data, saved, sizeof(saved));
+		boot();
+		CHECK(memcmp(before, ConfigStoreTest::s_ConfigStoreData, SIZE) == 0);
+		prepare(intended, nSeed);
+
+		flash::s_nOperations = 0;
+
+		if ((nEraseAt != 0) && ((random() % 4) != 0)) {
+			flash::s_nPowerLossAt = nEraseAt - (random() % 2);
+			nErases++;
+		} else {
+			flash::s_nPowerLossAt = 1 + random() % nOperations;
+		}
+
+		commit();
+		nPowerLosses++;
+
+		boot();
+
+		for (uint32_t nChunk = 0; nChunk < (SIZE / CHUNK_SIZE); nChunk++) {
+			if (!is_chunk_equal(ConfigStoreTest::s_ConfigStoreData, before, nChunk) && !is_chunk_equal(ConfigStoreTest::s_ConfigStoreData, after, nChunk)) {
+				nBad++;
+			}
+		}
+
+		memcpy(intended, after, SIZE);
+	}
+
+	CHECK(nBad == 0);
+	CHECK(nErases != 0);
+
+	printf("%u power losses, %u at an erase, %u chunks lost\n", static_cast<unsigned int>(nPowerLosses), static_cast<unsigned int>(nErases), static_cast<unsigned int>(nBad));
+}
+
+/**
+ * A device smaller than the log region uses the single image
+ */
+void test_small_device() {
+	memset(flash::s_Data, 0xFF, sizeof(flash::s_Data));
+	flash::s_nSize = SIZE;
+
+	boot();
+	CHECK(!ConfigStoreTest::s_bLogUsed);
+	commit();
+
+	change();
+	commit();
+
+	static uint8_t image[SIZE];
+	memcpy(image, ConfigStoreTest::s_ConfigStoreData, SIZE);
+
+	boot();
+	CHECK(memcmp(image, ConfigStoreTest::s_ConfigStoreData, ConfigStoreTest::s_nStoresSize) == 0);
+}
+}  // namespace
+
+int main() {
+	test_commits();
+	test_power_loss();
+	test_small_device();
+
+	return test::result();
+}
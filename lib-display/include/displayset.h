@@ -2,7 +2,7 @@
  * @file dislpayset.h
  *
  */
-/* Copyright (C) 2017-2023 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2017-2025 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -72,6 +72,11 @@ public:
 
 	virtual void PrintInfo() {}
 
+	/**
+	 * @brief For the displays with a framebuffer, to be called from the superloop.
+	 */
+	virtual void Run() {}
+
 protected:
 	uint32_t m_nCols;
 	uint32_t m_nRows;
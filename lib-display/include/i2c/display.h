@@ -2,7 +2,7 @@
  * @file display.h
  *
  */
-/* Copyright (C) 2017-2024 by Arjan van Vught mailto:info@gd32-dmx.org
+/* Copyright (C) 2017-2025 by Arjan van Vught mailto:info@gd32-dmx.org
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -316,6 +316,12 @@ public:
 	}
 
 	void Run() {
+#if defined (CONFIG_DISPLAY_ENABLE_FRAMEBUFFER)
+		if ((m_LcdDisplay != nullptr) && !m_bIsSleep) {
+			m_LcdDisplay->Run();
+		}
+#endif
+
 		if (m_nSleepTimeout == 0) {
 			return;
 		}
@@ -2,7 +2,7 @@
  * @file ssd1306.h
  *
  */
-/* Copyright (C) 2017-2024 by Arjan van Vught mailto:info@gd32-dmx.org
+/* Copyright (C) 2017-2025 by Arjan van Vught mailto:info@gd32-dmx.org
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -34,6 +34,30 @@
 
 #define OLED_I2C_SLAVE_ADDRESS_DEFAULT	0x3C
 
+/**
+ * With CONFIG_DISPLAY_ENABLE_FRAMEBUFFER the text is written into a copy of the
+ * display RAM. Only the changed columns of a page are marked as dirty. Run() sends
+ * the dirty columns in bursts, at most every CONFIG_DISPLAY_FRAMEBUFFER_INTERVAL_MS
+ * and not longer than CONFIG_DISPLAY_FRAMEBUFFER_BUDGET_US per call.
+ */
+
+#if defined (CONFIG_DISPLAY_ENABLE_FRAMEBUFFER)
+# if !defined (CONFIG_DISPLAY_FRAMEBUFFER_INTERVAL_MS)
+#  define CONFIG_DISPLAY_FRAMEBUFFER_INTERVAL_MS	40
+# endif
+# if !defined (CONFIG_DISPLAY_FRAMEBUFFER_BUDGET_US)
+#  define CONFIG_DISPLAY_FRAMEBUFFER_BUDGET_US		1000
+# endif
+
+namespace ssd1306::framebuffer {
+static constexpr uint32_t PAGES = 8;
+static constexpr uint32_t COLUMNS = 132;	///< SH1106
+static constexpr uint32_t INTERVAL_US = 1000 * CONFIG_DISPLAY_FRAMEBUFFER_INTERVAL_MS;
+static constexpr uint32_t BUDGET_US = CONFIG_DISPLAY_FRAMEBUFFER_BUDGET_US;
+static constexpr uint32_t CHUNK_MIN = 4;
+}  // namespace ssd1306::framebuffer
+#endif
+
 enum TOledPanel {
 	OLED_PANEL_128x64_8ROWS,	///< Default
 	OLED_PANEL_128x64_4ROWS,
@@ -73,6 +97,14 @@ public:
 
 	void PrintInfo() override;
 
+#if defined (CONFIG_DISPLAY_ENABLE_FRAMEBUFFER)
+	void Run() override;
+	/**
+	 * @brief Sends all the dirty columns, without time budget.
+	 */
+	void Flush();
+#endif
+
 	bool IsSH1106() {
 		return m_bHaveSH1106;
 	}
@@ -86,6 +118,13 @@ private:
 	void InitMembers();
 	void SendCommand(uint8_t);
 	void SendData(const uint8_t *pData, uint32_t nLength);
+	void SendAddress(uint32_t nColumn, uint32_t nPage);
+	void SetAddress(uint32_t nColumn, uint32_t nPage);
+#if defined (CONFIG_DISPLAY_ENABLE_FRAMEBUFFER)
+	void Store(const uint8_t *pData, uint32_t nLength);
+	void FlushChunk();
+	void Invalidate();
+#endif
 
 	void SetCursorOn();
 	void SetCursorOff();
@@ -99,6 +138,24 @@ private:
 	TOledPanel m_OledPanel { OLED_PANEL_128x64_8ROWS };
 	bool m_bHaveSH1106 { false };
 	uint32_t m_nPages;
+#if defined (CONFIG_DISPLAY_ENABLE_FRAMEBUFFER)
+	bool m_bFramebuffer { false };	///< Set after the detection of the SH1106
+	bool m_bFlushing { false };
+	uint32_t m_nColumn { 0 };
+	uint32_t m_nPage { 0 };
+	uint32_t m_nDirtyPages { 0 };
+	uint32_t m_nChunkBytes;
+	uint32_t m_nChunkMicros;		///< Time of the last chunk sent
+	uint32_t m_nFlushMicros { 0 };
+
+	struct Dirty {
+		uint8_t nFrom;
+		uint8_t nTo;		///< Exclusive
+	};
+
+	static inline Dirty s_Dirty[ssd1306::framebuffer::PAGES];
+	static inline uint8_t s_Framebuffer[ssd1306::framebuffer::PAGES][ssd1306::framebuffer::COLUMNS];
+#endif
 #if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE) || defined(CONFIG_DISPLAY_FIX_FLIP_VERTICALLY)
 	char *m_pShadowRam { nullptr };
 	uint32_t m_nShadowRamIndex { 0 };
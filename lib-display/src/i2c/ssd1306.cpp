@@ -2,7 +2,7 @@
  * @file ssd1306.cpp
  *
  */
-/* Copyright (C) 2017-2024 by Arjan van Vught mailto:info@gd32-dmx.org
+/* Copyright (C) 2017-2025 by Arjan van Vught mailto:info@gd32-dmx.org
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -31,6 +31,9 @@
 #include "i2c/ssd1306.h"
 
 #include "hal_i2c.h"
+#if defined (CONFIG_DISPLAY_ENABLE_FRAMEBUFFER)
+# include "hardware.h"
+#endif
 
 namespace ssd1306 {
 static constexpr auto SSD1306_LCD_WIDTH = 128;
@@ -294,8 +297,30 @@ bool Ssd1306::Start() {
 
 	CheckSH1106();
 
+#if defined (CONFIG_DISPLAY_ENABLE_FRAMEBUFFER)
+	/*
+	 * Bits per byte is 9, the overhead is the address transaction and the
+	 * slave address with the control byte of the data transaction.
+	 */
+	const auto nBytes = (framebuffer::BUDGET_US * (m_I2C.GetBaudrate() / 1000U)) / 9000U;
+	m_nChunkBytes = nBytes > (7 + framebuffer::CHUNK_MIN) ? nBytes - 7 : framebuffer::CHUNK_MIN;
+	if (m_nChunkBytes > SSD1306_LCD_WIDTH) {
+		m_nChunkBytes = SSD1306_LCD_WIDTH;
+	}
+	m_nChunkMicros = framebuffer::BUDGET_US;
+	m_bFramebuffer = true;
+
 	Ssd1306::Cls();
 
+	/*
+	 * The display RAM content is unknown after power on
+	 */
+	Invalidate();
+	Flush();
+#else
+	Ssd1306::Cls();
+#endif
+
 	SendCommand(cmd::DISPLAY_ON);
 	return true;
 }
@@ -308,15 +333,11 @@ void Ssd1306::Cls() {
 	}
 
 	for (uint32_t nPage = 0; nPage < m_nPages; nPage++) {
-		SendCommand(cmd::SET_LOWCOLUMN | (nColumnAdd & 0XF));
-		SendCommand(static_cast<uint8_t>(cmd::SET_HIGHCOLUMN | (nColumnAdd)));
-		SendCommand(static_cast<uint8_t>(cmd::SET_STARTPAGE | nPage));
+		SetAddress(nColumnAdd, nPage);
 		SendData(reinterpret_cast<const uint8_t*>(&_ClearBuffer), (nColumnAdd + SSD1306_LCD_WIDTH + 1));
 	}
 
-	SendCommand(cmd::SET_LOWCOLUMN | (nColumnAdd & 0XF));
-	SendCommand(static_cast<uint8_t>(cmd::SET_HIGHCOLUMN | (nColumnAdd)));
-	SendCommand(cmd::SET_STARTPAGE);
+	SetAddress(nColumnAdd, 0);
 
 #if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE)|| defined(CONFIG_DISPLAY_FIX_FLIP_VERTICALLY)
 	m_nShadowRamIndex = 0;
@@ -418,9 +439,7 @@ void Ssd1306::SetCursorPos(uint32_t nCol, uint32_t nRow) {
 		nCol = static_cast<uint8_t>(nCol + 4);
 	}
 
-	SendCommand(cmd::SET_LOWCOLUMN | (nCol & 0XF));
-	SendCommand(static_cast<uint8_t>(cmd::SET_HIGHCOLUMN | (nCol >> 4)));
-	SendCommand(static_cast<uint8_t>(cmd::SET_STARTPAGE | nRow));
+	SetAddress(nCol, nRow);
 
 #if defined(CONFIG_DISPLAY_ENABLE_CURSOR_MODE) || defined(CONFIG_DISPLAY_FIX_FLIP_VERTICALLY)
 	m_nShadowRamIndex = static_cast<uint16_t>((nRow * oled::font8x6::COLS) + (nCol / oled::font8x6::CHAR_W));
@@ -458,7 +477,12 @@ void Ssd1306::SetFlipVertically(bool doFlipVertically) {
 		SendCommand(cmd::COMSCAN_DEC);
 	}
 
-#if defined(CONFIG_DISPLAY_FIX_FLIP_VERTICALLY)
+#if defined (CONFIG_DISPLAY_ENABLE_FRAMEBUFFER)
+	/*
+	 * The framebuffer is sent again with the new orientation
+	 */
+	Invalidate();
+#elif defined(CONFIG_DISPLAY_FIX_FLIP_VERTICALLY)
 	for (uint32_t i = 0; i < m_nRows; i++) {
 		Ssd1306::SetCursorPos(0, static_cast<uint8_t>(i));
 		for (uint32_t j = 0; j < oled::font8x6::COLS; j++) {
@@ -500,10 +524,161 @@ void Ssd1306::SendCommand(uint8_t nCmd) {
 	m_I2C.WriteRegister(mode::COMMAND, nCmd);
 }
 
+/**
+ * pData[0] is the control byte
+ */
 void Ssd1306::SendData(const uint8_t *pData, uint32_t nLength) {
+#if defined (CONFIG_DISPLAY_ENABLE_FRAMEBUFFER)
+	if (m_bFramebuffer) {
+		Store(&pData[1], nLength - 1);
+		return;
+	}
+#endif
 	m_I2C.Write(reinterpret_cast<const char*>(pData), nLength);
 }
 
+/**
+ * The column and page address commands in a single transaction
+ */
+void Ssd1306::SendAddress(uint32_t nColumn, uint32_t nPage) {
+	const uint8_t buffer[] = {
+			mode::COMMAND,
+			static_cast<uint8_t>(cmd::SET_LOWCOLUMN | (nColumn & 0xF)),
+			static_cast<uint8_t>(cmd::SET_HIGHCOLUMN | ((nColumn >> 4) & 0xF)),
+			static_cast<uint8_t>(cmd::SET_STARTPAGE | (nPage & 0x7)) };
+
+	m_I2C.Write(reinterpret_cast<const char*>(buffer), sizeof(buffer));
+}
+
+void Ssd1306::SetAddress(uint32_t nColumn, uint32_t nPage) {
+#if defined (CONFIG_DISPLAY_ENABLE_FRAMEBUFFER)
+	if (m_bFramebuffer) {
+		m_nColumn = nColumn;
+		m_nPage = nPage;
+		return;
+	}
+#endif
+	SendAddress(nColumn, nPage);
+}
+
+#if defined (CONFIG_DISPLAY_ENABLE_FRAMEBUFFER)
+/**
+ * Page addressing mode: the column address wraps within the page
+ */
+void Ssd1306::Store(const uint8_t *pData, uint32_t nLength) {
+	if (m_nPage >= m_nPages) {
+		return;
+	}
+
+	const uint32_t nColumns = m_bHaveSH1106 ? framebuffer::COLUMNS : SSD1306_LCD_WIDTH;
+	auto *pPage = s_Framebuffer[m_nPage];
+	auto& dirty = s_Dirty[m_nPage];
+
+	for (uint32_t i = 0; i < nLength; i++) {
+		if (m_nColumn >= nColumns) {
+			m_nColumn = 0;
+		}
+
+		if (pPage[m_nColumn] != pData[i]) {
+			pPage[m_nColumn] = pData[i];
+
+			if (dirty.nFrom >= dirty.nTo) {
+				dirty.nFrom = static_cast<uint8_t>(m_nColumn);
+				dirty.nTo = static_cast<uint8_t>(m_nColumn + 1);
+				m_nDirtyPages |= (1U << m_nPage);
+			} else if (m_nColumn < dirty.nFrom) {
+				dirty.nFrom = static_cast<uint8_t>(m_nColumn);
+			} else if (m_nColumn >= dirty.nTo) {
+				dirty.nTo = static_cast<uint8_t>(m_nColumn + 1);
+			}
+		}
+
+		m_nColumn++;
+	}
+}
+
+void Ssd1306::Invalidate() {
+	const uint32_t nColumns = m_bHaveSH1106 ? framebuffer::COLUMNS : SSD1306_LCD_WIDTH;
+
+	for (uint32_t nPage = 0; nPage < m_nPages; nPage++) {
+		s_Dirty[nPage].nFrom = 0;
+		s_Dirty[nPage].nTo = static_cast<uint8_t>(nColumns);
+	}
+
+	m_nDirtyPages = (1U << m_nPages) - 1;
+}
+
+/**
+ * The first dirty page, at most m_nChunkBytes columns
+ */
+void Ssd1306::FlushChunk() {
+	const auto nPage = static_cast<uint32_t>(__builtin_ctz(m_nDirtyPages));
+	auto& dirty = s_Dirty[nPage];
+
+	auto nLength = static_cast<uint32_t>(dirty.nTo - dirty.nFrom);
+
+	if (nLength > m_nChunkBytes) {
+		nLength = m_nChunkBytes;
+	}
+
+	uint8_t buffer[1 + SSD1306_LCD_WIDTH];
+	buffer[0] = mode::DATA;
+	memcpy(&buffer[1], &s_Framebuffer[nPage][dirty.nFrom], nLength);
+
+	SendAddress(dirty.nFrom, nPage);
+	m_I2C.Write(reinterpret_cast<const char*>(buffer), 1 + nLength);
+
+	dirty.nFrom = static_cast<uint8_t>(dirty.nFrom + nLength);
+
+	if (dirty.nFrom >= dirty.nTo) {
+		m_nDirtyPages &= ~(1U << nPage);
+	}
+}
+
+void Ssd1306::Run() {
+	if (m_nDirtyPages == 0) {
+		return;
+	}
+
+	const auto nMicros = Hardware::Get()->Micros();
+
+	if (!m_bFlushing) {
+		if ((nMicros - m_nFlushMicros) < framebuffer::INTERVAL_US) {
+			return;
+		}
+
+		m_bFlushing = true;
+		m_nFlushMicros = nMicros;
+	}
+
+	/*
+	 * The first chunk fits the budget by its size, a next chunk is sent
+	 * when the time measured for the previous chunk still fits.
+	 */
+	auto nChunkStart = nMicros;
+
+	do {
+		FlushChunk();
+
+		const auto nNow = Hardware::Get()->Micros();
+		m_nChunkMicros = nNow - nChunkStart;
+		nChunkStart = nNow;
+	} while ((m_nDirtyPages != 0) && ((nChunkStart - nMicros) + m_nChunkMicros <= framebuffer::BUDGET_US));
+
+	if (m_nDirtyPages == 0) {
+		m_bFlushing = false;
+	}
+}
+
+void Ssd1306::Flush() {
+	while (m_nDirtyPages != 0) {
+		FlushChunk();
+	}
+
+	m_bFlushing = false;
+}
+#endif
+
 /**
  *  Cursor mode support
  */
@@ -602,9 +777,7 @@ void Ssd1306::SetColumnRow(UNUSED uint8_t nColumn, UNUSED uint8_t nRow) {
 		nColumnAdd = static_cast<uint8_t>(nColumnAdd + 4);
 	}
 
-	SendCommand(cmd::SET_LOWCOLUMN | (nColumnAdd & 0xF));
-	SendCommand(cmd::SET_HIGHCOLUMN | static_cast<uint8_t>(nColumnAdd >> 4));
-	SendCommand(cmd::SET_STARTPAGE | nRow);
+	SetAddress(nColumnAdd, nRow);
 #endif
 }
 
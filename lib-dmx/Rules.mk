@@ -1,3 +1,10 @@
 $(info $$MAKE_FLAGS [${MAKE_FLAGS}])
 
-EXTRA_INCLUDES+=../lib-lightset/include
\ No newline at end of file
+EXTRA_INCLUDES+=../lib-lightset/include
+
+ifneq ($(MAKE_FLAGS),)
+	ifeq ($(findstring CONFIG_DMX_ENABLE_CAPTURE,$(MAKE_FLAGS)), CONFIG_DMX_ENABLE_CAPTURE)
+		EXTRA_SRCDIR+=src/capture
+		EXTRA_INCLUDES+=../lib-network/include
+	endif
+endif
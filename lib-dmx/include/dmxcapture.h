@@ -0,0 +1,233 @@
+/**
+ * @file dmxcapture.h
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef DMXCAPTURE_H_
+#define DMXCAPTURE_H_
+
+#include <cstdint>
+#include <cstddef>
+
+#include "dmx_config.h"
+
+/**
+ * Capture of every frame received, enabled with CONFIG_DMX_ENABLE_CAPTURE.
+ *
+ * The receive interrupt handler writes the frames with the timing into a ring
+ * buffer. A frame is recorded from the start code until the slot time-out, the
+ * maximum number of slots, or the next break. Frames are dropped (and counted)
+ * when the ring buffer is full.
+ *
+ * The capture is started with the UDP message "capture!start" on UDP_PORT, and
+ * is then sent to the IP address and port of the sender as a pcap stream
+ * (LINKTYPE_USER0). The first datagram is the pcap file header, so the datagrams
+ * written to a file in the order received is a valid pcap file.
+ * The packet data is the Record, without the unused slots.
+ */
+
+#if !defined (CONFIG_DMX_CAPTURE_ENTRIES)
+# define CONFIG_DMX_CAPTURE_ENTRIES	256
+#endif
+
+namespace dmx::capture {
+static constexpr uint32_t ENTRIES = CONFIG_DMX_CAPTURE_ENTRIES;
+static_assert((ENTRIES & (ENTRIES - 1)) == 0, "CONFIG_DMX_CAPTURE_ENTRIES must be a power of 2");
+static constexpr uint32_t MASK = ENTRIES - 1;
+static constexpr uint32_t SLOTS_MAX = 513;		///< Start code included
+static constexpr uint16_t UDP_PORT = 5121;
+static constexpr uint32_t LINKTYPE_USER0 = 147;
+static constexpr uint32_t DATAGRAM_SIZE = 1440;
+static constexpr uint32_t DATAGRAMS_PER_RUN = 4;
+
+/**
+ * The time values are in microseconds
+ */
+struct Record {
+	uint32_t nMicros;				///< Break detected
+	uint32_t nBreakToBreak;			///< 0 when there is no previous break
+	uint32_t nBreakToStartCode;		///< The UART can not separate the break and the MAB
+	uint32_t nSlotToSlotMin;		///< 0 when there is only the start code
+	uint32_t nSlotToSlotMax;
+	uint16_t nSlots;				///< Start code included
+	uint16_t nReserved;
+	uint8_t Data[SLOTS_MAX];
+};
+
+static constexpr uint32_t RECORD_HEADER_SIZE = offsetof(Record, Data);
+
+struct Statistics {
+	uint32_t nRecords;
+	uint32_t nDropped;		///< Ring buffer full
+	uint32_t nDatagrams;
+};
+}  // namespace dmx::capture
+
+class DmxCapture {
+public:
+	DmxCapture();
+	~DmxCapture();
+
+	void Start(const uint32_t nToIp, const uint16_t nToPort);
+	void Stop();
+
+	/**
+	 * @brief Sends the captured frames, at most DATAGRAMS_PER_RUN datagrams per call.
+	 */
+	void Run();
+
+	bool IsActive() const {
+		return sv_bActive;
+	}
+
+	const dmx::capture::Statistics& GetStatistics() const {
+		return s_Statistics;
+	}
+
+	void Print() const;
+
+	/*
+	 * Called from the receive interrupt handler only
+	 */
+
+	static void Break(const uint32_t nMicros) {
+		End();
+
+		s_nBreakToBreak = s_bBreak ? nMicros - s_nBreakMicros : 0;
+		s_nBreakMicros = nMicros;
+		s_bBreak = true;
+	}
+
+	/**
+	 * @param nTicks Elapsed timer ticks since the break was detected.
+	 */
+	static void StartCode(const uint8_t nStartCode, const uint32_t nTicks) {
+		if (!sv_bActive) {
+			return;
+		}
+
+		if (((sv_nHead + 1) & dmx::capture::MASK) == sv_nTail) {
+			s_Statistics.nDropped++;
+			return;
+		}
+
+		auto& record = s_Records[sv_nHead];
+
+		record.nMicros = s_nBreakMicros;
+		record.nBreakToBreak = s_nBreakToBreak;
+		record.nBreakToStartCode = nTicks;
+		record.nSlots = 1;
+		record.Data[0] = nStartCode;
+
+		s_nSlotToSlotMin = UINT32_MAX;
+		s_nSlotToSlotMax = 0;
+		s_bOpen = true;
+	}
+
+	/**
+	 * @param nTicks Elapsed timer ticks since the previous slot.
+	 */
+	static void Slot(const uint8_t nData, const uint32_t nTicks) {
+		if (!s_bOpen) {
+			return;
+		}
+
+		auto& record = s_Records[sv_nHead];
+
+		if (record.nSlots == dmx::capture::SLOTS_MAX) {
+			End();
+			return;
+		}
+
+		record.Data[record.nSlots++] = nData;
+
+		if (nTicks < s_nSlotToSlotMin) {
+			s_nSlotToSlotMin = nTicks;
+		}
+
+		if (nTicks > s_nSlotToSlotMax) {
+			s_nSlotToSlotMax = nTicks;
+		}
+	}
+
+	static void End() {
+		if (!s_bOpen) {
+			return;
+		}
+
+		s_bOpen = false;
+
+		auto& record = s_Records[sv_nHead];
+
+		record.nBreakToStartCode /= dmx::config::capture::TICKS_PER_US;
+
+		if (record.nSlots == 1) {
+			record.nSlotToSlotMin = 0;
+			record.nSlotToSlotMax = 0;
+		} else {
+			record.nSlotToSlotMin = s_nSlotToSlotMin / dmx::config::capture::TICKS_PER_US;
+			record.nSlotToSlotMax = s_nSlotToSlotMax / dmx::config::capture::TICKS_PER_US;
+		}
+
+		__sync_synchronize();
+		sv_nHead = (sv_nHead + 1) & dmx::capture::MASK;
+		s_Statistics.nRecords++;
+	}
+
+	static DmxCapture *Get() {
+		return s_pThis;
+	}
+
+private:
+	void Input(const uint8_t *pBuffer, uint32_t nSize, uint32_t nFromIp, uint16_t nFromPort);
+
+	void static StaticCallbackFunction(const uint8_t *pBuffer, uint32_t nSize, uint32_t nFromIp, uint16_t nFromPort) {
+		s_pThis->Input(pBuffer, nSize, nFromIp, nFromPort);
+	}
+
+private:
+	int32_t m_nHandle { -1 };
+	uint32_t m_nToIp { 0 };
+	uint16_t m_nToPort { 0 };
+	uint32_t m_nPreviousMicros { 0 };
+	uint32_t m_nSeconds { 0 };
+	uint32_t m_nMicros { 0 };		///< [0, 1000000)
+	bool m_bFirst { true };
+
+	static inline volatile bool sv_bActive;
+	static inline volatile uint32_t sv_nHead;
+	static inline volatile uint32_t sv_nTail;
+	static inline bool s_bOpen;
+	static inline bool s_bBreak;
+	static inline uint32_t s_nBreakMicros;
+	static inline uint32_t s_nBreakToBreak;
+	static inline uint32_t s_nSlotToSlotMin;
+	static inline uint32_t s_nSlotToSlotMax;
+	static inline dmx::capture::Statistics s_Statistics;
+	static inline dmx::capture::Record s_Records[dmx::capture::ENTRIES];
+	static inline uint8_t s_Datagram[dmx::capture::DATAGRAM_SIZE];
+
+	static inline DmxCapture *s_pThis;
+};
+
+#endif /* DMXCAPTURE_H_ */
@@ -2,7 +2,7 @@
  * @file dmx_config.h
  *
  */
-/* Copyright (C) 2023-2024 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2023-2025 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -45,5 +45,9 @@ static constexpr auto INDEX_ENTRIES = (1U << 1);
 static constexpr auto INDEX_MASK = (INDEX_ENTRIES - 1);
 } // namespace dmx::buffer
 
+namespace dmx::config::capture {
+static constexpr uint32_t TICKS_PER_US = 100;	///< H3_HS_TIMER
+} // namespace dmx::config::capture
+
 
 #endif /* H3_SINGLE_DMX_CONFIG_H_ */
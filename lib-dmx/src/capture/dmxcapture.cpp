@@ -0,0 +1,224 @@
+/**
+ * @file dmxcapture.cpp
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#if defined (DEBUG_DMX_CAPTURE)
+# undef NDEBUG
+#endif
+
+#if defined(__GNUC__) && !defined(__clang__)
+# pragma GCC push_options
+# pragma GCC optimize ("O2")
+# pragma GCC optimize ("no-tree-loop-distribute-patterns")
+#endif
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cassert>
+
+#include "dmxcapture.h"
+
+#include "network.h"
+
+#include "debug.h"
+
+namespace dmx::capture {
+struct PcapHeader {
+	uint32_t nMagic;
+	uint16_t nVersionMajor;
+	uint16_t nVersionMinor;
+	int32_t nThisZone;
+	uint32_t nSigFigs;
+	uint32_t nSnapLength;
+	uint32_t nNetwork;
+};
+
+struct PcapRecordHeader {
+	uint32_t nSeconds;
+	uint32_t nMicros;
+	uint32_t nIncludedLength;
+	uint32_t nOriginalLength;
+};
+
+static constexpr char CMD_START[] = "capture!start";
+static constexpr char CMD_STOP[] = "capture!stop";
+}  // namespace dmx::capture
+
+using namespace dmx::capture;
+
+DmxCapture::DmxCapture() {
+	DEBUG_ENTRY
+
+	assert(s_pThis == nullptr);
+	s_pThis = this;
+
+	m_nHandle = Network::Get()->Begin(UDP_PORT, DmxCapture::StaticCallbackFunction);
+	assert(m_nHandle != -1);
+
+	DEBUG_EXIT
+}
+
+DmxCapture::~DmxCapture() {
+	DEBUG_ENTRY
+
+	Stop();
+
+	Network::Get()->End(UDP_PORT);
+	m_nHandle = -1;
+
+	s_pThis = nullptr;
+
+	DEBUG_EXIT
+}
+
+void DmxCapture::Input(const uint8_t *pBuffer, uint32_t nSize, uint32_t nFromIp, uint16_t nFromPort) {
+	if ((nSize > 0) && (pBuffer[nSize - 1] == '\n')) {
+		nSize--;
+	}
+
+	if ((nSize == sizeof(CMD_START) - 1) && (memcmp(pBuffer, CMD_START, nSize) == 0)) {
+		Start(nFromIp, nFromPort);
+		return;
+	}
+
+	if ((nSize == sizeof(CMD_STOP) - 1) && (memcmp(pBuffer, CMD_STOP, nSize) == 0)) {
+		Stop();
+		return;
+	}
+}
+
+void DmxCapture::Start(const uint32_t nToIp, const uint16_t nToPort) {
+	DEBUG_ENTRY
+
+	/*
+	 * The interrupt handler does not open a record while not active,
+	 * a record still open is not committed.
+	 */
+	sv_bActive = false;
+	__sync_synchronize();
+	s_bOpen = false;
+	sv_nHead = 0;
+	sv_nTail = 0;
+	memset(&s_Statistics, 0, sizeof(struct Statistics));
+
+	m_nToIp = nToIp;
+	m_nToPort = nToPort;
+	m_bFirst = true;
+
+	PcapHeader header;
+	header.nMagic = 0xa1b2c3d4;
+	header.nVersionMajor = 2;
+	header.nVersionMinor = 4;
+	header.nThisZone = 0;
+	header.nSigFigs = 0;
+	header.nSnapLength = sizeof(struct Record);
+	header.nNetwork = LINKTYPE_USER0;
+
+	Network::Get()->SendTo(m_nHandle, &header, sizeof(struct PcapHeader), m_nToIp, m_nToPort);
+
+	__sync_synchronize();
+	sv_bActive = true;
+
+	DEBUG_PRINTF(IPSTR ":%u", IP2STR(nToIp), nToPort);
+	DEBUG_EXIT
+}
+
+void DmxCapture::Stop() {
+	DEBUG_ENTRY
+
+	sv_bActive = false;
+	__sync_synchronize();
+	s_bOpen = false;
+
+	DEBUG_EXIT
+}
+
+void DmxCapture::Run() {
+	if (!sv_bActive) {
+		return;
+	}
+
+	for (uint32_t nDatagrams = 0; nDatagrams < DATAGRAMS_PER_RUN; nDatagrams++) {
+		uint32_t nLength = 0;
+
+		while (sv_nTail != sv_nHead) {
+			const auto& record = s_Records[sv_nTail];
+			const auto nRecordLength = RECORD_HEADER_SIZE + record.nSlots;
+
+			if ((nLength + sizeof(struct PcapRecordHeader) + nRecordLength) > DATAGRAM_SIZE) {
+				break;
+			}
+
+			/*
+			 * The 32-bit microseconds are extended to the pcap seconds and microseconds
+			 */
+			if (m_bFirst) {
+				m_bFirst = false;
+				m_nSeconds = record.nMicros / 1000000U;
+				m_nMicros = record.nMicros % 1000000U;
+			} else {
+				const auto nDelta = record.nMicros - m_nPreviousMicros;
+				m_nMicros += nDelta % 1000000U;
+				m_nSeconds += nDelta / 1000000U;
+
+				if (m_nMicros >= 1000000U) {
+					m_nMicros -= 1000000U;
+					m_nSeconds++;
+				}
+			}
+
+			m_nPreviousMicros = record.nMicros;
+
+			PcapRecordHeader header;
+			header.nSeconds = m_nSeconds;
+			header.nMicros = m_nMicros;
+			header.nIncludedLength = nRecordLength;
+			header.nOriginalLength = nRecordLength;
+
+			memcpy(&s_Datagram[nLength], &header, sizeof(struct PcapRecordHeader));
+			nLength += sizeof(struct PcapRecordHeader);
+			memcpy(&s_Datagram[nLength], &record, nRecordLength);
+			nLength += nRecordLength;
+
+			__sync_synchronize();
+			sv_nTail = (sv_nTail + 1) & MASK;
+		}
+
+		if (nLength == 0) {
+			return;
+		}
+
+		Network::Get()->SendTo(m_nHandle, s_Datagram, nLength, m_nToIp, m_nToPort);
+		s_Statistics.nDatagrams++;
+	}
+}
+
+void DmxCapture::Print() const {
+	puts("DMX capture");
+	printf(" Port     : %u\n", static_cast<unsigned int>(UDP_PORT));
+	printf(" Entries  : %u\n", static_cast<unsigned int>(ENTRIES));
+	printf(" Active   : %s\n", sv_bActive ? "Yes" : "No");
+	printf(" Records  : %u (dropped %u)\n", static_cast<unsigned int>(s_Statistics.nRecords), static_cast<unsigned int>(s_Statistics.nDropped));
+}
@@ -2,7 +2,7 @@
  * @file dmx.cpp
  *
  */
-/* Copyright (C) 2018-2024 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2018-2025 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -34,6 +34,9 @@
 #include <cassert>
 
 #include "dmx.h"
+#if defined (CONFIG_DMX_ENABLE_CAPTURE)
+# include "dmxcapture.h"
+#endif
 #include "rdm.h"
 #include "rdm_e120.h"
 
@@ -145,6 +148,11 @@ static void irq_timer0_dmx_receive(uint32_t clo) {
 			sv_DmxReceiveState = IDLE;
 			s_DmxData[sv_nDmxDataBufferIndexHead].Statistics.nSlotsInPacket = sv_nDmxDataIndex - 1;
 			sv_nDmxDataBufferIndexHead = (sv_nDmxDataBufferIndexHead + 1) & buffer::INDEX_MASK;
+#if defined (CONFIG_DMX_ENABLE_CAPTURE)
+			__disable_fiq();
+			DmxCapture::End();
+			__enable_fiq();
+#endif
 		} else {
 			H3_TIMER->TMR0_INTV = s_DmxData[sv_nDmxDataBufferIndexHead].Statistics.nSlotToSlot * 12;
 			H3_TIMER->TMR0_CTRL |= (TIMER_CTRL_EN_START | TIMER_CTRL_RELOAD); // 0x3;
@@ -254,9 +262,23 @@ static void fiq_dmx_in_handler() {
 	if (EXT_UART->LSR & UART_LSR_BI) {
 		sv_DmxReceiveState = PRE_BREAK;
 		sv_DmxBreakToBreakLatest = sv_nFiqMicrosCurrent;
+#if defined (CONFIG_DMX_ENABLE_CAPTURE)
+		DmxCapture::Break(H3_TIMER->AVS_CNT1);
+#endif
 	} else if (EXT_UART->O08.IIR & UART_IIR_IID_RD) {
 		const auto data = static_cast<uint8_t>(EXT_UART->O00.RBR);
 
+#if defined (CONFIG_DMX_ENABLE_CAPTURE)
+		/*
+		 * The HS timer is counting down
+		 */
+		if (sv_DmxReceiveState == BREAK) {
+			DmxCapture::StartCode(data, sv_DmxBreakToBreakLatest - sv_nFiqMicrosCurrent);
+		} else if (sv_DmxReceiveState != PRE_BREAK) {
+			DmxCapture::Slot(data, sv_nFiqMicrosPrevious - sv_nFiqMicrosCurrent);
+		}
+#endif
+
 		switch (sv_DmxReceiveState) {
 		case IDLE:
 			sv_DmxReceiveState = RDMDISC;
@@ -308,6 +330,9 @@ static void fiq_dmx_in_handler() {
 				sv_DmxReceiveState = IDLE;
 				s_DmxData[sv_nDmxDataBufferIndexHead].Statistics.nSlotsInPacket = dmx::max::CHANNELS;
 				sv_nDmxDataBufferIndexHead = (sv_nDmxDataBufferIndexHead + 1) & buffer::INDEX_MASK;
+#if defined (CONFIG_DMX_ENABLE_CAPTURE)
+				DmxCapture::End();
+#endif
 				dmb();
 			}
 			break;
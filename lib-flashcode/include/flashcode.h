@@ -2,7 +2,7 @@
  * @file flashcode.h
  *
  */
-/* Copyright (C) 2021-2023 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2021-2025 by Arjan van Vught mailto:info@gd32-dmx.org
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -46,6 +46,10 @@ public:
 	const char* GetName() const;
 	uint32_t GetSize() const;
 	uint32_t GetSectorSize() const;
+	/**
+	 * @return the size of the erase sector at nOffset, a device can have sectors of different sizes.
+	 */
+	uint32_t GetSectorSize(const uint32_t nOffset) const;
 
 	bool Read(uint32_t nOffset, uint32_t nLength, uint8_t *pBuffer, flashcode::result& nResult);
 	bool Erase(uint32_t nOffset, uint32_t nLength, flashcode::result& nResult);
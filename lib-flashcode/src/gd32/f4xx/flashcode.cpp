@@ -2,7 +2,7 @@
  * @file flashcode.cpp
  *
  */
-/* Copyright (C) 2022 by Arjan van Vught mailto:info@gd32-dmx.nl
+/* Copyright (C) 2022-2025 by Arjan van Vught mailto:info@gd32-dmx.org
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -42,6 +42,19 @@ uint32_t FlashCode::GetSectorSize() const {
 	return SIZE_16KB;
 }
 
+/**
+ * The sectors are 16K, 64K and 128K (256K in bank 1).
+ */
+uint32_t FlashCode::GetSectorSize(const uint32_t nOffset) const {
+	const auto sector_info = fmc_sector_info_get(nOffset + FLASH_BASE);
+
+	if (FMC_WRONG_SECTOR_NAME == sector_info.sector_name) {
+		return 0;
+	}
+
+	return sector_info.sector_size;
+}
+
 bool FlashCode::Read(uint32_t nOffset, uint32_t nLength, uint8_t *pBuffer, flashcode::result& nResult) {
 	DEBUG_ENTRY
 	DEBUG_PRINTF("nOffset=%p[%d], nLength=%u[%d], data=%p[%d]", nOffset, (((uint32_t)(nOffset) & 0x3) == 0), nLength, (((uint32_t)(nLength) & 0x3) == 0), data, (((uint32_t)(data) & 0x3) == 0));
@@ -2,7 +2,7 @@
  * @file flashcode.cpp
  *
  */
-/* Copyright (C) 2021-2024 by Arjan van Vught mailto:info@gd32-dmx.org
+/* Copyright (C) 2021-2025 by Arjan van Vught mailto:info@gd32-dmx.org
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -72,6 +72,10 @@ uint32_t FlashCode::GetSectorSize() const {
 	return spi_flash_get_sector_size();
 }
 
+uint32_t FlashCode::GetSectorSize([[maybe_unused]] const uint32_t nOffset) const {
+	return spi_flash_get_sector_size();
+}
+
 bool FlashCode::Read(uint32_t nOffset, uint32_t nLength, uint8_t *pBuffer, flashcode::result& nResult) {
 	DEBUG_ENTRY
 
@@ -0,0 +1,190 @@
+/**
+ * @file flashcode.cpp
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cassert>
+
+#include "flashcode.h"
+
+#include "debug.h"
+
+/*
+ * Simulated NOR flash in a file, for testing the firmware install on a host.
+ * An erase sets the bytes to 0xFF, a write can only clear bits.
+ */
+
+namespace flashcode {
+static constexpr auto FLASH_SECTOR_SIZE = 4096U;
+static constexpr auto FLASH_SIZE = (512 * FLASH_SECTOR_SIZE);
+static constexpr char FLASH_FILE_NAME[] = "flashcode.bin";
+static constexpr char FLASH_NAME[] = "Simulated";
+
+static FILE *s_pFile;
+}  // namespace flashcode
+
+using namespace flashcode;
+
+FlashCode *FlashCode::s_pThis;
+
+FlashCode::FlashCode() {
+	DEBUG_ENTRY
+	assert(s_pThis == nullptr);
+	s_pThis = this;
+
+	if ((s_pFile = fopen(FLASH_FILE_NAME, "r+")) == nullptr) {
+		if ((s_pFile = fopen(FLASH_FILE_NAME, "w+")) == nullptr) {
+			perror("fopen");
+			DEBUG_EXIT
+			return;
+		}
+
+		for (uint32_t i = 0; i < FLASH_SIZE; i++) {
+			if (fputc(0xFF, s_pFile) == EOF) {
+				perror("fputc");
+				DEBUG_EXIT
+				return;
+			}
+		}
+
+		static_cast<void>(fflush(s_pFile));
+	}
+
+	m_IsDetected = true;
+
+	DEBUG_EXIT
+}
+
+FlashCode::~FlashCode() {
+	DEBUG_ENTRY
+
+	if (s_pFile != nullptr) {
+		static_cast<void>(fclose(s_pFile));
+		s_pFile = nullptr;
+	}
+
+	DEBUG_EXIT
+}
+
+const char *FlashCode::GetName() const {
+	return FLASH_NAME;
+}
+
+uint32_t FlashCode::GetSize() const {
+	return FLASH_SIZE;
+}
+
+uint32_t FlashCode::GetSectorSize() const {
+	return FLASH_SECTOR_SIZE;
+}
+
+uint32_t FlashCode::GetSectorSize([[maybe_unused]] const uint32_t nOffset) const {
+	return FLASH_SECTOR_SIZE;
+}
+
+bool FlashCode::Read(uint32_t nOffset, uint32_t nLength, uint8_t *pBuffer, flashcode::result& nResult) {
+	DEBUG_ENTRY
+	assert(s_pFile != nullptr);
+
+	if (((nOffset + nLength) > FLASH_SIZE) || (fseek(s_pFile, static_cast<long int>(nOffset), SEEK_SET) != 0) || (fread(pBuffer, 1, nLength, s_pFile) != nLength)) {
+		nResult = result::ERROR;
+		DEBUG_EXIT
+		return true;
+	}
+
+	nResult = result::OK;
+	DEBUG_EXIT
+	return true;
+}
+
+bool FlashCode::Erase(uint32_t nOffset, uint32_t nLength, flashcode::result& nResult) {
+	DEBUG_ENTRY
+	DEBUG_PRINTF("nOffset=%x, nLength=%x", nOffset, nLength);
+	assert(s_pFile != nullptr);
+
+	if ((nOffset % FLASH_SECTOR_SIZE) || (nLength % FLASH_SECTOR_SIZE) || ((nOffset + nLength) > FLASH_SIZE) || (fseek(s_pFile, static_cast<long int>(nOffset), SEEK_SET) != 0)) {
+		nResult = result::ERROR;
+		DEBUG_EXIT
+		return true;
+	}
+
+	for (uint32_t i = 0; i < nLength; i++) {
+		if (fputc(0xFF, s_pFile) == EOF) {
+			nResult = result::ERROR;
+			DEBUG_EXIT
+			return true;
+		}
+	}
+
+	static_cast<void>(fflush(s_pFile));
+
+	nResult = result::OK;
+	DEBUG_EXIT
+	return true;
+}
+
+bool FlashCode::Write(uint32_t nOffset, uint32_t nLength, const uint8_t *pBuffer, flashcode::result& nResult) {
+	DEBUG_ENTRY
+	DEBUG_PRINTF("nOffset=%x, nLength=%x", nOffset, nLength);
+	assert(s_pFile != nullptr);
+
+	if ((nOffset + nLength) > FLASH_SIZE) {
+		nResult = result::ERROR;
+		DEBUG_EXIT
+		return true;
+	}
+
+	uint8_t block[256];
+
+	while (nLength != 0) {
+		const auto nBlock = nLength < sizeof(block) ? nLength : static_cast<uint32_t>(sizeof(block));
+
+		if ((fseek(s_pFile, static_cast<long int>(nOffset), SEEK_SET) != 0) || (fread(block, 1, nBlock, s_pFile) != nBlock)) {
+			nResult = result::ERROR;
+			DEBUG_EXIT
+			return true;
+		}
+
+		for (uint32_t i = 0; i < nBlock; i++) {
+			block[i] &= pBuffer[i];
+		}
+
+		if ((fseek(s_pFile, static_cast<long int>(nOffset), SEEK_SET) != 0) || (fwrite(block, 1, nBlock, s_pFile) != nBlock)) {
+			nResult = result::ERROR;
+			DEBUG_EXIT
+			return true;
+		}
+
+		nOffset += nBlock;
+		pBuffer += nBlock;
+		nLength -= nBlock;
+	}
+
+	static_cast<void>(fflush(s_pFile));
+
+	nResult = result::OK;
+	DEBUG_EXIT
+	return true;
+}
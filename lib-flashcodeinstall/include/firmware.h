@@ -118,7 +118,7 @@ static constexpr auto FILE_NAME_LENGTH = sizeof(FILE_NAME) - 1;
 # define IH_LOAD			0x40000000
 # define IH_EP				0x40000000
 # define OFFSET_UIMAGE		0x0
-# define FIRMWARE_MAX_SIZE  4096	// for dummy.bin
+# define FIRMWARE_MAX_SIZE	0x22000			// 136K, simulated flash
 #endif
 
 bool firmware_install_start(const uint8_t *pBuffer, const uint32_t nBufferSize);
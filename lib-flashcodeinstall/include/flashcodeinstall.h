@@ -33,6 +33,17 @@
 
 #include "firmware.h" //TODO Remove
 
+namespace flashcodeinstall {
+static constexpr uint32_t COMPARE_SIZE = 256;
+static constexpr uint32_t HEADER_SIZE = 64;	///< The uImage header, written when the install is complete
+
+struct Statistics {
+	uint32_t nBytes;
+	uint32_t nSectors;
+	uint32_t nSectorsWritten;	///< Sectors which were different, erased and written
+};
+}  // namespace flashcodeinstall
+
 class FlashCodeInstall: FlashCode {
 public:
 	FlashCodeInstall();
@@ -40,6 +51,25 @@ public:
 
 	bool WriteFirmware(const uint8_t *pBuffer, uint32_t nSize);
 
+	/*
+	 * Streaming install, fed chunk by chunk.
+	 * Only the sectors which differ from the flash contents are erased and written.
+	 * An interrupted install can be restarted, the sectors already written are skipped.
+	 * The header is kept in RAM and written by InstallEnd, after the verify.
+	 */
+	bool InstallStart(const uint32_t nOffset, const uint32_t nMaxSize);
+	bool InstallAppend(const uint8_t *pData, uint32_t nLength);
+	bool InstallEnd();
+	void InstallAbort();
+
+	bool IsInstallRunning() const {
+		return m_bInstallRunning;
+	}
+
+	const struct flashcodeinstall::Statistics& GetStatistics() const {
+		return m_Statistics;
+	}
+
 	static FlashCodeInstall* Get() {
 		return s_pThis;
 	}
@@ -51,6 +81,9 @@ private:
 	bool Diff(uint32_t nOffset);
 	void Write(uint32_t nOffset);
 	void Process(const char *pFileName, uint32_t nOffset);
+	bool SectorIsEqual(const uint32_t nLength);
+	bool SectorFlush(const uint32_t nLength);
+	bool HeaderWrite();
 
 private:
 	uint32_t m_nEraseSize { 0 };
@@ -59,6 +92,17 @@ private:
 	uint8_t *m_pFlashBuffer { nullptr };
 	FILE *m_pFile { nullptr };
 
+	uint32_t m_nInstallStart { 0 };
+	uint32_t m_nInstallAddress { 0 };
+	uint32_t m_nInstallEnd { 0 };
+	uint32_t m_nInstallIndex { 0 };
+	uint32_t m_nInstallCrc { 0 };	///< Excludes the header
+	uint32_t m_nEraseEnd { 0 };		///< End of the last erased sector
+	bool m_bInstallRunning { false };
+
+	struct flashcodeinstall::Statistics m_Statistics;
+	uint8_t m_Header[flashcodeinstall::HEADER_SIZE];
+
 	bool m_bHaveFlashChip { false };
 
 	static FlashCodeInstall *s_pThis;
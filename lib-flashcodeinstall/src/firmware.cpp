@@ -23,86 +23,143 @@
  * THE SOFTWARE.
  */
 
-#ifdef NDEBUG
+#if defined (DEBUG_FIRMWARE)
 # undef NDEBUG
 #endif
 
 #include <cstdint>
+#include <cstdio>
 #include <cassert>
 #include <zlib.h>
 
 #include "firmware.h"
+#include "flashcodeinstall.h"
 #include "ubootheader.h"
+
 #include "debug.h"
 
+/*
+ * The firmware is streamed into the flash, chunk by chunk.
+ * A new start aborts an install which is still running,
+ * the sectors already written are skipped by the restart.
+ * The uImage header is written last, only when the data CRC is correct.
+ */
+
+static_assert(sizeof(struct TImageHeader) == flashcodeinstall::HEADER_SIZE);
+
 namespace firmware {
-enum class State {
-	IDLE, START, CONTINUE
-};
+static uint32_t s_nDataSize;
+static uint32_t s_nDataCrc;
+static uint32_t s_nCrc;
+static uint32_t s_nHeader;
+
+static bool install_append(const uint8_t *pBuffer, uint32_t nBufferSize) {
+	auto *pFlashCodeInstall = FlashCodeInstall::Get();
+
+	if (!pFlashCodeInstall->InstallAppend(pBuffer, nBufferSize)) {
+		return false;
+	}
+
+	// The data CRC excludes the header
+	if (s_nHeader != 0) {
+		const auto nSkip = nBufferSize < s_nHeader ? nBufferSize : s_nHeader;
+		pBuffer += nSkip;
+		nBufferSize -= nSkip;
+		s_nHeader -= nSkip;
+	}
 
-static auto s_State = State::IDLE;
-static uint32_t s_nCRC;
+	s_nCrc = crc32(s_nCrc, pBuffer, nBufferSize);
+
+	return true;
+}
 
 bool firmware_install_start(const uint8_t *pBuffer, const uint32_t nBufferSize) {
 	DEBUG_ENTRY
 	DEBUG_PRINTF("Firmware: Buffer = %p, Buffer size = %u", reinterpret_cast<const void *>(pBuffer), nBufferSize);
 
-	assert(s_State == State::IDLE);
-	s_State = State::START;
+	auto *pFlashCodeInstall = FlashCodeInstall::Get();
 
-	assert(sizeof(struct TImageHeader) <= nBufferSize);
+	if ((pFlashCodeInstall == nullptr) || (nBufferSize < sizeof(struct TImageHeader))) {
+		DEBUG_EXIT
+		return false;
+	}
 
 	UBootHeader uBootHeader(pBuffer);
-	uBootHeader.Dump();
-
-	const auto isValid = uBootHeader.IsValid();
-	DEBUG_PRINTF("Firmware is valid? %s", isValid ? "Yes" : "No");
 
-	if (!isValid) {
+	if (!uBootHeader.IsValid()) {
+		uBootHeader.Dump();
 		DEBUG_EXIT
 		return false;
 	}
 
-	const uint32_t nFirmwareChunk = nBufferSize - sizeof(struct TImageHeader);
+	const auto *pImageHeader = reinterpret_cast<const TImageHeader *>(pBuffer);
 
-	if (nFirmwareChunk > 0) {
-		DEBUG_PRINTF("Firmware: Chunk = %u", nFirmwareChunk);
+	s_nDataSize = __builtin_bswap32(pImageHeader->ih_size);
+	s_nDataCrc = __builtin_bswap32(pImageHeader->ih_dcrc);
+	s_nCrc = 0;
+	s_nHeader = sizeof(struct TImageHeader);
 
-		const auto *pFirmware = pBuffer + sizeof(struct TImageHeader);
+	if ((s_nDataSize + sizeof(struct TImageHeader)) > FIRMWARE_MAX_SIZE) {
+		printf("Error: Firmware size %u > %u\n", static_cast<unsigned int>(s_nDataSize + sizeof(struct TImageHeader)), static_cast<unsigned int>(FIRMWARE_MAX_SIZE));
+		DEBUG_EXIT
+		return false;
+	}
 
-		s_nCRC = crc32(0, pFirmware, nFirmwareChunk);
+	if (!pFlashCodeInstall->InstallStart(OFFSET_UIMAGE, FIRMWARE_MAX_SIZE)) {
+		DEBUG_EXIT
+		return false;
 	}
 
+	const auto isOk = install_append(pBuffer, nBufferSize);
+
 	DEBUG_EXIT
-	return true;
+	return isOk;
 }
 
 bool firmware_install_continue(const uint8_t *pBuffer, const uint32_t nBufferSize) {
-	DEBUG_ENTRY
 	DEBUG_PRINTF("Firmware: Buffer = %p, Buffer size = %u", reinterpret_cast<const void *>(pBuffer), nBufferSize);
 
-	assert((s_State == State::START) || (s_State == State::CONTINUE));
-	s_State = State::CONTINUE;
+	auto *pFlashCodeInstall = FlashCodeInstall::Get();
 
-	s_nCRC = crc32(s_nCRC, pBuffer, nBufferSize);
+	if ((pFlashCodeInstall == nullptr) || !pFlashCodeInstall->IsInstallRunning()) {
+		return false;
+	}
 
-	DEBUG_EXIT
-	return true;
+	return install_append(pBuffer, nBufferSize);
 }
 
+/**
+ * @param nBufferSize can be 0, when all data has been passed with start or continue.
+ */
 bool firmware_install_end(const uint8_t *pBuffer, const uint32_t nBufferSize) {
 	DEBUG_ENTRY
 	DEBUG_PRINTF("Firmware: Buffer = %p, Buffer size = %u", reinterpret_cast<const void *>(pBuffer), nBufferSize);
 
-	assert(s_State == State::CONTINUE);
-	s_State = State::IDLE;
+	auto *pFlashCodeInstall = FlashCodeInstall::Get();
+
+	if ((pFlashCodeInstall == nullptr) || !pFlashCodeInstall->IsInstallRunning()) {
+		DEBUG_EXIT
+		return false;
+	}
+
+	if ((nBufferSize != 0) && !install_append(pBuffer, nBufferSize)) {
+		DEBUG_EXIT
+		return false;
+	}
 
-	s_nCRC = crc32(s_nCRC, pBuffer, nBufferSize);
+	const auto nSize = pFlashCodeInstall->GetStatistics().nBytes;
 
-	DEBUG_PRINTF("CRC: %x", s_nCRC);
+	if ((nSize != (s_nDataSize + sizeof(struct TImageHeader))) || (s_nCrc != s_nDataCrc)) {
+		printf("Error: Firmware size %u, CRC %.8x != %.8x\n", static_cast<unsigned int>(nSize), static_cast<unsigned int>(s_nCrc), static_cast<unsigned int>(s_nDataCrc));
+		// Nothing more is written, the header included, so the image cannot be booted
+		pFlashCodeInstall->InstallAbort();
+		DEBUG_EXIT
+		return false;
+	}
+
+	const auto isOk = pFlashCodeInstall->InstallEnd();
 
 	DEBUG_EXIT
-	return true;
+	return isOk;
 }
-
 }  // namespace firmware
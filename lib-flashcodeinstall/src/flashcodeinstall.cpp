@@ -23,8 +23,11 @@
  * THE SOFTWARE.
  */
 
+#include <cstdint>
 #include <cstdio>
+#include <cstring>
 #include <cassert>
+#include <zlib.h>
 
 #include "flashcodeinstall.h"
 #include "firmware.h"
@@ -34,59 +37,323 @@
 
 #include "debug.h"
 
+using namespace flashcodeinstall;
+
 bool FlashCodeInstall::WriteFirmware(const uint8_t *pBuffer, uint32_t nSize) {
 	DEBUG_ENTRY
 
 	assert(pBuffer != nullptr);
 	assert(nSize != 0);
 
-	DEBUG_PRINTF("(%p + %p)=%p, m_nFlashSize=%u", OFFSET_UIMAGE, nSize, (OFFSET_UIMAGE + nSize), static_cast<unsigned int>(m_nFlashSize));
+	if (!InstallStart(OFFSET_UIMAGE, nSize)) {
+		DEBUG_EXIT
+		return false;
+	}
 
-	if ((OFFSET_UIMAGE + nSize) > m_nFlashSize) {
-		printf("Error: (OFFSET_UIMAGE + nSize) %u > m_nFlashSize %u\n", static_cast<unsigned int>(OFFSET_UIMAGE + nSize), static_cast<unsigned int>(m_nFlashSize));
+	if (!InstallAppend(pBuffer, nSize)) {
 		DEBUG_EXIT
 		return false;
 	}
 
-	const auto bWatchdog = Hardware::Get()->IsWatchdog();
+	DEBUG_EXIT
+	return InstallEnd();
+}
+
+bool FlashCodeInstall::InstallStart(const uint32_t nOffset, const uint32_t nMaxSize) {
+	DEBUG_ENTRY
+	DEBUG_PRINTF("nOffset=%x, nMaxSize=%x, m_nFlashSize=%x", nOffset, nMaxSize, m_nFlashSize);
 
-	if (bWatchdog) {
-		Hardware::Get()->WatchdogStop();
+	const auto nSectorSize = FlashCode::GetSectorSize();
+
+	assert((nOffset % nSectorSize) == 0);
+	assert((nOffset % FlashCode::GetSectorSize(nOffset)) == 0);
+
+	if ((nOffset + nMaxSize) > m_nFlashSize) {
+		printf("Error: (nOffset + nMaxSize) %u > m_nFlashSize %u\n", static_cast<unsigned int>(nOffset + nMaxSize), static_cast<unsigned int>(m_nFlashSize));
+		DEBUG_EXIT
+		return false;
 	}
 
-	puts("Write firmware");
+	if (m_pFileBuffer == nullptr) {
+		m_nEraseSize = nSectorSize;
+		m_pFileBuffer = new uint8_t[m_nEraseSize];
+		assert(m_pFileBuffer != nullptr);
+	}
 
-	const auto nSectorSize = FlashCode::GetSectorSize();
-	const auto nEraseSize = (nSize + nSectorSize - 1) & ~(nSectorSize - 1);
+	assert(m_nEraseSize == nSectorSize);
 
-	DEBUG_PRINTF("nSize=%x, nSectorSize=%x, nEraseSize=%x", nSize, nSectorSize, nEraseSize);
+	m_nInstallStart = nOffset;
+	m_nInstallAddress = nOffset;
+	m_nInstallEnd = nOffset + nMaxSize;
+	m_nInstallIndex = 0;
+	m_nInstallCrc = 0;
+	m_nEraseEnd = nOffset;
+	m_bInstallRunning = true;
 
-	Display::Get()->TextStatus("Erase", CONSOLE_GREEN);
+	memset(&m_Statistics, 0, sizeof(struct Statistics));
 
-	flashcode::result nResult;
+	puts("Install firmware");
+	Display::Get()->TextStatus("Install", CONSOLE_GREEN);
 
-	while(!FlashCode::Erase(OFFSET_UIMAGE, nEraseSize, nResult));
+	DEBUG_EXIT
+	return true;
+}
+
+bool FlashCodeInstall::InstallAppend(const uint8_t *pData, uint32_t nLength) {
+	assert(pData != nullptr);
+
+	if (!m_bInstallRunning) {
+		return false;
+	}
 
-	if (flashcode::result::ERROR == nResult) {
-		puts("Error: flash erase");
+	if ((m_nInstallAddress + m_nInstallIndex + nLength) > m_nInstallEnd) {
+		puts("Error: firmware too large");
+		m_bInstallRunning = false;
 		return false;
 	}
 
-	Display::Get()->TextStatus("Writing", CONSOLE_GREEN);
+	if (m_Statistics.nBytes >= HEADER_SIZE) {
+		m_nInstallCrc = crc32(m_nInstallCrc, pData, nLength);
+	} else if ((m_Statistics.nBytes + nLength) > HEADER_SIZE) {
+		const auto nSkip = HEADER_SIZE - m_Statistics.nBytes;
+		m_nInstallCrc = crc32(m_nInstallCrc, pData + nSkip, nLength - nSkip);
+	}
+
+	m_Statistics.nBytes += nLength;
 
-	while(!FlashCode::Write(OFFSET_UIMAGE, nSize, pBuffer, nResult));
+	while (nLength != 0) {
+		auto nCopy = m_nEraseSize - m_nInstallIndex;
 
-	if (flashcode::result::ERROR == nResult) {
-		puts("Error: flash write");
+		if (nCopy > nLength) {
+			nCopy = nLength;
+		}
+
+		memcpy(&m_pFileBuffer[m_nInstallIndex], pData, nCopy);
+
+		m_nInstallIndex += nCopy;
+		pData += nCopy;
+		nLength -= nCopy;
+
+		if (m_nInstallIndex == m_nEraseSize) {
+			if (!SectorFlush(m_nEraseSize)) {
+				m_bInstallRunning = false;
+				return false;
+			}
+
+			m_nInstallAddress += m_nEraseSize;
+			m_nInstallIndex = 0;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Flushes the last sector and verifies the CRC of the flash contents against the received data.
+ * The header is written only when the verify passes.
+ */
+bool FlashCodeInstall::InstallEnd() {
+	DEBUG_ENTRY
+
+	if (!m_bInstallRunning) {
+		DEBUG_EXIT
+		return false;
+	}
+
+	m_bInstallRunning = false;
+
+	if (m_Statistics.nBytes < HEADER_SIZE) {
+		puts("Error: firmware too small");
+		DEBUG_EXIT
+		return false;
+	}
+
+	if ((m_nInstallIndex != 0) && !SectorFlush(m_nInstallIndex)) {
+		Display::Get()->TextStatus("Error: flash", CONSOLE_RED);
+		DEBUG_EXIT
+		return false;
+	}
+
+	uint32_t buffer[COMPARE_SIZE / 4];
+	uint32_t nCrc = 0;
+
+	for (uint32_t nOffset = HEADER_SIZE; nOffset < m_Statistics.nBytes; nOffset += COMPARE_SIZE) {
+		auto nLength = m_Statistics.nBytes - nOffset;
+
+		if (nLength > COMPARE_SIZE) {
+			nLength = COMPARE_SIZE;
+		}
+
+		flashcode::result nResult;
+		FlashCode::Read(m_nInstallStart + nOffset, (nLength + 3U) & ~3U, reinterpret_cast<uint8_t *>(buffer), nResult);
+
+		if (flashcode::result::ERROR == nResult) {
+			puts("Error: flash read");
+			DEBUG_EXIT
+			return false;
+		}
+
+		nCrc = crc32(nCrc, reinterpret_cast<uint8_t *>(buffer), nLength);
+	}
+
+	Hardware::Get()->WatchdogFeed();
+
+	if (nCrc != m_nInstallCrc) {
+		printf("Error: CRC %.8x != %.8x\n", static_cast<unsigned int>(nCrc), static_cast<unsigned int>(m_nInstallCrc));
+		Display::Get()->TextStatus("Error: CRC", CONSOLE_RED);
+		DEBUG_EXIT
 		return false;
 	}
 
-	if (bWatchdog) {
-		Hardware::Get()->WatchdogInit();
+	if (!HeaderWrite()) {
+		Display::Get()->TextStatus("Error: flash", CONSOLE_RED);
+		DEBUG_EXIT
+		return false;
 	}
 
+	printf("%u bytes, %u of %u sectors written\n", static_cast<unsigned int>(m_Statistics.nBytes), static_cast<unsigned int>(m_Statistics.nSectorsWritten), static_cast<unsigned int>(m_Statistics.nSectors));
 	Display::Get()->TextStatus("Done", CONSOLE_GREEN);
 
 	DEBUG_EXIT
 	return true;
 }
+
+/**
+ * Nothing more is written, the header included.
+ * A restart only needs to write the remaining sectors.
+ */
+void FlashCodeInstall::InstallAbort() {
+	DEBUG_ENTRY
+
+	if (m_bInstallRunning) {
+		m_bInstallRunning = false;
+		Display::Get()->TextStatus("Error: aborted", CONSOLE_RED);
+	}
+
+	DEBUG_EXIT
+}
+
+bool FlashCodeInstall::SectorIsEqual(const uint32_t nLength) {
+	uint32_t buffer[COMPARE_SIZE / 4];
+
+	for (uint32_t nOffset = 0; nOffset < nLength; nOffset += COMPARE_SIZE) {
+		auto nCompare = nLength - nOffset;
+
+		if (nCompare > COMPARE_SIZE) {
+			nCompare = COMPARE_SIZE;
+		}
+
+		flashcode::result nResult;
+		FlashCode::Read(m_nInstallAddress + nOffset, (nCompare + 3U) & ~3U, reinterpret_cast<uint8_t *>(buffer), nResult);
+
+		if ((flashcode::result::ERROR == nResult) || (memcmp(&m_pFileBuffer[nOffset], buffer, nCompare) != 0)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * The buffer is flushed in the erase sector containing it.
+ * A sector which is larger than the buffer (GD32F4xx 64K and 128K) is erased once, at its first buffer.
+ * A sector which is the size of the buffer is only erased and written when it differs from the flash contents.
+ * The watchdog is kept alive.
+ */
+bool FlashCodeInstall::SectorFlush(const uint32_t nLength) {
+	DEBUG_PRINTF("m_nInstallAddress=%x, nLength=%u, m_nEraseEnd=%x", m_nInstallAddress, nLength, m_nEraseEnd);
+
+	m_Statistics.nSectors++;
+
+	Hardware::Get()->WatchdogFeed();
+
+	uint32_t nSkip = 0;	// The header is left erased, it is written last
+
+	if (m_nInstallAddress == m_nInstallStart) {
+		nSkip = nLength < HEADER_SIZE ? nLength : HEADER_SIZE;
+		memcpy(m_Header, m_pFileBuffer, nSkip);
+		memset(m_pFileBuffer, 0xFF, nSkip);
+	}
+
+	flashcode::result nResult;
+
+	if (m_nInstallAddress >= m_nEraseEnd) {
+		const auto nSectorSize = FlashCode::GetSectorSize(m_nInstallAddress);
+
+		if (nSectorSize == 0) {
+			puts("Error: flash sector");
+			return false;
+		}
+
+		if ((nSectorSize == m_nEraseSize) && SectorIsEqual(nLength)) {
+			return true;
+		}
+
+		while (!FlashCode::Erase(m_nInstallAddress, nSectorSize, nResult)) {
+			Hardware::Get()->WatchdogFeed();
+		}
+
+		if (flashcode::result::ERROR == nResult) {
+			puts("Error: flash erase");
+			return false;
+		}
+
+		m_nEraseEnd = m_nInstallAddress + nSectorSize;
+	}
+
+	Hardware::Get()->WatchdogFeed();
+
+	auto nWriteLength = nLength;
+
+	while ((nWriteLength & 0x3) != 0) {
+		m_pFileBuffer[nWriteLength++] = 0xFF;
+	}
+
+	if (nWriteLength > nSkip) {
+		while (!FlashCode::Write(m_nInstallAddress + nSkip, nWriteLength - nSkip, &m_pFileBuffer[nSkip], nResult)) {
+			Hardware::Get()->WatchdogFeed();
+		}
+
+		if (flashcode::result::ERROR == nResult) {
+			puts("Error: flash write");
+			return false;
+		}
+	}
+
+	Hardware::Get()->WatchdogFeed();
+
+	if (!SectorIsEqual(nLength)) {
+		puts("Error: flash verify");
+		return false;
+	}
+
+	m_Statistics.nSectorsWritten++;
+	Display::Get()->Progress();
+
+	return true;
+}
+
+bool FlashCodeInstall::HeaderWrite() {
+	DEBUG_ENTRY
+
+	flashcode::result nResult;
+
+	while (!FlashCode::Write(m_nInstallStart, HEADER_SIZE, m_Header, nResult)) {
+		Hardware::Get()->WatchdogFeed();
+	}
+
+	uint32_t buffer[HEADER_SIZE / 4];
+
+	if (flashcode::result::OK == nResult) {
+		FlashCode::Read(m_nInstallStart, HEADER_SIZE, reinterpret_cast<uint8_t *>(buffer), nResult);
+	}
+
+	if ((flashcode::result::ERROR == nResult) || (memcmp(m_Header, buffer, HEADER_SIZE) != 0)) {
+		puts("Error: flash header");
+		DEBUG_EXIT
+		return false;
+	}
+
+	DEBUG_EXIT
+	return true;
+}
@@ -55,6 +55,11 @@ FlashCodeInstall::FlashCodeInstall() {
 
 FlashCodeInstall::~FlashCodeInstall() {
 	DEBUG_ENTRY
+
+	if (m_pFileBuffer != nullptr) {
+		delete[] m_pFileBuffer;
+	}
+
 	DEBUG_EXIT
 }
 
@@ -5,7 +5,7 @@
 /*
  * Based on https://github.com/sparkfun/L6470-AutoDriver/tree/master/Libraries/Arduino
  */
-/* Copyright (C) 2017-2023 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2017-2025 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -33,6 +33,12 @@
 
 #include "l6470.h"
 
+namespace autodriver {
+static constexpr uint32_t CHIP_SELECTS = 2;
+static constexpr uint32_t BATCH_BOARDS_MAX = 8;	///< Boards at a higher position are not batched
+static constexpr uint32_t BATCH_BYTES_MAX = 8;	///< Per board, a full queue is flushed
+}  // namespace autodriver
+
 class AutoDriver final: public L6470 {
 public:
 	AutoDriver(uint8_t, uint8_t, uint8_t, uint8_t);
@@ -44,8 +50,28 @@ public:
 
 	void Print();
 
+	/**
+	 * @brief The commands are queued per board, instead of a full-chain transfer per byte.
+	 * The commands with a response flush the queue of the chain first.
+	 */
+	static void BeginBatch();
+
+	/**
+	 * @brief Sends the queued commands as the minimum number of full-chain transfers.
+	 * The boards with less bytes queued are padded with NOP.
+	 */
+	static void EndBatch();
+
 private:
 	uint8_t SPIXfer(uint8_t) override;
+	void beginResponse() override {
+		m_bResponse = true;
+	}
+	void endResponse() override {
+		m_bResponse = false;
+	}
+
+	static void Flush(const uint32_t nSpiChipSelect);
 
 	/*
 	 * Additional methods
@@ -70,8 +96,17 @@ private:
 	uint8_t m_nBusyPin;
 	uint8_t m_nPosition;
 	bool m_bIsBusy;
+	bool m_bResponse { false };
+
+	static uint8_t m_nNumBoards[autodriver::CHIP_SELECTS];
+
+	struct Batch {
+		uint8_t Data[autodriver::BATCH_BOARDS_MAX][autodriver::BATCH_BYTES_MAX];
+		uint8_t nLength[autodriver::BATCH_BOARDS_MAX];
+	};
 
-	static uint8_t m_nNumBoards[2];
+	static inline Batch s_Batch[autodriver::CHIP_SELECTS];
+	static inline bool s_bBatch;
 };
 
 #endif /* AUTODRIVER_H_ */
@@ -4,7 +4,7 @@
  * @file l6470.h
  *
  */
-/* Copyright (C) 2017-2020 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2017-2025 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -198,6 +198,11 @@ public:
 
 private:
 	virtual uint8_t SPIXfer(uint8_t)=0;
+	/**
+	 * Around the commands with a response, these are never batched
+	 */
+	virtual void beginResponse() {}
+	virtual void endResponse() {}
 
 private:
 	long paramHandler(uint8_t, unsigned long);
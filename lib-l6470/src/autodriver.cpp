@@ -5,7 +5,7 @@
 /*
  * Based on https://github.com/sparkfun/L6470-AutoDriver/tree/master/Libraries/Arduino
  */
-/* Copyright (C) 2017-2023 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2017-2025 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -27,6 +27,8 @@
  */
 
 #include <cstdint>
+#include <cstring>
+#include <algorithm>
 #include <cassert>
 
 #include "hal_spi.h"
@@ -40,7 +42,7 @@
 
 static constexpr uint8_t BUSY_PIN_NOT_USED = 0xFF;
 
-uint8_t AutoDriver::m_nNumBoards[2];
+uint8_t AutoDriver::m_nNumBoards[autodriver::CHIP_SELECTS];
 
 AutoDriver::AutoDriver(uint8_t nPosition, uint8_t nSpiChipSelect, uint8_t nResetPin, uint8_t nBusyPin) :
 	m_nSpiChipSelect(nSpiChipSelect),
@@ -113,6 +115,26 @@ int AutoDriver::busyCheck() {
 uint8_t AutoDriver::SPIXfer(uint8_t data) {
 	DEBUG_ENTRY
 
+	if (s_bBatch) {
+		if (!m_bResponse && (m_nPosition < autodriver::BATCH_BOARDS_MAX)) {
+			auto& batch = s_Batch[m_nSpiChipSelect];
+
+			if (batch.nLength[m_nPosition] == autodriver::BATCH_BYTES_MAX) {
+				Flush(m_nSpiChipSelect);
+			}
+
+			batch.Data[m_nPosition][batch.nLength[m_nPosition]++] = data;
+
+			DEBUG_EXIT
+			return 0;
+		}
+
+		/*
+		 * Keep the order of the commands on the chain
+		 */
+		Flush(m_nSpiChipSelect);
+	}
+
 	char dataPacket[m_nNumBoards[m_nSpiChipSelect]];
 
 	for (uint32_t i = 0; i < m_nNumBoards[m_nSpiChipSelect]; i++) {
@@ -131,8 +153,61 @@ uint8_t AutoDriver::SPIXfer(uint8_t data) {
 	return static_cast<uint8_t>(dataPacket[m_nPosition]);
 }
 
+/*
+ * Each byte of a full-chain transfer is latched by the chip select going high,
+ * so a chain transfer is needed per byte of the longest command queue.
+ */
+void AutoDriver::Flush(const uint32_t nSpiChipSelect) {
+	auto& batch = s_Batch[nSpiChipSelect];
+	const auto nNumBoards = m_nNumBoards[nSpiChipSelect];
+	const auto nBatchBoards = std::min(static_cast<uint32_t>(nNumBoards), autodriver::BATCH_BOARDS_MAX);
+	uint32_t nTransfers = 0;
+
+	for (uint32_t i = 0; i < nBatchBoards; i++) {
+		nTransfers = std::max(nTransfers, static_cast<uint32_t>(batch.nLength[i]));
+	}
+
+	if (nTransfers == 0) {
+		return;
+	}
+
+	char dataPacket[nNumBoards];
+
+	FUNC_PREFIX(spi_chipSelect(static_cast<uint8_t>(nSpiChipSelect)));
+	FUNC_PREFIX(spi_set_speed_hz(2000000));
+	FUNC_PREFIX(spi_setDataMode(SPI_MODE3));
+
+	for (uint32_t nTransfer = 0; nTransfer < nTransfers; nTransfer++) {
+		for (uint32_t i = 0; i < nNumBoards; i++) {
+			if ((i < nBatchBoards) && (nTransfer < batch.nLength[i])) {
+				dataPacket[i] = static_cast<char>(batch.Data[i][nTransfer]);
+			} else {
+				dataPacket[i] = static_cast<char>(L6470_CMD_NOP);
+			}
+		}
+
+		FUNC_PREFIX(spi_transfern(dataPacket, nNumBoards));
+	}
+
+	memset(batch.nLength, 0, sizeof(batch.nLength));
+
+	DEBUG_PRINTF("nSpiChipSelect=%u, nTransfers=%u", static_cast<unsigned int>(nSpiChipSelect), static_cast<unsigned int>(nTransfers));
+}
+
 #pragma GCC diagnostic pop
 
+void AutoDriver::BeginBatch() {
+	s_bBatch = true;
+}
+
+void AutoDriver::EndBatch() {
+	for (uint32_t nSpiChipSelect = 0; nSpiChipSelect < autodriver::CHIP_SELECTS; nSpiChipSelect++) {
+		Flush(nSpiChipSelect);
+	}
+
+	s_bBatch = false;
+}
+
 uint16_t AutoDriver::getNumBoards() {
 	uint16_t n = 0;
 
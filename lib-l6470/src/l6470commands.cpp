@@ -2,7 +2,7 @@
  * @file l6470commands.cpp
  *
  */
-/* Copyright (C) 2017-2020 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2017-2025 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -34,9 +34,13 @@ void L6470::setParam(TL6470ParamRegisters param, unsigned long value) {
 }
 
 long L6470::getParam(TL6470ParamRegisters param) {
+	beginResponse();
+
 	SPIXfer(param | L6470_CMD_GET_PARAM);
+	const auto nValue = paramHandler(param, 0);
 
-	return paramHandler(param, 0);
+	endResponse();
+	return nValue;
 }
 
 long L6470::getPos() {
@@ -180,10 +184,13 @@ void L6470::hardHiZ() {
 int L6470::getStatus() {
 	int temp = 0;
 
+	beginResponse();
+
 	auto *bytePointer = reinterpret_cast<uint8_t*>(&temp);
 	SPIXfer(L6470_CMD_GET_STATUS);
 	bytePointer[1] = SPIXfer(0);
 	bytePointer[0] = SPIXfer(0);
 
+	endResponse();
 	return temp;
 }
@@ -0,0 +1,228 @@
+/**
+ * @file test_autodriver.cpp
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * The SPI stub records the bytes of every chip select frame. Three boards are
+ * daisy-chained on chip select 0 and one board is on chip select 1.
+ * The batched commands are checked for the number of frames, the bytes per
+ * board, the NOP padding and the flush before a command with a response.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "autodriver.h"
+#include "l6470constants.h"
+
+#include "test.h"
+
+namespace {
+struct Frame {
+	uint8_t nChipSelect;
+	std::vector<uint8_t> data;
+};
+
+std::vector<Frame> s_Frames;
+std::vector<uint8_t> s_Reply;
+uint32_t s_nSetups;
+uint8_t s_nChipSelect;
+
+void reset() {
+	s_Frames.clear();
+	s_Reply.clear();
+	s_nSetups = 0;
+}
+
+/*
+ * The bytes for the board at nPosition, one per frame
+ */
+std::vector<uint8_t> board(const uint8_t nChipSelect, const uint32_t nPosition) {
+	std::vector<uint8_t> bytes;
+
+	for (const auto& frame : s_Frames) {
+		if ((frame.nChipSelect == nChipSelect) && (nPosition < frame.data.size())) {
+			bytes.push_back(frame.data[nPosition]);
+		}
+	}
+
+	return bytes;
+}
+
+bool frames_are_chain_length(const uint8_t nChipSelect, const uint32_t nLength) {
+	for (const auto& frame : s_Frames) {
+		if ((frame.nChipSelect == nChipSelect) && (frame.data.size() != nLength)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+const std::vector<uint8_t> GOTO { L6470_CMD_GOTO, 0x12, 0x34, 0x56 };
+
+void test_direct() {
+	AutoDriver a(0, 0, 0), b(1, 0, 0), c(2, 0, 0), d(0, 1, 0);
+
+	reset();
+	a.goTo(0x123456);
+	b.softStop();
+	d.hardHiZ();
+
+	// A full-chain frame per byte
+	CHECK(s_Frames.size() == 6);
+	CHECK(frames_are_chain_length(0, 3));
+	CHECK(frames_are_chain_length(1, 1));
+	CHECK(board(0, 0) == std::vector<uint8_t>({ L6470_CMD_GOTO, 0x12, 0x34, 0x56, L6470_CMD_NOP }));
+	CHECK(board(0, 1) == std::vector<uint8_t>({ L6470_CMD_NOP, L6470_CMD_NOP, L6470_CMD_NOP, L6470_CMD_NOP, L6470_CMD_SOFT_STOP }));
+	CHECK(board(1, 0) == std::vector<uint8_t>({ L6470_CMD_HARD_HIZ }));
+	CHECK(s_nSetups == 6);
+}
+
+void test_batch() {
+	AutoDriver a(0, 0, 0), b(1, 0, 0), c(2, 0, 0), d(0, 1, 0);
+
+	reset();
+	c.run(L6470_DIR_FWD, 100);
+	const auto run = board(0, 2);
+	CHECK(run.size() == 4);
+	CHECK(run[0] == (L6470_CMD_RUN | L6470_DIR_FWD));
+
+	reset();
+	AutoDriver::BeginBatch();
+	a.goTo(0x123456);
+	b.softStop();
+	c.run(L6470_DIR_FWD, 100);
+	d.hardHiZ();
+
+	CHECK(s_Frames.empty());
+
+	AutoDriver::EndBatch();
+
+	// The longest queue is 4 bytes, a frame per byte. The set-up once per chip select.
+	CHECK(s_Frames.size() == 5);
+	CHECK(frames_are_chain_length(0, 3));
+	CHECK(frames_are_chain_length(1, 1));
+	CHECK(s_nSetups == 2);
+	CHECK(board(0, 0) == GOTO);
+	CHECK(board(0, 1) == std::vector<uint8_t>({ L6470_CMD_SOFT_STOP, L6470_CMD_NOP, L6470_CMD_NOP, L6470_CMD_NOP }));
+	CHECK(board(0, 2) == run);
+	CHECK(board(1, 0) == std::vector<uint8_t>({ L6470_CMD_HARD_HIZ }));
+
+	// Nothing queued, nothing sent
+	reset();
+	AutoDriver::BeginBatch();
+	AutoDriver::EndBatch();
+
+	CHECK(s_Frames.empty());
+	CHECK(s_nSetups == 0);
+}
+
+void test_response() {
+	AutoDriver a(0, 0, 0), b(1, 0, 0), c(2, 0, 0), d(0, 1, 0);
+
+	reset();
+	// The flush, the command and then the 3 bytes of ABS_POS
+	s_Reply = { 0x00, 0x00, 0x12, 0x34, 0x56 };
+
+	AutoDriver::BeginBatch();
+	a.softStop();
+	d.softStop();
+	const auto nPosition = b.getPos();
+	c.softStop();
+	AutoDriver::EndBatch();
+
+	CHECK(nPosition == 0x123456);
+
+	// The queue of chip select 0 is sent before the command with a response
+	CHECK(s_Frames.size() == 7);
+	CHECK(s_Frames[0].nChipSelect == 0);
+	CHECK(s_Frames[0].data == std::vector<uint8_t>({ L6470_CMD_SOFT_STOP, L6470_CMD_NOP, L6470_CMD_NOP }));
+	CHECK(s_Frames[1].data == std::vector<uint8_t>({ L6470_CMD_NOP, L6470_CMD_GET_PARAM | L6470_PARAM_ABS_POS, L6470_CMD_NOP }));
+	CHECK(board(0, 1).size() == 6);
+	CHECK(s_Frames[5].nChipSelect == 0);
+	CHECK(s_Frames[5].data == std::vector<uint8_t>({ L6470_CMD_NOP, L6470_CMD_NOP, L6470_CMD_SOFT_STOP }));
+	// The other chip select is not flushed
+	CHECK(s_Frames[6].nChipSelect == 1);
+	CHECK(s_Frames[6].data == std::vector<uint8_t>({ L6470_CMD_SOFT_STOP }));
+}
+
+void test_full_queue() {
+	AutoDriver a(0, 0, 0), b(1, 0, 0), c(2, 0, 0), d(0, 1, 0);
+
+	reset();
+	AutoDriver::BeginBatch();
+
+	for (uint32_t i = 0; i < 3; i++) {
+		a.goTo(0x123456);
+	}
+
+	// The full queue of 8 bytes is sent before the 9th byte is queued
+	CHECK(s_Frames.size() == autodriver::BATCH_BYTES_MAX);
+
+	AutoDriver::EndBatch();
+
+	CHECK(s_Frames.size() == 3 * GOTO.size());
+	CHECK(frames_are_chain_length(0, 3));
+	CHECK(s_nSetups == 2);
+
+	std::vector<uint8_t> expected;
+
+	for (uint32_t i = 0; i < 3; i++) {
+		expected.insert(expected.end(), GOTO.begin(), GOTO.end());
+	}
+
+	CHECK(board(0, 0) == expected);
+	CHECK(board(0, 1) == std::vector<uint8_t>(expected.size(), L6470_CMD_NOP));
+}
+}  // namespace
+
+void spi_chipSelect(uint8_t nChipSelect) {
+	s_nChipSelect = nChipSelect;
+	s_nSetups++;
+}
+
+void spi_set_speed_hz(uint32_t) {}
+void spi_setDataMode(uint8_t) {}
+
+void spi_transfern(char *pData, uint32_t nLength) {
+	s_Frames.push_back({ s_nChipSelect, std::vector<uint8_t>(reinterpret_cast<uint8_t *>(pData), reinterpret_cast<uint8_t *>(pData) + nLength) });
+
+	const auto nIndex = s_Frames.size() - 1;
+	const auto nReply = nIndex < s_Reply.size() ? s_Reply[nIndex] : 0;
+
+	for (uint32_t i = 0; i < nLength; i++) {
+		pData[i] = static_cast<char>(nReply);
+	}
+}
+
+int main() {
+	test_direct();
+	test_batch();
+	test_response();
+	test_full_queue();
+
+	return test::result();
+}
@@ -2,7 +2,7 @@
  * @file sparkfundmx.cpp
  *
  */
-/* Copyright (C) 2017-2024 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2017-2025 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -359,12 +359,19 @@ void SparkFunDmx::SetData([[maybe_unused]] uint32_t nPortIndex, const uint8_t *p
 		}
 	}
 
+	/*
+	 * The commands for all the motors go out as full-chain transfers
+	 */
+	AutoDriver::BeginBatch();
+
 	for (int i = 0; i < SPARKFUN_DMX_MAX_MOTORS; i++) {
 		if (bIsDmxDataChanged[i]) {
 			m_pL6470DmxModes[i]->DmxData(pData, nLength);
 		}
 	}
 
+	AutoDriver::EndBatch();
+
 	DEBUG_EXIT;
 }
 
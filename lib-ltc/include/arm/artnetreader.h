@@ -32,6 +32,7 @@
 #include "midi.h"
 
 #include "ltcoutputs.h"
+#include "ltcchase.h"
 
 #include "hardware.h"
 
@@ -42,6 +43,8 @@ public:
 	ArtNetReader() {
 		assert(s_pThis == nullptr);
 		s_pThis = this;
+
+		m_Chase.SetCallback(StaticCallbackFunctionChase);
 	}
 
 	~ArtNetReader() = default;
@@ -50,9 +53,9 @@ public:
 	void Stop();
 
 	void Run() {
-		const auto nTimeStamp = Hardware::Get()->Millis();
+		m_Chase.Run(Hardware::Get()->Micros());
 
-		if ((nTimeStamp - m_nTimestamp) >= 50U) {
+		if (!m_Chase.IsRunning()) {
 			LtcOutputs::Get()->ShowSysTime();
 			Hardware::Get()->SetMode(hardware::ledblink::Mode::NORMAL);
 			Reset(true);
@@ -67,8 +70,18 @@ public:
 		s_pThis->Handler(pTimeCode);
 	}
 
+	void Print() {
+		m_Chase.Print();
+	}
+
 private:
+	void static StaticCallbackFunctionChase(const struct ltc::TimeCode *pTimeCode) {
+		assert(s_pThis != nullptr);
+		s_pThis->Output(pTimeCode);
+	}
+
 	void Handler(const struct artnet::TimeCode *);
+	void Output(const struct ltc::TimeCode *);
 
 	void Reset(const bool doReset) {
 		if (m_doResetTimeCode != doReset) {
@@ -80,7 +93,7 @@ private:
 	}
 
 private:
-	uint32_t m_nTimestamp { 0 };
+	LtcChase m_Chase;
 	bool m_doResetTimeCode { true };
 	static inline ArtNetReader *s_pThis;
 };
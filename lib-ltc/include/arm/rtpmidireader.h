@@ -2,7 +2,7 @@
  * @file rtpmidireader.h
  *
  */
-/* Copyright (C) 2019-2024 by Arjan van Vught mailto:info@gd32-dmx.org
+/* Copyright (C) 2019-2025 by Arjan van Vught mailto:info@gd32-dmx.org
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -27,32 +27,59 @@
 #define ARM_RTPMIDIREADER_H_
 
 #include <cstdint>
+#include <cassert>
 
 #include "net/rtpmidihandler.h"
 #include "ltc.h"
+#include "ltcchase.h"
 
 #include "midibpm.h"
 
+/**
+ * Playing forward, the quarter frame timecode is passed through the chase engine,
+ * which filters out the network jitter. The chase engine does not run backwards,
+ * so playing backwards the frames are regenerated from the hardware timer.
+ */
+
 class RtpMidiReader final : public RtpMidiHandler {
 public:
+	RtpMidiReader() {
+		assert(s_pThis == nullptr);
+		s_pThis = this;
+
+		m_Chase.SetCallback(StaticCallbackFunctionChase);
+	}
+
 	void Start();
 	void Stop();
 	void Run();
 
 	void MidiMessage(const struct midi::Message *ptMidiMessage) override;
 
+	void Print() {
+		m_Chase.Print();
+	}
+
 private:
+	void static StaticCallbackFunctionChase(const struct ltc::TimeCode *pTimeCode) {
+		assert(s_pThis != nullptr);
+		s_pThis->Update(pTimeCode);
+	}
+
 	void HandleMtc(const struct midi::Message *ptMidiMessage);
 	void HandleMtcQf(const struct midi::Message *ptMidiMessage);
-	void Update();
+	void Update(const struct ltc::TimeCode *pTimeCode);
 
 private:
+	LtcChase m_Chase;
 	struct ltc::TimeCode m_LtcTimeCode;
 	uint8_t m_nPartPrevious { 0 };
 	bool m_bDirection { true };
 	uint32_t m_nMtcQfFramePrevious { 0 };
 	uint32_t m_nMtcQfFramesDelta { 0 };
 	MidiBPM m_MidiBPM;
+
+	static inline RtpMidiReader *s_pThis;
 };
 
 #endif /* ARM_RTPMIDIREADER_H_ */
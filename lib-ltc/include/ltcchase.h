@@ -0,0 +1,157 @@
+/**
+ * @file ltcchase.h
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef LTCCHASE_H_
+#define LTCCHASE_H_
+
+#include <cstdint>
+
+#include "ltc.h"
+
+/**
+ * Timecode chase engine, placed between a reader and the outputs.
+ *
+ * The position and the rate of the source are estimated with an alpha-beta
+ * filter (a second order PLL) on the arrival time of each frame. The outputs
+ * are driven from the estimate, evaluated at a fixed rate, so that the
+ * network jitter of the source does not show up at the outputs.
+ * When the input stops, the engine freewheels at the estimated rate.
+ * While not locked, the frames are passed through unchanged.
+ */
+
+namespace ltc::chase {
+/*
+ * Fixed point fraction bits for positions (frames) and rates (frames per second)
+ */
+static constexpr uint32_t Q = 16;
+static constexpr uint32_t OUTPUT_INTERVAL_MICROS = 1000;
+
+enum class State : uint8_t {
+	IDLE, LOCKING, LOCKED, FREEWHEEL
+};
+
+struct Config {
+	uint16_t nLockFrames;		///< Consecutive frames within the window before locking
+	uint16_t nUnlockFrames;		///< Consecutive frames outside the window before relocking
+	uint16_t nWindow;			///< Phase error window in 1/256 frame
+	uint16_t nFreewheelMillis;	///< Time to continue after the input has stopped
+	uint8_t nPhaseShift;		///< Phase gain 1/2^n
+	uint8_t nRateShift;			///< Rate gain 1/2^n
+};
+
+static constexpr struct Config CONFIG_DEFAULT = { 8, 3, 384, 2000, 5, 10 };
+
+struct Statistics {
+	uint32_t nFrames;
+	uint32_t nOutliers;			///< Frames outside the window
+	uint32_t nLocks;
+	uint32_t nUnlocks;			///< Relocks after consecutive outliers
+	uint32_t nFreewheels;
+	uint32_t nDropouts;			///< Freewheel time expired
+	uint32_t nOutputs;
+	uint32_t nJitterMicros;		///< Average absolute phase error
+	uint32_t nJitterMaxMicros;
+	int32_t nDriftPpm;			///< Estimated rate relative to the nominal rate
+};
+
+uint32_t frames_per_second(const ltc::Type type);
+uint32_t to_frames(const struct ltc::TimeCode& timeCode);
+void from_frames(uint32_t nFrames, const ltc::Type type, struct ltc::TimeCode& timeCode);
+}  // namespace ltc::chase
+
+typedef void (*LtcChaseCallbackFunctionPtr)(const struct ltc::TimeCode *);
+
+class LtcChase {
+public:
+	LtcChase(const struct ltc::chase::Config& config = ltc::chase::CONFIG_DEFAULT);
+
+	void Reset();
+
+	/**
+	 * A decoded frame from the reader.
+	 * @param nMicros Arrival time
+	 */
+	void Input(const struct ltc::TimeCode *pTimeCode, const uint32_t nMicros);
+
+	/**
+	 * Called from the main loop. The outputs are updated when the frame changes.
+	 */
+	void Run(const uint32_t nMicros);
+
+	void SetCallback(LtcChaseCallbackFunctionPtr pLtcChaseCallbackFunctionPtr) {
+		m_pLtcChaseCallbackFunctionPtr = pLtcChaseCallbackFunctionPtr;
+	}
+
+	ltc::chase::State GetState() const {
+		return m_State;
+	}
+
+	bool IsRunning() const {
+		return m_State != ltc::chase::State::IDLE;
+	}
+
+	/**
+	 * @return Position within the last output frame in 1/256 frame.
+	 */
+	uint32_t GetSubFrame() const {
+		return m_nSubFrame;
+	}
+
+	const struct ltc::chase::Statistics& GetStatistics() const {
+		return m_Statistics;
+	}
+
+	void Print();
+
+private:
+	int64_t Predict(const uint32_t nMicros) const;
+	int64_t Wrap(int64_t nDelta) const;
+	int64_t Normalize(int64_t nPosition) const;
+	void Acquire(const uint32_t nFrame, const uint32_t nMicros);
+	void Output(const uint32_t nFrame);
+
+private:
+	struct ltc::chase::Config m_Config;
+	int64_t m_nPosition { 0 };		///< Estimated position at m_nMicros (Q16 frames)
+	int64_t m_nRate { 0 };			///< Estimated rate (Q16 frames per second)
+	int64_t m_nRateNominal { 0 };
+	int64_t m_nFramesPerDay { 0 };
+	uint32_t m_nMicros { 0 };		///< Time of the last estimate update
+	uint32_t m_nMicrosInput { 0 };
+	uint32_t m_nMicrosOutput { 0 };
+	uint32_t m_nFrameOutput { 0 };
+	uint32_t m_nSubFrame { 0 };
+	uint32_t m_nInRange { 0 };
+	uint32_t m_nOutOfRange { 0 };
+	ltc::Type m_Type { ltc::Type::UNKNOWN };
+	ltc::chase::State m_State { ltc::chase::State::IDLE };
+	bool m_bOutputValid { false };
+
+	struct ltc::chase::Statistics m_Statistics;
+
+	LtcChaseCallbackFunctionPtr m_pLtcChaseCallbackFunctionPtr { nullptr };
+};
+
+#endif /* LTCCHASE_H_ */
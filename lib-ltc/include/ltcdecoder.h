@@ -0,0 +1,150 @@
+/**
+ * @file ltcdecoder.h
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef LTCDECODER_H_
+#define LTCDECODER_H_
+
+#include <cstdint>
+
+#include "ltc.h"
+
+/**
+ * Software LTC decoder for sampled audio (codec input, WAV stream).
+ *
+ * The samples are processed block-wise with a fixed cost per sample.
+ * The biphase-mark decoder uses the time between zero crossings only,
+ * so the polarity of the signal is irrelevant. The bit period is tracked
+ * continuously, allowing playback speeds from 0.5x up to 2x.
+ * Both forward and reverse playback are detected by the sync word.
+ */
+
+namespace ltc::decoder {
+static constexpr uint32_t SAMPLE_RATE = 48000;
+static constexpr uint32_t FORMAT_SIZE_BITS = 80;
+static constexpr uint16_t SYNC_WORD_FORWARD = 0x3FFD;
+static constexpr uint16_t SYNC_WORD_REVERSE = 0xBFFC;
+/*
+ * Fixed point fraction bits for sample positions and periods
+ */
+static constexpr uint32_t Q = 8;
+
+struct Frame {
+	struct ltc::TimeCode TimeCode;
+	uint64_t nSampleStart;		///< Stream position of the first edge of the frame (Q8)
+	uint64_t nSampleEnd;		///< Stream position of the last edge of the frame (Q8)
+	uint32_t nUserBits;
+	bool bReverse;
+};
+
+struct Statistics {
+	uint32_t nFrames;
+	uint32_t nInvalidFrames;	///< Sync word found, but BCD out of range
+	uint32_t nBiphaseErrors;	///< A half bit period not followed by a half bit period
+	uint32_t nResyncs;			///< Bit period re-acquired
+	uint32_t nDropouts;			///< Signal lost (squelch or time-out)
+};
+}  // namespace ltc::decoder
+
+typedef void (*LtcDecoderCallbackFunctionPtr)(const struct ltc::decoder::Frame *);
+
+class LtcDecoder {
+public:
+	LtcDecoder(uint32_t nSampleRate = ltc::decoder::SAMPLE_RATE);
+
+	void Reset();
+
+	/**
+	 * Feed a block of mono 16-bit signed samples.
+	 * The callback is called for each decoded frame.
+	 */
+	void Process(const int16_t *pSamples, uint32_t nSamples);
+
+	void SetCallback(LtcDecoderCallbackFunctionPtr pLtcDecoderCallbackFunctionPtr) {
+		m_pLtcDecoderCallbackFunctionPtr = pLtcDecoderCallbackFunctionPtr;
+	}
+
+	bool IsLocked() const {
+		return m_bLocked;
+	}
+
+	/**
+	 * @return Position since the start of the last decoded frame in 1/256 frame.
+	 * 256 is one frame duration after the start.
+	 */
+	uint32_t GetSubFrame() const;
+
+	/**
+	 * @return Playback speed relative to the nominal rate of the detected type in 1/256.
+	 */
+	uint32_t GetSpeed() const;
+
+	ltc::Type GetType() const {
+		return m_Type;
+	}
+
+	const struct ltc::decoder::Statistics& GetStatistics() const {
+		return m_Statistics;
+	}
+
+	void Print();
+
+private:
+	void Edge(const uint64_t nEdge);
+	void Bit(const uint32_t nBit, const uint64_t nEdge);
+	void DecodeFrame(const bool bReverse, const uint64_t nEdge);
+	void Dropout();
+
+private:
+	uint32_t m_nSampleRate;
+	uint32_t m_nPeriodMin;
+	uint32_t m_nPeriodMax;
+	uint32_t m_nBitPeriod;
+	uint64_t m_nSample { 0 };
+	uint64_t m_nCrossing { 0 };
+	uint64_t m_nEdgePrevious { 0 };
+	uint64_t m_nBitsLow { 0 };
+	uint32_t m_nBitsHigh { 0 };
+	uint32_t m_nBitCount { 0 };
+	uint32_t m_nHalfBit { 0 };
+	uint32_t m_nOutOfWindow { 0 };
+	int32_t m_nSamplePrevious { 0 };
+	int32_t m_nMax { 0 };
+	int32_t m_nMin { 0 };
+	uint8_t m_nSecondsPrevious { 0xFF };
+	uint8_t m_nFramesMax { 0 };
+	ltc::Type m_Type { ltc::Type::UNKNOWN };
+	bool m_bHigh { false };
+	bool m_bHalfBit { false };
+	bool m_bEdgeValid { false };
+	bool m_bLocked { false };
+	bool m_bTypeValid { false };
+
+	struct ltc::decoder::Statistics m_Statistics;
+	struct ltc::decoder::Frame m_Frame;
+
+	LtcDecoderCallbackFunctionPtr m_pLtcDecoderCallbackFunctionPtr { nullptr };
+};
+
+#endif /* LTCDECODER_H_ */
@@ -106,19 +106,24 @@ static inline bool timecode_is_equal(const struct ltc::TimeCode *pLtcTimeCode) {
 }
 
 void ArtNetReader::Handler(const struct artnet::TimeCode *pArtNetTimeCode) {
-	m_nTimestamp = Hardware::Get()->Millis();
+	m_Chase.Input(reinterpret_cast<const struct ltc::TimeCode *>(pArtNetTimeCode), Hardware::Get()->Micros());
 
+	gv_ltc_nUpdates = gv_ltc_nUpdates + 1;
+}
+
+/**
+ * Called by the chase engine, the network jitter is filtered out
+ */
+void ArtNetReader::Output(const struct ltc::TimeCode *pLtcTimeCode) {
 	if (ltc::Destination::IsEnabled(ltc::Destination::Output::LTC)) {
-		LtcSender::Get()->SetTimeCode(reinterpret_cast<const struct ltc::TimeCode *>(pArtNetTimeCode));
+		LtcSender::Get()->SetTimeCode(pLtcTimeCode);
 	}
 
 	if (ltc::Destination::IsEnabled(ltc::Destination::Output::ETC)) {
-		LtcEtc::Get()->Send(reinterpret_cast<const struct midi::Timecode *>(pArtNetTimeCode));
+		LtcEtc::Get()->Send(reinterpret_cast<const struct midi::Timecode *>(pLtcTimeCode));
 	}
 
-	if (!timecode_is_equal(reinterpret_cast<const struct ltc::TimeCode *>(pArtNetTimeCode))) {
+	if (!timecode_is_equal(pLtcTimeCode)) {
 		LtcOutputs::Get()->Update(const_cast<const struct ltc::TimeCode *>(&g_ltc_LtcTimeCode));
 	}
-
-	gv_ltc_nUpdates = gv_ltc_nUpdates + 1;
 }
@@ -126,7 +126,10 @@ void RtpMidiReader::HandleMtc(const struct midi::Message *ptMidiMessage) {
 	m_LtcTimeCode.nHours = pSystemExclusive[5] & 0x1F;
 	m_LtcTimeCode.nType = static_cast<uint8_t>(pSystemExclusive[5] >> 5);
 
-	Update();
+	// A full frame message is a locate
+	m_Chase.Reset();
+
+	Update(&m_LtcTimeCode);
 
 	gv_ltc_bTimeCodeAvailable = false;
 	gv_ltc_nTimeCodeCounter = 0;
@@ -158,44 +161,55 @@ void RtpMidiReader::HandleMtcQf(const struct midi::Message *ptMidiMessage) {
 
 		m_nMtcQfFramePrevious = m_LtcTimeCode.nFrames;
 
-		if (m_nMtcQfFramesDelta >= static_cast<uint32_t>(TimeCodeConst::FPS[m_LtcTimeCode.nType] - 2)) {
-			m_nMtcQfFramesDelta = 2;
-		}
+		if (m_bDirection) {
+			m_Chase.Input(&m_LtcTimeCode, Hardware::Get()->Micros());
+		} else {
+			if (m_Chase.IsRunning()) {
+				m_Chase.Reset();
+			}
 
-		__DMB();
+			if (m_nMtcQfFramesDelta >= static_cast<uint32_t>(TimeCodeConst::FPS[m_LtcTimeCode.nType] - 2)) {
+				m_nMtcQfFramesDelta = 2;
+			}
 
-		if (gv_ltc_nTimeCodeCounter < m_nMtcQfFramesDelta) {
-			Update();
-		}
+			__DMB();
+
+			if (gv_ltc_nTimeCodeCounter < m_nMtcQfFramesDelta) {
+				Update(&m_LtcTimeCode);
+			}
 
 #if defined (H3)
-		H3_TIMER->TMR0_CTRL |= TIMER_CTRL_SINGLE_MODE;
-		H3_TIMER->TMR0_INTV = TimeCodeConst::TMR_INTV[m_LtcTimeCode.nType];
-		H3_TIMER->TMR0_CTRL |= (TIMER_CTRL_EN_START | TIMER_CTRL_RELOAD);
+			H3_TIMER->TMR0_CTRL |= TIMER_CTRL_SINGLE_MODE;
+			H3_TIMER->TMR0_INTV = TimeCodeConst::TMR_INTV[m_LtcTimeCode.nType];
+			H3_TIMER->TMR0_CTRL |= (TIMER_CTRL_EN_START | TIMER_CTRL_RELOAD);
 #elif defined (GD32)
-		platform::ltc::timer11_set_type(m_LtcTimeCode.nType);
+			platform::ltc::timer11_set_type(m_LtcTimeCode.nType);
 #endif
-		gv_ltc_bTimeCodeAvailable = false;
-		gv_ltc_nTimeCodeCounter = 0;
+			gv_ltc_bTimeCodeAvailable = false;
+			gv_ltc_nTimeCodeCounter = 0;
+		}
 	}
 
 	m_nPartPrevious = nPart;
 }
 
-void RtpMidiReader::Update() {
+/**
+ * Called directly, or by the chase engine
+ */
+void RtpMidiReader::Update(const struct ltc::TimeCode *pTimeCode) {
 	if (ltc::Destination::IsEnabled(ltc::Destination::Output::LTC)) {
-		LtcSender::Get()->SetTimeCode(reinterpret_cast<const struct ltc::TimeCode*>(&m_LtcTimeCode));
+		LtcSender::Get()->SetTimeCode(pTimeCode);
 	}
 
 	if (ltc::Destination::IsEnabled(ltc::Destination::Output::ARTNET)) {
-		ArtNetNode::Get()->SendTimeCode(reinterpret_cast<struct artnet::TimeCode*>(&m_LtcTimeCode));
+		ArtNetNode::Get()->SendTimeCode(reinterpret_cast<const struct artnet::TimeCode *>(pTimeCode));
 	}
 
 	if (ltc::Destination::IsEnabled(ltc::Destination::Output::ETC)) {
-		LtcEtc::Get()->Send(reinterpret_cast<const midi::Timecode *>(&m_LtcTimeCode));
+		LtcEtc::Get()->Send(reinterpret_cast<const midi::Timecode *>(pTimeCode));
 	}
 
-	memcpy(&g_ltc_LtcTimeCode, &m_LtcTimeCode, sizeof(struct midi::Timecode));
+	memcpy(&g_ltc_LtcTimeCode, pTimeCode, sizeof(struct midi::Timecode));
 
 	LtcOutputs::Get()->Update(reinterpret_cast<const struct ltc::TimeCode*>(&g_ltc_LtcTimeCode));
 
@@ -203,35 +217,22 @@ void RtpMidiReader::Update() {
 }
 
 void RtpMidiReader::Run() {
+	m_Chase.Run(Hardware::Get()->Micros());
+
 	__DMB();
 
 	if (gv_ltc_bTimeCodeAvailable) {
 		gv_ltc_bTimeCodeAvailable = false;
 
-		const auto nFps = TimeCodeConst::FPS[m_LtcTimeCode.nType];
-
-		if (m_bDirection) {
-			m_LtcTimeCode.nFrames++;
-			if (nFps == m_LtcTimeCode.nFrames) {
-				m_LtcTimeCode.nFrames = 0;
-
-				m_LtcTimeCode.nSeconds++;
-				if (m_LtcTimeCode.nSeconds == 60) {
-					m_LtcTimeCode.nSeconds = 0;
+		// Playing forward, the chase engine drives the outputs
+		if (!m_bDirection) {
+			const auto nFps = TimeCodeConst::FPS[m_LtcTimeCode.nType];
 
-					m_LtcTimeCode.nMinutes++;
-					if (m_LtcTimeCode.nMinutes == 60) {
-						m_LtcTimeCode.nMinutes = 0;
+			if (m_LtcTimeCode.nFrames > 0) {
+				m_LtcTimeCode.nFrames--;
+			} else {
+				m_LtcTimeCode.nFrames = static_cast<uint8_t>(nFps - 1);
 
-						m_LtcTimeCode.nHours++;
-						if (m_LtcTimeCode.nHours == 24) {
-							m_LtcTimeCode.nHours = 0;
-						}
-					}
-				}
-			}
-		} else {
-			if (m_LtcTimeCode.nFrames == nFps - 1) {
 				if (m_LtcTimeCode.nSeconds > 0) {
 					m_LtcTimeCode.nSeconds--;
 				} else {
@@ -254,20 +255,20 @@ void RtpMidiReader::Run() {
 					}
 				}
 			}
-		}
 
-		Update();
+			Update(&m_LtcTimeCode);
 
- 		if (m_nMtcQfFramesDelta == 2) {
- 			m_nMtcQfFramesDelta = 0;
+			if (m_nMtcQfFramesDelta == 2) {
+				m_nMtcQfFramesDelta = 0;
 #if defined (H3)
- 			H3_TIMER->TMR0_CTRL |= TIMER_CTRL_SINGLE_MODE;
- 			H3_TIMER->TMR0_INTV = TimeCodeConst::TMR_INTV[m_LtcTimeCode.nType];
- 			H3_TIMER->TMR0_CTRL |= (TIMER_CTRL_EN_START | TIMER_CTRL_RELOAD);
+				H3_TIMER->TMR0_CTRL |= TIMER_CTRL_SINGLE_MODE;
+				H3_TIMER->TMR0_INTV = TimeCodeConst::TMR_INTV[m_LtcTimeCode.nType];
+				H3_TIMER->TMR0_CTRL |= (TIMER_CTRL_EN_START | TIMER_CTRL_RELOAD);
 #elif defined (GD32)
- 			platform::ltc::timer11_set_type(m_LtcTimeCode.nType);
+				platform::ltc::timer11_set_type(m_LtcTimeCode.nType);
 #endif
- 		}
+			}
+		}
 	}
 
 	__DMB();
@@ -0,0 +1,369 @@
+/**
+ * @file ltcchase.cpp
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#if defined (DEBUG_LTCCHASE)
+# undef NDEBUG
+#endif
+
+#if defined(__GNUC__) && !defined(__clang__)
+# pragma GCC push_options
+# pragma GCC optimize ("O3")
+#endif
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cassert>
+
+#include "ltcchase.h"
+#include "ltc.h"
+
+#include "debug.h"
+
+namespace ltc::chase {
+/*
+ * Drop frame: 2 frame numbers are skipped each minute, except every tenth minute
+ */
+static constexpr uint32_t DF_FRAMES_PER_MINUTE = (30 * 60) - 2;
+static constexpr uint32_t DF_FRAMES_PER_10_MINUTES = (10 * DF_FRAMES_PER_MINUTE) + 2;
+/*
+ * No input for this number of frame periods is a dropout
+ */
+static constexpr uint32_t DROPOUT_FRAMES = 3;
+/*
+ * The rate is kept within 1/8 of the nominal rate
+ */
+static constexpr uint32_t RATE_LIMIT_SHIFT = 3;
+/*
+ * The average jitter is an IIR filter of 1/16
+ */
+static constexpr uint32_t JITTER_SHIFT = 4;
+
+uint32_t frames_per_second(const ltc::Type type) {
+	switch (type) {
+	case ltc::Type::FILM:
+		return 24;
+	case ltc::Type::EBU:
+		return 25;
+	default:
+		break;
+	}
+
+	return 30;
+}
+
+uint32_t to_frames(const struct ltc::TimeCode& timeCode) {
+	const auto type = static_cast<ltc::Type>(timeCode.nType);
+	const auto nMinutes = (timeCode.nHours * 60U) + timeCode.nMinutes;
+	auto nFrames = (((nMinutes * 60U) + timeCode.nSeconds) * frames_per_second(type)) + timeCode.nFrames;
+
+	if (type == ltc::Type::DF) {
+		nFrames -= 2 * (nMinutes - (nMinutes / 10));
+	}
+
+	return nFrames;
+}
+
+void from_frames(uint32_t nFrames, const ltc::Type type, struct ltc::TimeCode& timeCode) {
+	if (type == ltc::Type::DF) {
+		const auto nTens = nFrames / DF_FRAMES_PER_10_MINUTES;
+		const auto nRemainder = nFrames % DF_FRAMES_PER_10_MINUTES;
+
+		nFrames += 18 * nTens;
+
+		if (nRemainder > 1) {
+			nFrames += 2 * ((nRemainder - 2) / DF_FRAMES_PER_MINUTE);
+		}
+	}
+
+	const auto nFps = frames_per_second(type);
+
+	timeCode.nFrames = static_cast<uint8_t>(nFrames % nFps);
+	nFrames /= nFps;
+	timeCode.nSeconds = static_cast<uint8_t>(nFrames % 60);
+	nFrames /= 60;
+	timeCode.nMinutes = static_cast<uint8_t>(nFrames % 60);
+	timeCode.nHours = static_cast<uint8_t>(nFrames / 60);
+	timeCode.nType = static_cast<uint8_t>(type);
+}
+
+static int64_t nominal_rate(const ltc::Type type) {
+	if (type == ltc::Type::DF) {
+		return (static_cast<int64_t>(30000) << Q) / 1001;
+	}
+
+	return static_cast<int64_t>(frames_per_second(type)) << Q;
+}
+
+static int64_t frames_per_day(const ltc::Type type) {
+	if (type == ltc::Type::DF) {
+		return 24 * 6 * DF_FRAMES_PER_10_MINUTES;
+	}
+
+	return 24 * 60 * 60 * static_cast<int64_t>(frames_per_second(type));
+}
+}  // namespace ltc::chase
+
+using namespace ltc::chase;
+
+LtcChase::LtcChase(const struct ltc::chase::Config& config) : m_Config(config) {
+	DEBUG_ENTRY
+
+	assert(m_Config.nLockFrames != 0);
+	assert(m_Config.nUnlockFrames != 0);
+	assert(m_Config.nPhaseShift < Q);
+	assert(m_Config.nRateShift < Q);
+
+	Reset();
+
+	DEBUG_EXIT
+}
+
+void LtcChase::Reset() {
+	m_Type = ltc::Type::UNKNOWN;
+	m_State = State::IDLE;
+	m_bOutputValid = false;
+	m_nSubFrame = 0;
+
+	memset(&m_Statistics, 0, sizeof(struct Statistics));
+}
+
+int64_t LtcChase::Predict(const uint32_t nMicros) const {
+	return m_nPosition + ((m_nRate * static_cast<int64_t>(nMicros - m_nMicros)) / 1000000);
+}
+
+/**
+ * @return The shortest distance on the 24 hour circle.
+ */
+int64_t LtcChase::Wrap(int64_t nDelta) const {
+	const auto nDay = m_nFramesPerDay << Q;
+
+	nDelta %= nDay;
+
+	if (nDelta >= (nDay / 2)) {
+		nDelta -= nDay;
+	} else if (nDelta < -(nDay / 2)) {
+		nDelta += nDay;
+	}
+
+	return nDelta;
+}
+
+int64_t LtcChase::Normalize(int64_t nPosition) const {
+	const auto nDay = m_nFramesPerDay << Q;
+
+	nPosition %= nDay;
+
+	if (nPosition < 0) {
+		nPosition += nDay;
+	}
+
+	return nPosition;
+}
+
+void LtcChase::Acquire(const uint32_t nFrame, const uint32_t nMicros) {
+	m_nPosition = static_cast<int64_t>(nFrame) << Q;
+	m_nRate = m_nRateNominal;
+	m_nMicros = nMicros;
+	m_nInRange = 1;
+	m_nOutOfRange = 0;
+	m_State = State::LOCKING;
+}
+
+void LtcChase::Output(const uint32_t nFrame) {
+	if (m_bOutputValid && (nFrame == m_nFrameOutput)) {
+		return;
+	}
+
+	m_nFrameOutput = nFrame;
+	m_bOutputValid = true;
+	m_Statistics.nOutputs++;
+
+	if (m_pLtcChaseCallbackFunctionPtr != nullptr) {
+		struct ltc::TimeCode timeCode;
+		from_frames(nFrame, m_Type, timeCode);
+		m_pLtcChaseCallbackFunctionPtr(&timeCode);
+	}
+}
+
+void LtcChase::Input(const struct ltc::TimeCode *pTimeCode, const uint32_t nMicros) {
+	assert(pTimeCode != nullptr);
+
+	if (pTimeCode->nType > static_cast<uint8_t>(ltc::Type::SMPTE)) {
+		return;
+	}
+
+	const auto type = static_cast<ltc::Type>(pTimeCode->nType);
+
+	if (type != m_Type) {
+		m_Type = type;
+		m_nRateNominal = nominal_rate(type);
+		m_nFramesPerDay = frames_per_day(type);
+		m_State = State::IDLE;
+	}
+
+	const auto nFrame = to_frames(*pTimeCode);
+
+	m_Statistics.nFrames++;
+	m_nMicrosInput = nMicros;
+
+	if (m_State == State::IDLE) {
+		Acquire(nFrame, nMicros);
+		Output(nFrame);
+		return;
+	}
+
+	const auto nElapsed = static_cast<int64_t>(nMicros - m_nMicros);
+	const auto nPredicted = Predict(nMicros);
+	const auto nError = Wrap((static_cast<int64_t>(nFrame) << Q) - nPredicted);
+	const auto nErrorAbsolute = nError < 0 ? -nError : nError;
+
+	if (nErrorAbsolute > (static_cast<int64_t>(m_Config.nWindow) << (Q - 8))) {
+		m_Statistics.nOutliers++;
+
+		if ((m_State == State::LOCKING) || (++m_nOutOfRange >= m_Config.nUnlockFrames)) {
+			if (m_State != State::LOCKING) {
+				m_Statistics.nUnlocks++;
+			}
+
+			Acquire(nFrame, nMicros);
+			Output(nFrame);
+		}
+
+		return;
+	}
+
+	m_nOutOfRange = 0;
+
+	/*
+	 * Alpha-beta filter
+	 */
+	m_nPosition = Normalize(nPredicted + (nError >> m_Config.nPhaseShift));
+	m_nMicros = nMicros;
+
+	if (nElapsed > 0) {
+		m_nRate += ((nError * 1000000) / nElapsed) >> m_Config.nRateShift;
+
+		const auto nLimit = m_nRateNominal >> RATE_LIMIT_SHIFT;
+
+		if (m_nRate > (m_nRateNominal + nLimit)) {
+			m_nRate = m_nRateNominal + nLimit;
+		} else if (m_nRate < (m_nRateNominal - nLimit)) {
+			m_nRate = m_nRateNominal - nLimit;
+		}
+	}
+
+	const auto nJitter = static_cast<int32_t>((nErrorAbsolute * 1000000) / m_nRate);
+
+	m_Statistics.nJitterMicros = static_cast<uint32_t>(static_cast<int32_t>(m_Statistics.nJitterMicros) + ((nJitter - static_cast<int32_t>(m_Statistics.nJitterMicros)) >> JITTER_SHIFT));
+
+	if (static_cast<uint32_t>(nJitter) > m_Statistics.nJitterMaxMicros) {
+		m_Statistics.nJitterMaxMicros = static_cast<uint32_t>(nJitter);
+	}
+
+	m_Statistics.nDriftPpm = static_cast<int32_t>(((m_nRate - m_nRateNominal) * 1000000) / m_nRateNominal);
+
+	if (m_State == State::LOCKING) {
+		if (++m_nInRange >= m_Config.nLockFrames) {
+			m_State = State::LOCKED;
+			m_Statistics.nLocks++;
+			DEBUG_PUTS("Locked");
+		} else {
+			Output(nFrame);
+		}
+	} else if (m_State == State::FREEWHEEL) {
+		m_State = State::LOCKED;
+	}
+}
+
+void LtcChase::Run(const uint32_t nMicros) {
+	if ((nMicros - m_nMicrosOutput) < OUTPUT_INTERVAL_MICROS) {
+		return;
+	}
+
+	m_nMicrosOutput = nMicros;
+
+	if (m_State == State::IDLE) {
+		return;
+	}
+
+	const auto nSinceInput = nMicros - m_nMicrosInput;
+	const auto nDropout = static_cast<uint32_t>((static_cast<int64_t>(DROPOUT_FRAMES * 1000000U) << Q) / m_nRateNominal);
+
+	if (m_State == State::LOCKING) {
+		if (nSinceInput > nDropout) {
+			m_State = State::IDLE;
+			m_bOutputValid = false;
+		}
+		return;
+	}
+
+	if ((m_State == State::LOCKED) && (nSinceInput > nDropout)) {
+		m_State = State::FREEWHEEL;
+		m_Statistics.nFreewheels++;
+		DEBUG_PUTS("Freewheel");
+	}
+
+	if ((m_State == State::FREEWHEEL) && (nSinceInput > (m_Config.nFreewheelMillis * 1000U))) {
+		m_State = State::IDLE;
+		m_bOutputValid = false;
+		m_Statistics.nDropouts++;
+		DEBUG_PUTS("Dropout");
+		return;
+	}
+
+	const auto nPosition = Normalize(Predict(nMicros));
+	const auto nFrame = static_cast<uint32_t>(nPosition >> Q);
+
+	m_nSubFrame = static_cast<uint32_t>(nPosition >> (Q - 8)) & 0xFF;
+
+	if (m_bOutputValid) {
+		const auto nDelta = Wrap((static_cast<int64_t>(nFrame) - static_cast<int64_t>(m_nFrameOutput)) << Q) >> Q;
+
+		// A small correction backwards holds the output frame
+		if ((nDelta <= 0) && (nDelta > -2)) {
+			return;
+		}
+	}
+
+	Output(nFrame);
+}
+
+void LtcChase::Print() {
+	static constexpr const char *STATE[] = { "Idle", "Locking", "Locked", "Freewheel" };
+
+	printf("Timecode chase\n");
+	printf(" State       : %s\n", STATE[static_cast<uint32_t>(m_State)]);
+	printf(" Type        : %s\n", ltc::get_type(m_Type));
+	printf(" Frames      : %u\n", static_cast<unsigned int>(m_Statistics.nFrames));
+	printf(" Outputs     : %u\n", static_cast<unsigned int>(m_Statistics.nOutputs));
+	printf(" Outliers    : %u\n", static_cast<unsigned int>(m_Statistics.nOutliers));
+	printf(" Locks       : %u\n", static_cast<unsigned int>(m_Statistics.nLocks));
+	printf(" Unlocks     : %u\n", static_cast<unsigned int>(m_Statistics.nUnlocks));
+	printf(" Freewheels  : %u\n", static_cast<unsigned int>(m_Statistics.nFreewheels));
+	printf(" Dropouts    : %u\n", static_cast<unsigned int>(m_Statistics.nDropouts));
+	printf(" Jitter      : %u us (max %u us)\n", static_cast<unsigned int>(m_Statistics.nJitterMicros), static_cast<unsigned int>(m_Statistics.nJitterMaxMicros));
+	printf(" Drift       : %d ppm\n", static_cast<int>(m_Statistics.nDriftPpm));
+}
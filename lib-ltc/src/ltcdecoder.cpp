@@ -0,0 +1,437 @@
+/**
+ * @file ltcdecoder.cpp
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#if defined (DEBUG_LTCDECODER)
+# undef NDEBUG
+#endif
+
+#if defined(__GNUC__) && !defined(__clang__)
+# pragma GCC push_options
+# pragma GCC optimize ("O3")
+#endif
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cassert>
+
+#include "ltcdecoder.h"
+#include "ltc.h"
+
+#include "debug.h"
+
+namespace ltc::decoder {
+/*
+ * The envelope decays with 1/1024 of the peak-to-peak value per sample.
+ * The hysteresis is 1/8 of the peak-to-peak value.
+ */
+static constexpr uint32_t ENVELOPE_DECAY_SHIFT = 10;
+static constexpr uint32_t HYSTERESIS_SHIFT = 3;
+static constexpr int32_t SQUELCH_PEAK_TO_PEAK = 512;
+/*
+ * The bit period is tracked with an IIR filter of 1/8
+ */
+static constexpr uint32_t PERIOD_TRACK_SHIFT = 3;
+/*
+ * Consecutive out of window intervals before a locked decoder re-acquires the bit period
+ */
+static constexpr uint32_t OUT_OF_WINDOW_MAX = 4;
+
+static uint64_t reverse_bits(uint64_t nBits) {
+	uint64_t nResult = 0;
+
+	for (uint32_t i = 0; i < 64; i++) {
+		nResult = (nResult << 1) | (nBits & 1);
+		nBits >>= 1;
+	}
+
+	return nResult;
+}
+
+static constexpr uint32_t field(const uint64_t nData, const uint32_t nShift, const uint32_t nWidth) {
+	return static_cast<uint32_t>(nData >> nShift) & ((1U << nWidth) - 1);
+}
+
+static constexpr uint32_t nominal_fps(const ltc::Type type) {
+	switch (type) {
+	case ltc::Type::FILM:
+		return 24;
+	case ltc::Type::EBU:
+		return 25;
+	default:
+		break;
+	}
+
+	return 30;
+}
+}  // namespace ltc::decoder
+
+using namespace ltc::decoder;
+
+LtcDecoder::LtcDecoder(uint32_t nSampleRate) : m_nSampleRate(nSampleRate) {
+	DEBUG_ENTRY
+
+	assert(nSampleRate != 0);
+
+	/*
+	 * Bit period at 2x speed of 30 fps with 20% margin,
+	 * up to the bit period at 0.5x speed of 24 fps with 25% margin.
+	 */
+	m_nPeriodMin = (m_nSampleRate << Q) / 6000U;
+	m_nPeriodMax = (m_nSampleRate << Q) / 768U;
+
+	Reset();
+
+	DEBUG_PRINTF("m_nPeriodMin=%u, m_nPeriodMax=%u", m_nPeriodMin, m_nPeriodMax);
+	DEBUG_EXIT
+}
+
+void LtcDecoder::Reset() {
+	m_nBitPeriod = (m_nSampleRate << Q) / (25U * FORMAT_SIZE_BITS);
+	m_nSample = 0;
+	m_nCrossing = 0;
+	m_nEdgePrevious = 0;
+	m_nBitsLow = 0;
+	m_nBitsHigh = 0;
+	m_nBitCount = 0;
+	m_nHalfBit = 0;
+	m_nOutOfWindow = 0;
+	m_nSamplePrevious = 0;
+	m_nMax = 0;
+	m_nMin = 0;
+	m_nSecondsPrevious = 0xFF;
+	m_nFramesMax = 0;
+	m_Type = ltc::Type::UNKNOWN;
+	m_bHigh = false;
+	m_bHalfBit = false;
+	m_bEdgeValid = false;
+	m_bLocked = false;
+	m_bTypeValid = false;
+
+	memset(&m_Statistics, 0, sizeof(struct Statistics));
+	memset(&m_Frame, 0, sizeof(struct Frame));
+}
+
+void LtcDecoder::Process(const int16_t *pSamples, uint32_t nSamples) {
+	assert(pSamples != nullptr);
+
+	const auto nTimeOut = static_cast<uint64_t>(2U * m_nPeriodMax);
+
+	for (uint32_t i = 0; i < nSamples; i++) {
+		const int32_t nSample = pSamples[i];
+
+		/*
+		 * Envelope follower, the center is the DC offset
+		 */
+		if (nSample > m_nMax) {
+			m_nMax = nSample;
+		}
+
+		if (nSample < m_nMin) {
+			m_nMin = nSample;
+		}
+
+		const auto nSpan = m_nMax - m_nMin;
+
+		m_nMax -= (nSpan >> ENVELOPE_DECAY_SHIFT);
+		m_nMin += (nSpan >> ENVELOPE_DECAY_SHIFT);
+
+		const auto nCenter = (m_nMax + m_nMin) / 2;
+		const auto nPrevious = m_nSamplePrevious - nCenter;
+		const auto nCurrent = nSample - nCenter;
+
+		/*
+		 * Zero crossing, linear interpolated between the previous and the current sample
+		 */
+		if ((nPrevious < 0) != (nCurrent < 0)) {
+			const auto nFraction = static_cast<uint32_t>((nPrevious * static_cast<int32_t>(1U << Q)) / (nPrevious - nCurrent));
+			m_nCrossing = ((m_nSample - 1) << Q) + nFraction;
+		}
+
+		/*
+		 * The edge is confirmed by the hysteresis, the time stamp is the last zero crossing
+		 */
+		if (nSpan >= SQUELCH_PEAK_TO_PEAK) {
+			const auto nHysteresis = nSpan >> HYSTERESIS_SHIFT;
+
+			if (!m_bHigh && (nCurrent > nHysteresis)) {
+				m_bHigh = true;
+				Edge(m_nCrossing);
+			} else if (m_bHigh && (nCurrent < -nHysteresis)) {
+				m_bHigh = false;
+				Edge(m_nCrossing);
+			}
+		}
+
+		if (m_bEdgeValid && (((m_nSample << Q) - m_nEdgePrevious) > nTimeOut)) {
+			Dropout();
+		}
+
+		m_nSamplePrevious = nSample;
+		m_nSample++;
+	}
+}
+
+void LtcDecoder::Dropout() {
+	if (m_bLocked) {
+		m_Statistics.nDropouts++;
+	}
+
+	m_bEdgeValid = false;
+	m_bLocked = false;
+	m_bHalfBit = false;
+	m_nBitCount = 0;
+}
+
+void LtcDecoder::Edge(const uint64_t nEdge) {
+	if (!m_bEdgeValid) {
+		m_bEdgeValid = true;
+		m_nEdgePrevious = nEdge;
+		return;
+	}
+
+	const auto nInterval = static_cast<uint32_t>(nEdge - m_nEdgePrevious);
+	m_nEdgePrevious = nEdge;
+
+	const auto nPeriod = m_nBitPeriod;
+
+	/*
+	 * A valid interval is either a half bit period (1) or a full bit period (0).
+	 * Anything else means that the tracked bit period is wrong, or it is noise.
+	 */
+	if ((nInterval < ((nPeriod * 3U) / 8U)) || (nInterval >= ((nPeriod * 3U) / 2U))) {
+		m_nOutOfWindow++;
+
+		if (!m_bLocked || (m_nOutOfWindow >= OUT_OF_WINDOW_MAX)) {
+			auto nPeriodNew = (nInterval >= nPeriod) ? nInterval : 2U * nInterval;
+
+			if (nPeriodNew < m_nPeriodMin) {
+				nPeriodNew = m_nPeriodMin;
+			} else if (nPeriodNew > m_nPeriodMax) {
+				nPeriodNew = m_nPeriodMax;
+			}
+
+			m_nBitPeriod = nPeriodNew;
+			m_nOutOfWindow = 0;
+			m_bLocked = false;
+			m_Statistics.nResyncs++;
+		}
+
+		m_bHalfBit = false;
+		m_nBitCount = 0;
+		return;
+	}
+
+	m_nOutOfWindow = 0;
+
+	uint32_t nBitLength;
+	uint32_t nBit;
+
+	if (nInterval < ((nPeriod * 3U) / 4U)) {
+		if (!m_bHalfBit) {
+			m_bHalfBit = true;
+			m_nHalfBit = nInterval;
+			return;
+		}
+
+		m_bHalfBit = false;
+		nBitLength = m_nHalfBit + nInterval;
+		nBit = 1;
+	} else {
+		if (m_bHalfBit) {
+			m_bHalfBit = false;
+			m_nBitCount = 0;
+			m_Statistics.nBiphaseErrors++;
+		}
+
+		nBitLength = nInterval;
+		nBit = 0;
+	}
+
+	/*
+	 * Varispeed tracking
+	 */
+	const auto nDelta = static_cast<int32_t>(nBitLength - nPeriod) / static_cast<int32_t>(1U << PERIOD_TRACK_SHIFT);
+	auto nPeriodNew = static_cast<uint32_t>(static_cast<int32_t>(nPeriod) + nDelta);
+
+	if (nPeriodNew < m_nPeriodMin) {
+		nPeriodNew = m_nPeriodMin;
+	} else if (nPeriodNew > m_nPeriodMax) {
+		nPeriodNew = m_nPeriodMax;
+	}
+
+	m_nBitPeriod = nPeriodNew;
+
+	Bit(nBit, nEdge);
+}
+
+void LtcDecoder::Bit(const uint32_t nBit, const uint64_t nEdge) {
+	m_nBitsHigh = ((m_nBitsHigh << 1) | static_cast<uint32_t>(m_nBitsLow >> 63)) & 0xFFFF;
+	m_nBitsLow = (m_nBitsLow << 1) | nBit;
+
+	if (m_nBitCount < FORMAT_SIZE_BITS) {
+		m_nBitCount++;
+
+		if (m_nBitCount < FORMAT_SIZE_BITS) {
+			return;
+		}
+	}
+
+	/*
+	 * Forward: the sync word is received last.
+	 * Reverse: the sync word is received first and bit reversed.
+	 */
+	if ((m_nBitsLow & 0xFFFF) == SYNC_WORD_FORWARD) {
+		DecodeFrame(false, nEdge);
+	} else if (m_nBitsHigh == SYNC_WORD_REVERSE) {
+		DecodeFrame(true, nEdge);
+	}
+}
+
+void LtcDecoder::DecodeFrame(const bool bReverse, const uint64_t nEdge) {
+	m_nBitCount = 0;
+
+	/*
+	 * nData bit n is LTC bit n
+	 */
+	uint64_t nData;
+
+	if (bReverse) {
+		nData = m_nBitsLow;
+	} else {
+		nData = reverse_bits((static_cast<uint64_t>(m_nBitsHigh) << 48) | (m_nBitsLow >> 16));
+	}
+
+	const auto nFramesUnits = field(nData, 0, 4);
+	const auto nFramesTens = field(nData, 8, 2);
+	const auto nSecondsUnits = field(nData, 16, 4);
+	const auto nSecondsTens = field(nData, 24, 3);
+	const auto nMinutesUnits = field(nData, 32, 4);
+	const auto nMinutesTens = field(nData, 40, 3);
+	const auto nHoursUnits = field(nData, 48, 4);
+	const auto nHoursTens = field(nData, 56, 2);
+
+	if ((nFramesUnits > 9) || (nSecondsUnits > 9) || (nMinutesUnits > 9) || (nHoursUnits > 9)) {
+		m_Statistics.nInvalidFrames++;
+		return;
+	}
+
+	const auto nFrames = static_cast<uint8_t>(nFramesTens * 10 + nFramesUnits);
+	const auto nSeconds = static_cast<uint8_t>(nSecondsTens * 10 + nSecondsUnits);
+	const auto nMinutes = static_cast<uint8_t>(nMinutesTens * 10 + nMinutesUnits);
+	const auto nHours = static_cast<uint8_t>(nHoursTens * 10 + nHoursUnits);
+
+	if ((nFrames > 29) || (nSeconds > 59) || (nMinutes > 59) || (nHours > 23)) {
+		m_Statistics.nInvalidFrames++;
+		return;
+	}
+
+	/*
+	 * The type is detected by the drop frame flag or by the highest frame number within one second.
+	 * Until a second boundary has been seen, the type is estimated from the bit period.
+	 */
+	if (field(nData, 10, 1)) {
+		m_Type = ltc::Type::DF;
+		m_bTypeValid = true;
+	} else {
+		if (nSeconds != m_nSecondsPrevious) {
+			if ((m_nSecondsPrevious != 0xFF) && (m_nFramesMax >= 23)) {
+				if (m_nFramesMax == 23) {
+					m_Type = ltc::Type::FILM;
+				} else if (m_nFramesMax == 24) {
+					m_Type = ltc::Type::EBU;
+				} else {
+					m_Type = ltc::Type::SMPTE;
+				}
+				m_bTypeValid = true;
+			}
+
+			m_nSecondsPrevious = nSeconds;
+			m_nFramesMax = 0;
+		}
+
+		if (nFrames > m_nFramesMax) {
+			m_nFramesMax = nFrames;
+		}
+
+		if (!m_bTypeValid) {
+			const auto nFps = static_cast<uint32_t>((static_cast<uint64_t>(m_nSampleRate) << Q) / (FORMAT_SIZE_BITS * m_nBitPeriod));
+
+			if (nFps < 25) {
+				m_Type = ltc::Type::FILM;
+			} else if (nFps < 28) {
+				m_Type = ltc::Type::EBU;
+			} else {
+				m_Type = ltc::Type::SMPTE;
+			}
+		}
+	}
+
+	m_Frame.TimeCode.nFrames = nFrames;
+	m_Frame.TimeCode.nSeconds = nSeconds;
+	m_Frame.TimeCode.nMinutes = nMinutes;
+	m_Frame.TimeCode.nHours = nHours;
+	m_Frame.TimeCode.nType = static_cast<uint8_t>(m_Type);
+
+	m_Frame.nUserBits = 0;
+
+	for (uint32_t i = 0; i < 8; i++) {
+		m_Frame.nUserBits |= field(nData, 4 + (i * 8), 4) << (i * 4);
+	}
+
+	m_Frame.nSampleEnd = nEdge;
+	m_Frame.nSampleStart = nEdge - static_cast<uint64_t>(FORMAT_SIZE_BITS * m_nBitPeriod);
+	m_Frame.bReverse = bReverse;
+
+	m_bLocked = true;
+	m_Statistics.nFrames++;
+
+	if (m_pLtcDecoderCallbackFunctionPtr != nullptr) {
+		m_pLtcDecoderCallbackFunctionPtr(&m_Frame);
+	}
+}
+
+uint32_t LtcDecoder::GetSubFrame() const {
+	const auto nElapsed = (m_nSample << Q) - m_Frame.nSampleStart;
+	return static_cast<uint32_t>((nElapsed << 8) / (FORMAT_SIZE_BITS * m_nBitPeriod));
+}
+
+uint32_t LtcDecoder::GetSpeed() const {
+	const auto nNominal = static_cast<uint64_t>(FORMAT_SIZE_BITS * nominal_fps(m_Type)) * m_nBitPeriod;
+	return static_cast<uint32_t>((static_cast<uint64_t>(m_nSampleRate) << (Q + 8)) / nNominal);
+}
+
+void LtcDecoder::Print() {
+	printf("LTC decoder\n");
+	printf(" Sample rate : %u\n", static_cast<unsigned int>(m_nSampleRate));
+	printf(" Type        : %s\n", ltc::get_type(m_Type));
+	printf(" Locked      : %s\n", m_bLocked ? "Yes" : "No");
+	printf(" Speed       : %u/256\n", static_cast<unsigned int>(GetSpeed()));
+	printf(" Frames      : %u\n", static_cast<unsigned int>(m_Statistics.nFrames));
+	printf(" Invalid     : %u\n", static_cast<unsigned int>(m_Statistics.nInvalidFrames));
+	printf(" Biphase     : %u\n", static_cast<unsigned int>(m_Statistics.nBiphaseErrors));
+	printf(" Resyncs     : %u\n", static_cast<unsigned int>(m_Statistics.nResyncs));
+	printf(" Dropouts    : %u\n", static_cast<unsigned int>(m_Statistics.nDropouts));
+}
@@ -0,0 +1,260 @@
+/**
+ * @file test_ltcchase.cpp
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * Arrival traces of a timecode source, with network jitter and lost frames,
+ * are replayed through LtcChase. The time of each output is compared with
+ * the ideal time of its frame.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+
+#include "ltcchase.h"
+#include "ltc.h"
+
+#include "test.h"
+
+using namespace ltc::chase;
+
+namespace trace {
+struct Arrival {
+	uint32_t nFrame;
+	uint32_t nMicros;
+};
+
+struct Source {
+	ltc::Type type;
+	uint32_t nFrameFirst;
+	uint32_t nFrames;
+	uint32_t nStep;				///< Frames per message, MTC quarter frames give a frame every 2 frames
+	double fRatePpm;			///< Deviation from the nominal rate
+	double fJitterMicros;		///< Uniform 0..fJitterMicros
+	uint32_t nLostFirst;
+	uint32_t nLostCount;
+};
+
+static constexpr uint32_t START_MICROS = 1000000;
+static constexpr uint32_t LATENCY_MICROS = 5000;
+
+static double period(const Source& source) {
+	const auto fFps = (source.type == ltc::Type::DF) ? (30000.0 / 1001.0) : static_cast<double>(frames_per_second(source.type));
+	return (1000000.0 / fFps) * (1.0 - source.fRatePpm * 1e-6);
+}
+
+static std::vector<Arrival> generate(const Source& source) {
+	std::vector<Arrival> arrivals;
+	const auto fPeriod = period(source);
+
+	for (uint32_t i = 0; i < source.nFrames; i += source.nStep) {
+		if ((i >= source.nLostFirst) && (i < (source.nLostFirst + source.nLostCount))) {
+			continue;
+		}
+
+		const auto fJitter = (static_cast<double>(rand()) / RAND_MAX) * source.fJitterMicros;
+		arrivals.push_back({ source.nFrameFirst + i, static_cast<uint32_t>(START_MICROS + (i * fPeriod) + LATENCY_MICROS + fJitter) });
+	}
+
+	return arrivals;
+}
+}  // namespace trace
+
+namespace replay {
+struct Output {
+	uint32_t nFrame;
+	uint32_t nMicros;
+};
+
+static uint32_t s_nMicros;
+static std::vector<Output> s_Outputs;
+
+static void output(const struct ltc::TimeCode *pTimeCode) {
+	s_Outputs.push_back({ to_frames(*pTimeCode), s_nMicros });
+}
+
+struct Result {
+	uint32_t nNonConsecutive;
+	double fOffsetMicros;
+	double fDeviationMicros;
+};
+
+/**
+ * The main loop runs every 100 us
+ */
+static Result run(LtcChase& chase, const trace::Source& source, const std::vector<trace::Arrival>& arrivals, const uint32_t nSkip) {
+	s_Outputs.clear();
+	chase.SetCallback(output);
+
+	const auto fPeriod = trace::period(source);
+	const auto nEnd = static_cast<uint32_t>(trace::START_MICROS + (source.nFrames * fPeriod) + 3000000);
+	size_t nNext = 0;
+
+	for (s_nMicros = trace::START_MICROS; s_nMicros < nEnd; s_nMicros += 100) {
+		while ((nNext < arrivals.size()) && (arrivals[nNext].nMicros <= s_nMicros)) {
+			struct ltc::TimeCode timeCode;
+			from_frames(arrivals[nNext].nFrame, source.type, timeCode);
+			chase.Input(&timeCode, s_nMicros);
+			nNext++;
+		}
+
+		chase.Run(s_nMicros);
+	}
+
+	Result result {};
+	double fSum = 0;
+	double fSumSquares = 0;
+	uint32_t nCount = 0;
+
+	for (size_t i = 1; i < s_Outputs.size(); i++) {
+		if (s_Outputs[i].nFrame != (s_Outputs[i - 1].nFrame + 1)) {
+			result.nNonConsecutive++;
+		}
+
+		if (i < nSkip) {
+			continue;
+		}
+
+		const auto fIdeal = trace::START_MICROS + trace::LATENCY_MICROS + ((s_Outputs[i].nFrame - source.nFrameFirst) * fPeriod);
+		const auto fError = s_Outputs[i].nMicros - fIdeal;
+
+		fSum += fError;
+		fSumSquares += fError * fError;
+		nCount++;
+	}
+
+	if (nCount != 0) {
+		result.fOffsetMicros = fSum / nCount;
+		result.fDeviationMicros = sqrt((fSumSquares / nCount) - (result.fOffsetMicros * result.fOffsetMicros));
+	}
+
+	return result;
+}
+}  // namespace replay
+
+static void test_drop_frame() {
+	uint32_t nErrors = 0;
+
+	for (uint32_t nFrame = 0; nFrame < (24 * 6 * 17982); nFrame++) {
+		struct ltc::TimeCode timeCode;
+		from_frames(nFrame, ltc::Type::DF, timeCode);
+
+		if (to_frames(timeCode) != nFrame) {
+			nErrors++;
+		}
+
+		// Frames 0 and 1 are skipped at each minute, except every tenth minute
+		if (((timeCode.nMinutes % 10) != 0) && (timeCode.nSeconds == 0) && (timeCode.nFrames < 2)) {
+			nErrors++;
+		}
+	}
+
+	CHECK(nErrors == 0);
+}
+
+static void test_jitter(const double fJitterMicros, const double fMaxDeviationMicros) {
+	const trace::Source source = { ltc::Type::EBU, 3600 * 25, 25 * 60, 1, 300, fJitterMicros, 900, 10 };
+	const auto arrivals = trace::generate(source);
+
+	LtcChase chase;
+	const auto result = replay::run(chase, source, arrivals, 60);
+	const auto& statistics = chase.GetStatistics();
+
+	printf("jitter 0..%.0f us (sd %.0f us): output offset %.0f us, sd %.0f us, %u outputs, %u non consecutive\n", fJitterMicros, fJitterMicros / sqrt(12.0),
+			result.fOffsetMicros, result.fDeviationMicros, static_cast<unsigned int>(replay::s_Outputs.size()), static_cast<unsigned int>(result.nNonConsecutive));
+
+	CHECK(result.nNonConsecutive == 0);
+	CHECK(result.fDeviationMicros < fMaxDeviationMicros);
+	CHECK(statistics.nLocks == 1);
+	CHECK(statistics.nUnlocks == 0);
+	// The 10 lost frames are bridged by the freewheel, the end of the trace is a dropout
+	CHECK(statistics.nFreewheels == 2);
+	CHECK(statistics.nDropouts == 1);
+	CHECK(!chase.IsRunning());
+}
+
+/**
+ * MTC quarter frames, as received by RtpMidiReader, give a timecode every 2 frames
+ */
+static void test_quarter_frames() {
+	const trace::Source source = { ltc::Type::SMPTE, 1000, 30 * 60, 2, -100, 10000, 0, 0 };
+	const auto arrivals = trace::generate(source);
+
+	LtcChase chase;
+	const auto result = replay::run(chase, source, arrivals, 60);
+
+	printf("quarter frames 0..10000 us: output offset %.0f us, sd %.0f us, %u outputs, %u non consecutive\n",
+			result.fOffsetMicros, result.fDeviationMicros, static_cast<unsigned int>(replay::s_Outputs.size()), static_cast<unsigned int>(result.nNonConsecutive));
+
+	// While locking, the frames are passed through
+	CHECK(result.nNonConsecutive <= chase.GetStatistics().nLocks * CONFIG_DEFAULT.nLockFrames);
+	CHECK(chase.GetStatistics().nLocks == 1);
+	CHECK(result.fDeviationMicros < 2000);
+	CHECK(replay::s_Outputs.size() + 20 >= source.nFrames);
+}
+
+/**
+ * A locate in the source relocks after nUnlockFrames frames
+ */
+static void test_locate() {
+	trace::Source source = { ltc::Type::FILM, 0, 24 * 20, 1, 0, 2000, 0, 0 };
+	auto arrivals = trace::generate(source);
+
+	for (size_t i = arrivals.size() / 2; i < arrivals.size(); i++) {
+		arrivals[i].nFrame += 1000;
+	}
+
+	LtcChase chase;
+	replay::run(chase, source, arrivals, 0);
+
+	const auto& statistics = chase.GetStatistics();
+	uint32_t nJumps = 0;
+
+	for (size_t i = 1; i < replay::s_Outputs.size(); i++) {
+		if (replay::s_Outputs[i].nFrame != (replay::s_Outputs[i - 1].nFrame + 1)) {
+			nJumps++;
+			CHECK(replay::s_Outputs[i].nFrame > replay::s_Outputs[i - 1].nFrame);
+		}
+	}
+
+	CHECK(statistics.nUnlocks == 1);
+	CHECK(statistics.nLocks == 2);
+	CHECK(statistics.nOutliers == CONFIG_DEFAULT.nUnlockFrames);
+	CHECK(nJumps == 1);
+}
+
+int main() {
+	srand(1);
+
+	test_drop_frame();
+	test_jitter(20000, 2000);
+	test_jitter(40000, 5000);
+	test_quarter_frames();
+	test_locate();
+
+	return test::result();
+}
@@ -0,0 +1,253 @@
+/**
+ * @file test_ltcdecoder.cpp
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * The audio of LtcEncoder is written to a WAV file, which is read back,
+ * resampled for the playback speed, mixed with noise and optionally
+ * inverted, and then decoded by LtcDecoder.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <algorithm>
+
+#include "ltcencoder.h"
+#include "ltcdecoder.h"
+#include "ltc.h"
+
+#include "test.h"
+
+LtcEncoder::~LtcEncoder() {
+	s_pThis = nullptr;
+}
+
+namespace wav {
+struct Header {
+	char Riff[4];
+	uint32_t nRiffSize;
+	char Wave[4];
+	char Fmt[4];
+	uint32_t nFmtSize;
+	uint16_t nFormat;
+	uint16_t nChannels;
+	uint32_t nSampleRate;
+	uint32_t nByteRate;
+	uint16_t nBlockAlign;
+	uint16_t nBitsPerSample;
+	char Data[4];
+	uint32_t nDataSize;
+} __attribute__((packed));
+
+static bool write(const char *pFileName, const std::vector<int16_t>& samples) {
+	Header header;
+	const auto nDataSize = static_cast<uint32_t>(samples.size() * sizeof(int16_t));
+
+	memcpy(header.Riff, "RIFF", 4);
+	header.nRiffSize = 36 + nDataSize;
+	memcpy(header.Wave, "WAVE", 4);
+	memcpy(header.Fmt, "fmt ", 4);
+	header.nFmtSize = 16;
+	header.nFormat = 1;
+	header.nChannels = 1;
+	header.nSampleRate = ltc::decoder::SAMPLE_RATE;
+	header.nByteRate = ltc::decoder::SAMPLE_RATE * sizeof(int16_t);
+	header.nBlockAlign = sizeof(int16_t);
+	header.nBitsPerSample = 16;
+	memcpy(header.Data, "data", 4);
+	header.nDataSize = nDataSize;
+
+	auto *pFile = fopen(pFileName, "wb");
+
+	if (pFile == nullptr) {
+		perror(pFileName);
+		return false;
+	}
+
+	fwrite(&header, sizeof(Header), 1, pFile);
+	fwrite(samples.data(), sizeof(int16_t), samples.size(), pFile);
+	fclose(pFile);
+
+	return true;
+}
+
+static bool read(const char *pFileName, std::vector<int16_t>& samples) {
+	auto *pFile = fopen(pFileName, "rb");
+
+	if (pFile == nullptr) {
+		perror(pFileName);
+		return false;
+	}
+
+	Header header;
+	auto isValid = (fread(&header, sizeof(Header), 1, pFile) == 1);
+	isValid = isValid && (memcmp(header.Riff, "RIFF", 4) == 0) && (memcmp(header.Data, "data", 4) == 0);
+	isValid = isValid && (header.nChannels == 1) && (header.nBitsPerSample == 16) && (header.nSampleRate == ltc::decoder::SAMPLE_RATE);
+
+	if (isValid) {
+		samples.resize(header.nDataSize / sizeof(int16_t));
+		isValid = (fread(samples.data(), sizeof(int16_t), samples.size(), pFile) == samples.size());
+	}
+
+	fclose(pFile);
+	return isValid;
+}
+}  // namespace wav
+
+static constexpr uint32_t FPS[4] = { 24, 25, 30, 30 };
+static constexpr uint32_t SECONDS = 4;
+
+static std::vector<ltc::TimeCode> s_Decoded;
+
+static void decoded(const struct ltc::decoder::Frame *pFrame) {
+	s_Decoded.push_back(pFrame->TimeCode);
+}
+
+static uint32_t to_frames(const ltc::TimeCode& tc, const uint32_t nFps) {
+	return ((tc.nHours * 60U + tc.nMinutes) * 60U + tc.nSeconds) * nFps + tc.nFrames;
+}
+
+static void encode(LtcEncoder& encoder, const ltc::Type type, std::vector<int16_t>& samples) {
+	const auto nFps = FPS[static_cast<uint32_t>(type)];
+	ltc::TimeCode tc = { 0, 58, 59, 1, static_cast<uint8_t>(type) };
+
+	samples.clear();
+
+	for (uint32_t i = 0; i < nFps * SECONDS; i++) {
+		encoder.SetTimeCode(&tc);
+		encoder.Encode();
+		const auto *pBuffer = encoder.GetBufferPointer();
+		samples.insert(samples.end(), pBuffer, pBuffer + encoder.GetBufferSize());
+
+		if (++tc.nFrames == nFps) {
+			tc.nFrames = 0;
+			if (++tc.nSeconds == 60) {
+				tc.nSeconds = 0;
+				if (++tc.nMinutes == 60) {
+					tc.nMinutes = 0;
+					tc.nHours++;
+				}
+			}
+		}
+	}
+}
+
+/*
+ * Linear interpolation for the playback speed, 30% level with a DC offset
+ */
+static void play(const std::vector<int16_t>& wav, const float fSpeed, const int32_t nNoise, const bool bInvert, std::vector<int16_t>& samples) {
+	samples.clear();
+
+	for (float fPosition = 0; fPosition < static_cast<float>(wav.size() - 1); fPosition += fSpeed) {
+		const auto i = static_cast<uint32_t>(fPosition);
+		const auto fFraction = fPosition - static_cast<float>(i);
+		auto fValue = static_cast<float>(wav[i]) * (1.0f - fFraction) + static_cast<float>(wav[i + 1]) * fFraction;
+
+		fValue = fValue * 0.3f + 3000.0f;
+
+		if (nNoise != 0) {
+			fValue += static_cast<float>((rand() % (2 * nNoise + 1)) - nNoise);
+		}
+
+		samples.push_back(static_cast<int16_t>(bInvert ? -fValue : fValue));
+	}
+}
+
+static void run(const std::vector<int16_t>& wav, const ltc::Type type, const float fSpeed, const int32_t nNoise, const bool bInvert) {
+	const auto nFps = FPS[static_cast<uint32_t>(type)];
+	std::vector<int16_t> samples;
+
+	play(wav, fSpeed, nNoise, bInvert, samples);
+
+	s_Decoded.clear();
+
+	LtcDecoder decoder;
+	decoder.SetCallback(decoded);
+
+	for (size_t i = 0; i < samples.size(); i += 256) {
+		decoder.Process(&samples[i], static_cast<uint32_t>(std::min<size_t>(256, samples.size() - i)));
+	}
+
+	printf("type %u speed %.1f noise %d%s: %u frames, speed %u/256\n", static_cast<unsigned int>(type), static_cast<double>(fSpeed), static_cast<int>(nNoise), bInvert ? " inverted" : "",
+			static_cast<unsigned int>(s_Decoded.size()), static_cast<unsigned int>(decoder.GetSpeed()));
+
+	/*
+	 * The first frames are needed to acquire the bit period
+	 */
+	CHECK(s_Decoded.size() + 4 >= nFps * SECONDS);
+	CHECK(decoder.GetStatistics().nInvalidFrames == 0);
+
+	for (size_t i = 1; i < s_Decoded.size(); i++) {
+		if (!CHECK(to_frames(s_Decoded[i], nFps) == to_frames(s_Decoded[i - 1], nFps) + 1)) {
+			break;
+		}
+	}
+
+	if (!s_Decoded.empty()) {
+		const auto& last = s_Decoded.back();
+		const auto nLast = to_frames({ 0, 58, 59, 1, 0 }, nFps) + nFps * SECONDS - 1;
+		/*
+		 * The last frame of the stream has no edge after its sync word
+		 */
+		CHECK((to_frames(last, nFps) + 1 == nLast) || (to_frames(last, nFps) == nLast));
+		CHECK(last.nType == static_cast<uint8_t>(type));
+	}
+
+	const auto nSpeed = decoder.GetSpeed();
+	const auto nExpected = static_cast<uint32_t>(fSpeed * 256.0f);
+	CHECK((nSpeed + 8 >= nExpected) && (nSpeed <= nExpected + 8));
+}
+
+int main() {
+	srand(1);
+
+	LtcEncoder encoder;
+
+	for (const auto type : { ltc::Type::FILM, ltc::Type::EBU, ltc::Type::SMPTE }) {
+		std::vector<int16_t> samples;
+		encode(encoder, type, samples);
+
+		char fileName[64];
+		snprintf(fileName, sizeof(fileName), "build_linux/ltc_%u.wav", static_cast<unsigned int>(type));
+
+		std::vector<int16_t> wav;
+
+		if (!CHECK(wav::write(fileName, samples) && wav::read(fileName, wav))) {
+			continue;
+		}
+
+		CHECK(wav == samples);
+
+		for (const auto fSpeed : { 0.5f, 1.0f, 2.0f }) {
+			run(wav, type, fSpeed, 0, false);
+			run(wav, type, fSpeed, 2000, false);
+			run(wav, type, fSpeed, 2000, true);
+		}
+	}
+
+	return test::result();
+}
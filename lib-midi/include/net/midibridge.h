@@ -0,0 +1,147 @@
+/**
+ * @file midibridge.h
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef NET_MIDIBRIDGE_H_
+#define NET_MIDIBRIDGE_H_
+
+#include <cstdint>
+#include <cassert>
+
+#include "net/rtpmidi.h"
+#include "net/rtpmidihandler.h"
+
+#include "midi.h"
+
+/**
+ * Bridge between the MIDI UART and an RTP-MIDI session.
+ *
+ * MIDI in -> network: the messages are queued and sent as one RTP-MIDI packet
+ * per tick, with the delta times encoded. A queued Control Change, Pitch Bend
+ * or Channel Pressure is updated in place by a newer value for the same
+ * controller, unless a note, a program change, bank select, (N)RPN or data
+ * entry of the same channel is queued after it. System Exclusive flushes the
+ * queue and is sent as is.
+ *
+ * Network -> MIDI out: the channel messages are sent with running status.
+ * The status byte is repeated after a pause, so a receiver connected later will
+ * synchronize.
+ */
+
+#if !defined (CONFIG_MIDI_BRIDGE_TICK_MS)
+# define CONFIG_MIDI_BRIDGE_TICK_MS	2
+#endif
+
+namespace midi::bridge {
+static constexpr uint32_t TICK_MS = CONFIG_MIDI_BRIDGE_TICK_MS;
+static constexpr uint32_t QUEUE_SIZE = 64;
+static constexpr uint32_t READ_MAX = 16;					///< UART bytes parsed per Run()
+static constexpr uint32_t RUNNING_STATUS_REFRESH_MS = 250;
+/*
+ * Delta time (up to 4 octets) followed by a 3 byte message
+ */
+static constexpr uint32_t EVENT_SIZE_MAX = 4 + 3;
+
+static_assert((QUEUE_SIZE * EVENT_SIZE_MAX) <= rtpmidi::COMMAND_LONG_LENGTH_MAX, "The queue must fit in one packet");
+
+struct Event {
+	uint32_t nTimestamp;	///< RTP timestamp
+	uint32_t nMicros;		///< For the latency
+	uint8_t nStatus;
+	uint8_t nData1;
+	uint8_t nData2;
+	uint8_t nLength;
+};
+
+struct Statistics {
+	uint32_t nEventsIn;
+	uint32_t nEventsOut;
+	uint32_t nCoalesced;		///< Superseded values replaced in the queue
+	uint32_t nDropped;			///< No session established
+	uint32_t nPackets;
+	uint32_t nQueueDepthMax;
+	uint32_t nLatencyMax;		///< Microseconds from MIDI in to packet sent
+	uint64_t nLatencyTotal;
+	uint32_t nUartMessages;
+	uint32_t nUartRunningStatus;	///< Status bytes not sent
+};
+}  // namespace midi::bridge
+
+class MidiBridge final: public RtpMidiHandler {
+public:
+	MidiBridge();
+
+	/**
+	 * @brief Reads the MIDI input and sends the queue when the tick has elapsed.
+	 * Call it once per superloop iteration.
+	 */
+	void Run();
+
+	/**
+	 * @brief Queues a message received from the MIDI input.
+	 * @param pMessage Pointer to the MIDI message.
+	 */
+	void Input(const struct midi::Message *pMessage);
+
+	/**
+	 * @brief Sends the queued messages in one RTP-MIDI packet.
+	 */
+	void Flush();
+
+	/**
+	 * @brief Message received from the RTP-MIDI session, sent to the MIDI output.
+	 */
+	void MidiMessage(const struct midi::Message *pMessage) override;
+
+	uint32_t GetQueueDepth() const {
+		return m_nEvents;
+	}
+
+	const struct midi::bridge::Statistics& GetStatistics() const {
+		return m_Statistics;
+	}
+
+	void Print();
+
+	static MidiBridge *Get() {
+		return s_pThis;
+	}
+
+private:
+	bool Coalesce(const uint8_t nStatus, const uint8_t nData1, const uint8_t nData2);
+	void SendSystemExclusive(const struct midi::Message *pMessage);
+
+private:
+	uint32_t m_nEvents { 0 };
+	uint32_t m_nFirstMillis { 0 };
+	uint32_t m_nRunningStatusMillis { 0 };
+	uint8_t m_nRunningStatusTx { 0 };
+
+	struct midi::bridge::Event m_Queue[midi::bridge::QUEUE_SIZE];
+	struct midi::bridge::Statistics m_Statistics;
+
+	static inline MidiBridge *s_pThis;
+};
+
+#endif /* NET_MIDIBRIDGE_H_ */
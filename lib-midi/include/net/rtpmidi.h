@@ -6,7 +6,7 @@
  * which extends AppleMidi to add functionality for RTP-MIDI communication.
  * It supports sending and receiving raw MIDI data, timecodes, and MIDI quarter frames.
  */
-/* Copyright (C) 2019-2024 by Arjan van Vught mailto:info@gd32-dmx.org
+/* Copyright (C) 2019-2025 by Arjan van Vught mailto:info@gd32-dmx.org
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -31,6 +31,7 @@
 #define NET_RTPMIDI_H_
 
 #include <cstdint>
+#include <cstring>
 #include <cassert>
 
 #include "net/applemidi.h"
@@ -65,6 +66,11 @@ struct Header {
  * @brief Offset for commands in the RTP-MIDI buffer.
  */
 static constexpr auto COMMAND_OFFSET = sizeof(struct Header);
+/*
+ * The MIDI command section header is 1 byte (B = 0) or 2 bytes (B = 1)
+ */
+static constexpr auto COMMAND_SHORT_LENGTH_MAX = 0x0FU;
+static constexpr auto COMMAND_LONG_LENGTH_MAX = BUFFER_SIZE - COMMAND_OFFSET - 2;
 }  // namespace rtpmidi
 
 /**
@@ -208,6 +214,47 @@ public:
 		nMidiQuarterFramePiece = (nMidiQuarterFramePiece + 1) & 0x07;
 	}
 
+	/**
+	 * @brief Sends a MIDI command list in one packet.
+	 *
+	 * The first command has no delta time (Z = 0), it is at nTimestamp.
+	 * The delta times of the following commands must be encoded by the caller.
+	 *
+	 * @param pCommands Pointer to the command list.
+	 * @param nLength Length of the command list.
+	 * @param nTimestamp RTP timestamp of the first command, see GetTimestamp().
+	 * @return false when there is no session established.
+	 */
+	bool SendCommands(const uint8_t *pCommands, const uint32_t nLength, const uint32_t nTimestamp) {
+		assert(nLength <= rtpmidi::COMMAND_LONG_LENGTH_MAX);
+
+		auto *pHeader = reinterpret_cast<rtpmidi::Header*>(m_pSendBuffer);
+
+		pHeader->nSequenceNumber = __builtin_bswap16(m_nSequenceNumber++);
+		pHeader->nTimestamp = __builtin_bswap32(nTimestamp);
+
+		uint32_t nOffset = rtpmidi::COMMAND_OFFSET;
+
+		if (nLength <= rtpmidi::COMMAND_SHORT_LENGTH_MAX) {
+			m_pSendBuffer[nOffset++] = static_cast<uint8_t>(nLength);
+		} else {
+			m_pSendBuffer[nOffset++] = static_cast<uint8_t>(0x80 | (nLength >> 8));
+			m_pSendBuffer[nOffset++] = static_cast<uint8_t>(nLength);
+		}
+
+		memcpy(&m_pSendBuffer[nOffset], pCommands, nLength);
+
+		return AppleMidi::Send(m_pSendBuffer, nOffset + nLength);
+	}
+
+	/**
+	 * @brief Gets the current RTP timestamp (10 kHz).
+	 * @return The current RTP timestamp.
+	 */
+	uint32_t GetTimestamp() {
+		return AppleMidi::Now();
+	}
+
 	/**
 	 * @brief Sets the RTP-MIDI handler.
 	 * @param pRtpMidiHandler Pointer to the RTP-MIDI handler instance.
@@ -278,7 +325,8 @@ private:
 		pHeader->nSequenceNumber = __builtin_bswap16(m_nSequenceNumber++);
 		pHeader->nTimestamp = __builtin_bswap32(AppleMidi::Now());
 
-		m_pSendBuffer[rtpmidi::COMMAND_OFFSET] = static_cast<uint8_t>(nLength); //FIXME BUG works now only
+		assert(nLength <= rtpmidi::COMMAND_SHORT_LENGTH_MAX);
+		m_pSendBuffer[rtpmidi::COMMAND_OFFSET] = static_cast<uint8_t>(nLength);
 
 		AppleMidi::Send(m_pSendBuffer, 1 + sizeof(struct rtpmidi::Header) + nLength);
 	}
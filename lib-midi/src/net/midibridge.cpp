@@ -0,0 +1,358 @@
+/**
+ * @file midibridge.cpp
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#if defined (DEBUG_NET_MIDIBRIDGE)
+# undef NDEBUG
+#endif
+
+#if defined(__GNUC__) && !defined(__clang__)
+# pragma GCC push_options
+# pragma GCC optimize ("O2")
+# pragma GCC optimize ("no-tree-loop-distribute-patterns")
+#endif
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cassert>
+
+#include "net/midibridge.h"
+#include "net/rtpmidi.h"
+
+#include "midi.h"
+
+#include "hardware.h"
+
+#include "debug.h"
+
+using namespace midi::bridge;
+
+static uint8_t s_Commands[QUEUE_SIZE * EVENT_SIZE_MAX];
+
+/*
+ * Variable length, 7 bits per octet, most significant first
+ */
+static uint32_t encode_delta_time(uint8_t *pDst, uint32_t nDelta) {
+	nDelta &= 0x0FFFFFFF;
+
+	uint32_t nLength = 0;
+
+	if (nDelta >= (1U << 21)) {
+		pDst[nLength++] = static_cast<uint8_t>(0x80 | (nDelta >> 21));
+	}
+
+	if (nDelta >= (1U << 14)) {
+		pDst[nLength++] = static_cast<uint8_t>(0x80 | ((nDelta >> 14) & 0x7F));
+	}
+
+	if (nDelta >= (1U << 7)) {
+		pDst[nLength++] = static_cast<uint8_t>(0x80 | ((nDelta >> 7) & 0x7F));
+	}
+
+	pDst[nLength++] = static_cast<uint8_t>(nDelta & 0x7F);
+
+	return nLength;
+}
+
+/*
+ * The order matters for bank select, (N)RPN, data entry and channel mode messages
+ */
+static bool is_coalescable_controller(const uint8_t nController) {
+	switch (nController) {
+	case 0:		// Bank Select MSB
+	case 6:		// Data Entry MSB
+	case 32:	// Bank Select LSB
+	case 38:	// Data Entry LSB
+	case 96:	// Data Increment
+	case 97:	// Data Decrement
+	case 98:	// NRPN LSB
+	case 99:	// NRPN MSB
+	case 100:	// RPN LSB
+	case 101:	// RPN MSB
+		return false;
+	default:
+		break;
+	}
+
+	return nController < 120;
+}
+
+/*
+ * A newer value is not moved in front of a note, a program change or a controller whose order matters
+ */
+static bool is_order_dependent(const struct Event& event) {
+	switch (static_cast<midi::Types>(event.nStatus & 0xF0)) {
+	case midi::Types::NOTE_OFF:
+	case midi::Types::NOTE_ON:
+	case midi::Types::AFTER_TOUCH_POLY:
+	case midi::Types::PROGRAM_CHANGE:
+		return true;
+	case midi::Types::CONTROL_CHANGE:
+		return !is_coalescable_controller(event.nData1);
+	default:
+		break;
+	}
+
+	return false;
+}
+
+MidiBridge::MidiBridge() {
+	DEBUG_ENTRY
+
+	assert(s_pThis == nullptr);
+	s_pThis = this;
+
+	memset(&m_Statistics, 0, sizeof(struct Statistics));
+
+	DEBUG_EXIT
+}
+
+void MidiBridge::Run() {
+	auto *pMidi = Midi::Get();
+
+	for (uint32_t i = 0; i < READ_MAX; i++) {
+		if (pMidi->Read()) {
+			Input(pMidi->GetMessage());
+		}
+	}
+
+	if ((m_nEvents != 0) && ((Hardware::Get()->Millis() - m_nFirstMillis) >= TICK_MS)) {
+		Flush();
+	}
+}
+
+bool MidiBridge::Coalesce(const uint8_t nStatus, const uint8_t nData1, const uint8_t nData2) {
+	const auto nType = static_cast<midi::Types>(nStatus & 0xF0);
+
+	if (nType == midi::Types::CONTROL_CHANGE) {
+		if (!is_coalescable_controller(nData1)) {
+			return false;
+		}
+	} else if ((nType != midi::Types::PITCH_BEND) && (nType != midi::Types::AFTER_TOUCH_CHANNEL)) {
+		return false;
+	}
+
+	// The queued value is replaced unless an order dependent event of the same channel is queued after it
+	const auto nChannel = static_cast<uint8_t>(nStatus & 0x0F);
+
+	for (auto i = m_nEvents; i-- > 0;) {
+		auto& event = m_Queue[i];
+
+		if ((event.nStatus >= 0xF0) || ((event.nStatus & 0x0F) != nChannel)) {
+			continue;
+		}
+
+		if ((event.nStatus == nStatus) && ((nType != midi::Types::CONTROL_CHANGE) || (event.nData1 == nData1))) {
+			event.nData1 = nData1;
+			event.nData2 = nData2;
+			return true;
+		}
+
+		if (is_order_dependent(event)) {
+			return false;
+		}
+	}
+
+	return false;
+}
+
+void MidiBridge::Input(const struct midi::Message *pMessage) {
+	assert(pMessage != nullptr);
+
+	m_Statistics.nEventsIn++;
+
+	const auto type = pMessage->tType;
+
+	if (type == midi::Types::INVALIDE_TYPE) {
+		return;
+	}
+
+	if (type == midi::Types::SYSTEM_EXCLUSIVE) {
+		Flush();
+		SendSystemExclusive(pMessage);
+		return;
+	}
+
+	auto nStatus = static_cast<uint8_t>(type);
+
+	if (type < midi::Types::SYSTEM_EXCLUSIVE) {
+		nStatus = static_cast<uint8_t>(nStatus | ((pMessage->nChannel - 1U) & 0x0F));
+	}
+
+	if (Coalesce(nStatus, pMessage->nData1, pMessage->nData2)) {
+		m_Statistics.nCoalesced++;
+		return;
+	}
+
+	if (m_nEvents == QUEUE_SIZE) {
+		Flush();
+	}
+
+	if (m_nEvents == 0) {
+		m_nFirstMillis = Hardware::Get()->Millis();
+	}
+
+	auto& event = m_Queue[m_nEvents++];
+
+	event.nTimestamp = RtpMidi::Get()->GetTimestamp();
+	event.nMicros = Hardware::Get()->Micros();
+	event.nStatus = nStatus;
+	event.nData1 = pMessage->nData1;
+	event.nData2 = pMessage->nData2;
+	event.nLength = static_cast<uint8_t>(pMessage->nBytesCount > 3 ? 3 : pMessage->nBytesCount);
+
+	if (m_nEvents > m_Statistics.nQueueDepthMax) {
+		m_Statistics.nQueueDepthMax = m_nEvents;
+	}
+}
+
+/**
+ * One packet with all the queued messages. The first message is at the
+ * RTP timestamp, each next message has the delta time to the previous one.
+ */
+void MidiBridge::Flush() {
+	if (m_nEvents == 0) {
+		return;
+	}
+
+	const auto nMicros = Hardware::Get()->Micros();
+	auto nTimestampPrevious = m_Queue[0].nTimestamp;
+	uint32_t nLength = 0;
+	uint32_t nLatencyMax = 0;
+	uint64_t nLatencyTotal = 0;
+
+	for (uint32_t i = 0; i < m_nEvents; i++) {
+		const auto& event = m_Queue[i];
+
+		if (i != 0) {
+			nLength += encode_delta_time(&s_Commands[nLength], event.nTimestamp - nTimestampPrevious);
+			nTimestampPrevious = event.nTimestamp;
+		}
+
+		s_Commands[nLength++] = event.nStatus;
+
+		if (event.nLength > 1) {
+			s_Commands[nLength++] = event.nData1;
+		}
+
+		if (event.nLength > 2) {
+			s_Commands[nLength++] = event.nData2;
+		}
+
+		const auto nLatency = nMicros - event.nMicros;
+
+		nLatencyTotal += nLatency;
+
+		if (nLatency > nLatencyMax) {
+			nLatencyMax = nLatency;
+		}
+	}
+
+	assert(nLength <= sizeof(s_Commands));
+
+	if (RtpMidi::Get()->SendCommands(s_Commands, nLength, m_Queue[0].nTimestamp)) {
+		m_Statistics.nPackets++;
+		m_Statistics.nEventsOut += m_nEvents;
+		m_Statistics.nLatencyTotal += nLatencyTotal;
+
+		if (nLatencyMax > m_Statistics.nLatencyMax) {
+			m_Statistics.nLatencyMax = nLatencyMax;
+		}
+	} else {
+		m_Statistics.nDropped += m_nEvents;
+	}
+
+	m_nEvents = 0;
+}
+
+void MidiBridge::SendSystemExclusive(const struct midi::Message *pMessage) {
+	if (RtpMidi::Get()->SendCommands(pMessage->aSystemExclusive, pMessage->nBytesCount, RtpMidi::Get()->GetTimestamp())) {
+		m_Statistics.nPackets++;
+		m_Statistics.nEventsOut++;
+	} else {
+		m_Statistics.nDropped++;
+	}
+}
+
+/**
+ * A System Common message cancels the running status, a System Real Time message does not.
+ */
+void MidiBridge::MidiMessage(const struct midi::Message *pMessage) {
+	assert(pMessage != nullptr);
+
+	const auto type = pMessage->tType;
+
+	if (type == midi::Types::INVALIDE_TYPE) {
+		return;
+	}
+
+	auto *pMidi = Midi::Get();
+
+	m_Statistics.nUartMessages++;
+
+	if (type == midi::Types::SYSTEM_EXCLUSIVE) {
+		m_nRunningStatusTx = 0;
+		pMidi->SendRaw(pMessage->aSystemExclusive, pMessage->nBytesCount);
+		return;
+	}
+
+	const uint32_t nLength = pMessage->nBytesCount > 3 ? 3 : pMessage->nBytesCount;
+	uint8_t aData[3];
+
+	aData[0] = static_cast<uint8_t>(type);
+	aData[1] = pMessage->nData1;
+	aData[2] = pMessage->nData2;
+
+	if (type < midi::Types::SYSTEM_EXCLUSIVE) {
+		aData[0] = static_cast<uint8_t>(aData[0] | ((pMessage->nChannel - 1U) & 0x0F));
+
+		const auto nMillis = Hardware::Get()->Millis();
+
+		if ((aData[0] == m_nRunningStatusTx) && ((nMillis - m_nRunningStatusMillis) < RUNNING_STATUS_REFRESH_MS)) {
+			m_Statistics.nUartRunningStatus++;
+			pMidi->SendRaw(&aData[1], nLength - 1);
+			return;
+		}
+
+		m_nRunningStatusTx = aData[0];
+		m_nRunningStatusMillis = nMillis;
+	} else if (type < midi::Types::CLOCK) {
+		m_nRunningStatusTx = 0;
+	}
+
+	pMidi->SendRaw(aData, nLength);
+}
+
+void MidiBridge::Print() {
+	const auto nLatencyAverage = m_Statistics.nEventsOut == 0 ? 0 : static_cast<uint32_t>(m_Statistics.nLatencyTotal / m_Statistics.nEventsOut);
+
+	puts("MIDI Bridge");
+	printf(" Tick      : %u ms\n", static_cast<unsigned int>(TICK_MS));
+	printf(" Events    : %u in, %u out, %u coalesced, %u dropped\n", static_cast<unsigned int>(m_Statistics.nEventsIn), static_cast<unsigned int>(m_Statistics.nEventsOut), static_cast<unsigned int>(m_Statistics.nCoalesced), static_cast<unsigned int>(m_Statistics.nDropped));
+	printf(" Packets   : %u\n", static_cast<unsigned int>(m_Statistics.nPackets));
+	printf(" Queue     : %u, max %u/%u\n", static_cast<unsigned int>(m_nEvents), static_cast<unsigned int>(m_Statistics.nQueueDepthMax), static_cast<unsigned int>(QUEUE_SIZE));
+	printf(" Latency   : %u us average, %u us max\n", static_cast<unsigned int>(nLatencyAverage), static_cast<unsigned int>(m_Statistics.nLatencyMax));
+	printf(" MIDI out  : %u messages, %u running status\n", static_cast<unsigned int>(m_Statistics.nUartMessages), static_cast<unsigned int>(m_Statistics.nUartRunningStatus));
+}
@@ -0,0 +1,357 @@
+/**
+ * @file test_midibridge.cpp
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * MIDI in -> network: the queue is sent with Flush() and the commands of the
+ * RTP-MIDI packet are checked, for the delta time encoding and for the
+ * coalescing of the Control Change, Pitch Bend and Channel Pressure values.
+ * Network -> MIDI out: the bytes sent to the UART are checked for running status.
+ *
+ * The network, the UART and the software timers are implemented by the test,
+ * the time is simulated.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "net/midibridge.h"
+#include "net/rtpmidi.h"
+#include "net/apps/mdns.h"
+
+#include "midi.h"
+
+#include "hardware.h"
+#include "network.h"
+#include "softwaretimers.h"
+
+#include "test.h"
+
+namespace {
+static constexpr uint16_t PORT_CONTROL = 5004;
+static constexpr uint16_t PORT_MIDI = 5005;
+static constexpr uint32_t REMOTE_IP = 0x0100000A;
+
+std::vector<uint8_t> s_Packet;
+std::vector<uint8_t> s_Uart;
+}  // namespace
+
+Network *Network::s_pThis;
+Midi *Midi::s_pThis;
+
+Network::Network(int, char **) {
+	s_pThis = this;
+	strcpy(m_aHostName, "test");
+}
+
+Network::~Network() {
+	s_pThis = nullptr;
+}
+
+int32_t Network::Begin(uint16_t nPort, net::UdpCallbackFunctionPtr) {
+	return nPort;
+}
+
+int32_t Network::End(uint16_t) {
+	return 0;
+}
+
+void Network::MacAddressCopyTo(uint8_t *pMacAddress) {
+	memset(pMacAddress, 0x11, net::MAC_SIZE);
+}
+
+void Network::SendTo(int32_t nHandle, const void *pBuffer, uint32_t nLength, uint32_t, uint16_t) {
+	if (nHandle == PORT_MIDI) {
+		const auto *p = reinterpret_cast<const uint8_t *>(pBuffer);
+		s_Packet.assign(p, p + nLength);
+	}
+}
+
+bool mdns_service_record_add(const char *, const mdns::Services, const char *, const uint16_t) {
+	return true;
+}
+
+TimerHandle_t SoftwareTimerAdd(const uint32_t, const TimerCallbackFunction_t) {
+	return 1;
+}
+
+bool SoftwareTimerDelete(TimerHandle_t& nId) {
+	nId = TIMER_ID_NONE;
+	return true;
+}
+
+bool SoftwareTimerChange(const TimerHandle_t, const uint32_t) {
+	return true;
+}
+
+Midi::Midi() {
+	s_pThis = this;
+}
+
+bool Midi::Parse() {
+	return false;
+}
+
+void uart_transmit(const uint32_t, const uint8_t *pData, uint32_t nLength) {
+	s_Uart.insert(s_Uart.end(), pData, pData + nLength);
+}
+
+namespace {
+midi::Message message(const midi::Types type, const uint8_t nChannel, const uint8_t nData1, const uint8_t nData2 = 0, const uint8_t nBytesCount = 3) {
+	midi::Message msg {};
+
+	msg.tType = type;
+	msg.nChannel = nChannel;
+	msg.nData1 = nData1;
+	msg.nData2 = nData2;
+	msg.nBytesCount = nBytesCount;
+
+	return msg;
+}
+
+midi::Message cc(const uint8_t nChannel, const uint8_t nController, const uint8_t nValue) {
+	return message(midi::Types::CONTROL_CHANGE, nChannel, nController, nValue);
+}
+
+/*
+ * Invitation on the control port and on the MIDI port
+ */
+void establish_session(RtpMidi& rtpMidi) {
+	applemidi::ExchangePacket invitation {};
+
+	invitation.nSignature = 0xFFFF;
+	invitation.nCommand = __builtin_bswap16(0x494E);	// "IN"
+
+	rtpMidi.InputControlMessage(reinterpret_cast<const uint8_t *>(&invitation), sizeof(invitation), REMOTE_IP, PORT_CONTROL);
+	rtpMidi.InputMidiMessage(reinterpret_cast<const uint8_t *>(&invitation), sizeof(invitation), REMOTE_IP, PORT_MIDI);
+}
+
+/*
+ * The commands of the packet sent, without the RTP header and the command section header
+ */
+std::vector<uint8_t> flush(MidiBridge& bridge, uint32_t *pTimestamp = nullptr) {
+	s_Packet.clear();
+	bridge.Flush();
+
+	if (s_Packet.size() <= rtpmidi::COMMAND_OFFSET) {
+		return {};
+	}
+
+	if (pTimestamp != nullptr) {
+		uint32_t nTimestamp;
+		memcpy(&nTimestamp, &s_Packet[4], sizeof(uint32_t));
+		*pTimestamp = __builtin_bswap32(nTimestamp);
+	}
+
+	auto nOffset = rtpmidi::COMMAND_OFFSET;
+	uint32_t nLength = s_Packet[nOffset++];
+
+	if (nLength & 0x80) {
+		nLength = ((nLength & 0x0F) << 8) | s_Packet[nOffset++];
+	}
+
+	if ((nOffset + nLength) != s_Packet.size()) {
+		return {};
+	}
+
+	return std::vector<uint8_t>(s_Packet.begin() + nOffset, s_Packet.end());
+}
+
+/*
+ * Variable length quantity, reference implementation
+ */
+void append_delta_time(std::vector<uint8_t>& v, uint32_t nDelta) {
+	uint8_t groups[4];
+	uint32_t nGroups = 0;
+
+	do {
+		groups[nGroups++] = static_cast<uint8_t>(nDelta & 0x7F);
+		nDelta >>= 7;
+	} while (nDelta != 0);
+
+	while (nGroups-- > 1) {
+		v.push_back(groups[nGroups] | 0x80);
+	}
+
+	v.push_back(groups[0]);
+}
+
+void test_delta_time(MidiBridge& bridge) {
+	// Milliseconds, the RTP timestamp is 10 kHz: 0, 120, 130, 16380, 16390, 2097150 and 2097160
+	static constexpr uint32_t STEPS_MS[] = { 0, 12, 13, 1638, 1639, 209715, 209716 };
+
+	const auto nStart = RtpMidi::Get()->GetTimestamp();
+	std::vector<uint8_t> expected;
+	uint8_t nNote = 36;
+
+	for (const auto nStep : STEPS_MS) {
+		test::g_nMicros += static_cast<uint64_t>(nStep) * 1000U;
+
+		if (nNote != 36) {
+			append_delta_time(expected, nStep * 10U);
+		}
+
+		const auto msg = message(midi::Types::NOTE_ON, 1, nNote, 100);
+		bridge.Input(&msg);
+
+		expected.push_back(0x90);
+		expected.push_back(nNote++);
+		expected.push_back(100);
+	}
+
+	uint32_t nTimestamp = 0;
+	const auto commands = flush(bridge, &nTimestamp);
+
+	CHECK(nTimestamp == nStart);
+	CHECK(commands == expected);
+
+	// The 2 byte messages
+	auto msg = message(midi::Types::PROGRAM_CHANGE, 16, 5, 0, 2);
+	bridge.Input(&msg);
+	msg = message(midi::Types::AFTER_TOUCH_CHANNEL, 16, 64, 0, 2);
+	bridge.Input(&msg);
+
+	CHECK(flush(bridge) == std::vector<uint8_t>({ 0xCF, 5, 0x00, 0xDF, 64 }));
+}
+
+struct Coalesce {
+	const char *pName;
+	std::vector<midi::Message> in;
+	std::vector<uint8_t> out;	///< The delta times are 0
+};
+
+void test_coalesce(MidiBridge& bridge) {
+	const auto clock = message(midi::Types::CLOCK, 0, 0, 0, 1);
+	const auto noteOn = message(midi::Types::NOTE_ON, 1, 60, 100);
+	const auto programChange = message(midi::Types::PROGRAM_CHANGE, 1, 3, 0, 2);
+	const auto bend1 = message(midi::Types::PITCH_BEND, 1, 0, 64);
+	const auto bend2 = message(midi::Types::PITCH_BEND, 1, 1, 65);
+	const auto pressure1 = message(midi::Types::AFTER_TOUCH_CHANNEL, 1, 10, 0, 2);
+	const auto pressure2 = message(midi::Types::AFTER_TOUCH_CHANNEL, 1, 20, 0, 2);
+
+	const Coalesce COALESCE[] = {
+		{ "same controller", { cc(1, 7, 10), cc(1, 7, 20), cc(1, 7, 30) }, { 0xB0, 7, 30 } },
+		{ "other controller between", { cc(1, 7, 10), cc(1, 10, 5), cc(1, 7, 20) }, { 0xB0, 7, 20, 0, 0xB0, 10, 5 } },
+		{ "other channel between", { cc(1, 7, 10), cc(2, 7, 1), cc(1, 7, 20) }, { 0xB0, 7, 20, 0, 0xB1, 7, 1 } },
+		{ "system real time between", { cc(1, 7, 10), clock, cc(1, 7, 20) }, { 0xB0, 7, 20, 0, 0xF8 } },
+		{ "note between", { cc(1, 7, 10), noteOn, cc(1, 7, 20) }, { 0xB0, 7, 10, 0, 0x90, 60, 100, 0, 0xB0, 7, 20 } },
+		{ "program change between", { cc(1, 7, 10), programChange, cc(1, 7, 20) }, { 0xB0, 7, 10, 0, 0xC0, 3, 0, 0xB0, 7, 20 } },
+		{ "bank select between", { cc(1, 7, 10), cc(1, 0, 1), cc(1, 7, 20) }, { 0xB0, 7, 10, 0, 0xB0, 0, 1, 0, 0xB0, 7, 20 } },
+		{ "RPN between", { cc(1, 7, 10), cc(1, 101, 0), cc(1, 7, 20) }, { 0xB0, 7, 10, 0, 0xB0, 101, 0, 0, 0xB0, 7, 20 } },
+		{ "NRPN between", { cc(1, 7, 10), cc(1, 98, 0), cc(1, 7, 20) }, { 0xB0, 7, 10, 0, 0xB0, 98, 0, 0, 0xB0, 7, 20 } },
+		{ "data increment between", { cc(1, 7, 10), cc(1, 96, 0), cc(1, 7, 20) }, { 0xB0, 7, 10, 0, 0xB0, 96, 0, 0, 0xB0, 7, 20 } },
+		{ "data entry", { cc(1, 6, 1), cc(1, 6, 2), cc(1, 38, 3), cc(1, 38, 4) }, { 0xB0, 6, 1, 0, 0xB0, 6, 2, 0, 0xB0, 38, 3, 0, 0xB0, 38, 4 } },
+		{ "bank select", { cc(1, 0, 1), cc(1, 0, 2), cc(1, 32, 3), cc(1, 32, 4) }, { 0xB0, 0, 1, 0, 0xB0, 0, 2, 0, 0xB0, 32, 3, 0, 0xB0, 32, 4 } },
+		{ "channel mode", { cc(1, 7, 10), cc(1, 121, 0), cc(1, 7, 20), cc(1, 123, 0), cc(1, 123, 0) }, { 0xB0, 7, 10, 0, 0xB0, 121, 0, 0, 0xB0, 7, 20, 0, 0xB0, 123, 0, 0, 0xB0, 123, 0 } },
+		{ "RPN sequence", { cc(1, 101, 0), cc(1, 100, 0), cc(1, 6, 2), cc(1, 101, 0), cc(1, 100, 1), cc(1, 6, 64) }, { 0xB0, 101, 0, 0, 0xB0, 100, 0, 0, 0xB0, 6, 2, 0, 0xB0, 101, 0, 0, 0xB0, 100, 1, 0, 0xB0, 6, 64 } },
+		{ "pitch bend", { bend1, cc(1, 1, 5), bend2 }, { 0xE0, 1, 65, 0, 0xB0, 1, 5 } },
+		{ "pitch bend note between", { bend1, noteOn, bend2 }, { 0xE0, 0, 64, 0, 0x90, 60, 100, 0, 0xE0, 1, 65 } },
+		{ "channel pressure", { pressure1, pressure2 }, { 0xD0, 20 } },
+	};
+
+	uint32_t nErrors = 0;
+
+	for (const auto& test : COALESCE) {
+		for (const auto& msg : test.in) {
+			bridge.Input(&msg);
+		}
+
+		if (flush(bridge) != test.out) {
+			printf("Coalesce: %s\n", test.pName);
+			nErrors++;
+		}
+	}
+
+	CHECK(nErrors == 0);
+
+	// The statistics of the first test case only
+	const auto nCoalesced = bridge.GetStatistics().nCoalesced;
+
+	bridge.Input(&COALESCE[0].in[0]);
+	bridge.Input(&COALESCE[0].in[1]);
+	bridge.Input(&COALESCE[0].in[2]);
+
+	CHECK(bridge.GetQueueDepth() == 1);
+	CHECK(bridge.GetStatistics().nCoalesced == (nCoalesced + 2));
+
+	flush(bridge);
+}
+
+void test_running_status(MidiBridge& bridge) {
+	s_Uart.clear();
+
+	const midi::Message MESSAGES[] = {
+		message(midi::Types::NOTE_ON, 1, 60, 100),
+		message(midi::Types::NOTE_ON, 1, 61, 100),		// Running status
+		message(midi::Types::CLOCK, 0, 0, 0, 1),		// Does not cancel the running status
+		message(midi::Types::NOTE_ON, 1, 62, 100),		// Running status
+		message(midi::Types::NOTE_ON, 2, 62, 100),
+		message(midi::Types::SONG_SELECT, 0, 3, 0, 2),	// Cancels the running status
+		message(midi::Types::NOTE_ON, 2, 63, 100),
+		message(midi::Types::PROGRAM_CHANGE, 2, 1, 0, 2),
+		message(midi::Types::PROGRAM_CHANGE, 2, 2, 0, 2),	// Running status
+	};
+
+	for (const auto& msg : MESSAGES) {
+		bridge.MidiMessage(&msg);
+	}
+
+	CHECK(s_Uart == std::vector<uint8_t>({ 0x90, 60, 100, 61, 100, 0xF8, 62, 100, 0x91, 62, 100, 0xF3, 3, 0x91, 63, 100, 0xC1, 1, 2 }));
+
+	// The status byte is repeated after a pause
+	s_Uart.clear();
+
+	const auto noteOn = message(midi::Types::NOTE_ON, 2, 64, 1);
+
+	bridge.MidiMessage(&noteOn);
+	test::g_nMicros += (midi::bridge::RUNNING_STATUS_REFRESH_MS - 1) * 1000U;
+	bridge.MidiMessage(&noteOn);
+	test::g_nMicros += 1000U;
+	bridge.MidiMessage(&noteOn);
+
+	CHECK(s_Uart == std::vector<uint8_t>({ 0x91, 64, 1, 64, 1, 0x91, 64, 1 }));
+}
+}  // namespace
+
+int main() {
+	Network network(0, nullptr);
+	Midi midi;
+	RtpMidi rtpMidi;
+	MidiBridge bridge;
+
+	test::g_nMicros = 1000000;
+
+	rtpMidi.Start();
+	rtpMidi.SetHandler(&bridge);
+
+	establish_session(rtpMidi);
+
+	test_delta_time(bridge);
+	test_coalesce(bridge);
+	test_running_status(bridge);
+
+	return test::result();
+}
@@ -37,6 +37,11 @@ int32_t tcp_begin(const uint16_t, TcpCallbackFunctionPtr callback);
 int32_t tcp_end(const int32_t);
 void tcp_write(const int32_t, const uint8_t *, uint32_t, const uint32_t);
 void tcp_abort(const int32_t, const uint32_t);
+/**
+ * @return The number of bytes tcp_write accepts now for the connection,
+ * the send window plus the free space in the transmission queue.
+ */
+uint32_t tcp_get_send_space(const int32_t, const uint32_t);
 }  // namespace net
 
 #endif /* NET_TCP_H_ */
@@ -28,6 +28,7 @@
 # undef NDEBUG
 #endif
 
+#include <cstdint>
 #include <cstdio>
 #include <string.h>
 #include <sys/socket.h>
@@ -186,6 +187,11 @@ void tcp_write(const int32_t nHandle, const uint8_t *pBuffer, uint32_t nLength,
 	}
 }
 
+uint32_t tcp_get_send_space([[maybe_unused]] const int32_t nHandle, [[maybe_unused]] const uint32_t HandleConnectionIndex) {
+	// The socket buffer of the kernel takes care of the flow control
+	return UINT32_MAX;
+}
+
 static void close_with_rst(int socket_fd) {
 	struct linger linger_option = {1, 0}; // Enable linger, zero timeout
 	setsockopt(socket_fd, SOL_SOCKET, SO_LINGER, &linger_option, sizeof(linger_option));
@@ -196,7 +202,18 @@ static void close_with_rst(int socket_fd) {
 
 
 void tcp_abort(const int32_t nHandle, const uint32_t HandleConnectionIndex) {
-	close_with_rst(poll_set[nHandle][HandleConnectionIndex].fd);
+	auto& pollSet = poll_set[nHandle][HandleConnectionIndex];
+
+	// There is no connection
+	if ((pollSet.fd == 0) || (pollSet.fd == server_sockfd[nHandle])) {
+		return;
+	}
+
+	close_with_rst(pollSet.fd);
+
+	pollSet.fd = 0;
+	pollSet.events = 0;
+	pollSet.revents = 0;
 }
 
 void tcp_run() {
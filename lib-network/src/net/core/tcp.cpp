@@ -1055,6 +1055,12 @@ __attribute__((hot)) void tcp_input(struct t_tcp *pTcp) {
 
 					s_Ports[nIndexPort].callback(nIndexTCB, reinterpret_cast<uint8_t *>(&pTcp->tcp) + nDataOffset, nDataLength);
 
+					// The callback has aborted the connection
+					if (pTCB->state == STATE_LISTEN) {
+						DEBUG_EXIT
+						return;
+					}
+
 					// Send acknowledgment
 					SendInfo sendInfo;
 					sendInfo.SEQ = pTCB->SND.NXT;
@@ -1208,7 +1214,14 @@ void tcp_write(const int32_t nHandleListen, const uint8_t *pBuffer, uint32_t nLe
 
 	const auto *p = pBuffer;
 
-	while ((nLength > 0) && (nLength <= pTCB->SND.WND)) {
+#if defined(TCP_TX_QUEUE_SIZE)
+	// Keep the order, when there is queued data for this connection then the new data is queued as well
+	const auto isQueued = !s_Ports[nHandleListen].transmissionQueue.dataSegmentQueue.IsEmpty() && (s_Ports[nHandleListen].transmissionQueue.pTcb == pTCB);
+#else
+	constexpr auto isQueued = false;
+#endif
+
+	while (!isQueued && (nLength > 0) && (nLength <= pTCB->SND.WND)) {
 		const auto nWriteLength = (nLength > TCP_DATA_SIZE) ? TCP_DATA_SIZE : nLength;
 		const bool isLastSegment = (nLength < TCP_DATA_SIZE);
 
@@ -1222,7 +1235,7 @@ void tcp_write(const int32_t nHandleListen, const uint8_t *pBuffer, uint32_t nLe
 #if defined(TCP_TX_QUEUE_SIZE)
 		auto& transmissionQueue = s_Ports[nHandleListen].transmissionQueue;
 		auto& dataSegmentQueue = transmissionQueue.dataSegmentQueue;
-		assert(dataSegmentQueue.IsEmpty());
+		assert(dataSegmentQueue.IsEmpty() || (transmissionQueue.pTcb == pTCB));
 
 		transmissionQueue.pTcb = pTCB;
 
@@ -1240,6 +1253,32 @@ void tcp_write(const int32_t nHandleListen, const uint8_t *pBuffer, uint32_t nLe
 	}
 }
 
+uint32_t tcp_get_send_space(const int32_t nHandleListen, const uint32_t nHandleConnection) {
+	assert(nHandleListen >= 0);
+	assert(nHandleListen < TCP_MAX_PORTS_ALLOWED);
+	assert(nHandleConnection < TCP_MAX_TCBS_ALLOWED);
+
+	const auto *pTCB = &s_Ports[nHandleListen].TCB[nHandleConnection];
+
+#if defined(TCP_TX_QUEUE_SIZE)
+	const auto& transmissionQueue = s_Ports[nHandleListen].transmissionQueue;
+	const auto& dataSegmentQueue = transmissionQueue.dataSegmentQueue;
+
+	if (!dataSegmentQueue.IsEmpty()) {
+		if (transmissionQueue.pTcb != pTCB) {
+			return 0;
+		}
+
+		return dataSegmentQueue.GetFree() * TCP_DATA_SIZE;
+	}
+
+	constexpr uint32_t nQueueSize = TCP_TX_QUEUE_SIZE * TCP_DATA_SIZE;
+	return (pTCB->SND.WND > nQueueSize) ? pTCB->SND.WND : nQueueSize;
+#else
+	return pTCB->SND.WND;
+#endif
+}
+
 void tcp_abort(const int32_t nHandleListen, const uint32_t nHandleConnection) {
 	assert(nHandleListen >= 0);
 	assert(nHandleListen < TCP_MAX_PORTS_ALLOWED);
@@ -1248,12 +1287,30 @@ void tcp_abort(const int32_t nHandleListen, const uint32_t nHandleConnection) {
 	auto *pTCB = &s_Ports[nHandleListen].TCB[nHandleConnection];
 	assert(pTCB != nullptr);
 
+	// There is no connection
+	if (pTCB->state == STATE_LISTEN) {
+		return;
+	}
+
 	struct SendInfo info;
 	info.CTL = Control::RST;
 	info.SEQ = pTCB->SND.NXT;
 	info.ACK = pTCB->RCV.NXT;
 
 	tcp_send_segment(pTCB, info);
+
+#if defined(TCP_TX_QUEUE_SIZE)
+	// The queued data must not follow the reset
+	auto& transmissionQueue = s_Ports[nHandleListen].transmissionQueue;
+
+	if (transmissionQueue.pTcb == pTCB) {
+		while (!transmissionQueue.dataSegmentQueue.IsEmpty()) {
+			transmissionQueue.dataSegmentQueue.Pop();
+		}
+	}
+#endif
+
+	tcp_init_tcb(pTCB, s_Ports[nHandleListen].nLocalPort);
 }
 
 }  // namespace net
@@ -2,7 +2,7 @@
  * @file datasegmentqueue.h
  *
  */
-/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+/* Copyright (C) 2024-2025 by Arjan van Vught mailto:info@gd32-dmx.org
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -52,6 +52,14 @@ public:
 		return m_isFull;
 	}
 
+	uint32_t GetFree() const {
+		if (m_isFull) {
+			return 0;
+		}
+
+		return TCP_TX_QUEUE_SIZE - ((m_nHead + TCP_TX_QUEUE_SIZE - m_nTail) % TCP_TX_QUEUE_SIZE);
+	}
+
 	bool Push(const uint8_t *pData, const uint32_t nLength, const bool isLastSegment) {
 		assert(pData != nullptr);
 		assert(nLength > 0);
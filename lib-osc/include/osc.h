@@ -27,6 +27,7 @@
 #define OSC_H_
 
 #include <cstdint>
+#include <cstring>
 
 namespace osc {
 namespace validate {
@@ -72,6 +73,13 @@ namespace port {
 static constexpr uint16_t DEFAULT_INCOMING = 8000;
 static constexpr uint16_t DEFAULT_OUTGOING = 9000;
 }  // namespace port
+namespace bundle {
+/* '#bundle' OSC-string followed by the OSC Time Tag */
+static constexpr char ID[] = "#bundle";
+static constexpr uint32_t HEADER_SIZE = 16;
+/* Seconds since midnight on January 1, 1900 (32 bits) and fractional parts of a second (32 bits) */
+static constexpr uint64_t TIMETAG_IMMEDIATELY = 1;
+}  // namespace bundle
 }  // namespace osc
 
 extern "C" {
@@ -88,6 +96,20 @@ inline static char *get_path(void *pPath, unsigned nSize) {
 inline static bool is_match(const char *str, const char *p) {
 	return lo_pattern_match(str, p) == 0 ? false : true;
 }
+
+inline static bool is_bundle(const void *pData, uint32_t nSize) {
+	return (nSize >= bundle::HEADER_SIZE) && (memcmp(pData, bundle::ID, sizeof(bundle::ID)) == 0);
+}
+
+inline static uint32_t get_uint32(const uint8_t *pData) {
+	uint32_t nValue;
+	memcpy(&nValue, pData, sizeof(uint32_t));
+	return __builtin_bswap32(nValue);
+}
+
+inline static uint64_t get_timetag(const uint8_t *pData) {
+	return (static_cast<uint64_t>(get_uint32(pData)) << 32) | get_uint32(pData + 4);
+}
 }  // namespace osc
 
 #endif /* OSC_H_ */
@@ -0,0 +1,98 @@
+/**
+ * @file oscdispatcher.h
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef OSCDISPATCHER_H_
+#define OSCDISPATCHER_H_
+
+#include <cstdint>
+
+/**
+ * The registered addresses are compiled into a tree of path segments.
+ * A segment "#" matches a decimal number, which is returned in the result.
+ * A registered segment with pattern characters (a configured path such as /dmx*)
+ * is glob matched against the incoming segment, after the exact and number matches.
+ * An incoming address with pattern characters falls back to the glob matcher,
+ * for the registered addresses without number and pattern segments only.
+ */
+
+namespace osc::dispatcher {
+static constexpr uint32_t MAX_NODES = 32;
+static constexpr uint32_t MAX_ENTRIES = 16;
+static constexpr uint32_t MAX_NUMBERS = 2;
+static constexpr uint32_t POOL_SIZE = 768;
+static constexpr uint8_t ID_NONE = 0xFF;
+static constexpr char NUMBER_SEGMENT = '#';
+
+struct Result {
+	uint32_t nId;
+	uint32_t nNumbers;
+	uint32_t nNumber[MAX_NUMBERS];
+};
+}  // namespace osc::dispatcher
+
+class OscDispatcher {
+public:
+	OscDispatcher() {
+		Clear();
+	}
+
+	void Clear();
+	bool Add(const char *pPath, const uint8_t nId);
+	bool Dispatch(const char *pAddress, osc::dispatcher::Result& result) const;
+
+	void Dump();
+
+private:
+	uint32_t AddSegment(const uint32_t nParent, const char *pSegment, const uint32_t nLength);
+	bool Glob(const char *pAddress, osc::dispatcher::Result& result) const;
+
+private:
+	struct Node {
+		const char *pSegment;
+		uint32_t nHash;
+		uint16_t nLength;
+		uint8_t nChild;
+		uint8_t nSibling;
+		uint8_t nId;
+		bool bNumber;
+		bool bPattern;
+	};
+
+	struct Entry {
+		const char *pPath;
+		uint8_t nId;
+		bool bHasNumber;
+		bool bHasPattern;
+	};
+
+	Node m_Nodes[osc::dispatcher::MAX_NODES];
+	Entry m_Entries[osc::dispatcher::MAX_ENTRIES];
+	char m_Pool[osc::dispatcher::POOL_SIZE];
+	uint32_t m_nNodes;
+	uint32_t m_nEntries;
+	uint32_t m_nPoolUsed;
+};
+
+#endif /* OSCDISPATCHER_H_ */
@@ -2,7 +2,7 @@
  * @file oscserver.h
  *
  */
-/* Copyright (C) 2017-2023 by Arjan van Vught mailto:info@gd32-dmx.org
+/* Copyright (C) 2017-2025 by Arjan van Vught mailto:info@gd32-dmx.org
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -31,6 +31,7 @@
 #include <cassert>
 
 #include "oscsimplesend.h"
+#include "oscdispatcher.h"
 
 #include "hardware.h"
 #include "network.h"
@@ -48,10 +49,45 @@ struct DefaultPort {
 
 struct Max {
 	static constexpr auto PATH_LENGTH = 128U;
+	static constexpr auto BUNDLE_DEPTH = 4U;
+	static constexpr auto BUNDLE_SIZE = 1024U;
+	static constexpr auto SCHEDULED = 8U;
+	/*
+	 * One universe per output port, the paths of the other universes are rejected.
+	 * LIGHTSET_PORTS must not exceed the ports of the output.
+	 */
+#if defined (LIGHTSET_PORTS) && (LIGHTSET_PORTS > 0)
+	static constexpr uint32_t UNIVERSES = LIGHTSET_PORTS;
+#else
+	static constexpr uint32_t UNIVERSES = 1;
+#endif
+};
+
+static_assert(Max::UNIVERSES <= 32, "The pending and running masks are 32-bit");
+
+/*
+ * Address identifiers for the dispatcher
+ */
+enum class Path : uint8_t {
+	DMX, DMX_CHANNEL, BLACKOUT, PING, INFO, UNIVERSE, UNIVERSE_CHANNEL
+};
+
+struct Statistics {
+	uint32_t nMessages;		///< DMX messages received
+	uint32_t nOutputs;		///< Universes sent to the output
+};
+
+struct Scheduled {
+	uint64_t nTimeTag;
+	uint32_t nFromIp;
+	uint32_t nSize;
+	uint8_t Data[Max::BUNDLE_SIZE];
 };
 } // namespace osc::server
 
 
+class OscSimpleMessage;
+
 class OscServerHandler {
 public:
 	virtual ~OscServerHandler() {}
@@ -80,7 +116,18 @@ public:
 		DEBUG_ENTRY
 
 		if (m_pLightSet != nullptr) {
-			m_pLightSet->Stop(0);
+			for (uint32_t nPortIndex = 0; nPortIndex < osc::server::Max::UNIVERSES; nPortIndex++) {
+				m_pLightSet->Stop(nPortIndex);
+			}
+		}
+
+		m_nDmxDataPending = 0;
+		m_nRunning = 0;
+
+		m_nScheduled = 0;
+
+		for (auto& scheduled : s_Scheduled) {
+			scheduled.nSize = 0;
 		}
 
 		assert(m_nHandle != -1);
@@ -96,7 +143,31 @@ public:
 		printf(" Outgoing Port        : %d\n", m_nPortOutgoing);
 		printf(" DMX Path             : [%s][%s]\n", s_aPath, s_aPathSecond);
 		printf("  Blackout Path       : [%s]\n", s_aPathBlackOut);
+		printf(" Universe Path        : [%s/<universe>][%s/<universe>/<channel>] %u\n", OscServer::PATH_UNIVERSE, OscServer::PATH_UNIVERSE, static_cast<unsigned int>(osc::server::Max::UNIVERSES));
 		printf(" Partial Transmission : %s\n", m_bPartialTransmission ? "Yes" : "No");
+
+		for (uint32_t nPortIndex = 0; nPortIndex < osc::server::Max::UNIVERSES; nPortIndex++) {
+			const auto& statistics = m_Statistics[nPortIndex];
+
+			if (statistics.nMessages != 0) {
+				printf("  Universe %-2u        : %u messages, %u outputs\n", static_cast<unsigned int>(1 + nPortIndex), static_cast<unsigned int>(statistics.nMessages), static_cast<unsigned int>(statistics.nOutputs));
+			}
+		}
+	}
+
+	/**
+	 * The bundles with a time tag that has been reached are handled, then the
+	 * universes changed since the previous call are sent to the output,
+	 * once per universe. Call it once per superloop iteration.
+	 */
+	void Run() {
+		if (m_nScheduled != 0) {
+			RunScheduled();
+		}
+
+		if (m_nDmxDataPending != 0) {
+			Flush();
+		}
 	}
 
 	void Input(const uint8_t *pBuffer, uint32_t nSize, uint32_t nFromIp, uint16_t nFromPort);
@@ -162,13 +233,26 @@ public:
 		return m_bEnableNoChangeUpdate;
 	}
 
+	const osc::server::Statistics& GetStatistics(const uint32_t nPortIndex) const {
+		assert(nPortIndex < osc::server::Max::UNIVERSES);
+		return m_Statistics[nPortIndex];
+	}
+
 	static OscServer *Get() {
 		return s_pThis;
 	}
 
 private:
-	int GetChannel(const char *p);
-	bool IsDmxDataChanged(const uint8_t *pData, uint16_t nStartChannel, uint32_t nLength);
+	void Compile();
+	void HandleDmx(OscSimpleMessage& Msg, uint32_t nPortIndex);
+	void HandleChannel(OscSimpleMessage& Msg, uint32_t nPortIndex, uint32_t nChannel);
+	bool IsDmxDataChanged(uint32_t nPortIndex, const uint8_t *pData, uint16_t nStartChannel, uint32_t nLength);
+	void HandleMessage(const uint8_t *pBuffer, uint32_t nSize, uint32_t nFromIp);
+	void HandleBundle(const uint8_t *pBuffer, uint32_t nSize, uint32_t nFromIp, uint32_t nDepth);
+	void Schedule(uint64_t nTimeTag, const uint8_t *pBuffer, uint32_t nSize, uint32_t nFromIp);
+	void RunScheduled();
+	void SetDmxDataPending(uint32_t nPortIndex, uint32_t nLastChannel);
+	void Flush();
 
 	/**
 	 * @brief Static callback function for receiving UDP packets.
@@ -186,13 +270,20 @@ private:
 	uint16_t m_nPortIncoming { osc::server::DefaultPort::INCOMING };
 	uint16_t m_nPortOutgoing { osc::server::DefaultPort::OUTGOING };
 	int32_t m_nHandle { -1 };
-	uint32_t m_nLastChannel { 0 };
+	uint32_t m_nLastChannel[osc::server::Max::UNIVERSES];
+	uint32_t m_nScheduled { 0 };
+	uint32_t m_nDmxDataPending { 0 };	///< Bit per universe
+	uint32_t m_nRunning { 0 };			///< Bit per universe
 
 	bool m_bPartialTransmission { false };
 	bool m_bEnableNoChangeUpdate { false };
-	bool m_bIsRunning { false };
+	bool m_bCompiled { false };
 	char m_Os[32];
 
+	osc::server::Statistics m_Statistics[osc::server::Max::UNIVERSES];
+
+	OscDispatcher m_Dispatcher;
+
 	OscServerHandler *m_pOscServerHandler { nullptr };
 	LightSet *m_pLightSet { nullptr };
 
@@ -204,9 +295,18 @@ private:
 	static inline char s_aPathInfo[osc::server::Max::PATH_LENGTH];
 	static inline char s_aPathBlackOut[osc::server::Max::PATH_LENGTH];
 
-	static inline uint8_t s_pData[lightset::dmx::UNIVERSE_SIZE];
+	static inline uint8_t s_pData[osc::server::Max::UNIVERSES][lightset::dmx::UNIVERSE_SIZE];
 	static inline uint8_t s_pOsc[lightset::dmx::UNIVERSE_SIZE];
 
+	/*
+	 * Bundles with a future time tag, s_nScheduledIndex is ordered by time tag.
+	 */
+	static inline osc::server::Scheduled s_Scheduled[osc::server::Max::SCHEDULED];
+	static inline uint8_t s_nScheduledIndex[osc::server::Max::SCHEDULED];
+	static inline osc::server::Scheduled s_Running;	///< The bundle being handled by RunScheduled
+
+	static constexpr char PATH_UNIVERSE[] = "/dmx";
+
 	static inline OscServer *s_pThis;
 };
 
@@ -0,0 +1,338 @@
+/**
+ * @file oscdispatcher.cpp
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#if defined (DEBUG_OSCDISPATCHER)
+# undef NDEBUG
+#endif
+
+#if defined(__GNUC__) && !defined(__clang__)
+# pragma GCC push_options
+# pragma GCC optimize ("O3")
+#endif
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cassert>
+
+#include "oscdispatcher.h"
+#include "osc.h"
+
+#include "debug.h"
+
+using namespace osc::dispatcher;
+
+namespace osc::dispatcher {
+/*
+ * FNV-1a
+ */
+static constexpr uint32_t HASH_OFFSET = 2166136261U;
+static constexpr uint32_t HASH_PRIME = 16777619U;
+/*
+ * Maximum number of digits for a number segment
+ */
+static constexpr uint32_t NUMBER_DIGITS_MAX = 5;
+/*
+ * Maximum length of an incoming segment matched against a pattern segment
+ */
+static constexpr uint32_t SEGMENT_LENGTH_MAX = 63;
+
+static bool is_pattern(const char *pAddress) {
+	return strpbrk(pAddress, "*?[{") != nullptr;
+}
+
+static bool is_pattern(const char *pSegment, const uint32_t nLength) {
+	for (uint32_t i = 0; i < nLength; i++) {
+		const auto c = pSegment[i];
+
+		if ((c == '*') || (c == '?') || (c == '[') || (c == '{')) {
+			return true;
+		}
+	}
+
+	return false;
+}
+}  // namespace osc::dispatcher
+
+void OscDispatcher::Clear() {
+	memset(m_Nodes, 0, sizeof(m_Nodes));
+
+	m_Nodes[0].nId = ID_NONE;
+	m_nNodes = 1;	// Node 0 is the root
+	m_nEntries = 0;
+	m_nPoolUsed = 0;
+}
+
+uint32_t OscDispatcher::AddSegment(const uint32_t nParent, const char *pSegment, const uint32_t nLength) {
+	const auto bNumber = (nLength == 1) && (pSegment[0] == NUMBER_SEGMENT);
+	const auto bPattern = (!bNumber) && is_pattern(pSegment, nLength);
+
+	auto nHash = HASH_OFFSET;
+
+	for (uint32_t i = 0; i < nLength; i++) {
+		nHash = (nHash ^ static_cast<uint8_t>(pSegment[i])) * HASH_PRIME;
+	}
+
+	uint32_t nLast = 0;
+
+	for (auto nChild = m_Nodes[nParent].nChild; nChild != 0; nChild = m_Nodes[nChild].nSibling) {
+		const auto& node = m_Nodes[nChild];
+
+		if (bNumber) {
+			if (node.bNumber) {
+				return nChild;
+			}
+		} else if ((!node.bNumber) && (node.bPattern == bPattern) && (node.nHash == nHash) && (node.nLength == nLength) && (memcmp(node.pSegment, pSegment, nLength) == 0)) {
+			return nChild;
+		}
+
+		nLast = nChild;
+	}
+
+	if (m_nNodes == MAX_NODES) {
+		return 0;
+	}
+
+	/*
+	 * The glob matcher needs a terminated pattern
+	 */
+	if (bPattern) {
+		if ((m_nPoolUsed + nLength + 1) > POOL_SIZE) {
+			return 0;
+		}
+
+		auto *pCopy = &m_Pool[m_nPoolUsed];
+		memcpy(pCopy, pSegment, nLength);
+		pCopy[nLength] = '\0';
+		m_nPoolUsed += nLength + 1;
+		pSegment = pCopy;
+	}
+
+	const auto nNode = m_nNodes++;
+	auto& node = m_Nodes[nNode];
+
+	node.pSegment = pSegment;
+	node.nHash = nHash;
+	node.nLength = static_cast<uint16_t>(nLength);
+	node.nChild = 0;
+	node.nSibling = 0;
+	node.nId = ID_NONE;
+	node.bNumber = bNumber;
+	node.bPattern = bPattern;
+
+	if (nLast == 0) {
+		m_Nodes[nParent].nChild = static_cast<uint8_t>(nNode);
+	} else {
+		m_Nodes[nLast].nSibling = static_cast<uint8_t>(nNode);
+	}
+
+	return nNode;
+}
+
+/**
+ * @param pPath Address, a segment "#" is a number. Example: /dmx/#/#
+ * A segment with pattern characters is matched with the glob matcher. Example: /dmx?/#
+ * @return false when the tables are full or the address is already registered.
+ */
+bool OscDispatcher::Add(const char *pPath, const uint8_t nId) {
+	assert(pPath != nullptr);
+	assert(nId != ID_NONE);
+
+	const auto nPathLength = strlen(pPath);
+
+	if ((pPath[0] != '/') || (m_nEntries == MAX_ENTRIES) || ((m_nPoolUsed + nPathLength + 1) > POOL_SIZE)) {
+		DEBUG_PRINTF("Can not add %s", pPath);
+		return false;
+	}
+
+	auto *pCopy = &m_Pool[m_nPoolUsed];
+	memcpy(pCopy, pPath, nPathLength + 1);
+	m_nPoolUsed += static_cast<uint32_t>(nPathLength + 1);
+
+	uint32_t nNode = 0;
+	auto bHasNumber = false;
+	auto bHasPattern = false;
+	const auto *pSegment = pCopy + 1;
+
+	for (;;) {
+		const auto *pEnd = strchr(pSegment, '/');
+		const auto nLength = static_cast<uint32_t>((pEnd == nullptr) ? strlen(pSegment) : static_cast<size_t>(pEnd - pSegment));
+
+		nNode = AddSegment(nNode, pSegment, nLength);
+
+		if (nNode == 0) {
+			DEBUG_PRINTF("No node for %s", pPath);
+			return false;
+		}
+
+		bHasNumber |= m_Nodes[nNode].bNumber;
+		bHasPattern |= m_Nodes[nNode].bPattern;
+
+		if (pEnd == nullptr) {
+			break;
+		}
+
+		pSegment = pEnd + 1;
+	}
+
+	if (m_Nodes[nNode].nId != ID_NONE) {
+		DEBUG_PRINTF("Duplicate %s", pPath);
+		return false;
+	}
+
+	m_Nodes[nNode].nId = nId;
+
+	m_Entries[m_nEntries].pPath = pCopy;
+	m_Entries[m_nEntries].nId = nId;
+	m_Entries[m_nEntries].bHasNumber = bHasNumber;
+	m_Entries[m_nEntries].bHasPattern = bHasPattern;
+	m_nEntries++;
+
+	return true;
+}
+
+bool OscDispatcher::Glob(const char *pAddress, osc::dispatcher::Result& result) const {
+	for (uint32_t i = 0; i < m_nEntries; i++) {
+		const auto& entry = m_Entries[i];
+
+		if ((!entry.bHasNumber) && (!entry.bHasPattern) && osc::is_match(entry.pPath, pAddress)) {
+			result.nId = entry.nId;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool OscDispatcher::Dispatch(const char *pAddress, osc::dispatcher::Result& result) const {
+	assert(pAddress != nullptr);
+
+	result.nNumbers = 0;
+
+	if (pAddress[0] != '/') {
+		return false;
+	}
+
+	if (is_pattern(pAddress)) {
+		return Glob(pAddress, result);
+	}
+
+	uint32_t nNode = 0;
+	const auto *p = pAddress + 1;
+
+	for (;;) {
+		const auto *pSegment = p;
+		auto nHash = HASH_OFFSET;
+
+		while ((*p != '\0') && (*p != '/')) {
+			nHash = (nHash ^ static_cast<uint8_t>(*p)) * HASH_PRIME;
+			p++;
+		}
+
+		const auto nLength = static_cast<uint32_t>(p - pSegment);
+
+		uint32_t nFound = 0;
+		uint32_t nNumber = 0;
+		uint32_t nPatterns = 0;
+
+		for (auto nChild = m_Nodes[nNode].nChild; nChild != 0; nChild = m_Nodes[nChild].nSibling) {
+			const auto& node = m_Nodes[nChild];
+
+			if (node.bNumber) {
+				nNumber = nChild;
+			} else if (node.bPattern) {
+				nPatterns++;
+			} else if ((node.nHash == nHash) && (node.nLength == nLength) && (memcmp(node.pSegment, pSegment, nLength) == 0)) {
+				nFound = nChild;
+				break;
+			}
+		}
+
+		if ((nFound == 0) && (nNumber != 0) && (nLength != 0) && (nLength <= NUMBER_DIGITS_MAX) && (result.nNumbers < MAX_NUMBERS)) {
+			uint32_t nValue = 0;
+			uint32_t i;
+
+			for (i = 0; i < nLength; i++) {
+				const auto c = pSegment[i];
+
+				if ((c < '0') || (c > '9')) {
+					break;
+				}
+
+				nValue = nValue * 10 + static_cast<uint32_t>(c - '0');
+			}
+
+			if (i == nLength) {
+				result.nNumber[result.nNumbers++] = nValue;
+				nFound = nNumber;
+			}
+		}
+
+		/*
+		 * Registered segments with pattern characters, such as a configured path /dmx*
+		 */
+		if ((nFound == 0) && (nPatterns != 0) && (nLength <= SEGMENT_LENGTH_MAX)) {
+			char aSegment[SEGMENT_LENGTH_MAX + 1];
+			memcpy(aSegment, pSegment, nLength);
+			aSegment[nLength] = '\0';
+
+			for (auto nChild = m_Nodes[nNode].nChild; nChild != 0; nChild = m_Nodes[nChild].nSibling) {
+				const auto& node = m_Nodes[nChild];
+
+				if (node.bPattern && osc::is_match(aSegment, node.pSegment)) {
+					nFound = nChild;
+					break;
+				}
+			}
+		}
+
+		if (nFound == 0) {
+			return false;
+		}
+
+		nNode = nFound;
+
+		if (*p == '\0') {
+			break;
+		}
+
+		p++;
+	}
+
+	if (m_Nodes[nNode].nId == ID_NONE) {
+		return false;
+	}
+
+	result.nId = m_Nodes[nNode].nId;
+	return true;
+}
+
+void OscDispatcher::Dump() {
+	for (uint32_t i = 0; i < m_nEntries; i++) {
+		printf(" %2u %s\n", static_cast<unsigned int>(m_Entries[i].nId), m_Entries[i].pPath);
+	}
+
+	printf(" Nodes %u/%u, Pool %u/%u\n", static_cast<unsigned int>(m_nNodes), static_cast<unsigned int>(MAX_NODES), static_cast<unsigned int>(m_nPoolUsed), static_cast<unsigned int>(POOL_SIZE));
+}
@@ -2,7 +2,7 @@
  * @file oscserver.cpp
  *
  */
-/* Copyright (C) 2017-2024 by Arjan van Vught mailto:info@gd32-dmx.org
+/* Copyright (C) 2017-2025 by Arjan van Vught mailto:info@gd32-dmx.org
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -31,6 +31,7 @@
 #include <cstdio>
 #include <cstring>
 #include <cassert>
+#include <sys/time.h>
 
 #include "oscserver.h"
 #include "osc.h"
@@ -42,6 +43,8 @@
 
 #include "hardware.h"
 
+#include "net/protocol/ntp.h"
+
 #include "debug.h"
 
 #define OSCSERVER_DEFAULT_PATH_PRIMARY		"/dmx1"
@@ -69,6 +72,9 @@ OscServer::OscServer() {
 	memset(s_aPathBlackOut, 0, sizeof(s_aPathBlackOut));
 	strcpy(s_aPathBlackOut, OSCSERVER_DEFAULT_PATH_BLACKOUT);
 
+	memset(m_nLastChannel, 0, sizeof(m_nLastChannel));
+	memset(m_Statistics, 0, sizeof(m_Statistics));
+
 	snprintf(m_Os, sizeof(m_Os) - 1, "[V%s] %s", SOFTWARE_VERSION, __DATE__);
 
 	uint8_t nHwTextLength;
@@ -104,6 +110,8 @@ void OscServer::SetPath(const char* pPath) {
 		s_aPathSecond[nLength] = '\0';
 	}
 
+	m_bCompiled = false;
+
 	DEBUG_PUTS(s_aPath);
 	DEBUG_PUTS(s_aPathSecond);
 }
@@ -120,6 +128,8 @@ void OscServer::SetPathInfo(const char* pPathInfo) {
 		}
 	}
 
+	m_bCompiled = false;
+
 	DEBUG_PUTS(s_aPathInfo);
 }
 
@@ -135,208 +145,381 @@ void OscServer::SetPathBlackOut(const char* pPathBlackOut) {
 		}
 	}
 
+	m_bCompiled = false;
+
 	DEBUG_PUTS(s_aPathBlackOut);
 }
 
-int OscServer::GetChannel(const char* p) {
-	assert(p != nullptr);
+/**
+ * The configured paths are compiled into the dispatcher on first use after a change.
+ * When paths collide, the first one added wins, which is the order of the former
+ * sequential matching.
+ */
+void OscServer::Compile() {
+	DEBUG_ENTRY
 
-	auto *s = const_cast<char *>(p) + strlen(s_aPath) + 1;
-	int nChannel = 0;
-	int i;
+	char aPath[osc::server::Max::PATH_LENGTH + 2];
 
-	for (i = 0; (i < 3) && (*s != '\0'); i++) {
-		int c = *s;
+	m_Dispatcher.Clear();
+	m_Dispatcher.Add(s_aPath, static_cast<uint8_t>(osc::server::Path::DMX));
+	m_Dispatcher.Add(s_aPathBlackOut, static_cast<uint8_t>(osc::server::Path::BLACKOUT));
 
-		if ((c < '0') || (c > '9')) {
-			return -1;
-		}
+	snprintf(aPath, sizeof(aPath), "%s/%c", s_aPath, osc::dispatcher::NUMBER_SEGMENT);
+	m_Dispatcher.Add(aPath, static_cast<uint8_t>(osc::server::Path::DMX_CHANNEL));
 
-		nChannel = nChannel * 10 + c - '0';
-		s++;
-	}
+	m_Dispatcher.Add("/ping", static_cast<uint8_t>(osc::server::Path::PING));
+	m_Dispatcher.Add(s_aPathInfo, static_cast<uint8_t>(osc::server::Path::INFO));
 
-	if (nChannel > static_cast<int32_t>(lightset::dmx::UNIVERSE_SIZE)) {
-		return -1;
-	}
+	snprintf(aPath, sizeof(aPath), "%s/%c", PATH_UNIVERSE, osc::dispatcher::NUMBER_SEGMENT);
+	m_Dispatcher.Add(aPath, static_cast<uint8_t>(osc::server::Path::UNIVERSE));
+
+	snprintf(aPath, sizeof(aPath), "%s/%c/%c", PATH_UNIVERSE, osc::dispatcher::NUMBER_SEGMENT, osc::dispatcher::NUMBER_SEGMENT);
+	m_Dispatcher.Add(aPath, static_cast<uint8_t>(osc::server::Path::UNIVERSE_CHANNEL));
+
+	m_bCompiled = true;
 
-	return nChannel;
+#ifndef NDEBUG
+	m_Dispatcher.Dump();
+#endif
+	DEBUG_EXIT
 }
 
-bool OscServer::IsDmxDataChanged(const uint8_t* pData, uint16_t nStartChannel, uint32_t nLength) {
+bool OscServer::IsDmxDataChanged(uint32_t nPortIndex, const uint8_t* pData, uint16_t nStartChannel, uint32_t nLength) {
+	assert(nPortIndex < osc::server::Max::UNIVERSES);
 	assert(pData != nullptr);
 	assert(nLength <= lightset::dmx::UNIVERSE_SIZE);
 
-	auto isChanged = false;
-	const auto *src = pData;
-	auto *dst = &s_pData[--nStartChannel];
-	const auto nEnd = nStartChannel + nLength;
+	auto *pDst = &s_pData[nPortIndex][nStartChannel - 1];
 
-	assert(nEnd <= lightset::dmx::UNIVERSE_SIZE);
+	assert((nStartChannel - 1U + nLength) <= lightset::dmx::UNIVERSE_SIZE);
 
-	for (uint32_t i = nStartChannel; i < nEnd; i++) {
-		if (*dst != *src) {
-			*dst = *src;
-			isChanged = true;
-		}
-		dst++;
-		src++;
+	if (memcmp(pDst, pData, nLength) == 0) {
+		return false;
 	}
 
-	return isChanged;
+	memcpy(pDst, pData, nLength);
+	return true;
+}
+
+void OscServer::SetDmxDataPending(uint32_t nPortIndex, uint32_t nLastChannel) {
+	assert(nPortIndex < osc::server::Max::UNIVERSES);
+
+	m_nLastChannel[nPortIndex] = nLastChannel > m_nLastChannel[nPortIndex] ? nLastChannel : m_nLastChannel[nPortIndex];
+	m_nDmxDataPending |= (1U << nPortIndex);
+}
+
+/**
+ * All channel updates received since the previous flush (messages, bundles and
+ * scheduled bundles) are sent to the output with one SetData per universe.
+ */
+void OscServer::Flush() {
+	while (m_nDmxDataPending != 0) {
+		const auto nPortIndex = static_cast<uint32_t>(__builtin_ctz(m_nDmxDataPending));
+		const auto nPortMask = (1U << nPortIndex);
+
+		m_nDmxDataPending &= ~nPortMask;
+
+		if (!m_bPartialTransmission) {
+			m_pLightSet->SetData(nPortIndex, s_pData[nPortIndex], lightset::dmx::UNIVERSE_SIZE);
+		} else {
+			m_pLightSet->SetData(nPortIndex, s_pData[nPortIndex], m_nLastChannel[nPortIndex]);
+		}
+
+		m_Statistics[nPortIndex].nOutputs++;
+
+		if ((m_nRunning & nPortMask) == 0) {
+			m_nRunning |= nPortMask;
+			m_pLightSet->Start(nPortIndex);
+		}
+	}
 }
 
 void OscServer::Input(const uint8_t *pBuffer, uint32_t nSize, uint32_t nFromIp, [[maybe_unused]] uint16_t nFromPort) {
-	auto bIsDmxDataChanged = false;
+	debug_dump(pBuffer, nSize);
 
-	OscSimpleMessage Msg(pBuffer, nSize);
+	if (osc::is_bundle(pBuffer, nSize)) {
+		HandleBundle(pBuffer, nSize, nFromIp, 0);
+	} else {
+		HandleMessage(pBuffer, nSize, nFromIp);
+	}
+}
 
-	auto *pUdpBuffer = reinterpret_cast<const char *>(pBuffer);
+static uint64_t get_timetag_now() {
+	struct timeval tv;
+	gettimeofday(&tv, nullptr);
 
-	debug_dump(pUdpBuffer, nSize);
+	const auto nSeconds = static_cast<uint64_t>(static_cast<uint32_t>(tv.tv_sec) + ntp::JAN_1970);
+	const auto nFraction = (static_cast<uint64_t>(tv.tv_usec) << 32) / ntp::MICROSECONDS_IN_SECOND;
 
-	DEBUG_PRINTF("[%d] path : %s", nSize, osc::get_path(const_cast<char *>(pUdpBuffer), nSize));
+	return (nSeconds << 32) | nFraction;
+}
 
-	if (osc::is_match(pUdpBuffer, s_aPath)) {
-		const auto nArgc = Msg.GetArgc();
+/**
+ * A bundle with a time tag in the past, or "immediately", is executed now.
+ * Otherwise the bundle is queued and executed from Run().
+ * Nested bundles are handled the same way, with their own time tag.
+ */
+void OscServer::HandleBundle(const uint8_t *pBuffer, uint32_t nSize, uint32_t nFromIp, uint32_t nDepth) {
+	if (nDepth >= osc::server::Max::BUNDLE_DEPTH) {
+		DEBUG_PUTS("Bundle nesting too deep");
+		return;
+	}
 
-		if ((nArgc == 1) && (Msg.GetType(0) == osc::type::BLOB)) {
-			DEBUG_PUTS("Blob received");
+	const auto nTimeTag = osc::get_timetag(&pBuffer[8]);
 
-			OSCBlob blob = Msg.GetBlob(0);
-			const auto size = static_cast<uint16_t>(blob.GetDataSize());
+	DEBUG_PRINTF("Bundle [%u] %.8x.%.8x", nSize, static_cast<uint32_t>(nTimeTag >> 32), static_cast<uint32_t>(nTimeTag));
 
-			if (size <= lightset::dmx::UNIVERSE_SIZE) {
-				const auto *ptr = blob.GetDataPtr();
+	if ((nTimeTag > osc::bundle::TIMETAG_IMMEDIATELY) && (nTimeTag > get_timetag_now())) {
+		Schedule(nTimeTag, pBuffer, nSize, nFromIp);
+		return;
+	}
 
-				bIsDmxDataChanged = IsDmxDataChanged(ptr, 1, size);
+	auto nOffset = osc::bundle::HEADER_SIZE;
 
-				if (bIsDmxDataChanged || m_bEnableNoChangeUpdate) {
-					if ((!m_bPartialTransmission) || (size == lightset::dmx::UNIVERSE_SIZE)) {
-						m_pLightSet->SetData(0, s_pData, lightset::dmx::UNIVERSE_SIZE);
-					} else {
-						m_nLastChannel = (size > m_nLastChannel ? size : m_nLastChannel);
-						m_pLightSet->SetData(0, s_pData, m_nLastChannel);
-					}
+	while ((nOffset + 4) <= nSize) {
+		const auto nElementSize = osc::get_uint32(&pBuffer[nOffset]);
+		nOffset += 4;
 
-					if (!m_bIsRunning) {
-						m_bIsRunning = true;
-						m_pLightSet->Start(0);
-					}
-				}
-			} else {
-				DEBUG_PUTS("Too many channels");
-				return;
-			}
-		} else if ((nArgc == 2) && (Msg.GetType(0) == osc::type::INT32)) {
-			auto nChannel = static_cast<uint16_t>(1 + Msg.GetInt(0));
+		if ((nElementSize == 0) || ((nElementSize & 0x3) != 0) || (nElementSize > (nSize - nOffset))) {
+			DEBUG_PRINTF("Invalid bundle element size %u", nElementSize);
+			return;
+		}
 
-			if ((nChannel < 1) || (nChannel > lightset::dmx::UNIVERSE_SIZE)) {
-				DEBUG_PRINTF("Invalid channel [%d]", nChannel);
-				return;
-			}
+		const auto *pElement = &pBuffer[nOffset];
+
+		if (osc::is_bundle(pElement, nElementSize)) {
+			HandleBundle(pElement, nElementSize, nFromIp, nDepth + 1);
+		} else {
+			HandleMessage(pElement, nElementSize, nFromIp);
+		}
 
-			uint8_t nData;
+		nOffset += nElementSize;
+	}
+}
 
-			if (Msg.GetType(1) == osc::type::INT32) {
-				DEBUG_PUTS("ii received");
-				nData = static_cast<uint8_t>(Msg.GetInt(1));
-			} else if (Msg.GetType(1) == osc::type::FLOAT) {
-				DEBUG_PUTS("if received");
-				nData = static_cast<uint8_t>(Msg.GetFloat(1) * lightset::dmx::MAX_VALUE);
-			} else {
-				return;
-			}
+void OscServer::Schedule(uint64_t nTimeTag, const uint8_t *pBuffer, uint32_t nSize, uint32_t nFromIp) {
+	if ((m_nScheduled == osc::server::Max::SCHEDULED) || (nSize > osc::server::Max::BUNDLE_SIZE)) {
+		DEBUG_PUTS("Bundle can not be scheduled");
+		return;
+	}
+
+	uint32_t nSlot = 0;
+
+	while ((nSlot < osc::server::Max::SCHEDULED) && (s_Scheduled[nSlot].nSize != 0)) {
+		nSlot++;
+	}
+
+	if (nSlot == osc::server::Max::SCHEDULED) {
+		DEBUG_PUTS("No free slot");
+		return;
+	}
+
+	auto& scheduled = s_Scheduled[nSlot];
+
+	scheduled.nTimeTag = nTimeTag;
+	scheduled.nFromIp = nFromIp;
+	scheduled.nSize = nSize;
+	memcpy(scheduled.Data, pBuffer, nSize);
+
+	/*
+	 * Insert after the entries with an earlier or equal time tag,
+	 * so bundles with the same time tag are executed in order of arrival.
+	 */
+	auto nPosition = m_nScheduled;
+
+	while ((nPosition > 0) && (s_Scheduled[s_nScheduledIndex[nPosition - 1]].nTimeTag > nTimeTag)) {
+		s_nScheduledIndex[nPosition] = s_nScheduledIndex[nPosition - 1];
+		nPosition--;
+	}
 
-			DEBUG_PRINTF("Channel = %d, Data = %.2x", nChannel, nData);
+	s_nScheduledIndex[nPosition] = static_cast<uint8_t>(nSlot);
+	m_nScheduled++;
+}
+
+void OscServer::RunScheduled() {
+	const auto nNow = get_timetag_now();
 
-			bIsDmxDataChanged = IsDmxDataChanged(&nData, nChannel, 1);
+	while (m_nScheduled != 0) {
+		const auto nSlot = s_nScheduledIndex[0];
+		auto& scheduled = s_Scheduled[nSlot];
 
-			if (bIsDmxDataChanged || m_bEnableNoChangeUpdate) {
-				if (!m_bPartialTransmission) {
-					m_pLightSet->SetData(0, s_pData, lightset::dmx::UNIVERSE_SIZE);
-				} else {
-					m_nLastChannel = nChannel > m_nLastChannel ? nChannel : m_nLastChannel;
-					m_pLightSet->SetData(0, s_pData, m_nLastChannel);
-				}
+		if (scheduled.nTimeTag > nNow) {
+			break;
+		}
 
-				if (!m_bIsRunning) {
-					m_bIsRunning = true;
-					m_pLightSet->Start(0);
-				}
+		m_nScheduled--;
+
+		for (uint32_t i = 0; i < m_nScheduled; i++) {
+			s_nScheduledIndex[i] = s_nScheduledIndex[i + 1];
+		}
+
+		/*
+		 * The slot is free before the bundle is handled,
+		 * a nested bundle with a future time tag can be scheduled again.
+		 */
+		s_Running.nFromIp = scheduled.nFromIp;
+		s_Running.nSize = scheduled.nSize;
+		memcpy(s_Running.Data, scheduled.Data, scheduled.nSize);
+
+		scheduled.nSize = 0;
+
+		HandleBundle(s_Running.Data, s_Running.nSize, s_Running.nFromIp, 0);
+	}
+}
+
+void OscServer::HandleDmx(OscSimpleMessage& Msg, uint32_t nPortIndex) {
+	m_Statistics[nPortIndex].nMessages++;
+
+	const auto nArgc = Msg.GetArgc();
+
+	if ((nArgc == 1) && (Msg.GetType(0) == osc::type::BLOB)) {
+		DEBUG_PUTS("Blob received");
+
+		OSCBlob blob = Msg.GetBlob(0);
+		const auto size = static_cast<uint16_t>(blob.GetDataSize());
+
+		if (size <= lightset::dmx::UNIVERSE_SIZE) {
+			const auto *ptr = blob.GetDataPtr();
+
+			if (IsDmxDataChanged(nPortIndex, ptr, 1, size) || m_bEnableNoChangeUpdate) {
+				SetDmxDataPending(nPortIndex, size);
 			}
+		} else {
+			DEBUG_PUTS("Too many channels");
 		}
 
 		return;
 	}
 
-	if ((m_pOscServerHandler != nullptr) && (osc::is_match(pUdpBuffer, s_aPathBlackOut))) {
-		if (Msg.GetType(0) != osc::type::FLOAT) {
-			DEBUG_PUTS("No float");
+	if ((nArgc == 2) && (Msg.GetType(0) == osc::type::INT32)) {
+		auto nChannel = static_cast<uint16_t>(1 + Msg.GetInt(0));
+
+		if ((nChannel < 1) || (nChannel > lightset::dmx::UNIVERSE_SIZE)) {
+			DEBUG_PRINTF("Invalid channel [%d]", nChannel);
 			return;
 		}
 
-		if (Msg.GetFloat(0) != 0) {
-			m_pOscServerHandler->Blackout();
-			DEBUG_PUTS("Blackout");
+		uint8_t nData;
+
+		if (Msg.GetType(1) == osc::type::INT32) {
+			DEBUG_PUTS("ii received");
+			nData = static_cast<uint8_t>(Msg.GetInt(1));
+		} else if (Msg.GetType(1) == osc::type::FLOAT) {
+			DEBUG_PUTS("if received");
+			nData = static_cast<uint8_t>(Msg.GetFloat(1) * lightset::dmx::MAX_VALUE);
 		} else {
-			m_pOscServerHandler->Update();
-			DEBUG_PUTS("Update");
+			return;
 		}
 
+		DEBUG_PRINTF("Channel = %d, Data = %.2x", nChannel, nData);
+
+		if (IsDmxDataChanged(nPortIndex, &nData, nChannel, 1) || m_bEnableNoChangeUpdate) {
+			SetDmxDataPending(nPortIndex, nChannel);
+		}
+	}
+}
+
+/**
+ * /path/N 'i' or 'f'
+ */
+void OscServer::HandleChannel(OscSimpleMessage& Msg, uint32_t nPortIndex, uint32_t nChannel) {
+	m_Statistics[nPortIndex].nMessages++;
+
+	if ((Msg.GetArgc() != 1) || (nChannel < 1) || (nChannel > lightset::dmx::UNIVERSE_SIZE)) {
 		return;
 	}
 
-	if (osc::is_match(pUdpBuffer, s_aPathSecond)) {
-		const auto nArgc = Msg.GetArgc();
-
-		if (nArgc == 1) { // /path/N 'i' or 'f'
-			const auto nChannel = static_cast<uint16_t>(GetChannel(pUdpBuffer));
-
-			if (nChannel >= 1 && nChannel <= lightset::dmx::UNIVERSE_SIZE) {
-				uint8_t nData;
-
-				if (Msg.GetType(0) == osc::type::INT32) {
-					DEBUG_PUTS("i received");
-					nData = static_cast<uint8_t>(Msg.GetInt(0));
-				} else if (Msg.GetType(0) == osc::type::FLOAT) {
-					DEBUG_PRINTF("f received %f", Msg.GetFloat(0));
-					nData = static_cast<uint8_t>(Msg.GetFloat(0) * lightset::dmx::MAX_VALUE);
-				} else {
-					return;
-				}
-
-				DEBUG_PRINTF("Channel = %d, Data = %.2x", nChannel, nData);
-
-				bIsDmxDataChanged = IsDmxDataChanged(&nData, nChannel, 1);
-
-				if (bIsDmxDataChanged || m_bEnableNoChangeUpdate) {
-					if (!m_bPartialTransmission) {
-						m_pLightSet->SetData(0, s_pData, lightset::dmx::UNIVERSE_SIZE);
-					} else {
-						m_nLastChannel = nChannel > m_nLastChannel ? nChannel : m_nLastChannel;
-						m_pLightSet->SetData(0, s_pData, m_nLastChannel);
-					}
-
-					if (!m_bIsRunning) {
-						m_bIsRunning = true;
-						m_pLightSet->Start(0);
-					}
-				}
-			}
-		}
+	uint8_t nData;
 
+	if (Msg.GetType(0) == osc::type::INT32) {
+		DEBUG_PUTS("i received");
+		nData = static_cast<uint8_t>(Msg.GetInt(0));
+	} else if (Msg.GetType(0) == osc::type::FLOAT) {
+		DEBUG_PRINTF("f received %f", Msg.GetFloat(0));
+		nData = static_cast<uint8_t>(Msg.GetFloat(0) * lightset::dmx::MAX_VALUE);
+	} else {
 		return;
 	}
 
-	if (osc::is_match(pUdpBuffer, "/ping")) {
-		OscSimpleSend MsgSend(m_nHandle, nFromIp, m_nPortOutgoing, "/pong", nullptr);
+	DEBUG_PRINTF("Channel = %u, Data = %.2x", nChannel, nData);
 
-		DEBUG_PUTS("ping received, pong sent");
+	if (IsDmxDataChanged(nPortIndex, &nData, static_cast<uint16_t>(nChannel), 1) || m_bEnableNoChangeUpdate) {
+		SetDmxDataPending(nPortIndex, nChannel);
+	}
+}
+
+void OscServer::HandleMessage(const uint8_t *pBuffer, uint32_t nSize, uint32_t nFromIp) {
+	const auto *pPath = osc::get_path(const_cast<uint8_t *>(pBuffer), nSize);
+
+	if (pPath == nullptr) {
+		DEBUG_PUTS("Invalid path");
+		return;
+	}
+
+	DEBUG_PRINTF("[%d] path : %s", nSize, pPath);
+
+	if (!m_bCompiled) {
+		Compile();
+	}
+
+	osc::dispatcher::Result result;
+
+	if (!m_Dispatcher.Dispatch(pPath, result)) {
 		return;
 	}
 
-	if (osc::is_match(pUdpBuffer, s_aPathInfo)) {
+	OscSimpleMessage Msg(pBuffer, nSize);
+
+	switch (static_cast<osc::server::Path>(result.nId)) {
+	case osc::server::Path::DMX:
+		HandleDmx(Msg, 0);
+		break;
+	case osc::server::Path::DMX_CHANNEL:
+		HandleChannel(Msg, 0, result.nNumber[0]);
+		break;
+	case osc::server::Path::UNIVERSE:
+	case osc::server::Path::UNIVERSE_CHANNEL: {
+		const auto nUniverse = result.nNumber[0];
+
+		if ((nUniverse < 1) || (nUniverse > osc::server::Max::UNIVERSES)) {
+			DEBUG_PRINTF("Invalid universe [%u]", nUniverse);
+			return;
+		}
+
+		if (result.nNumbers == 1) {
+			HandleDmx(Msg, nUniverse - 1);
+		} else {
+			HandleChannel(Msg, nUniverse - 1, result.nNumber[1]);
+		}
+	}
+		break;
+	case osc::server::Path::BLACKOUT:
+		if (m_pOscServerHandler == nullptr) {
+			return;
+		}
+
+		if (Msg.GetType(0) != osc::type::FLOAT) {
+			DEBUG_PUTS("No float");
+			return;
+		}
+
+		Flush();
+
+		if (Msg.GetFloat(0) != 0) {
+			m_pOscServerHandler->Blackout();
+			DEBUG_PUTS("Blackout");
+		} else {
+			m_pOscServerHandler->Update();
+			DEBUG_PUTS("Update");
+		}
+		break;
+	case osc::server::Path::PING: {
+		OscSimpleSend MsgSend(m_nHandle, nFromIp, m_nPortOutgoing, "/pong", nullptr);
+
+		DEBUG_PUTS("ping received, pong sent");
+	}
+		break;
+	case osc::server::Path::INFO: {
 		OscSimpleSend MsgSendInfo(m_nHandle, nFromIp, m_nPortOutgoing, "/info/os", "s", m_Os);
 		OscSimpleSend MsgSendModel(m_nHandle, nFromIp, m_nPortOutgoing, "/info/model", "s", m_pModel);
 		OscSimpleSend MsgSendSoc(m_nHandle, nFromIp, m_nPortOutgoing, "/info/soc", "s", m_pSoC);
@@ -344,7 +527,9 @@ void OscServer::Input(const uint8_t *pBuffer, uint32_t nSize, uint32_t nFromIp,
 		if (m_pOscServerHandler != nullptr) {
 			m_pOscServerHandler->Info(m_nHandle, nFromIp, m_nPortOutgoing);
 		}
-
-		return;
+	}
+		break;
+	default:
+		break;
 	}
 }
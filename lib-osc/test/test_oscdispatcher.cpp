@@ -0,0 +1,178 @@
+/**
+ * @file test_oscdispatcher.cpp
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * The dispatcher is checked against the paths registered by OscServer::Compile(),
+ * with the default and with a configured path containing pattern characters.
+ * The benchmark compares the dispatcher with the sequential glob matching of the
+ * previous OscServer.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include "oscdispatcher.h"
+#include "osc.h"
+
+#include "test.h"
+
+extern "C" {
+#include "../src/pattern_match.c"
+}
+
+namespace {
+enum Id : uint8_t {
+	DMX, DMX_CHANNEL, BLACKOUT, PING, INFO, UNIVERSE, UNIVERSE_CHANNEL
+};
+
+void compile(OscDispatcher& dispatcher, const char *pPath) {
+	char aPath[64];
+
+	dispatcher.Clear();
+	CHECK(dispatcher.Add(pPath, DMX));
+	snprintf(aPath, sizeof(aPath), "%s/blackout", pPath);
+	CHECK(dispatcher.Add(aPath, BLACKOUT));
+	snprintf(aPath, sizeof(aPath), "%s/#", pPath);
+	CHECK(dispatcher.Add(aPath, DMX_CHANNEL));
+	CHECK(dispatcher.Add("/ping", PING));
+	CHECK(dispatcher.Add("/2", INFO));
+	CHECK(dispatcher.Add("/dmx/#", UNIVERSE));
+	CHECK(dispatcher.Add("/dmx/#/#", UNIVERSE_CHANNEL));
+}
+
+bool dispatch(const OscDispatcher& dispatcher, const char *pAddress, const uint32_t nId, const uint32_t nNumbers = 0, const uint32_t nNumber0 = 0, const uint32_t nNumber1 = 0) {
+	osc::dispatcher::Result result;
+
+	if (!dispatcher.Dispatch(pAddress, result)) {
+		printf("%s not dispatched\n", pAddress);
+		return false;
+	}
+
+	if ((result.nId != nId) || (result.nNumbers != nNumbers)) {
+		printf("%s -> %u/%u\n", pAddress, static_cast<unsigned int>(result.nId), static_cast<unsigned int>(result.nNumbers));
+		return false;
+	}
+
+	return ((nNumbers < 1) || (result.nNumber[0] == nNumber0)) && ((nNumbers < 2) || (result.nNumber[1] == nNumber1));
+}
+
+bool no_dispatch(const OscDispatcher& dispatcher, const char *pAddress) {
+	osc::dispatcher::Result result;
+	return !dispatcher.Dispatch(pAddress, result);
+}
+
+void test_default() {
+	OscDispatcher dispatcher;
+	compile(dispatcher, "/dmx1");
+
+	CHECK(dispatch(dispatcher, "/dmx1", DMX));
+	CHECK(dispatch(dispatcher, "/dmx1/blackout", BLACKOUT));
+	CHECK(dispatch(dispatcher, "/dmx1/12", DMX_CHANNEL, 1, 12));
+	CHECK(dispatch(dispatcher, "/dmx1/512", DMX_CHANNEL, 1, 512));
+	CHECK(dispatch(dispatcher, "/ping", PING));
+	CHECK(dispatch(dispatcher, "/2", INFO));
+	CHECK(dispatch(dispatcher, "/dmx/3", UNIVERSE, 1, 3));
+	CHECK(dispatch(dispatcher, "/dmx/3/100", UNIVERSE_CHANNEL, 2, 3, 100));
+
+	CHECK(no_dispatch(dispatcher, "/dmx1/x"));
+	CHECK(no_dispatch(dispatcher, "/dmx1/123456"));
+	CHECK(no_dispatch(dispatcher, "/dmx2"));
+	CHECK(no_dispatch(dispatcher, "/ping/"));
+	CHECK(no_dispatch(dispatcher, "dmx1"));
+
+	// Incoming address patterns
+	CHECK(dispatch(dispatcher, "/dmx1/black*", BLACKOUT));
+	CHECK(dispatch(dispatcher, "/d?x1", DMX));
+	CHECK(dispatch(dispatcher, "/p{i,o}ng", PING));
+	CHECK(no_dispatch(dispatcher, "/dmx/*"));
+}
+
+void test_configured_pattern() {
+	OscDispatcher dispatcher;
+	compile(dispatcher, "/dmx*");
+
+	CHECK(dispatch(dispatcher, "/dmx1", DMX));
+	CHECK(dispatch(dispatcher, "/dmxA", DMX));
+	CHECK(dispatch(dispatcher, "/dmx1/blackout", BLACKOUT));
+	CHECK(dispatch(dispatcher, "/dmx7/42", DMX_CHANNEL, 1, 42));
+	// Exact and number segments have priority over a pattern segment
+	CHECK(dispatch(dispatcher, "/dmx/3", UNIVERSE, 1, 3));
+	CHECK(dispatch(dispatcher, "/dmx/3/100", UNIVERSE_CHANNEL, 2, 3, 100));
+	CHECK(dispatch(dispatcher, "/ping", PING));
+
+	CHECK(no_dispatch(dispatcher, "/dm"));
+	CHECK(no_dispatch(dispatcher, "/dmx1/x"));
+
+	compile(dispatcher, "/light/[a-c]");
+
+	CHECK(dispatch(dispatcher, "/light/b", DMX));
+	CHECK(dispatch(dispatcher, "/light/c/7", DMX_CHANNEL, 1, 7));
+	CHECK(no_dispatch(dispatcher, "/light/d"));
+	CHECK(no_dispatch(dispatcher, "/light/b/blackou"));
+}
+
+void benchmark() {
+	static constexpr const char *ADDRESSES[] = {"/dmx1/12", "/dmx1", "/dmx1/blackout", "/ping", "/2", "/dmx/1/100", "/foo/bar", "/dmx1/511"};
+	static constexpr uint32_t COUNT = 2000000;
+
+	OscDispatcher dispatcher;
+	compile(dispatcher, "/dmx1");
+
+	uint32_t nDispatched = 0;
+	auto nStart = test::nanos();
+
+	for (uint32_t i = 0; i < COUNT; i++) {
+		osc::dispatcher::Result result;
+		nDispatched += dispatcher.Dispatch(ADDRESSES[i & 7], result) ? 1 : 0;
+	}
+
+	const auto nDispatcher = test::nanos() - nStart;
+
+	uint32_t nMatched = 0;
+	nStart = test::nanos();
+
+	for (uint32_t i = 0; i < COUNT; i++) {
+		const auto *pAddress = ADDRESSES[i & 7];
+		nMatched += (osc::is_match(pAddress, "/dmx1") || osc::is_match(pAddress, "/dmx1/blackout") || osc::is_match(pAddress, "/dmx1/*")
+				|| osc::is_match(pAddress, "/ping") || osc::is_match(pAddress, "/2")) ? 1 : 0;
+	}
+
+	const auto nGlob = test::nanos() - nStart;
+
+	CHECK(nDispatched == COUNT / 8 * 7);
+	CHECK(nMatched == COUNT / 8 * 6);
+
+	printf("Dispatcher %.1f M messages/s, sequential glob %.1f M messages/s\n", COUNT * 1e3 / static_cast<double>(nDispatcher), COUNT * 1e3 / static_cast<double>(nGlob));
+}
+}  // namespace
+
+int main() {
+	test_default();
+	test_configured_pattern();
+	benchmark();
+
+	return test::result();
+}
@@ -2,7 +2,7 @@
  * @file pca9685.h
  *
  */
-/* Copyright (C) 2017-2020 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2017-2025 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -88,6 +88,11 @@ public:
 	void Write(const uint32_t nChannel, const uint16_t nValue);
 	void Write(const uint16_t nOn, const uint16_t nOff);
 	void Write(const uint16_t nValue);
+	/**
+	 * @brief Writes nCount consecutive channels in one auto-increment I2C transaction.
+	 * @return The number of bytes on the bus, the address byte included.
+	 */
+	uint32_t Write(const uint32_t nChannel, const uint32_t nCount, const uint16_t *pOn, const uint16_t *pOff);
 
 	void SetFullOn(const uint32_t nChannel, const bool bMode);
 	void SetFullOff(const uint32_t nChannel, const bool bMode);
@@ -2,7 +2,7 @@
  * @file pca9685pwmled.h
  *
  */
-/* Copyright (C) 2017-2023 by Arjan van Vught mailto:info@gd32-dmx.org
+/* Copyright (C) 2017-2025 by Arjan van Vught mailto:info@gd32-dmx.org
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -62,6 +62,31 @@ public:
 			Write(nChannel, nValue);
 		}
 	}
+
+	/**
+	 * @brief As Set with a 16-bit value, for nCount consecutive channels.
+	 * There are no register reads, the full on and full off bits are written with the counts.
+	 * @return The number of bytes on the bus.
+	 */
+	uint32_t Set(const uint32_t nChannel, const uint32_t nCount, const uint16_t *pData) {
+		uint16_t on[pca9685::PWM_CHANNELS];
+		uint16_t off[pca9685::PWM_CHANNELS];
+
+		for (uint32_t i = 0; i < nCount; i++) {
+			if (pData[i] >= 0xFFF) {
+				on[i] = 0x1000;
+				off[i] = 0;
+			} else if (pData[i] == 0) {
+				on[i] = 0;
+				off[i] = 0x1000;
+			} else {
+				on[i] = 0;
+				off[i] = pData[i];
+			}
+		}
+
+		return Write(nChannel, nCount, on, off);
+	}
 };
 
 #endif /* PCA9685PWMLED_H_ */
@@ -2,7 +2,7 @@
  * @file pca9685.cpp
  *
  */
-/* Copyright (C) 2017-2023 by Arjan van Vught mailto:info@gd32-dmx.org
+/* Copyright (C) 2017-2025 by Arjan van Vught mailto:info@gd32-dmx.org
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -206,6 +206,33 @@ void PCA9685::Write(const uint16_t nValue) {
 	Write(static_cast<uint32_t>(16), nValue);
 }
 
+uint32_t PCA9685::Write(const uint32_t nChannel, const uint32_t nCount, const uint16_t *pOn, const uint16_t *pOff) {
+	assert((nChannel + nCount) <= pca9685::PWM_CHANNELS);
+	assert(pOn != nullptr);
+	assert(pOff != nullptr);
+
+	char buffer[1 + 4 * pca9685::PWM_CHANNELS];
+
+	buffer[0] = static_cast<char>(PCA9685_REG_LED0_ON_L + (nChannel << 2));
+
+	auto *pBuffer = &buffer[1];
+
+	for (uint32_t i = 0; i < nCount; i++) {
+		*pBuffer++ = static_cast<char>(pOn[i] & 0xFF);
+		*pBuffer++ = static_cast<char>(pOn[i] >> 8);
+		*pBuffer++ = static_cast<char>(pOff[i] & 0xFF);
+		*pBuffer++ = static_cast<char>(pOff[i] >> 8);
+	}
+
+	const auto nLength = 1 + 4 * nCount;
+
+	I2cSetup();
+
+	FUNC_PREFIX(i2c_write(buffer, nLength));
+
+	return 1 + nLength;
+}
+
 void PCA9685::Read(const uint32_t nChannel, uint16_t *pOn, uint16_t *pOff) {
 	assert(pOn != nullptr);
 	assert(pOff != nullptr);
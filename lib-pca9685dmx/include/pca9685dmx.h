@@ -2,7 +2,7 @@
  * @file pca9685dmx.h
  *
  */
-/* Copyright (C) 2023-2024 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2023-2025 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -35,6 +35,8 @@
 
 #include "lightset.h"
 
+class PCA9685DmxLed;
+
 namespace pca9685dmx {
 static constexpr uint8_t BOARD_INSTANCES_DEFAULT 	= 1;
 static constexpr uint8_t BOARD_INSTANCES_MAX		= 32;
@@ -110,6 +112,11 @@ public:
 		m_Configuration.servo.nRightUs = nRightUs;
 	}
 
+	/**
+	 * @brief Writes the changed LED channels, to be called from the main loop.
+	 */
+	void Run();
+
 	LightSet *GetLightSet() {
 		if (m_pLightSet == nullptr) {
 			Start();
@@ -136,6 +143,7 @@ private:
 	pca9685dmx::Configuration m_Configuration;
 
 	LightSet *m_pLightSet { nullptr };
+	PCA9685DmxLed *m_pDmxLed { nullptr };
 
 	static PCA9685Dmx *s_pThis;
 };
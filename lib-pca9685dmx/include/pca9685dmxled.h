@@ -2,7 +2,7 @@
  * @file pca9685dmxled.h
  *
  */
-/* Copyright (C) 2018-2023 by Arjan van Vught mailto:info@gd32-dmx.org
+/* Copyright (C) 2018-2025 by Arjan van Vught mailto:info@gd32-dmx.org
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -34,6 +34,17 @@
 #include "pca9685dmxstore.h"
 #include "pca9685pwmled.h"
 
+namespace pca9685dmx::led {
+static constexpr uint32_t GAP_MAX = 1;	///< Unchanged channels written to join two runs of changed channels
+
+struct Statistics {
+	uint32_t nChannels;			///< Channels changed
+	uint32_t nTransactions;
+	uint32_t nBytes;
+	uint32_t nUtilisation;		///< Percentage of the last second the I2C bus was busy
+};
+}  // namespace pca9685dmx::led
+
 class PCA9685DmxLed final: public LightSet {
 public:
 	PCA9685DmxLed(const pca9685dmx::Configuration &configuration);
@@ -68,8 +79,28 @@ public:
 
 	bool GetSlotInfo(uint16_t nSlotOffset, lightset::SlotInfo& tSlotInfo) override;
 
+	/**
+	 * @brief Writes the changed channels of one board, to be called from the main loop.
+	 * The changed channels of a board are written with auto-increment burst writes,
+	 * and a board per call keeps the time the main loop is blocked on the I2C bus short.
+	 */
+	void Run();
+
+	const pca9685dmx::led::Statistics& GetStatistics() const {
+		return m_Statistics;
+	}
+
 	void Print() override;
 
+private:
+	void Update(const uint32_t nBoard, const uint32_t nChannel, const uint16_t nValue) {
+		m_Value[nBoard][nChannel] = nValue;
+		m_nDirty[nBoard] = static_cast<uint16_t>(m_nDirty[nBoard] | (1U << nChannel));
+		m_Statistics.nChannels++;
+	}
+
+	void Flush(const uint32_t nBoard);
+
 private:
 	uint16_t m_nBoardInstances;
 	uint16_t m_nDmxFootprint;
@@ -78,6 +109,13 @@ private:
 	bool m_bUse8Bit;
 	uint8_t m_DmxData[lightset::dmx::UNIVERSE_SIZE];
 	PCA9685PWMLed **m_pPWMLed;
+	uint16_t m_Value[pca9685dmx::BOARD_INSTANCES_MAX][pca9685::PWM_CHANNELS];
+	uint16_t m_nDirty[pca9685dmx::BOARD_INSTANCES_MAX];
+	uint32_t m_nBoardNext { 0 };
+	uint32_t m_nBusyMicros { 0 };
+	uint32_t m_nWindowMicros { 0 };
+
+	pca9685dmx::led::Statistics m_Statistics;
 };
 
 #endif /* PCA9685DMXLED_H_ */
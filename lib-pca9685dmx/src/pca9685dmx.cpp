@@ -2,7 +2,7 @@
  * @file pca9685dmx.cpp
  *
  */
-/* Copyright (C) 2023-2024 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2023-2025 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -71,6 +71,7 @@ PCA9685Dmx::~PCA9685Dmx() {
 		m_pLightSet->Stop(0);
 		delete m_pLightSet;
 		m_pLightSet = nullptr;
+		m_pDmxLed = nullptr;
 	}
 
 	DEBUG_EXIT
@@ -94,8 +95,15 @@ void PCA9685Dmx::Start () {
 		auto *pLed = new PCA9685DmxLed(m_Configuration);
 		assert(pLed != nullptr);
 		m_pLightSet = pLed;
+		m_pDmxLed = pLed;
 		pLed->Start(0);
 	}
 
 	DEBUG_EXIT
 }
+
+void PCA9685Dmx::Run() {
+	if (m_pDmxLed != nullptr) {
+		m_pDmxLed->Run();
+	}
+}
@@ -2,7 +2,7 @@
  * @file pca9685dmxled.cpp
  *
  */
-/* Copyright (C) 2018-2024 by Arjan van Vught mailto:info@gd32-dmx.org
+/* Copyright (C) 2018-2025 by Arjan van Vught mailto:info@gd32-dmx.org
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -25,11 +25,14 @@
 
 #include <cstdint>
 #include <cstdio>
+#include <cstring>
 #include <cassert>
 
 #include "pca9685dmxled.h"
 #include "lightset.h"
 
+#include "hardware.h"
+
 #include "debug.h"
 
 PCA9685DmxLed::PCA9685DmxLed(const pca9685dmx::Configuration& configuration) {
@@ -56,6 +59,9 @@ PCA9685DmxLed::PCA9685DmxLed(const pca9685dmx::Configuration& configuration) {
 	m_nDmxStartAddress = configuration.nDmxStartAddress;
 
 	memset(m_DmxData, 0, sizeof(m_DmxData));
+	memset(m_Value, 0, sizeof(m_Value));
+	memset(m_nDirty, 0, sizeof(m_nDirty));
+	memset(&m_Statistics, 0, sizeof(struct pca9685dmx::led::Statistics));
 
 	m_pPWMLed = new PCA9685PWMLed*[m_nBoardInstances];
 	assert(m_pPWMLed != nullptr);
@@ -96,6 +102,7 @@ void PCA9685DmxLed::Stop([[maybe_unused]] const uint32_t nPortIndex) {
 	DEBUG_ENTRY
 
 	for (uint32_t j = 0; j < m_nBoardInstances; j++) {
+		m_nDirty[j] = 0;
 		m_pPWMLed[j]->SetFullOff(CHANNEL(16), true);
 	}
 
@@ -124,7 +131,7 @@ void PCA9685DmxLed::SetData([[maybe_unused]] uint32_t nPortIndex, const uint8_t
 #ifndef NDEBUG
 					printf("m_pPWMLed[%u]->SetDmx(CHANNEL(%u), %u)\n", j, i, static_cast<uint32_t>(value));
 #endif
-					m_pPWMLed[j]->Set(i, value);
+					Update(j, i, static_cast<uint16_t>((value << 4) | (value >> 4)));
 				}
 				pCurrentData++;
 				pPreviousData++;
@@ -149,7 +156,7 @@ void PCA9685DmxLed::SetData([[maybe_unused]] uint32_t nPortIndex, const uint8_t
 #ifndef NDEBUG
 					printf("m_pPWMLed[%u]->SetDmx(CHANNEL(%u), %u)\n", j, i, static_cast<uint32_t>(value));
 #endif
-					m_pPWMLed[j]->Set(i, value);
+					Update(j, i, value);
 				}
 				pCurrentData++;
 				pPreviousData++;
@@ -159,6 +166,56 @@ void PCA9685DmxLed::SetData([[maybe_unused]] uint32_t nPortIndex, const uint8_t
 	}
 }
 
+void PCA9685DmxLed::Flush(const uint32_t nBoard) {
+	auto nDirty = static_cast<uint32_t>(m_nDirty[nBoard]);
+	m_nDirty[nBoard] = 0;
+
+	while (nDirty != 0) {
+		const auto nFirst = static_cast<uint32_t>(__builtin_ctz(nDirty));
+		auto nLast = nFirst;
+
+		for (auto i = nFirst + 1; i < pca9685::PWM_CHANNELS; i++) {
+			if ((nDirty & (1U << i)) != 0) {
+				nLast = i;
+			} else if ((i - nLast) > pca9685dmx::led::GAP_MAX) {
+				break;
+			}
+		}
+
+		const auto nCount = 1 + nLast - nFirst;
+
+		m_Statistics.nBytes += m_pPWMLed[nBoard]->Set(nFirst, nCount, &m_Value[nBoard][nFirst]);
+		m_Statistics.nTransactions++;
+
+		nDirty &= ~(((1U << nCount) - 1) << nFirst);
+	}
+}
+
+void PCA9685DmxLed::Run() {
+	const auto nMicros = Hardware::Get()->Micros();
+	const auto nElapsed = nMicros - m_nWindowMicros;
+
+	if (nElapsed >= 1000000) {
+		m_Statistics.nUtilisation = m_nBusyMicros / (nElapsed / 100);
+		m_nBusyMicros = 0;
+		m_nWindowMicros = nMicros;
+	}
+
+	for (uint32_t j = 0; j < m_nBoardInstances; j++) {
+		const auto nBoard = m_nBoardNext;
+
+		if (++m_nBoardNext == m_nBoardInstances) {
+			m_nBoardNext = 0;
+		}
+
+		if (m_nDirty[nBoard] != 0) {
+			Flush(nBoard);
+			m_nBusyMicros += Hardware::Get()->Micros() - nMicros;
+			return;
+		}
+	}
+}
+
 bool PCA9685DmxLed::GetSlotInfo(uint16_t nSlotOffset, lightset::SlotInfo& tSlotInfo) {
 	if (nSlotOffset >  m_nDmxFootprint) {
 		return false;
@@ -175,4 +232,5 @@ void PCA9685DmxLed::Print() {
 	printf(" Board instances: %u\n", m_nBoardInstances);
 	printf(" Channel count: %u\n", m_nChannelCount);
 	printf(" DMX start address: %u [footprint: %u]\n", m_nDmxStartAddress, m_nDmxFootprint);
+	printf(" I2C: %u channels in %u transactions, %u bytes, %u%% busy\n", static_cast<unsigned int>(m_Statistics.nChannels), static_cast<unsigned int>(m_Statistics.nTransactions), static_cast<unsigned int>(m_Statistics.nBytes), static_cast<unsigned int>(m_Statistics.nUtilisation));
 }
@@ -0,0 +1,48 @@
+/**
+ * @file hal_i2c.h
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef HAL_I2C_H_
+#define HAL_I2C_H_
+
+#include <cstdint>
+
+/**
+ * Stub of the I2C driver, the transactions are implemented by the test
+ */
+
+#define FUNC_PREFIX(x) x
+
+struct HAL_I2C {
+	static constexpr uint32_t FULL_SPEED = 400000;
+};
+
+inline void i2c_begin() {}
+inline void i2c_set_baudrate(uint32_t) {}
+
+void i2c_set_address(uint8_t nAddress);
+void i2c_write(const char *pData, uint32_t nLength);
+void i2c_read(char *pData, uint32_t nLength);
+
+#endif /* HAL_I2C_H_ */
@@ -0,0 +1,215 @@
+/**
+ * @file test_pca9685dmxled.cpp
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * The I2C stub records the address and the bytes of every write. With 64
+ * channels there are 4 boards. Checked are the burst writes per board, the
+ * register addresses, the merging of the runs of changed channels and the
+ * full on and full off encoding.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "pca9685dmxled.h"
+#include "configstore.h"
+
+#include "test.h"
+
+namespace {
+static constexpr uint8_t ADDRESS = 0x40;
+static constexpr uint8_t LED0_ON_L = 0x06;
+static constexpr uint32_t CHANNELS = 64;
+
+struct Transaction {
+	uint8_t nAddress;
+	std::vector<uint8_t> data;
+};
+
+std::vector<Transaction> s_Transactions;
+uint8_t s_nAddress;
+uint8_t s_DmxData[lightset::dmx::UNIVERSE_SIZE];
+
+pca9685dmx::Configuration configuration() {
+	pca9685dmx::Configuration config {};
+
+	config.nAddress = ADDRESS;
+	config.nChannelCount = CHANNELS;
+	config.nDmxStartAddress = 1;
+	config.bUse8Bit = true;
+	config.led.nLedPwmFrequency = pca9685::pwmled::DEFAULT_FREQUENCY;
+
+	return config;
+}
+
+void run(PCA9685DmxLed& led, const uint32_t nCount) {
+	for (uint32_t i = 0; i < nCount; i++) {
+		led.Run();
+	}
+}
+
+/*
+ * LEDn_ON_L, LEDn_ON_H, LEDn_OFF_L, LEDn_OFF_H
+ */
+void append(std::vector<uint8_t>& data, const uint16_t nOn, const uint16_t nOff) {
+	data.push_back(static_cast<uint8_t>(nOn & 0xFF));
+	data.push_back(static_cast<uint8_t>(nOn >> 8));
+	data.push_back(static_cast<uint8_t>(nOff & 0xFF));
+	data.push_back(static_cast<uint8_t>(nOff >> 8));
+}
+
+uint16_t value(const uint8_t nDmx) {
+	return static_cast<uint16_t>((nDmx << 4) | (nDmx >> 4));
+}
+
+void test_burst() {
+	PCA9685DmxLed led(configuration());
+
+	for (uint32_t i = 0; i < CHANNELS; i++) {
+		s_DmxData[i] = static_cast<uint8_t>(i + 1);
+	}
+
+	s_Transactions.clear();
+	led.SetData(0, s_DmxData, lightset::dmx::UNIVERSE_SIZE);
+
+	// Nothing on the bus until Run()
+	CHECK(s_Transactions.empty());
+
+	led.Run();
+
+	// A board per call
+	CHECK(s_Transactions.size() == 1);
+
+	run(led, 4);
+
+	CHECK(s_Transactions.size() == 4);
+
+	uint32_t nErrors = 0;
+
+	for (uint32_t nBoard = 0; nBoard < s_Transactions.size(); nBoard++) {
+		std::vector<uint8_t> expected { LED0_ON_L };
+
+		for (uint32_t i = 0; i < pca9685::PWM_CHANNELS; i++) {
+			append(expected, 0, value(s_DmxData[nBoard * pca9685::PWM_CHANNELS + i]));
+		}
+
+		const auto& transaction = s_Transactions[nBoard];
+
+		if ((transaction.nAddress != ADDRESS + nBoard) || (transaction.data != expected)) {
+			nErrors++;
+		}
+	}
+
+	CHECK(nErrors == 0);
+
+	const auto& statistics = led.GetStatistics();
+
+	CHECK(statistics.nChannels == CHANNELS);
+	CHECK(statistics.nTransactions == 4);
+	CHECK(statistics.nBytes == 4 * (1 + 1 + 4 * pca9685::PWM_CHANNELS));
+
+	// Unchanged data
+	s_Transactions.clear();
+	led.SetData(0, s_DmxData, lightset::dmx::UNIVERSE_SIZE);
+	run(led, 4);
+
+	CHECK(s_Transactions.empty());
+}
+
+void test_runs() {
+	PCA9685DmxLed led(configuration());
+
+	for (uint32_t i = 0; i < CHANNELS; i++) {
+		s_DmxData[i] = static_cast<uint8_t>(i + 1);
+	}
+
+	led.SetData(0, s_DmxData, lightset::dmx::UNIVERSE_SIZE);
+	run(led, 4);
+
+	/*
+	 * Board 0: channel 0 full on and channel 2 full off, the unchanged channel 1
+	 * joins the runs. Channel 7 is too far away and has its own write.
+	 * Board 1: channel 0.
+	 */
+	s_DmxData[0] = 0xFF;
+	s_DmxData[2] = 0;
+	s_DmxData[7] = 10;
+	s_DmxData[16] = 20;
+
+	s_Transactions.clear();
+	led.SetData(0, s_DmxData, lightset::dmx::UNIVERSE_SIZE);
+	run(led, 4);
+
+	CHECK(s_Transactions.size() == 3);
+
+	if (s_Transactions.size() != 3) {
+		return;
+	}
+
+	std::vector<uint8_t> expected { LED0_ON_L };
+	append(expected, 0x1000, 0);
+	append(expected, 0, value(s_DmxData[1]));
+	append(expected, 0, 0x1000);
+
+	CHECK(s_Transactions[0].nAddress == ADDRESS);
+	CHECK(s_Transactions[0].data == expected);
+
+	expected = { LED0_ON_L + 7 * 4 };
+	append(expected, 0, value(10));
+
+	CHECK(s_Transactions[1].nAddress == ADDRESS);
+	CHECK(s_Transactions[1].data == expected);
+
+	expected = { LED0_ON_L };
+	append(expected, 0, value(20));
+
+	CHECK(s_Transactions[2].nAddress == ADDRESS + 1);
+	CHECK(s_Transactions[2].data == expected);
+}
+}  // namespace
+
+void i2c_set_address(uint8_t nAddress) {
+	s_nAddress = nAddress;
+}
+
+void i2c_write(const char *pData, uint32_t nLength) {
+	s_Transactions.push_back({ s_nAddress, std::vector<uint8_t>(reinterpret_cast<const uint8_t *>(pData), reinterpret_cast<const uint8_t *>(pData) + nLength) });
+}
+
+void i2c_read(char *pData, uint32_t nLength) {
+	for (uint32_t i = 0; i < nLength; i++) {
+		pData[i] = 0;
+	}
+}
+
+void ConfigStore::Update(configstore::Store, uint32_t, const void *, uint32_t, uint32_t, uint32_t) {}
+
+int main() {
+	test_burst();
+	test_runs();
+
+	return test::result();
+}
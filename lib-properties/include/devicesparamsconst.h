@@ -2,7 +2,7 @@
  * @file devicesparamsconst.h
  *
  */
-/* Copyright (C) 2019-2024 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2019-2025 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -48,6 +48,33 @@ struct DevicesParamsConst {
 
 	static const char GAMMA_CORRECTION[];
 	static const char GAMMA_VALUE[];
+
+	static const char WHITE_BALANCE[3][20];
+	static const char DITHER[];
+
+#if defined (CONFIG_PIXELDMX_MAX_PORTS)
+	static inline const char COUNT_PORT[8][20] = {
+			"led_count_port_1",
+			"led_count_port_2",
+			"led_count_port_3",
+			"led_count_port_4",
+			"led_count_port_5",
+			"led_count_port_6",
+			"led_count_port_7",
+			"led_count_port_8"
+	};
+
+	static inline const char TYPE_PORT[8][20] = {
+			"led_type_port_1",
+			"led_type_port_2",
+			"led_type_port_3",
+			"led_type_port_4",
+			"led_type_port_5",
+			"led_type_port_6",
+			"led_type_port_7",
+			"led_type_port_8"
+	};
+#endif
 };
 
 #endif /* DEVICESPARAMSCONST_H_ */
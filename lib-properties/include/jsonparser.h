@@ -0,0 +1,70 @@
+/**
+ * @file jsonparser.h
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef JSONPARSER_H_
+#define JSONPARSER_H_
+
+#include <cstdint>
+
+/**
+ * Event (SAX) based JSON parser without dynamic memory.
+ *
+ * The strings are unescaped in place, the key and value of an event point
+ * into the buffer and are not '\0' terminated.
+ * The input is one JSON value, optionally followed by whitespace.
+ * The input ends at nLength or at a '\0'.
+ */
+
+namespace json::parser {
+static constexpr uint32_t DEPTH_MAX = 16;
+
+enum class Type : uint8_t {
+	OBJECT_START, OBJECT_END, ARRAY_START, ARRAY_END, STRING, NUMBER, TRUE, FALSE, NUL
+};
+
+struct Event {
+	const char *pKey;			///< nullptr for an element of an array
+	const char *pValue;			///< STRING, NUMBER, TRUE, FALSE and NUL only
+	uint32_t nKeyLength;
+	uint32_t nValueLength;
+	uint32_t nDepth;			///< 0 is the top level value
+	Type type;
+};
+}  // namespace json::parser
+
+/**
+ * @return false stops the parser
+ */
+typedef bool (*JsonParserCallbackFunctionPtr)(void *pContext, const struct json::parser::Event& event);
+
+class JsonParser {
+public:
+	/**
+	 * @return false when the input is not valid JSON or the callback has stopped the parser.
+	 */
+	static bool Parse(char *pBuffer, const uint32_t nLength, JsonParserCallbackFunctionPtr pJsonParserCallbackFunctionPtr, void *pContext);
+};
+
+#endif /* JSONPARSER_H_ */
@@ -0,0 +1,117 @@
+/**
+ * @file jsonwriter.h
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef JSONWRITER_H_
+#define JSONWRITER_H_
+
+#include <cstdint>
+
+/**
+ * Streaming JSON writer without dynamic memory and without printf formatting.
+ *
+ * Without a flush function the output is written to the buffer only,
+ * IsOverflow() tells if it was truncated.
+ * With a flush function the buffer is sent as a HTTP/1.1 chunk each time it is full,
+ * so the size of the output is not limited by the size of the buffer.
+ * A chunk header with a fixed width is reserved in front of the data,
+ * so a chunk is passed to the flush function without copying.
+ */
+
+namespace json::writer {
+static constexpr uint32_t DEPTH_MAX = 16;
+static constexpr uint32_t CHUNK_HEADER_SIZE = 6;	///< "XXXX\r\n"
+static constexpr uint32_t CHUNK_TRAILER_SIZE = 2;	///< "\r\n"
+}  // namespace json::writer
+
+typedef void (*JsonWriterFlushFunctionPtr)(void *pContext, const char *pData, const uint32_t nLength);
+
+class JsonWriter {
+public:
+	JsonWriter(char *pBuffer, const uint32_t nSize, JsonWriterFlushFunctionPtr pJsonWriterFlushFunctionPtr = nullptr, void *pContext = nullptr);
+
+	/**
+	 * @param pKey Name of the member, nullptr for an element of an array or the top level value.
+	 */
+	void ObjectStart(const char *pKey = nullptr);
+	void ObjectEnd();
+	void ArrayStart(const char *pKey = nullptr);
+	void ArrayEnd();
+
+	void Add(const char *pKey, const char *pValue);
+	void Add(const char *pKey, const char *pValue, const uint32_t nLength);
+	void Add(const char *pKey, const uint32_t nValue);
+	void Add(const char *pKey, const int32_t nValue);
+	void Add(const char *pKey, const bool bValue);
+
+	/**
+	 * @brief Add a value which is already valid JSON, for example a number with a fraction.
+	 */
+	void AddRaw(const char *pKey, const char *pValue, const uint32_t nLength);
+
+	/**
+	 * @brief Flushes the remaining data. In chunked mode the last (empty) chunk is sent.
+	 * @return Total number of bytes of JSON written.
+	 */
+	uint32_t Finish();
+
+	bool IsOverflow() const {
+		return m_bOverflow;
+	}
+
+	bool IsChunked() const {
+		return m_pJsonWriterFlushFunctionPtr != nullptr;
+	}
+
+private:
+	void Value(const char *pKey);
+	void String(const char *pString, const uint32_t nLength);
+	void Uint(uint32_t nValue);
+	void Write(const char *pData, uint32_t nLength);
+	void Put(const char c) {
+		if (__builtin_expect((m_nOffset == m_nEnd), 0)) {
+			Flush();
+			if (m_nOffset == m_nEnd) {
+				m_bOverflow = true;
+				return;
+			}
+		}
+		m_pBuffer[m_nOffset++] = c;
+	}
+	void Flush();
+
+private:
+	char *m_pBuffer;
+	JsonWriterFlushFunctionPtr m_pJsonWriterFlushFunctionPtr;
+	void *m_pContext;
+	uint32_t m_nStart;
+	uint32_t m_nEnd;
+	uint32_t m_nOffset;
+	uint32_t m_nTotal { 0 };
+	uint32_t m_nDepth { 0 };
+	uint32_t m_nHasElements { 0 };	///< Bit per depth
+	bool m_bOverflow { false };
+};
+
+#endif /* JSONWRITER_H_ */
@@ -2,7 +2,7 @@
  * @file devicesparamsconst.cpp
  *
  */
-/* Copyright (C) 2019-2024 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2019-2025 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -48,3 +48,6 @@ const char DevicesParamsConst::TEST_PATTERN[] = "test_pattern";
 const char DevicesParamsConst::GAMMA_CORRECTION[] = "gamma_correction";
 const char DevicesParamsConst::GAMMA_VALUE[] = "gamma_value";
 
+const char DevicesParamsConst::WHITE_BALANCE[3][20] = { "white_balance_red", "white_balance_green", "white_balance_blue" };
+const char DevicesParamsConst::DITHER[] = "dither";
+
@@ -0,0 +1,414 @@
+/**
+ * @file jsonparser.cpp
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#if defined (DEBUG_JSONPARSER)
+# undef NDEBUG
+#endif
+
+#if defined(__GNUC__) && !defined(__clang__)
+# pragma GCC push_options
+# pragma GCC optimize ("O2")
+#endif
+
+#include <cstdint>
+#include <cstring>
+#include <cassert>
+
+#include "jsonparser.h"
+
+#include "debug.h"
+
+using namespace json::parser;
+
+namespace json::parser {
+enum class State {
+	VALUE, KEY, KEY_OR_END, VALUE_OR_END, COMMA_OR_END
+};
+
+static bool is_whitespace(const char c) {
+	return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\r');
+}
+
+static int32_t hex_value(const char c) {
+	if ((c >= '0') && (c <= '9')) {
+		return c - '0';
+	}
+
+	const auto l = c | 0x20;
+
+	if ((l >= 'a') && (l <= 'f')) {
+		return l - 'a' + 10;
+	}
+
+	return -1;
+}
+
+/**
+ * Unescapes the string in place.
+ * @param i Index of the opening quote, on return the index after the closing quote.
+ * @return false when the string is not terminated or has an invalid escape.
+ */
+static bool parse_string(char *pBuffer, const uint32_t nLength, uint32_t& i, uint32_t& nStringLength) {
+	auto nRead = ++i;
+	auto nWrite = i;
+
+	while (nRead < nLength) {
+		auto c = pBuffer[nRead++];
+
+		if (c == '"') {
+			nStringLength = nWrite - i;
+			i = nRead;
+			return true;
+		}
+
+		if (static_cast<uint8_t>(c) < 0x20) {
+			return false;
+		}
+
+		if (c == '\\') {
+			if (nRead == nLength) {
+				return false;
+			}
+
+			c = pBuffer[nRead++];
+
+			switch (c) {
+			case '"':
+			case '\\':
+			case '/':
+				break;
+			case 'b':
+				c = '\b';
+				break;
+			case 'f':
+				c = '\f';
+				break;
+			case 'n':
+				c = '\n';
+				break;
+			case 'r':
+				c = '\r';
+				break;
+			case 't':
+				c = '\t';
+				break;
+			case 'u': {
+				if ((nRead + 4) > nLength) {
+					return false;
+				}
+
+				uint32_t nCodePoint = 0;
+
+				for (uint32_t j = 0; j < 4; j++) {
+					const auto nDigit = hex_value(pBuffer[nRead++]);
+					if (nDigit < 0) {
+						return false;
+					}
+					nCodePoint = (nCodePoint << 4) | static_cast<uint32_t>(nDigit);
+				}
+
+				// UTF-8, the encoding is never longer than the escape sequence
+				if (nCodePoint < 0x80) {
+					c = static_cast<char>(nCodePoint);
+				} else if (nCodePoint < 0x800) {
+					pBuffer[nWrite++] = static_cast<char>(0xC0 | (nCodePoint >> 6));
+					c = static_cast<char>(0x80 | (nCodePoint & 0x3F));
+				} else {
+					pBuffer[nWrite++] = static_cast<char>(0xE0 | (nCodePoint >> 12));
+					pBuffer[nWrite++] = static_cast<char>(0x80 | ((nCodePoint >> 6) & 0x3F));
+					c = static_cast<char>(0x80 | (nCodePoint & 0x3F));
+				}
+				break;
+			}
+			default:
+				return false;
+			}
+		}
+
+		pBuffer[nWrite++] = c;
+	}
+
+	return false;
+}
+
+/**
+ * -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+ * @return false when the number is not valid.
+ */
+static bool parse_number(const char *pBuffer, const uint32_t nLength, uint32_t& i) {
+	const auto is_digit = [&](const uint32_t n) {
+		return (n < nLength) && (pBuffer[n] >= '0') && (pBuffer[n] <= '9');
+	};
+
+	if ((i < nLength) && (pBuffer[i] == '-')) {
+		i++;
+	}
+
+	if (!is_digit(i)) {
+		return false;
+	}
+
+	if (pBuffer[i++] != '0') {
+		while (is_digit(i)) {
+			i++;
+		}
+	}
+
+	if ((i < nLength) && (pBuffer[i] == '.')) {
+		if (!is_digit(++i)) {
+			return false;
+		}
+
+		while (is_digit(i)) {
+			i++;
+		}
+	}
+
+	if ((i < nLength) && ((pBuffer[i] | 0x20) == 'e')) {
+		i++;
+
+		if ((i < nLength) && ((pBuffer[i] == '+') || (pBuffer[i] == '-'))) {
+			i++;
+		}
+
+		if (!is_digit(i)) {
+			return false;
+		}
+
+		while (is_digit(i)) {
+			i++;
+		}
+	}
+
+	return true;
+}
+
+/**
+ * Only whitespace can follow the value.
+ */
+static bool is_end(const char *pBuffer, const uint32_t nLength, uint32_t i) {
+	while ((i < nLength) && is_whitespace(pBuffer[i])) {
+		i++;
+	}
+
+	return (i == nLength) || (pBuffer[i] == '\0');
+}
+}  // namespace json::parser
+
+bool JsonParser::Parse(char *pBuffer, const uint32_t nLength, JsonParserCallbackFunctionPtr pJsonParserCallbackFunctionPtr, void *pContext) {
+	assert(pBuffer != nullptr);
+	assert(pJsonParserCallbackFunctionPtr != nullptr);
+
+	struct Event event;
+	event.pKey = nullptr;
+	event.nKeyLength = 0;
+
+	uint32_t nDepth = 0;
+	uint32_t nIsObject = 0;	// Bit per depth
+	auto state = State::VALUE;
+	uint32_t i = 0;
+
+	for (;;) {
+		while ((i < nLength) && is_whitespace(pBuffer[i])) {
+			i++;
+		}
+
+		if ((i == nLength) || (pBuffer[i] == '\0')) {
+			break;
+		}
+
+		const auto c = pBuffer[i];
+		auto bIsClose = false;
+
+		switch (state) {
+		case State::KEY_OR_END:
+			if (c == '}') {
+				bIsClose = true;
+				break;
+			}
+			 __attribute__ ((fallthrough));
+			/* no break */
+		case State::KEY:
+			if (c != '"') {
+				DEBUG_PRINTF("Key expected at %u", i);
+				return false;
+			}
+
+			event.pKey = &pBuffer[i + 1];
+
+			if (!parse_string(pBuffer, nLength, i, event.nKeyLength)) {
+				return false;
+			}
+
+			while ((i < nLength) && is_whitespace(pBuffer[i])) {
+				i++;
+			}
+
+			if ((i == nLength) || (pBuffer[i] != ':')) {
+				return false;
+			}
+
+			i++;
+			state = State::VALUE;
+			continue;
+		case State::VALUE_OR_END:
+			if (c == ']') {
+				bIsClose = true;
+				break;
+			}
+			state = State::VALUE;
+			continue;
+		case State::COMMA_OR_END:
+			if (c == ',') {
+				i++;
+				state = (nIsObject & (1U << nDepth)) ? State::KEY : State::VALUE;
+				continue;
+			}
+
+			if (c != ((nIsObject & (1U << nDepth)) ? '}' : ']')) {
+				DEBUG_PRINTF("',' expected at %u", i);
+				return false;
+			}
+
+			bIsClose = true;
+			break;
+		case State::VALUE:
+			break;
+		default:
+			assert(0);
+			__builtin_unreachable();
+			break;
+		}
+
+		event.nDepth = nDepth;
+
+		if (bIsClose) {
+			i++;
+			event.type = (nIsObject & (1U << nDepth)) ? Type::OBJECT_END : Type::ARRAY_END;
+			event.pKey = nullptr;
+			event.pValue = nullptr;
+			nDepth--;
+			event.nDepth = nDepth;
+
+			if (!pJsonParserCallbackFunctionPtr(pContext, event)) {
+				return false;
+			}
+
+			if (nDepth == 0) {
+				return is_end(pBuffer, nLength, i);
+			}
+
+			state = State::COMMA_OR_END;
+			continue;
+		}
+
+		// A value
+		event.pValue = &pBuffer[i];
+
+		if ((c == '{') || (c == '[')) {
+			if (nDepth == (DEPTH_MAX - 1)) {
+				return false;
+			}
+
+			i++;
+			event.type = (c == '{') ? Type::OBJECT_START : Type::ARRAY_START;
+			event.pValue = nullptr;
+			event.nValueLength = 0;
+
+			if (!pJsonParserCallbackFunctionPtr(pContext, event)) {
+				return false;
+			}
+
+			nDepth++;
+
+			if (c == '{') {
+				nIsObject |= (1U << nDepth);
+				state = State::KEY_OR_END;
+			} else {
+				nIsObject &= ~(1U << nDepth);
+				state = State::VALUE_OR_END;
+			}
+
+			event.pKey = nullptr;
+			event.nKeyLength = 0;
+			continue;
+		}
+
+		if (c == '"') {
+			event.pValue = &pBuffer[i + 1];
+			event.type = Type::STRING;
+
+			if (!parse_string(pBuffer, nLength, i, event.nValueLength)) {
+				return false;
+			}
+		} else if ((c == '-') || ((c >= '0') && (c <= '9'))) {
+			const auto nStart = i;
+
+			if (!parse_number(pBuffer, nLength, i)) {
+				DEBUG_PRINTF("Invalid number at %u", nStart);
+				return false;
+			}
+
+			event.type = Type::NUMBER;
+			event.nValueLength = i - nStart;
+		} else {
+			static constexpr const char *LITERALS[] = { "true", "false", "null" };
+			static constexpr Type TYPES[] = { Type::TRUE, Type::FALSE, Type::NUL };
+			uint32_t j;
+
+			for (j = 0; j < 3; j++) {
+				const auto nLiteralLength = static_cast<uint32_t>(strlen(LITERALS[j]));
+
+				if (((i + nLiteralLength) <= nLength) && (memcmp(&pBuffer[i], LITERALS[j], nLiteralLength) == 0)) {
+					event.type = TYPES[j];
+					event.nValueLength = nLiteralLength;
+					i += nLiteralLength;
+					break;
+				}
+			}
+
+			if (j == 3) {
+				DEBUG_PRINTF("Value expected at %u", i);
+				return false;
+			}
+		}
+
+		if (!pJsonParserCallbackFunctionPtr(pContext, event)) {
+			return false;
+		}
+
+		if (nDepth == 0) {
+			return is_end(pBuffer, nLength, i);
+		}
+
+		event.pKey = nullptr;
+		event.nKeyLength = 0;
+		state = State::COMMA_OR_END;
+	}
+
+	// The input has ended before the value is complete
+	DEBUG_PUTS("Unexpected end");
+	return false;
+}
@@ -0,0 +1,270 @@
+/**
+ * @file jsonwriter.cpp
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#if defined(__GNUC__) && !defined(__clang__)
+# pragma GCC push_options
+# pragma GCC optimize ("O2")
+#endif
+
+#include <cstdint>
+#include <cstring>
+#include <cassert>
+
+#include "jsonwriter.h"
+
+#include "debug.h"
+
+using namespace json::writer;
+
+namespace json::writer {
+static constexpr char HEX_DIGITS[] = "0123456789abcdef";
+}  // namespace json::writer
+
+JsonWriter::JsonWriter(char *pBuffer, const uint32_t nSize, JsonWriterFlushFunctionPtr pJsonWriterFlushFunctionPtr, void *pContext):
+	m_pBuffer(pBuffer),
+	m_pJsonWriterFlushFunctionPtr(pJsonWriterFlushFunctionPtr),
+	m_pContext(pContext)
+{
+	assert(pBuffer != nullptr);
+
+	if (pJsonWriterFlushFunctionPtr != nullptr) {
+		assert(nSize > (CHUNK_HEADER_SIZE + CHUNK_TRAILER_SIZE));
+		assert((nSize - CHUNK_HEADER_SIZE - CHUNK_TRAILER_SIZE) <= 0xFFFF);
+		m_nStart = CHUNK_HEADER_SIZE;
+		m_nEnd = nSize - CHUNK_TRAILER_SIZE;
+	} else {
+		m_nStart = 0;
+		m_nEnd = nSize;
+	}
+
+	m_nOffset = m_nStart;
+}
+
+void JsonWriter::Flush() {
+	if (m_pJsonWriterFlushFunctionPtr == nullptr) {
+		return;
+	}
+
+	const auto nLength = m_nOffset - m_nStart;
+
+	if (nLength == 0) {
+		return;
+	}
+
+	m_pBuffer[0] = HEX_DIGITS[(nLength >> 12) & 0xF];
+	m_pBuffer[1] = HEX_DIGITS[(nLength >> 8) & 0xF];
+	m_pBuffer[2] = HEX_DIGITS[(nLength >> 4) & 0xF];
+	m_pBuffer[3] = HEX_DIGITS[nLength & 0xF];
+	m_pBuffer[4] = '\r';
+	m_pBuffer[5] = '\n';
+	m_pBuffer[m_nOffset++] = '\r';
+	m_pBuffer[m_nOffset++] = '\n';
+
+	m_pJsonWriterFlushFunctionPtr(m_pContext, m_pBuffer, m_nOffset);
+
+	m_nTotal += nLength;
+	m_nOffset = m_nStart;
+}
+
+void JsonWriter::Write(const char *pData, uint32_t nLength) {
+	while (nLength != 0) {
+		if (m_nOffset == m_nEnd) {
+			Flush();
+			if (m_nOffset == m_nEnd) {
+				m_bOverflow = true;
+				return;
+			}
+		}
+
+		auto nCopy = m_nEnd - m_nOffset;
+
+		if (nCopy > nLength) {
+			nCopy = nLength;
+		}
+
+		memcpy(&m_pBuffer[m_nOffset], pData, nCopy);
+		m_nOffset += nCopy;
+		pData += nCopy;
+		nLength -= nCopy;
+	}
+}
+
+void JsonWriter::String(const char *pString, const uint32_t nLength) {
+	Put('"');
+
+	uint32_t nRun = 0;
+
+	for (uint32_t i = 0; i < nLength; i++) {
+		const auto c = static_cast<uint8_t>(pString[i]);
+
+		if ((c >= 0x20) && (c != '"') && (c != '\\')) {
+			nRun++;
+			continue;
+		}
+
+		Write(&pString[i - nRun], nRun);
+		nRun = 0;
+
+		Put('\\');
+
+		if (c == '"' || c == '\\') {
+			Put(static_cast<char>(c));
+		} else if (c == '\n') {
+			Put('n');
+		} else if (c == '\r') {
+			Put('r');
+		} else if (c == '\t') {
+			Put('t');
+		} else {
+			Write("u00", 3);
+			Put(HEX_DIGITS[c >> 4]);
+			Put(HEX_DIGITS[c & 0xF]);
+		}
+	}
+
+	Write(&pString[nLength - nRun], nRun);
+	Put('"');
+}
+
+void JsonWriter::Uint(uint32_t nValue) {
+	char digits[10];
+	uint32_t i = sizeof(digits);
+
+	do {
+		digits[--i] = static_cast<char>('0' + (nValue % 10U));
+		nValue /= 10U;
+	} while (nValue != 0);
+
+	Write(&digits[i], static_cast<uint32_t>(sizeof(digits) - i));
+}
+
+/**
+ * Separator and member name in front of a value
+ */
+void JsonWriter::Value(const char *pKey) {
+	const auto nMask = (1U << m_nDepth);
+
+	if (m_nHasElements & nMask) {
+		Put(',');
+	}
+
+	m_nHasElements |= nMask;
+
+	if (pKey != nullptr) {
+		String(pKey, static_cast<uint32_t>(strlen(pKey)));
+		Put(':');
+	}
+}
+
+void JsonWriter::ObjectStart(const char *pKey) {
+	assert(m_nDepth < (DEPTH_MAX - 1));
+
+	Value(pKey);
+	Put('{');
+
+	m_nDepth++;
+	m_nHasElements &= ~(1U << m_nDepth);
+}
+
+void JsonWriter::ObjectEnd() {
+	assert(m_nDepth > 0);
+
+	m_nDepth--;
+	Put('}');
+}
+
+void JsonWriter::ArrayStart(const char *pKey) {
+	assert(m_nDepth < (DEPTH_MAX - 1));
+
+	Value(pKey);
+	Put('[');
+
+	m_nDepth++;
+	m_nHasElements &= ~(1U << m_nDepth);
+}
+
+void JsonWriter::ArrayEnd() {
+	assert(m_nDepth > 0);
+
+	m_nDepth--;
+	Put(']');
+}
+
+void JsonWriter::Add(const char *pKey, const char *pValue) {
+	assert(pValue != nullptr);
+	Add(pKey, pValue, static_cast<uint32_t>(strlen(pValue)));
+}
+
+void JsonWriter::Add(const char *pKey, const char *pValue, const uint32_t nLength) {
+	Value(pKey);
+	String(pValue, nLength);
+}
+
+void JsonWriter::Add(const char *pKey, const uint32_t nValue) {
+	Value(pKey);
+	Uint(nValue);
+}
+
+void JsonWriter::Add(const char *pKey, const int32_t nValue) {
+	Value(pKey);
+
+	if (nValue < 0) {
+		Put('-');
+		Uint(static_cast<uint32_t>(0) - static_cast<uint32_t>(nValue));
+	} else {
+		Uint(static_cast<uint32_t>(nValue));
+	}
+}
+
+void JsonWriter::Add(const char *pKey, const bool bValue) {
+	Value(pKey);
+
+	if (bValue) {
+		Write("true", 4);
+	} else {
+		Write("false", 5);
+	}
+}
+
+void JsonWriter::AddRaw(const char *pKey, const char *pValue, const uint32_t nLength) {
+	Value(pKey);
+	Write(pValue, nLength);
+}
+
+uint32_t JsonWriter::Finish() {
+	assert(m_nDepth == 0);
+
+	if (m_pJsonWriterFlushFunctionPtr == nullptr) {
+		m_nTotal = m_nOffset;
+		return m_nTotal;
+	}
+
+	Flush();
+
+	static constexpr char LAST_CHUNK[] = "0\r\n\r\n";
+	m_pJsonWriterFlushFunctionPtr(m_pContext, LAST_CHUNK, sizeof(LAST_CHUNK) - 1);
+
+	return m_nTotal;
+}
@@ -2,7 +2,7 @@
  * @file properties.cpp
  *
  */
-/* Copyright (C) 2021-2024 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2021-2025 by Arjan van Vught mailto:info@gd32-dmx.org
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -24,119 +24,98 @@
  */
 
 #include <cstdint>
+#include <cstring>
 #include <cassert>
-#include <ctype.h>
 
-#include "debug.h"
-
-namespace properties {
-int convert_json_file(char *pBuffer, uint32_t nLength, const bool bSkipFileName) {
-	DEBUG_ENTRY
-	assert(pBuffer != nullptr);
-	assert(nLength > 1);
+#include "jsonparser.h"
 
-	debug_dump(pBuffer, static_cast<uint16_t>(nLength));
-
-	const auto *pSrc = pBuffer;
-	auto *pDst = pBuffer;
-
-	if (pSrc[0] != '{') {
-		DEBUG_EXIT
-		return -1;
-	}
+#include "debug.h"
 
-	uint32_t nNewLength = 1;
-	uint32_t i = 1;
+/*
+ * Converts the JSON object in place into properties, one "name=value" per line.
+ * With the file name : {"file.txt":{"name":value,...}} -> "#file.txt\nname=value\n..."
+ * Without            : {"name":value,...}               -> "name=value\n..."
+ * Nested objects and arrays are skipped.
+ * The output is never longer than the input, so the output can overwrite the input.
+ */
 
-	if (!bSkipFileName) {
-		pDst[0] = '#';
-		pDst++;
-		pSrc++;
+namespace properties {
+struct Convert {
+	char *pDst;
+	uint32_t nValueDepth;
+	bool bHasFileName;
+};
+
+static void append(Convert *pConvert, const char *pSrc, const uint32_t nLength) {
+	memmove(pConvert->pDst, pSrc, nLength);
+	pConvert->pDst += nLength;
+}
 
-		for (;i < nLength; i++) {
-			if (*pSrc++ == '"') {
-				break;
-			}
-		}
+static bool convert_callback(void *pContext, const struct json::parser::Event& event) {
+	auto *pConvert = reinterpret_cast<Convert *>(pContext);
 
-		// File name
-		for (; (i < nLength) && (*pSrc != '"'); i++) {
-			*pDst++ = *pSrc++;
-			nNewLength++;
+	if (event.type == json::parser::Type::OBJECT_START) {
+		if ((event.nDepth == 1) && (pConvert->nValueDepth == 2) && !pConvert->bHasFileName) {
+			pConvert->bHasFileName = true;
+			*pConvert->pDst++ = '#';
+			append(pConvert, event.pKey, event.nKeyLength);
+			*pConvert->pDst++ = '\n';
 		}
+		return true;
+	}
 
-		*pDst++ = '\n';
-		nNewLength++;
-
-		while ((*pSrc != '{') &&  (i++ < nLength)) {
-			pSrc++;
-		}
-	} else {
-		while ((*pSrc != '{') &&  (i++ < nLength)) {
-			pSrc++;
-		}
+	if ((event.pValue == nullptr) || (event.pKey == nullptr) || (event.nDepth != pConvert->nValueDepth)) {
+		return true;
 	}
 
-	for (; i < nLength; i++) {
-		// Name
-		while (i++ < nLength) {
-			if (*pSrc++ == '"') {
-				break;
+	append(pConvert, event.pKey, event.nKeyLength);
+	*pConvert->pDst++ = '=';
+
+	if (event.type == json::parser::Type::TRUE) {
+		*pConvert->pDst++ = '1';
+	} else if (event.type == json::parser::Type::FALSE) {
+		*pConvert->pDst++ = '0';
+	} else if (event.type != json::parser::Type::NUL) {
+		// Control characters would break the line format
+		for (uint32_t i = 0; i < event.nValueLength; i++) {
+			const auto c = event.pValue[i];
+			if (static_cast<uint8_t>(c) >= 0x20) {
+				*pConvert->pDst++ = c;
 			}
 		}
+	}
 
-		while ((*pSrc != '"') &&  (i++ < nLength)) {
-			*pDst++ = *pSrc++;
-			nNewLength++;
-		}
-
-
-		if (*pSrc == '"') {
-			*pDst++ = '=';
-			nNewLength++;
-		}
-
-		// Value
-		while (i++ < nLength) {
-			if (*pSrc++ == ':') {
-				break;
-			}
-		}
+	*pConvert->pDst++ = '\n';
 
-		while ((*pSrc == ' ') && (i++ < nLength)) {
-			pSrc++;
-		}
+	return true;
+}
 
-		if (*pSrc == '"') {
-			pSrc++;
-		}
+int convert_json_file(char *pBuffer, uint32_t nLength, const bool bSkipFileName) {
+	DEBUG_ENTRY
+	assert(pBuffer != nullptr);
+	assert(nLength > 1);
 
-		if (*pSrc == '"') {
-			pSrc++;
-		}
+	debug_dump(pBuffer, static_cast<uint16_t>(nLength));
 
-		while ((*pSrc != '"') && (*pSrc != ',') && (*pSrc != '}') &&  (i++ < nLength)) {
-			const int c = *pSrc;
-			if ( ((c >= static_cast<int>(' ') && c <= static_cast<int>('z')))) {
-				*pDst++ = *pSrc++;
-				nNewLength++;
-			}
-		}
+	if (pBuffer[0] != '{') {
+		DEBUG_EXIT
+		return -1;
+	}
 
-		if ((*pSrc == '"') || (*pSrc == ',') || (*pSrc == '}')) {
-			*pDst++ = '\n';
-			nNewLength++;
-		}
+	Convert convert;
+	convert.pDst = pBuffer;
+	convert.nValueDepth = bSkipFileName ? 1 : 2;
+	convert.bHasFileName = false;
 
-		pSrc++;
+	if (!JsonParser::Parse(pBuffer, nLength, convert_callback, &convert)) {
+		DEBUG_EXIT
+		return -1;
 	}
 
-	if (bSkipFileName) {
-		nNewLength--;
-	}
+	const auto nNewLength = static_cast<int>(convert.pDst - pBuffer);
 
 	debug_dump(pBuffer, static_cast<uint16_t>(nNewLength));
 	DEBUG_EXIT
-	return static_cast<int>(nNewLength);
+	return nNewLength;
 }
 }  // namespace properties
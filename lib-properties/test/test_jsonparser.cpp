@@ -0,0 +1,212 @@
+/**
+ * @file test_jsonparser.cpp
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * The events of a document are checked as a trace, with the strings
+ * unescaped in place.
+ * A truncated document is parsed from a buffer that still holds the rest of
+ * the document, so reading past nLength would complete it: every prefix must
+ * be rejected and the bytes past nLength must not be written.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "jsonparser.h"
+
+#include "test.h"
+
+namespace {
+using json::parser::Type;
+
+struct Trace {
+	std::string s;
+	uint32_t nEvents;
+	uint32_t nStop;		///< The callback returns false at this event, 0 is never
+};
+
+bool callback(void *pContext, const json::parser::Event& event) {
+	auto *pTrace = reinterpret_cast<Trace *>(pContext);
+
+	pTrace->nEvents++;
+	pTrace->s += static_cast<char>('0' + event.nDepth);
+
+	if (event.pKey != nullptr) {
+		pTrace->s.append(event.pKey, event.nKeyLength);
+		pTrace->s += ':';
+	}
+
+	switch (event.type) {
+	case Type::OBJECT_START:
+		pTrace->s += '{';
+		break;
+	case Type::OBJECT_END:
+		pTrace->s += '}';
+		break;
+	case Type::ARRAY_START:
+		pTrace->s += '[';
+		break;
+	case Type::ARRAY_END:
+		pTrace->s += ']';
+		break;
+	case Type::STRING:
+		pTrace->s += '"';
+		pTrace->s.append(event.pValue, event.nValueLength);
+		pTrace->s += '"';
+		break;
+	default:
+		pTrace->s.append(event.pValue, event.nValueLength);
+		break;
+	}
+
+	pTrace->s += ' ';
+
+	return pTrace->nEvents != pTrace->nStop;
+}
+
+bool parse(const char *pJson, std::string& trace) {
+	char buffer[256];
+	const auto nLength = static_cast<uint32_t>(strlen(pJson));
+	memcpy(buffer, pJson, nLength);
+
+	Trace t {};
+	const auto isValid = JsonParser::Parse(buffer, nLength, callback, &t);
+	trace = t.s;
+
+	return isValid;
+}
+
+static constexpr char DOCUMENT[] = R"( {"node":{"label":"a\"b","universes":[1,-2.5e+3,0.25],"on":true},
+	"list":[{},[],[null,false]], "e":{"x":[{"y":"z"}]} } )";
+
+void test_document() {
+	std::string trace;
+
+	CHECK(parse(DOCUMENT, trace));
+	CHECK(trace == "0{ 1node:{ 2label:\"a\"b\" 2universes:[ 31 3-2.5e+3 30.25 2] 2on:true 1} "
+			"1list:[ 2{ 2} 2[ 2] 2[ 3null 3false 2] 1] 1e:{ 2x:[ 3{ 4y:\"z\" 3} 2] 1} 0} ");
+
+	CHECK(parse("1", trace) && (trace == "01 "));
+	CHECK(parse(" \"s\"\r\n", trace) && (trace == "0\"s\" "));
+	CHECK(parse("-0.5E-3", trace) && (trace == "0-0.5E-3 "));
+	CHECK(parse("null", trace) && (trace == "0null "));
+}
+
+void test_unescape() {
+	std::string trace;
+
+	CHECK(parse(R"(["a\"b\\c\/d\b\f\n\r\t\u0041\u00e9\u20ac"])", trace));
+	CHECK(trace == "0[ 1\"a\"b\\c/d\b\f\n\r\tA\xc3\xa9\xe2\x82\xac\" 0] ");
+
+	CHECK(parse(R"({"k\u0031":"v"})", trace));
+	CHECK(trace == "0{ 1k1:\"v\" 0} ");
+}
+
+void test_truncated() {
+	static constexpr auto LENGTH = static_cast<uint32_t>(sizeof(DOCUMENT) - 1);
+	char buffer[LENGTH];
+	uint32_t nErrors = 0;
+
+	// The last byte is trailing whitespace
+	for (uint32_t nLength = 0; nLength < (LENGTH - 1); nLength++) {
+		memcpy(buffer, DOCUMENT, LENGTH);
+
+		Trace t {};
+
+		if (JsonParser::Parse(buffer, nLength, callback, &t) || (memcmp(&buffer[nLength], &DOCUMENT[nLength], LENGTH - nLength) != 0)) {
+			if (nErrors++ == 0) {
+				printf("Length %u\n", nLength);
+			}
+		}
+	}
+
+	CHECK(nErrors == 0);
+
+	memcpy(buffer, DOCUMENT, LENGTH);
+	Trace t {};
+	CHECK(JsonParser::Parse(buffer, LENGTH - 1, callback, &t));
+
+	// A '\0' ends the input
+	char nul[] = "{\"a\":1}\0}";
+	CHECK(JsonParser::Parse(nul, sizeof(nul) - 1, callback, &t));
+	char early[] = "{\"a\":1\0}";
+	CHECK(!JsonParser::Parse(early, sizeof(early) - 1, callback, &t));
+}
+
+void test_invalid() {
+	static constexpr const char *INVALID[] = {
+		"", " ", "01", "-01", "1.", ".5", "-", "+1", "1e", "1e+", "0x10",
+		"tru", "True", "nul", "nulll", "'a'", "\"a", "\"a\nb\"", R"("\x")", R"("\u12g4")", R"("\u123")",
+		"[", "]", "[1,]", "[,1]", "[1 2]", "[1]]", "[1}", "{", "}", "{,}", "{\"a\"}", "{\"a\":}",
+		"{\"a\" 1}", "{\"a\":1,}", "{\"a\":1 \"b\":2}", "{a:1}", "{1:1}", "{\"a\":1]", "{}x", "[] []", "1 2"
+	};
+
+	uint32_t nErrors = 0;
+
+	for (const auto *pJson : INVALID) {
+		std::string trace;
+
+		if (parse(pJson, trace)) {
+			printf("Valid: %s\n", pJson);
+			nErrors++;
+		}
+	}
+
+	CHECK(nErrors == 0);
+}
+
+void test_depth() {
+	std::string json(json::parser::DEPTH_MAX - 1, '[');
+	json.append(json::parser::DEPTH_MAX - 1, ']');
+
+	std::string trace;
+	CHECK(parse(json.c_str(), trace));
+
+	json = std::string(json::parser::DEPTH_MAX, '[') + std::string(json::parser::DEPTH_MAX, ']');
+	CHECK(!parse(json.c_str(), trace));
+}
+
+void test_stop() {
+	char buffer[] = "[1,2,3]";
+	Trace t {};
+	t.nStop = 2;
+
+	CHECK(!JsonParser::Parse(buffer, sizeof(buffer) - 1, callback, &t));
+	CHECK(t.nEvents == 2);
+}
+}  // namespace
+
+int main() {
+	test_document();
+	test_unescape();
+	test_truncated();
+	test_invalid();
+	test_depth();
+	test_stop();
+
+	return test::result();
+}
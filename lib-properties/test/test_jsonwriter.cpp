@@ -0,0 +1,266 @@
+/**
+ * @file test_jsonwriter.cpp
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * The document is written once into a buffer that is large enough and once
+ * chunked, for every buffer size from the smallest one that holds a chunk
+ * header and trailer up to a TCP segment.
+ * The flush callback is a model of StreamWrite in httpdhandlerequest.cpp:
+ * a chunk that does not fit in the TCP send space aborts the connection.
+ * Every chunk must be well framed, a full buffer is a chunk of exactly the
+ * buffer size, and the data of the chunks must be the unchunked document.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "jsonwriter.h"
+
+#include "test.h"
+
+namespace {
+static constexpr uint32_t DOCUMENT_SIZE = 16384;
+static constexpr uint32_t SEGMENT_SIZE = 1460;
+
+char s_Document[DOCUMENT_SIZE];
+char s_Buffer[SEGMENT_SIZE];
+
+struct Sink {
+	std::string data;
+	uint32_t nSendSpace;
+	uint32_t nChunks;
+	uint32_t nChunkSizeMax;
+	bool isLastChunk;
+	bool isFramingError;
+	bool isAborted;
+};
+
+int32_t hex_value(const char c) {
+	if ((c >= '0') && (c <= '9')) {
+		return c - '0';
+	}
+
+	if ((c >= 'a') && (c <= 'f')) {
+		return c - 'a' + 10;
+	}
+
+	return -1;
+}
+
+void flush(void *pContext, const char *pData, const uint32_t nLength) {
+	auto *pSink = reinterpret_cast<Sink *>(pContext);
+
+	if (pSink->isAborted) {
+		return;
+	}
+
+	if (pSink->nSendSpace < nLength) {
+		pSink->isAborted = true;
+		return;
+	}
+
+	if (pSink->isLastChunk) {
+		pSink->isFramingError = true;	// Nothing after the last chunk
+		return;
+	}
+
+	if ((nLength == 5) && (memcmp(pData, "0\r\n\r\n", 5) == 0)) {
+		pSink->isLastChunk = true;
+		return;
+	}
+
+	const auto nSize = json::writer::CHUNK_HEADER_SIZE + json::writer::CHUNK_TRAILER_SIZE;
+
+	if (nLength <= nSize) {
+		pSink->isFramingError = true;	// Only the last chunk is empty
+		return;
+	}
+
+	uint32_t nDataLength = 0;
+
+	for (uint32_t i = 0; i < 4; i++) {
+		const auto nDigit = hex_value(pData[i]);
+
+		if (nDigit < 0) {
+			pSink->isFramingError = true;
+			return;
+		}
+
+		nDataLength = (nDataLength << 4) | static_cast<uint32_t>(nDigit);
+	}
+
+	if ((nDataLength != (nLength - nSize)) || (memcmp(&pData[4], "\r\n", 2) != 0) || (memcmp(&pData[nLength - 2], "\r\n", 2) != 0)) {
+		pSink->isFramingError = true;
+		return;
+	}
+
+	pSink->data.append(&pData[json::writer::CHUNK_HEADER_SIZE], nDataLength);
+	pSink->nChunks++;
+
+	if (nLength > pSink->nChunkSizeMax) {
+		pSink->nChunkSizeMax = nLength;
+	}
+}
+
+void write_document(JsonWriter& writer) {
+	writer.ObjectStart();
+	writer.Add("name", "node \"1\"\\\n");
+	writer.ArrayStart("universes");
+
+	for (uint32_t i = 0; i < 128; i++) {
+		writer.ObjectStart();
+		writer.Add("universe", i + 1);
+		writer.Add("offset", static_cast<int32_t>(i) - 64);
+		writer.Add("enabled", (i & 1) == 0);
+		writer.Add("label", "\tport\r\x01");
+		writer.ObjectEnd();
+	}
+
+	writer.ArrayEnd();
+	writer.ObjectEnd();
+}
+
+void test_nested() {
+	char buffer[128];
+	JsonWriter writer(buffer, sizeof(buffer));
+
+	writer.ObjectStart();
+	writer.ArrayStart("a");
+	writer.Add(nullptr, static_cast<uint32_t>(1));
+	writer.Add(nullptr, static_cast<int32_t>(-2));
+	writer.Add(nullptr, true);
+	writer.Add(nullptr, false);
+	writer.ObjectStart();
+	writer.Add("b", "x");
+	writer.ObjectEnd();
+	writer.ArrayStart();
+	writer.ArrayEnd();
+	writer.ArrayEnd();
+	writer.ObjectStart("c");
+	writer.ObjectEnd();
+	writer.AddRaw("d", "null", 4);
+	writer.Add("e", static_cast<uint32_t>(4294967295U));
+	writer.Add("f", static_cast<int32_t>(INT32_MIN));
+	writer.ObjectEnd();
+
+	static constexpr char EXPECTED[] = R"({"a":[1,-2,true,false,{"b":"x"},[]],"c":{},"d":null,"e":4294967295,"f":-2147483648})";
+
+	const auto nTotal = writer.Finish();
+
+	CHECK(!writer.IsOverflow());
+	CHECK(nTotal == sizeof(EXPECTED) - 1);
+	CHECK(memcmp(buffer, EXPECTED, sizeof(EXPECTED) - 1) == 0);
+}
+
+void test_escape() {
+	char buffer[128];
+	JsonWriter writer(buffer, sizeof(buffer));
+
+	static constexpr char STRING[] = "q\"b\\n\nr\rt\t\x01\x1f/\xc3\xa9";
+	static constexpr char EXPECTED[] = R"({"k\"\\":"q\"b\\n\nr\rt\t\u0001\u001f/)" "\xc3\xa9" R"(","z":"a\u0000b"})";
+
+	writer.ObjectStart();
+	writer.Add("k\"\\", STRING);
+	writer.Add("z", "a\0b", 3);
+	writer.ObjectEnd();
+
+	const auto nTotal = writer.Finish();
+
+	CHECK(!writer.IsOverflow());
+	CHECK(nTotal == sizeof(EXPECTED) - 1);
+	CHECK(memcmp(buffer, EXPECTED, sizeof(EXPECTED) - 1) == 0);
+}
+
+void test_overflow() {
+	JsonWriter writer(s_Buffer, 64);
+	write_document(writer);
+	writer.Finish();
+
+	CHECK(writer.IsOverflow());
+}
+
+void test_chunked() {
+	JsonWriter document(s_Document, sizeof(s_Document));
+	write_document(document);
+	const auto nDocument = document.Finish();
+
+	CHECK(!document.IsOverflow());
+	CHECK(!document.IsChunked());
+
+	uint32_t nErrors = 0;
+
+	for (uint32_t nSize = json::writer::CHUNK_HEADER_SIZE + json::writer::CHUNK_TRAILER_SIZE + 1; nSize <= SEGMENT_SIZE; nSize++) {
+		Sink sink {};
+		sink.nSendSpace = nSize;
+
+		JsonWriter writer(s_Buffer, nSize, flush, &sink);
+		write_document(writer);
+		const auto nTotal = writer.Finish();
+
+		const auto nData = nSize - json::writer::CHUNK_HEADER_SIZE - json::writer::CHUNK_TRAILER_SIZE;
+		const auto nChunks = (nDocument + nData - 1) / nData;
+
+		if (!writer.IsChunked() || writer.IsOverflow() || sink.isAborted || sink.isFramingError || !sink.isLastChunk
+				|| (nTotal != nDocument) || (sink.nChunks != nChunks) || (sink.nChunkSizeMax != ((nChunks > 1) ? nSize : nDocument + nSize - nData))
+				|| (sink.data.size() != nDocument) || (memcmp(sink.data.data(), s_Document, nDocument) != 0)) {
+			if (nErrors++ == 0) {
+				printf("Buffer size %u\n", nSize);
+			}
+		}
+	}
+
+	CHECK(nErrors == 0);
+}
+
+/*
+ * A send space of one byte less than the buffer size does not hold a full chunk.
+ */
+void test_send_space() {
+	for (const uint32_t nSize : { 64U, 512U, SEGMENT_SIZE }) {
+		Sink sink {};
+		sink.nSendSpace = nSize - 1;
+
+		JsonWriter writer(s_Buffer, nSize, flush, &sink);
+		write_document(writer);
+		writer.Finish();
+
+		CHECK(sink.isAborted);
+		CHECK(sink.nChunks == 0);
+		CHECK(!sink.isFramingError);
+	}
+}
+}  // namespace
+
+int main() {
+	test_nested();
+	test_escape();
+	test_overflow();
+	test_chunked();
+	test_send_space();
+
+	return test::result();
+}
@@ -2,7 +2,7 @@
  * @file rdmddiscovery.h
  *
  */
-/* Copyright (C) 2023 by Arjan van Vught mailto:info@gd32-dmx.org
+/* Copyright (C) 2023-2025 by Arjan van Vught mailto:info@gd32-dmx.org
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -29,8 +29,10 @@
 #include <rdmtod.h>
 #include <cstdint>
 #include <algorithm>
+#include <cassert>
 
 #include "rdmmessage.h"
+#include "dmx.h"
 #include "debug.h"
 
 namespace rdmdiscovery {
@@ -43,10 +45,16 @@ namespace rdmdiscovery {
 #endif
 static constexpr uint32_t UNMUTE_COUNTER = 3;
 static constexpr uint32_t MUTE_COUNTER = 10;
-static constexpr uint32_t DISCOVERY_STACK_SIZE = rdmtod::TOD_TABLE_SIZE;
+/*
+ * The binary search is depth first, with at most one pending branch for each of the 48 UID bits.
+ */
+static constexpr uint32_t DISCOVERY_STACK_SIZE = 64;
 static constexpr uint32_t DISCOVERY_COUNTER = 3;
 static constexpr uint32_t QUIKFIND_COUNTER = 5;
 static constexpr uint32_t QUIKFIND_DISCOVERY_COUNTER = 5;
+static constexpr uint32_t MAX_PORTS = dmx::config::max::PORTS;
+
+static_assert(MAX_PORTS <= 32, "The running mask is 32-bit");
 
 enum class State {
 	IDLE,
@@ -60,8 +68,28 @@ enum class State {
 	LATE_RESPONSE,
 	FINISHED
 };
+
+struct Statistics {
+	uint32_t nFull;
+	uint32_t nIncremental;
+	uint32_t nMillisLast;			///< Duration of the last run
+	uint32_t nMillisMax;
+	uint32_t nDiscUniqueBranch;		///< DISC_UNIQUE_BRANCH requests sent
+	uint32_t nCollisions;			///< DISC_UNIQUE_BRANCH responses with a checksum error
+	uint32_t nMutes;				///< DISC_MUTE requests sent
+	uint32_t nVerified;				///< Known UIDs confirmed with a unicast DISC_MUTE
+	uint32_t nFound;
+	uint32_t nLost;
+};
 }  // namespace rdmdiscovery
 
+/**
+ * Each DMX port has its own discovery state machine and RDM message.
+ * The state machines only wait for their own port (send, then poll for the response),
+ * so Run() advances all running ports in turn, while one port is waiting for a
+ * response window the others are sending.
+ */
+
 class RDMDiscovery {
 public:
 	RDMDiscovery(const uint8_t *pUid);
@@ -69,152 +97,193 @@ public:
 	bool Full(const uint32_t nPortIndex, RDMTod *pRDMTod);
 	bool Incremental(const uint32_t nPortIndex, RDMTod *pRDMTod);
 
-	bool Stop();
+	bool Stop(const uint32_t nPortIndex);
 
-	bool IsRunning(uint32_t& nPortIndex, bool& bIsIncremental) const {
-		nPortIndex = m_nPortIndex;
-		bIsIncremental = m_doIncremental;
-		return (m_State != rdmdiscovery::State::IDLE);
+	bool IsRunning(const uint32_t nPortIndex, bool& bIsIncremental) const {
+		if (nPortIndex >= rdmdiscovery::MAX_PORTS) {
+			return false;
+		}
+
+		bIsIncremental = m_Port[nPortIndex].doIncremental;
+		return (m_Port[nPortIndex].state != rdmdiscovery::State::IDLE);
+	}
+
+	bool IsRunning() const {
+		return m_nRunning != 0;
 	}
 
+	/**
+	 * @brief Reports one finished port per call.
+	 */
 	bool IsFinished(uint32_t& nPortIndex, bool& bIsIncremental) {
-		nPortIndex = m_nPortIndex;
-		bIsIncremental = m_doIncremental;
+		for (nPortIndex = 0; nPortIndex < rdmdiscovery::MAX_PORTS; nPortIndex++) {
+			auto& port = m_Port[nPortIndex];
 
-		if (m_bIsFinished) {
-			m_bIsFinished = false;
-			return true;
+			if (port.bIsFinished) {
+				port.bIsFinished = false;
+				bIsIncremental = port.doIncremental;
+				return true;
+			}
 		}
 
 		return false;
 	}
 
+	const rdmdiscovery::Statistics& GetStatistics(const uint32_t nPortIndex) const {
+		assert(nPortIndex < rdmdiscovery::MAX_PORTS);
+		return m_Port[nPortIndex].statistics;
+	}
+
 	uint32_t CopyWorkingQueue(char *pOutBuffer, const uint32_t nOutBufferSize);
 
 	void Run() {
-		if (__builtin_expect((m_State == rdmdiscovery::State::IDLE), 1)) {
+		if (__builtin_expect((m_nRunning == 0), 1)) {
 			return;
 		}
 
-		Process();
+		auto nRunning = m_nRunning;
+
+		while (nRunning != 0) {
+			const auto nPortIndex = static_cast<uint32_t>(__builtin_ctz(nRunning));
+			nRunning &= ~(1U << nPortIndex);
+
+			if (m_Port[nPortIndex].state != rdmdiscovery::State::IDLE) {
+				Process(nPortIndex);
+			}
+
+			if (m_Port[nPortIndex].state == rdmdiscovery::State::IDLE) {
+				m_nRunning &= ~(1U << nPortIndex);
+			}
+		}
 	}
 
+	void Print(const uint32_t nPortIndex);
+
 private:
-	void Process();
+	struct Port;
+
+	void Process(const uint32_t nPortIndex);
 	bool Start(const uint32_t nPortIndex, RDMTod *pRDMTod, const bool doIncremental);
-	bool IsValidDiscoveryResponse(uint8_t *pUid);
+	bool IsValidDiscoveryResponse(Port& port, uint8_t *pUid);
 
-	void SavedState([[maybe_unused]] const uint32_t nLine);
-	void NewState(const rdmdiscovery::State state, const bool doStateLateResponse, [[maybe_unused]] const uint32_t nLine);
+	void SavedState(Port& port, [[maybe_unused]] const uint32_t nLine);
+	void NewState(Port& port, const rdmdiscovery::State state, const bool doStateLateResponse, [[maybe_unused]] const uint32_t nLine);
 
 private:
-	RDMMessage m_Message;
-	uint8_t *m_pResponse { nullptr };
-	uint8_t m_Uid[RDM_UID_SIZE];
-	uint32_t m_nPortIndex { 0 };
-	RDMTod *m_pRDMTod { nullptr };
-
-	bool m_bIsFinished { false };
-	bool m_doIncremental { false };
-	rdmdiscovery::State m_State { rdmdiscovery::State::IDLE };
-	rdmdiscovery::State m_SavedState { rdmdiscovery::State::IDLE };
-
-	struct {
-		uint32_t nMicros;
-	} m_LateResponse;
-
-	struct {
-		uint32_t nCounter;
-		uint32_t nMicros;
-		bool bCommandRunning;
-	} m_UnMute;
-
-	struct {
-		uint32_t nTodEntries;
-		uint32_t nCounter;
-		uint32_t nMicros;
-		uint8_t uid[RDM_UID_SIZE];
-		bool bCommandRunning;
-	} m_Mute;
-
-	struct {
+	struct Port {
+		RDMMessage message;
+		uint8_t *pResponse;
+		RDMTod *pRDMTod;
+		uint32_t nMillisStart;
+
+		bool bIsFinished;
+		bool doIncremental;
+		rdmdiscovery::State state;
+		rdmdiscovery::State savedState;
+
+		struct {
+			uint32_t nMicros;
+		} lateResponse;
+
 		struct {
-			bool push(const uint64_t nLowerBound, const uint64_t nUpperBound) {
-				if (nTop == rdmdiscovery::DISCOVERY_STACK_SIZE - 1) {
-					assert(0);
-					return false;
+			uint32_t nCounter;
+			uint32_t nMicros;
+			bool bCommandRunning;
+		} unMute;
+
+		struct {
+			uint32_t nTodEntries;
+			uint32_t nCounter;
+			uint32_t nMicros;
+			uint8_t uid[RDM_UID_SIZE];
+			bool bCommandRunning;
+		} mute;
+
+		struct {
+			struct {
+				bool push(const uint64_t nLowerBound, const uint64_t nUpperBound) {
+					if (nTop == rdmdiscovery::DISCOVERY_STACK_SIZE - 1) {
+						assert(0);
+						return false;
+					}
+
+					nTop++;
+					items[nTop].nLowerBound = nLowerBound;
+					items[nTop].nUpperBound = nUpperBound;
+
+					nDebugStackTopMax = std::max(nDebugStackTopMax, nTop);
+					return true;
 				}
 
-				nTop++;
-				items[nTop].nLowerBound = nLowerBound;
-				items[nTop].nUpperBound = nUpperBound;
+				bool pop(uint64_t &nLowerBound, uint64_t &nUpperBound) {
+					if (nTop == -1) {
+						return false;
+					}
 
-				nDebugStackTopMax = std::max(nDebugStackTopMax, nTop);
-				return true;
-			}
+					nLowerBound = items[nTop].nLowerBound;
+					nUpperBound = items[nTop].nUpperBound;
+					nTop--;
 
-			bool pop(uint64_t &nLowerBound, uint64_t &nUpperBound) {
-				if (nTop == -1) {
-					return false;
+					return true;
 				}
 
-				nLowerBound = items[nTop].nLowerBound;
-				nUpperBound = items[nTop].nUpperBound;
-				nTop--;
+				int32_t nTop;
 
-				return true;
-			}
+				struct {
+					uint64_t nLowerBound;
+					uint64_t nUpperBound;
+				} items[rdmdiscovery::DISCOVERY_STACK_SIZE];
 
-			int32_t nTop;
+				int32_t nDebugStackTopMax;
+			} stack;
 
-			struct {
-				uint64_t nLowerBound;
-				uint64_t nUpperBound;
-			} items[rdmdiscovery::DISCOVERY_STACK_SIZE];
-
-			int32_t nDebugStackTopMax;
-		} stack;
-
-		uint64_t nLowerBound;
-		uint64_t nMidPosition;
-		uint64_t nUpperBound;
-		uint32_t nCounter;
-		uint32_t nMicros;
-		uint8_t uid[RDM_UID_SIZE];
-		uint8_t pdl[2][RDM_UID_SIZE];
-		bool bCommandRunning;
-	} m_Discovery;
-
-	struct {
-		uint32_t nCounter;
-		uint32_t nMicros;
-		bool bCommandRunning;
-	} m_DiscoverySingleDevice;
-
-	struct {
-		uint32_t nCounter;
-		uint32_t nMicros;
-		bool bCommandRunning;
-		uint8_t uid[RDM_UID_SIZE];
-	} m_QuikFind;
-
-	struct {
-		uint32_t nCounter;
-		uint32_t nMicros;
-		bool bCommandRunning;
-		uint8_t uid[RDM_UID_SIZE];
-	} m_QuikFindDiscovery;
+			uint64_t nLowerBound;
+			uint64_t nMidPosition;
+			uint64_t nUpperBound;
+			uint32_t nCounter;
+			uint32_t nMicros;
+			uint8_t uid[RDM_UID_SIZE];
+			uint8_t pdl[2][RDM_UID_SIZE];
+			bool bCommandRunning;
+		} discovery;
+
+		struct {
+			uint32_t nCounter;
+			uint32_t nMicros;
+			bool bCommandRunning;
+		} discoverySingleDevice;
+
+		struct {
+			uint32_t nCounter;
+			uint32_t nMicros;
+			bool bCommandRunning;
+			uint8_t uid[RDM_UID_SIZE];
+		} quikFind;
+
+		struct {
+			uint32_t nCounter;
+			uint32_t nMicros;
+			bool bCommandRunning;
+			uint8_t uid[RDM_UID_SIZE];
+		} quikFindDiscovery;
+
+		rdmdiscovery::Statistics statistics;
 
 #ifndef NDEBUG
-	struct {
 		struct {
-			uint64_t nLowerBound;
-			uint64_t nUpperBound;
-		} tree[1024];
+			struct {
+				uint64_t nLowerBound;
+				uint64_t nUpperBound;
+			} tree[1024];
 
-		uint32_t nTreeIndex;
-	} debug;
+			uint32_t nTreeIndex;
+		} debug;
 #endif
+	};
+
+	uint8_t m_Uid[RDM_UID_SIZE];
+	uint32_t m_nRunning { 0 };	///< Bit per port
+	Port m_Port[rdmdiscovery::MAX_PORTS];
 };
 
 #endif /* RDMDDISCOVERY_H_ */
@@ -2,7 +2,7 @@
  * @file rdmtod.h
  *
  */
-/* Copyright (C) 2017-2023 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2017-2025 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -38,41 +38,54 @@
 #include "debug.h"
 
 namespace rdmtod {
+/*
+ * The number of UIDs per port, a target can define a smaller table.
+ */
 #if !defined (RDM_DISCOVERY_TOD_TABLE_SIZE)
-# define RDM_DISCOVERY_TOD_TABLE_SIZE 200U
+# define RDM_DISCOVERY_TOD_TABLE_SIZE 1024U
 #endif
 static constexpr uint32_t TOD_TABLE_SIZE = RDM_DISCOVERY_TOD_TABLE_SIZE;
-static constexpr uint32_t MUTES_TABLE_SIZE = (TOD_TABLE_SIZE + 32) / 32;
 static constexpr uint32_t INVALID_ENTRY = static_cast<uint32_t>(~0);
-struct Tod {
-	uint8_t uid[RDM_UID_SIZE];
-};
+/*
+ * The 48-bit UID is stored as big-endian number, so the numeric order is the UID order.
+ * The top bit of an entry is the mute flag.
+ */
+static constexpr uint64_t UID_MASK = 0x0000FFFFFFFFFFFF;
+static constexpr uint64_t MUTED = (static_cast<uint64_t>(1) << 63);
+
+inline uint64_t uid_to_key(const uint8_t *pUid) {
+	uint64_t nKey = 0;
+
+	for (uint32_t i = 0; i < RDM_UID_SIZE; i++) {
+		nKey = (nKey << 8) | pUid[i];
+	}
+
+	return nKey;
+}
+
+inline void key_to_uid(const uint64_t nKey, uint8_t *pUid) {
+	for (uint32_t i = 0; i < RDM_UID_SIZE; i++) {
+		pUid[i] = static_cast<uint8_t>(nKey >> (40 - (i * 8)));
+	}
+}
 }  // namespace rdmtod
 
+/**
+ * The UIDs are kept sorted, lookups are a binary search.
+ * Iteration by index is in UID order, which is used for the TOD paging.
+ */
+
 class RDMTod {
 public:
 	RDMTod() {
-		for (uint32_t i = 0; i < rdmtod::TOD_TABLE_SIZE; i++) {
-			memcpy(&m_Tod[i], UID_ALL, RDM_UID_SIZE);
-		}
-
-		for (uint32_t i = 0; i < rdmtod::MUTES_TABLE_SIZE; i++) {
-			m_nMutes[i] = 0;
-		}
+		memcpy(m_Uid, UID_ALL, RDM_UID_SIZE);
 	}
 
 	~RDMTod() = default;
 
 	void Reset() {
-		for (uint32_t i = 0; i < m_nEntries; i++) {
-			memcpy(&m_Tod[i], UID_ALL, RDM_UID_SIZE);
-		}
-
 		m_nEntries = 0;
-
-		for (uint32_t i = 0; i < rdmtod::MUTES_TABLE_SIZE; i++) {
-			m_nMutes[i] = 0;
-		}
+		m_nSavedIndex = rdmtod::INVALID_ENTRY;
 	}
 
 	bool AddUid(const uint8_t *pUid) {
@@ -80,11 +93,18 @@ public:
 			return false;
 		}
 
-		if (Exist(pUid)) {
+		const auto nKey = rdmtod::uid_to_key(pUid);
+		const auto nIndex = LowerBound(nKey);
+
+		if ((nIndex < m_nEntries) && ((m_Tod[nIndex] & rdmtod::UID_MASK) == nKey)) {
 			return false;
 		}
 
-		memcpy(&m_Tod[m_nEntries++], pUid, RDM_UID_SIZE);
+		memmove(&m_Tod[nIndex + 1], &m_Tod[nIndex], (m_nEntries - nIndex) * sizeof(m_Tod[0]));
+
+		m_Tod[nIndex] = nKey;
+		m_nEntries++;
+		m_nSavedIndex = rdmtod::INVALID_ENTRY;
 
 		return true;
 	}
@@ -94,64 +114,71 @@ public:
 	}
 
 	bool CopyUidEntry(uint32_t nIndex, uint8_t uid[RDM_UID_SIZE]) {
-		if (nIndex > m_nEntries) {
+		if (nIndex >= m_nEntries) {
 			memcpy(uid, UID_ALL, RDM_UID_SIZE);
 			return false;
 		}
 
-		memcpy(uid, &m_Tod[nIndex], RDM_UID_SIZE);
+		rdmtod::key_to_uid(m_Tod[nIndex], uid);
 		return true;
 	}
 
-	void Copy(uint8_t *pTable) {
-		DEBUG_ENTRY
-		DEBUG_PRINTF("m_nEntries=%u", static_cast<unsigned int>(m_nEntries));
+	/**
+	 * @brief Copy nCount UIDs, in UID order, starting at nIndex.
+	 * @return The number of UIDs copied.
+	 */
+	uint32_t Copy(uint8_t *pTable, const uint32_t nIndex, uint32_t nCount) {
 		assert(pTable != nullptr);
 
-		const auto *pSrc = reinterpret_cast<const uint8_t*>(m_Tod);
+		if (nIndex >= m_nEntries) {
+			return 0;
+		}
+
+		if (nCount > (m_nEntries - nIndex)) {
+			nCount = m_nEntries - nIndex;
+		}
+
 		auto *pDst = pTable;
 
-		for (uint32_t i = 0; i < (m_nEntries * RDM_UID_SIZE); i++) {
-			*pDst++ = *pSrc++;
+		for (uint32_t i = nIndex; i < (nIndex + nCount); i++) {
+			rdmtod::key_to_uid(m_Tod[i], pDst);
+			pDst += RDM_UID_SIZE;
 		}
 
+		return nCount;
+	}
+
+	void Copy(uint8_t *pTable) {
+		DEBUG_ENTRY
+		DEBUG_PRINTF("m_nEntries=%u", static_cast<unsigned int>(m_nEntries));
+
+		Copy(pTable, 0, m_nEntries);
+
 		DEBUG_EXIT
 	}
 
 	bool Delete(const uint8_t *pUid) {
-		bool found = false;
-		uint32_t i;
-
-		for (i = 0; i < m_nEntries; i++) {
-			if (memcmp(&m_Tod[i], pUid, RDM_UID_SIZE) == 0) {
-				found = true;
-				break;
-			}
-		}
+		const auto nKey = rdmtod::uid_to_key(pUid);
+		const auto nIndex = LowerBound(nKey);
 
-		if (!found) {
+		if ((nIndex == m_nEntries) || ((m_Tod[nIndex] & rdmtod::UID_MASK) != nKey)) {
 			return false;
 		}
 
-		if (i == rdmtod::TOD_TABLE_SIZE - 1) {
-			memcpy(&m_Tod[i], UID_ALL, RDM_UID_SIZE);
-		} else {
-			for (; i < m_nEntries; i++) {
-				memcpy(&m_Tod[i], &m_Tod[i + 1], RDM_UID_SIZE);
-			}
-		}
-
 		m_nEntries--;
+		memmove(&m_Tod[nIndex], &m_Tod[nIndex + 1], (m_nEntries - nIndex) * sizeof(m_Tod[0]));
+		m_nSavedIndex = rdmtod::INVALID_ENTRY;
 
 		return true;
 	}
 
 	bool Exist(const uint8_t *pUid) {
-		for (uint32_t nIndex = 0 ; nIndex < m_nEntries; nIndex++) {
-			if (memcmp(&m_Tod[nIndex], pUid, RDM_UID_SIZE) == 0) {
-				m_nSavedIndex = nIndex;
-				return true;
-			}
+		const auto nKey = rdmtod::uid_to_key(pUid);
+		const auto nIndex = LowerBound(nKey);
+
+		if ((nIndex < m_nEntries) && ((m_Tod[nIndex] & rdmtod::UID_MASK) == nKey)) {
+			m_nSavedIndex = nIndex;
+			return true;
 		}
 
 		m_nSavedIndex = rdmtod::INVALID_ENTRY;
@@ -159,13 +186,19 @@ public:
 	}
 
 	const uint8_t *Next() {
+		if (m_nEntries == 0) {
+			m_nSavedIndex = rdmtod::INVALID_ENTRY;
+			return UID_ALL;
+		}
+
 		m_nSavedIndex++;
 
-		if (m_nSavedIndex == m_nEntries) {
+		if (m_nSavedIndex >= m_nEntries) {
 			m_nSavedIndex = 0;
 		}
 
-		return m_Tod[m_nSavedIndex].uid;
+		rdmtod::key_to_uid(m_Tod[m_nSavedIndex], m_Uid);
+		return m_Uid;
 	}
 
 	void Mute() {
@@ -173,10 +206,7 @@ public:
 			return;
 		}
 
-		const auto i = m_nSavedIndex / 32;
-		const auto shift = m_nSavedIndex - (i * 32);
-
-		m_nMutes[i] |= (1U << shift);
+		m_Tod[m_nSavedIndex] |= rdmtod::MUTED;
 	}
 
 	void UnMute() {
@@ -184,15 +214,12 @@ public:
 			return;
 		}
 
-		const auto i = m_nSavedIndex / 32;
-		const auto shift = m_nSavedIndex - (i * 32);
-
-		m_nMutes[i] &= ~(1U << shift);
+		m_Tod[m_nSavedIndex] &= ~rdmtod::MUTED;
 	}
 
 	void UnMuteAll() {
-		for (uint32_t i = 0; i < rdmtod::MUTES_TABLE_SIZE; i++) {
-			m_nMutes[i] = 0;
+		for (uint32_t i = 0; i < m_nEntries; i++) {
+			m_Tod[i] &= ~rdmtod::MUTED;
 		}
 	}
 
@@ -201,37 +228,53 @@ public:
 			return true;
 		}
 
-		const auto i = m_nSavedIndex / 32;
-		const auto mutes = m_nMutes[i];
-		const auto shift = m_nSavedIndex - (i * 32);
-
-		return (mutes & (1U << shift)) == (1U << shift);
+		return (m_Tod[m_nSavedIndex] & rdmtod::MUTED) == rdmtod::MUTED;
 	}
 
 	void Dump([[maybe_unused]] uint32_t nCount) {
 #ifndef NDEBUG
-	if (nCount > rdmtod::TOD_TABLE_SIZE) {
-		nCount = rdmtod::TOD_TABLE_SIZE;
+	if (nCount > m_nEntries) {
+		nCount = m_nEntries;
 	}
 
 	printf("[%u]\n", static_cast<unsigned int>(nCount));
 	for (uint32_t i = 0 ; i < nCount; i++) {
-		printf("%.2x%.2x:%.2x%.2x%.2x%.2x\n", m_Tod[i].uid[0], m_Tod[i].uid[1], m_Tod[i].uid[2], m_Tod[i].uid[3], m_Tod[i].uid[4], m_Tod[i].uid[5]);
+		uint8_t uid[RDM_UID_SIZE];
+		rdmtod::key_to_uid(m_Tod[i], uid);
+		printf("%.2x%.2x:%.2x%.2x%.2x%.2x\n", uid[0], uid[1], uid[2], uid[3], uid[4], uid[5]);
 	}
 #endif
 	}
-	
+
 	void Dump() {
 #ifndef NDEBUG
 		Dump(m_nEntries);
 #endif
 	}
 
+private:
+	uint32_t LowerBound(const uint64_t nKey) const {
+		uint32_t nLow = 0;
+		uint32_t nHigh = m_nEntries;
+
+		while (nLow < nHigh) {
+			const auto nMiddle = (nLow + nHigh) / 2;
+
+			if ((m_Tod[nMiddle] & rdmtod::UID_MASK) < nKey) {
+				nLow = nMiddle + 1;
+			} else {
+				nHigh = nMiddle;
+			}
+		}
+
+		return nLow;
+	}
+
 private:
 	uint32_t m_nEntries { 0 };
 	uint32_t m_nSavedIndex { rdmtod::INVALID_ENTRY };
-	uint32_t m_nMutes[rdmtod::MUTES_TABLE_SIZE];
-	rdmtod::Tod m_Tod[rdmtod::TOD_TABLE_SIZE];
+	uint64_t m_Tod[rdmtod::TOD_TABLE_SIZE];
+	uint8_t m_Uid[RDM_UID_SIZE];
 };
 
 #endif /* RDMTOD_H_ */
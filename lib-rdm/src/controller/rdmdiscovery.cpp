@@ -2,7 +2,7 @@
  * @file rdmddiscovery.cpp
  *
  */
-/* Copyright (C) 2023 by Arjan van Vught mailto:info@gd32-dmx.org
+/* Copyright (C) 2023-2025 by Arjan van Vught mailto:info@gd32-dmx.org
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -73,12 +73,28 @@ static void print_uid([[maybe_unused]] uint64_t nUid) {
 
 }  // namespace rdmdiscovery
 
-#define NEW_STATE(state, late)	NewState (state, late, __LINE__);
-#define SAVED_STATE()			SavedState (__LINE__);
+#define NEW_STATE(state, late)	NewState (port, state, late, __LINE__);
+#define SAVED_STATE()			SavedState (port, __LINE__);
 
 RDMDiscovery::RDMDiscovery(const uint8_t *pUid) {
 	memcpy(m_Uid, pUid, RDM_UID_SIZE);
-	m_Message.SetSrcUid(pUid);
+
+	for (uint32_t nPortIndex = 0; nPortIndex < rdmdiscovery::MAX_PORTS; nPortIndex++) {
+		auto& port = m_Port[nPortIndex];
+
+		port.message.SetSrcUid(pUid);
+		port.message.SetPortID(static_cast<uint8_t>(1 + nPortIndex));
+		port.pResponse = nullptr;
+		port.pRDMTod = nullptr;
+		port.bIsFinished = false;
+		port.doIncremental = false;
+		port.state = rdmdiscovery::State::IDLE;
+		port.savedState = rdmdiscovery::State::IDLE;
+		port.discovery.stack.nTop = -1;
+		port.discovery.stack.nDebugStackTopMax = -1;
+
+		memset(&port.statistics, 0, sizeof(struct rdmdiscovery::Statistics));
+	}
 
 #ifndef NDEBUG
 	printf("Uid : ");
@@ -87,29 +103,45 @@ RDMDiscovery::RDMDiscovery(const uint8_t *pUid) {
 #endif
 }
 
+/**
+ * The working queues of all running ports.
+ */
 uint32_t RDMDiscovery::CopyWorkingQueue(char *pOutBuffer, const uint32_t nOutBufferSize) {
 	const auto nSize = static_cast<int32_t>(nOutBufferSize);
-	int32_t nIndex = 0;
 	int32_t nLength = 0;
 	uint8_t pLowerBound[RDM_UID_SIZE];
 	uint8_t pUpperBound[RDM_UID_SIZE];
 
-	while (nIndex <= m_Discovery.stack.nTop) {
-		memcpy(pLowerBound, rdmdiscovery::convert_uid(m_Discovery.stack.items[nIndex].nLowerBound), RDM_UID_SIZE);
-		memcpy(pUpperBound, rdmdiscovery::convert_uid(m_Discovery.stack.items[nIndex].nUpperBound), RDM_UID_SIZE);
+	for (uint32_t nPortIndex = 0; nPortIndex < rdmdiscovery::MAX_PORTS; nPortIndex++) {
+		const auto& stack = m_Port[nPortIndex].discovery.stack;
+
+		if (m_Port[nPortIndex].state == rdmdiscovery::State::IDLE) {
+			continue;
+		}
+
+		int32_t nIndex = 0;
+
+		while ((nIndex <= stack.nTop) && (nLength < nSize)) {
+			memcpy(pLowerBound, rdmdiscovery::convert_uid(stack.items[nIndex].nLowerBound), RDM_UID_SIZE);
+			memcpy(pUpperBound, rdmdiscovery::convert_uid(stack.items[nIndex].nUpperBound), RDM_UID_SIZE);
 
-		nLength += snprintf(&pOutBuffer[nLength], static_cast<size_t>(nSize - nLength),
-				"\"%.2x%.2x:%.2x%.2x%.2x%.2x-%.2x%.2x:%.2x%.2x%.2x%.2x\",",
-				pLowerBound[0], pLowerBound[1], pLowerBound[2], pLowerBound[3], pLowerBound[4], pLowerBound[5],
-				pUpperBound[0], pUpperBound[1], pUpperBound[2], pUpperBound[3], pUpperBound[4], pUpperBound[5]);
+			nLength += snprintf(&pOutBuffer[nLength], static_cast<size_t>(nSize - nLength),
+					"\"%.2x%.2x:%.2x%.2x%.2x%.2x-%.2x%.2x:%.2x%.2x%.2x%.2x\",",
+					pLowerBound[0], pLowerBound[1], pLowerBound[2], pLowerBound[3], pLowerBound[4], pLowerBound[5],
+					pUpperBound[0], pUpperBound[1], pUpperBound[2], pUpperBound[3], pUpperBound[4], pUpperBound[5]);
 
-		nIndex++;
+			nIndex++;
+		}
 	}
 
 	if (nLength == 0) {
 		return 0;
 	}
 
+	if (nLength > nSize) {
+		nLength = nSize;
+	}
+
 	pOutBuffer[nLength - 1] = '\0';
 
 	return static_cast<uint32_t>(nLength - 1);
@@ -117,15 +149,32 @@ uint32_t RDMDiscovery::CopyWorkingQueue(char *pOutBuffer, const uint32_t nOutBuf
 
 bool RDMDiscovery::Full(const uint32_t nPortIndex, RDMTod *pRDMTod) {
 	DEBUG_ENTRY
+
+	if ((nPortIndex >= rdmdiscovery::MAX_PORTS) || (m_Port[nPortIndex].state != rdmdiscovery::State::IDLE)) {
+		DEBUG_EXIT
+		return false;
+	}
+
 	pRDMTod->Reset();
 	const auto b = Start(nPortIndex, pRDMTod, false);
 	DEBUG_EXIT
 	return b;
 }
 
+/**
+ * The known UIDs are verified first with a unicast DISC_MUTE, a UID without a response is removed.
+ * The verified devices stay muted, so the branch search that follows only finds the new devices.
+ * Without new devices this is a single DISC_UNIQUE_BRANCH without a response.
+ */
 bool RDMDiscovery::Incremental(const uint32_t nPortIndex, RDMTod *pRDMTod) {
 	DEBUG_ENTRY
-	m_Mute.nTodEntries = pRDMTod->GetUidCount();
+
+	if ((nPortIndex >= rdmdiscovery::MAX_PORTS) || (m_Port[nPortIndex].state != rdmdiscovery::State::IDLE)) {
+		DEBUG_EXIT
+		return false;
+	}
+
+	m_Port[nPortIndex].mute.nTodEntries = pRDMTod->GetUidCount();
 	const auto b = Start(nPortIndex, pRDMTod, true);
 	DEBUG_EXIT
 	return b;
@@ -134,81 +183,116 @@ bool RDMDiscovery::Incremental(const uint32_t nPortIndex, RDMTod *pRDMTod) {
 bool RDMDiscovery::Start(const uint32_t nPortIndex, RDMTod *pRDMTod, const bool doIncremental) {
 	DEBUG_ENTRY
 
-	if (m_State != rdmdiscovery::State::IDLE) {
+	auto& port = m_Port[nPortIndex];
+
+	if (port.state != rdmdiscovery::State::IDLE) {
 		DEBUG_PUTS("Is already running.");
 		DEBUG_EXIT
 		return false;
 	}
 
-	m_nPortIndex = nPortIndex;
-	m_pRDMTod = pRDMTod;
+	port.pRDMTod = pRDMTod;
+	port.nMillisStart = Hardware::Get()->Millis();
 
-	m_doIncremental = doIncremental;
-	m_bIsFinished = false;
+	port.doIncremental = doIncremental;
+	port.bIsFinished = false;
 
-	m_UnMute.nCounter = rdmdiscovery::UNMUTE_COUNTER;
-	m_UnMute.bCommandRunning = false;
+	if (doIncremental) {
+		port.statistics.nIncremental++;
+	} else {
+		port.statistics.nFull++;
+	}
+
+	port.unMute.nCounter = rdmdiscovery::UNMUTE_COUNTER;
+	port.unMute.bCommandRunning = false;
 
-	m_Mute.nCounter = rdmdiscovery::MUTE_COUNTER;
-	m_Mute.bCommandRunning = false;
+	port.mute.nCounter = rdmdiscovery::MUTE_COUNTER;
+	port.mute.bCommandRunning = false;
 
-	m_Discovery.stack.nTop = -1;
-	m_Discovery.stack.push(0x000000000000, 0xfffffffffffe);
-	m_Discovery.nCounter = rdmdiscovery::DISCOVERY_COUNTER;
+	port.discovery.stack.nTop = -1;
+	port.discovery.stack.push(0x000000000000, 0xfffffffffffe);
+	port.discovery.nCounter = rdmdiscovery::DISCOVERY_COUNTER;
 
-	m_Discovery.bCommandRunning = false;
+	port.discovery.bCommandRunning = false;
 
-	m_DiscoverySingleDevice.nCounter = rdmdiscovery::MUTE_COUNTER;
-	m_DiscoverySingleDevice.bCommandRunning = false;
+	port.discoverySingleDevice.nCounter = rdmdiscovery::MUTE_COUNTER;
+	port.discoverySingleDevice.bCommandRunning = false;
 
-	m_QuikFind.nCounter = rdmdiscovery::QUIKFIND_COUNTER;
-	m_QuikFind.bCommandRunning = false;
+	port.quikFind.nCounter = rdmdiscovery::QUIKFIND_COUNTER;
+	port.quikFind.bCommandRunning = false;
 
-	m_QuikFindDiscovery.nCounter = rdmdiscovery::QUIKFIND_DISCOVERY_COUNTER;
-	m_QuikFindDiscovery.bCommandRunning = false;
+	port.quikFindDiscovery.nCounter = rdmdiscovery::QUIKFIND_DISCOVERY_COUNTER;
+	port.quikFindDiscovery.bCommandRunning = false;
 
 	NEW_STATE(rdmdiscovery::State::UNMUTE, false);
 
+	m_nRunning |= (1U << nPortIndex);
+
 #ifndef NDEBUG
-	debug.nTreeIndex = 0;
+	port.debug.nTreeIndex = 0;
 #endif
 	DEBUG_EXIT
 	return true;
 }
 
-bool RDMDiscovery::Stop() {
+bool RDMDiscovery::Stop(const uint32_t nPortIndex) {
 	DEBUG_ENTRY
 
-	if (m_State == rdmdiscovery::State::IDLE) {
+	if ((nPortIndex >= rdmdiscovery::MAX_PORTS) || (m_Port[nPortIndex].state == rdmdiscovery::State::IDLE)) {
 		DEBUG_PUTS("Not running.");
 		DEBUG_EXIT
 		return false;
 	}
 
-	m_bIsFinished = false;
+	auto& port = m_Port[nPortIndex];
 
-	NEW_STATE(rdmdiscovery::State::IDLE, true);
+	port.bIsFinished = false;
+
+	/*
+	 * A late response is still received, the port is idle after its time out.
+	 */
+	if (port.state == rdmdiscovery::State::LATE_RESPONSE) {
+		port.savedState = rdmdiscovery::State::IDLE;
+	} else {
+		NEW_STATE(rdmdiscovery::State::IDLE, true);
+	}
+
+	if (port.state == rdmdiscovery::State::IDLE) {
+		m_nRunning &= ~(1U << nPortIndex);
+	}
 
 	DEBUG_EXIT
 	return true;
 }
 
-bool RDMDiscovery::IsValidDiscoveryResponse(uint8_t *pUid) {
+void RDMDiscovery::Print(const uint32_t nPortIndex) {
+	assert(nPortIndex < rdmdiscovery::MAX_PORTS);
+	const auto& statistics = m_Port[nPortIndex].statistics;
+
+	printf("RDM Discovery %c\n", static_cast<char>('A' + nPortIndex));
+	printf(" Full/Incremental : %u/%u\n", static_cast<unsigned int>(statistics.nFull), static_cast<unsigned int>(statistics.nIncremental));
+	printf(" Duration         : %u ms (max %u ms)\n", static_cast<unsigned int>(statistics.nMillisLast), static_cast<unsigned int>(statistics.nMillisMax));
+	printf(" DUB/Collisions   : %u/%u\n", static_cast<unsigned int>(statistics.nDiscUniqueBranch), static_cast<unsigned int>(statistics.nCollisions));
+	printf(" Mutes/Verified   : %u/%u\n", static_cast<unsigned int>(statistics.nMutes), static_cast<unsigned int>(statistics.nVerified));
+	printf(" Found/Lost       : %u/%u\n", static_cast<unsigned int>(statistics.nFound), static_cast<unsigned int>(statistics.nLost));
+}
+
+bool RDMDiscovery::IsValidDiscoveryResponse(Port& port, uint8_t *pUid) {
 	uint8_t checksum[2];
 	uint16_t nRdmChecksum = 6 * 0xFF;
 	auto bIsValid = false;
 
-	if (m_pResponse[0] == 0xFE) {
-		pUid[0] = m_pResponse[8] & m_pResponse[9];
-		pUid[1] = m_pResponse[10] & m_pResponse[11];
+	if (port.pResponse[0] == 0xFE) {
+		pUid[0] = port.pResponse[8] & port.pResponse[9];
+		pUid[1] = port.pResponse[10] & port.pResponse[11];
 
-		pUid[2] = m_pResponse[12] & m_pResponse[13];
-		pUid[3] = m_pResponse[14] & m_pResponse[15];
-		pUid[4] = m_pResponse[16] & m_pResponse[17];
-		pUid[5] = m_pResponse[18] & m_pResponse[19];
+		pUid[2] = port.pResponse[12] & port.pResponse[13];
+		pUid[3] = port.pResponse[14] & port.pResponse[15];
+		pUid[4] = port.pResponse[16] & port.pResponse[17];
+		pUid[5] = port.pResponse[18] & port.pResponse[19];
 
-		checksum[0] = m_pResponse[22] & m_pResponse[23];
-		checksum[1] = m_pResponse[20] & m_pResponse[21];
+		checksum[0] = port.pResponse[22] & port.pResponse[23];
+		checksum[1] = port.pResponse[20] & port.pResponse[21];
 
 		for (uint32_t i = 0; i < 6; i++) {
 			nRdmChecksum = static_cast<uint16_t>(nRdmChecksum + pUid[i]);
@@ -227,50 +311,53 @@ bool RDMDiscovery::IsValidDiscoveryResponse(uint8_t *pUid) {
 	return bIsValid;
 }
 
-void RDMDiscovery::SavedState([[maybe_unused]] const uint32_t nLine) {
-	assert(m_SavedState != m_State);
+void RDMDiscovery::SavedState(Port& port, [[maybe_unused]] const uint32_t nLine) {
+	assert(port.savedState != port.state);
 #ifndef NDEBUG
-	printf("State %s->%s at line %u\n", rdmdiscovery::StateName[static_cast<uint32_t>(m_State)], rdmdiscovery::StateName[static_cast<uint32_t>(m_SavedState)], nLine);
+	printf("State %s->%s at line %u\n", rdmdiscovery::StateName[static_cast<uint32_t>(port.state)], rdmdiscovery::StateName[static_cast<uint32_t>(port.savedState)], nLine);
 #endif
-	m_State = m_SavedState;
+	port.state = port.savedState;
 }
 
-void RDMDiscovery::NewState(const rdmdiscovery::State state, const bool doStateLateResponse, [[maybe_unused]] const uint32_t nLine) {
-	assert(m_State != state);
+void RDMDiscovery::NewState(Port& port, const rdmdiscovery::State state, const bool doStateLateResponse, [[maybe_unused]] const uint32_t nLine) {
+	assert(port.state != state);
 
-	if (doStateLateResponse && (m_State != rdmdiscovery::State::LATE_RESPONSE)) {
+	if (doStateLateResponse && (port.state != rdmdiscovery::State::LATE_RESPONSE)) {
 #ifndef NDEBUG
 		assert(static_cast<uint32_t>(state) < sizeof(rdmdiscovery::StateName) / sizeof(rdmdiscovery::StateName[0]));
-		printf("State %s->%s [%s] at line %u\n", rdmdiscovery::StateName[static_cast<uint32_t>(m_State)], rdmdiscovery::StateName[static_cast<uint32_t>(rdmdiscovery::State::LATE_RESPONSE)], rdmdiscovery::StateName[static_cast<uint32_t>(state)],  nLine);
+		printf("State %s->%s [%s] at line %u\n", rdmdiscovery::StateName[static_cast<uint32_t>(port.state)], rdmdiscovery::StateName[static_cast<uint32_t>(rdmdiscovery::State::LATE_RESPONSE)], rdmdiscovery::StateName[static_cast<uint32_t>(state)],  nLine);
 #endif
-		m_LateResponse.nMicros = Hardware::Get()->Micros();
-		m_SavedState = state;
-		m_State = rdmdiscovery::State::LATE_RESPONSE;
+		port.lateResponse.nMicros = Hardware::Get()->Micros();
+		port.savedState = state;
+		port.state = rdmdiscovery::State::LATE_RESPONSE;
 	} else {
 #ifndef NDEBUG
-		printf("State %s->%s at line %u\n", rdmdiscovery::StateName[static_cast<uint32_t>(m_State)], rdmdiscovery::StateName[static_cast<uint32_t>(state)],  nLine);
+		printf("State %s->%s at line %u\n", rdmdiscovery::StateName[static_cast<uint32_t>(port.state)], rdmdiscovery::StateName[static_cast<uint32_t>(state)],  nLine);
 #endif
-		m_State = state;
+		port.state = state;
 	}
 }
 
-void RDMDiscovery::Process() {
-	switch (m_State) {
+void RDMDiscovery::Process(const uint32_t nPortIndex) {
+	assert(nPortIndex < rdmdiscovery::MAX_PORTS);
+	auto& port = m_Port[nPortIndex];
+
+	switch (port.state) {
 	case rdmdiscovery::State::LATE_RESPONSE:  ///< LATE_RESPONSE
-		m_Message.Receive(m_nPortIndex);
+		port.message.Receive(nPortIndex);
 
-		if ((Hardware::Get()->Micros() - m_LateResponse.nMicros) > rdmdiscovery::LATE_RESPONSE_TIME_OUT) {
+		if ((Hardware::Get()->Micros() - port.lateResponse.nMicros) > rdmdiscovery::LATE_RESPONSE_TIME_OUT) {
 			SAVED_STATE();
 		}
 
 		return;
 		break;
 	case rdmdiscovery::State::UNMUTE:  ///< UNMUTE
-		if (m_UnMute.nCounter == 0) {
-			m_UnMute.nCounter = rdmdiscovery::UNMUTE_COUNTER;
-			m_UnMute.bCommandRunning = false;
+		if (port.unMute.nCounter == 0) {
+			port.unMute.nCounter = rdmdiscovery::UNMUTE_COUNTER;
+			port.unMute.bCommandRunning = false;
 
-			if (m_doIncremental) {
+			if (port.doIncremental) {
 				NEW_STATE(rdmdiscovery::State::MUTE, false);
 				return;
 			}
@@ -279,195 +366,203 @@ void RDMDiscovery::Process() {
 			return;
 		}
 
-		if (!m_UnMute.bCommandRunning) {
-			m_Message.SetPortID(static_cast<uint8_t>(1 + m_nPortIndex));
-			m_Message.SetDstUid(UID_ALL);
-			m_Message.SetCc(E120_DISCOVERY_COMMAND);
-			m_Message.SetPid(E120_DISC_UN_MUTE);
-			m_Message.SetPd(nullptr, 0);
-			m_Message.Send(m_nPortIndex);
+		if (!port.unMute.bCommandRunning) {
+			port.message.SetPortID(static_cast<uint8_t>(1 + nPortIndex));
+			port.message.SetDstUid(UID_ALL);
+			port.message.SetCc(E120_DISCOVERY_COMMAND);
+			port.message.SetPid(E120_DISC_UN_MUTE);
+			port.message.SetPd(nullptr, 0);
+			port.message.Send(nPortIndex);
 
-			m_UnMute.nMicros = Hardware::Get()->Micros();
-			m_UnMute.bCommandRunning = true;
+			port.unMute.nMicros = Hardware::Get()->Micros();
+			port.unMute.bCommandRunning = true;
 			return;
 		}
 
-		m_Message.Receive(m_nPortIndex);
+		port.message.Receive(nPortIndex);
 
-		if ((Hardware::Get()->Micros() - m_UnMute.nMicros) > rdmdiscovery::RECEIVE_TIME_OUT) {
-			assert(m_UnMute.nCounter > 0);
-			m_UnMute.nCounter--;
-			m_UnMute.bCommandRunning = false;
+		if ((Hardware::Get()->Micros() - port.unMute.nMicros) > rdmdiscovery::RECEIVE_TIME_OUT) {
+			assert(port.unMute.nCounter > 0);
+			port.unMute.nCounter--;
+			port.unMute.bCommandRunning = false;
 		}
 
 		return;
 		break;
 	case rdmdiscovery::State::MUTE:  ///< MUTE
-		if (m_Mute.nTodEntries == 0) {
-			m_Mute.bCommandRunning = false;
+		if (port.mute.nTodEntries == 0) {
+			port.mute.bCommandRunning = false;
 			NEW_STATE(rdmdiscovery::State::DISCOVERY, false);
 			return;
 		}
 
-		if (m_Mute.nCounter == 0) {
-			m_Mute.nCounter = rdmdiscovery::MUTE_COUNTER;
-			m_Mute.bCommandRunning = false;
+		if (port.mute.nCounter == 0) {
+			port.mute.nCounter = rdmdiscovery::MUTE_COUNTER;
+			port.mute.bCommandRunning = false;
 #ifndef NDEBUG
-			printf("Device is gone ");rdmdiscovery::print_uid(m_Mute.uid); puts("");
+			printf("Device is gone ");rdmdiscovery::print_uid(port.mute.uid); puts("");
 #endif
-			m_pRDMTod->Delete(m_Mute.uid);
+			port.pRDMTod->Delete(port.mute.uid);
+			port.statistics.nLost++;
 
-			if (m_Mute.nTodEntries > 0) {
-				m_Mute.nTodEntries--;
+			if (port.mute.nTodEntries > 0) {
+				port.mute.nTodEntries--;
 			}
 
 			return;
 		}
 
-		if (!m_Mute.bCommandRunning) {
-			assert(m_Mute.nTodEntries > 0);
-			m_pRDMTod->CopyUidEntry(m_Mute.nTodEntries - 1, m_Mute.uid);
+		if (!port.mute.bCommandRunning) {
+			assert(port.mute.nTodEntries > 0);
+			port.pRDMTod->CopyUidEntry(port.mute.nTodEntries - 1, port.mute.uid);
 
-			m_Message.SetPortID(static_cast<uint8_t>(1 + m_nPortIndex));
-			m_Message.SetDstUid(m_Mute.uid);
-			m_Message.SetCc(E120_DISCOVERY_COMMAND);
-			m_Message.SetPid(E120_DISC_MUTE);
-			m_Message.SetPd(nullptr, 0);
-			m_Message.Send(m_nPortIndex);
+			port.message.SetPortID(static_cast<uint8_t>(1 + nPortIndex));
+			port.message.SetDstUid(port.mute.uid);
+			port.message.SetCc(E120_DISCOVERY_COMMAND);
+			port.message.SetPid(E120_DISC_MUTE);
+			port.message.SetPd(nullptr, 0);
+			port.message.Send(nPortIndex);
+			port.statistics.nMutes++;
 
-			m_Mute.nMicros = Hardware::Get()->Micros();
-			m_Mute.bCommandRunning = true;
+			port.mute.nMicros = Hardware::Get()->Micros();
+			port.mute.bCommandRunning = true;
 			return;
 		}
 
-		m_pResponse = const_cast<uint8_t *>(m_Message.Receive(m_nPortIndex));
+		port.pResponse = const_cast<uint8_t *>(port.message.Receive(nPortIndex));
 
-		if (m_pResponse != nullptr) {
-			assert(m_Mute.nTodEntries > 0);
-			m_Mute.nTodEntries--;
-			m_Mute.bCommandRunning = false;
+		if (port.pResponse != nullptr) {
+			assert(port.mute.nTodEntries > 0);
+			port.mute.nTodEntries--;
+			port.mute.nCounter = rdmdiscovery::MUTE_COUNTER;	// The time outs are counted per UID
+			port.mute.bCommandRunning = false;
+			port.statistics.nVerified++;
 			return;
 		}
 
-		if ((Hardware::Get()->Micros() - m_Mute.nMicros) > rdmdiscovery::RECEIVE_TIME_OUT) {
-			assert(m_Mute.nCounter > 0);
-			m_Mute.nCounter--;
-			m_Message.Send(m_nPortIndex);
-			m_Mute.nMicros = Hardware::Get()->Micros();
+		if ((Hardware::Get()->Micros() - port.mute.nMicros) > rdmdiscovery::RECEIVE_TIME_OUT) {
+			assert(port.mute.nCounter > 0);
+			port.mute.nCounter--;
+			port.message.Send(nPortIndex);
+			port.mute.nMicros = Hardware::Get()->Micros();
 		}
 
 		return;
 		break;
 	case rdmdiscovery::State::DISCOVERY:		///< DISCOVERY
-		if (m_Discovery.bCommandRunning) {
-			m_pResponse = const_cast<uint8_t *>(m_Message.Receive(m_nPortIndex));
+		if (port.discovery.bCommandRunning) {
+			port.pResponse = const_cast<uint8_t *>(port.message.Receive(nPortIndex));
 
-			if ((m_pResponse != nullptr) || (m_Discovery.nCounter == 0)) {
-				m_Discovery.bCommandRunning = false;
+			if ((port.pResponse != nullptr) || (port.discovery.nCounter == 0)) {
+				port.discovery.bCommandRunning = false;
 				NEW_STATE(rdmdiscovery::State::DUB, false);
 				return;
 			}
 
-			if ((Hardware::Get()->Micros() - m_Discovery.nMicros) > rdmdiscovery::RECEIVE_TIME_OUT) {
-				assert(m_Discovery.nCounter > 0);
-				m_Discovery.nCounter--;
-				m_Message.Send(m_nPortIndex);
-				m_Discovery.nMicros = Hardware::Get()->Micros();
+			if ((Hardware::Get()->Micros() - port.discovery.nMicros) > rdmdiscovery::RECEIVE_TIME_OUT) {
+				assert(port.discovery.nCounter > 0);
+				port.discovery.nCounter--;
+				port.message.Send(nPortIndex);
+				port.discovery.nMicros = Hardware::Get()->Micros();
 			}
 
 			return;
 		}
 
-		if (!m_Discovery.stack.pop(m_Discovery.nLowerBound, m_Discovery.nUpperBound)) {
-			m_Discovery.bCommandRunning = false;
+		if (!port.discovery.stack.pop(port.discovery.nLowerBound, port.discovery.nUpperBound)) {
+			port.discovery.bCommandRunning = false;
 			NEW_STATE(rdmdiscovery::State::FINISHED, true);
 			return;
 		}
 
 #ifndef NDEBUG
-		debug.tree[debug.nTreeIndex].nLowerBound = m_Discovery.nLowerBound;
-		debug.tree[debug.nTreeIndex++].nUpperBound = m_Discovery.nUpperBound;
+		port.debug.tree[port.debug.nTreeIndex].nLowerBound = port.discovery.nLowerBound;
+		port.debug.tree[port.debug.nTreeIndex++].nUpperBound = port.discovery.nUpperBound;
 #endif
 
-		if (m_Discovery.nLowerBound == m_Discovery.nUpperBound) {
-			m_QuikFindDiscovery.bCommandRunning = false;
+		if (port.discovery.nLowerBound == port.discovery.nUpperBound) {
+			port.quikFindDiscovery.bCommandRunning = false;
 			NEW_STATE(rdmdiscovery::State::DISCOVERY_SINGLE_DEVICE, true);
 			return;
 		}
 
-		memcpy(m_Discovery.pdl[0], rdmdiscovery::convert_uid(m_Discovery.nLowerBound), RDM_UID_SIZE);
-		memcpy(m_Discovery.pdl[1], rdmdiscovery::convert_uid(m_Discovery.nUpperBound), RDM_UID_SIZE);
+		memcpy(port.discovery.pdl[0], rdmdiscovery::convert_uid(port.discovery.nLowerBound), RDM_UID_SIZE);
+		memcpy(port.discovery.pdl[1], rdmdiscovery::convert_uid(port.discovery.nUpperBound), RDM_UID_SIZE);
 
 #ifndef NDEBUG
-		printf("DISC_UNIQUE_BRANCH -> "); rdmdiscovery::print_uid(m_Discovery.pdl[0]); printf(" "); rdmdiscovery::print_uid(m_Discovery.pdl[1]); puts("");
+		printf("DISC_UNIQUE_BRANCH -> "); rdmdiscovery::print_uid(port.discovery.pdl[0]); printf(" "); rdmdiscovery::print_uid(port.discovery.pdl[1]); puts("");
 #endif
 
-		m_Message.SetDstUid(UID_ALL);
-		m_Message.SetCc(E120_DISCOVERY_COMMAND);
-		m_Message.SetPid(E120_DISC_UNIQUE_BRANCH);
-		m_Message.SetPd(reinterpret_cast<const uint8_t*>(m_Discovery.pdl), 2 * RDM_UID_SIZE);
-		m_Message.Send(m_nPortIndex);
+		port.message.SetDstUid(UID_ALL);
+		port.message.SetCc(E120_DISCOVERY_COMMAND);
+		port.message.SetPid(E120_DISC_UNIQUE_BRANCH);
+		port.message.SetPd(reinterpret_cast<const uint8_t*>(port.discovery.pdl), 2 * RDM_UID_SIZE);
+		port.message.Send(nPortIndex);
+		port.statistics.nDiscUniqueBranch++;
 
-		m_Discovery.nCounter = rdmdiscovery::DISCOVERY_COUNTER;
-		m_Discovery.nMicros = Hardware::Get()->Micros();
-		m_Discovery.bCommandRunning = true;
+		port.discovery.nCounter = rdmdiscovery::DISCOVERY_COUNTER;
+		port.discovery.nMicros = Hardware::Get()->Micros();
+		port.discovery.bCommandRunning = true;
 
 		return;
 		break;
 	case rdmdiscovery::State::DISCOVERY_SINGLE_DEVICE:		///< DISCOVERY_SINGLE_DEVICE
-		if (m_DiscoverySingleDevice.nCounter == 0) {
-			m_DiscoverySingleDevice.nCounter = rdmdiscovery::QUIKFIND_DISCOVERY_COUNTER;
-			m_DiscoverySingleDevice.bCommandRunning = false;
+		if (port.discoverySingleDevice.nCounter == 0) {
+			port.discoverySingleDevice.nCounter = rdmdiscovery::QUIKFIND_DISCOVERY_COUNTER;
+			port.discoverySingleDevice.bCommandRunning = false;
 			NEW_STATE(rdmdiscovery::State::DISCOVERY, true);
 			return;
 		}
 
-		if (!m_DiscoverySingleDevice.bCommandRunning) {
-			memcpy(m_Discovery.uid, rdmdiscovery::convert_uid(m_Discovery.nLowerBound), RDM_UID_SIZE);
+		if (!port.discoverySingleDevice.bCommandRunning) {
+			memcpy(port.discovery.uid, rdmdiscovery::convert_uid(port.discovery.nLowerBound), RDM_UID_SIZE);
 
-			m_Message.SetCc(E120_DISCOVERY_COMMAND);
-			m_Message.SetPid(E120_DISC_MUTE);
-			m_Message.SetDstUid(m_Discovery.uid);
-			m_Message.SetPd(nullptr, 0);
-			m_Message.Send(m_nPortIndex);
+			port.message.SetCc(E120_DISCOVERY_COMMAND);
+			port.message.SetPid(E120_DISC_MUTE);
+			port.message.SetDstUid(port.discovery.uid);
+			port.message.SetPd(nullptr, 0);
+			port.message.Send(nPortIndex);
+			port.statistics.nMutes++;
 
-			m_DiscoverySingleDevice.nMicros = Hardware::Get()->Micros();
-			m_DiscoverySingleDevice.bCommandRunning = true;
+			port.discoverySingleDevice.nMicros = Hardware::Get()->Micros();
+			port.discoverySingleDevice.bCommandRunning = true;
 			return;
 		}
 
-		m_pResponse = const_cast<uint8_t *>(m_Message.Receive(m_nPortIndex));
+		port.pResponse = const_cast<uint8_t *>(port.message.Receive(nPortIndex));
 
-		if (m_pResponse != nullptr) {
-			const auto pResponse = reinterpret_cast<struct TRdmMessage*>(m_pResponse);
+		if (port.pResponse != nullptr) {
+			const auto pResponse = reinterpret_cast<struct TRdmMessage*>(port.pResponse);
 
-			if ((pResponse->command_class == E120_DISCOVERY_COMMAND_RESPONSE) && (memcmp(m_Discovery.uid, pResponse->source_uid, RDM_UID_SIZE) == 0)) {
-				m_pRDMTod->AddUid(m_Discovery.uid);
+			if ((pResponse->command_class == E120_DISCOVERY_COMMAND_RESPONSE) && (memcmp(port.discovery.uid, pResponse->source_uid, RDM_UID_SIZE) == 0)) {
+				if (port.pRDMTod->AddUid(port.discovery.uid)) {
+					port.statistics.nFound++;
+				}
 #ifndef NDEBUG
 				printf("AddUid : ");
-				rdmdiscovery::print_uid(m_Discovery.uid);
+				rdmdiscovery::print_uid(port.discovery.uid);
 				puts("");
 #endif
 
-				m_DiscoverySingleDevice.nCounter = rdmdiscovery::QUIKFIND_DISCOVERY_COUNTER;
-				m_DiscoverySingleDevice.bCommandRunning = false;
+				port.discoverySingleDevice.nCounter = rdmdiscovery::QUIKFIND_DISCOVERY_COUNTER;
+				port.discoverySingleDevice.bCommandRunning = false;
 				NEW_STATE(rdmdiscovery::State::DISCOVERY, false);
 			}
 
 			return;
 		}
 
-		if ((Hardware::Get()->Micros() - m_DiscoverySingleDevice.nMicros) > rdmdiscovery::RECEIVE_TIME_OUT) {
-			assert(m_Mute.nCounter > 0);
-			m_DiscoverySingleDevice.nCounter--;
-			m_Message.Send(m_nPortIndex);
-			m_DiscoverySingleDevice.nMicros = Hardware::Get()->Micros();
+		if ((Hardware::Get()->Micros() - port.discoverySingleDevice.nMicros) > rdmdiscovery::RECEIVE_TIME_OUT) {
+			assert(port.discoverySingleDevice.nCounter > 0);
+			port.discoverySingleDevice.nCounter--;
+			port.message.Send(nPortIndex);
+			port.discoverySingleDevice.nMicros = Hardware::Get()->Micros();
 		}
 
 		return;
 		break;
 	case rdmdiscovery::State::DUB:	///< DUB
-		if (m_pResponse == nullptr) {
+		if (port.pResponse == nullptr) {
 #ifndef NDEBUG
 			puts("No responses");
 #endif
@@ -475,51 +570,54 @@ void RDMDiscovery::Process() {
 			return;
 		}
 
-		if (IsValidDiscoveryResponse(m_QuikFind.uid)) {
+		if (IsValidDiscoveryResponse(port, port.quikFind.uid)) {
 			NEW_STATE(rdmdiscovery::State::QUICKFIND, true);
 			return;
 		}
 
-		m_Discovery.nMidPosition = ((m_Discovery.nLowerBound & (0x0000800000000000 - 1)) + (m_Discovery.nUpperBound & (0x0000800000000000 - 1))) / 2
-				+ (m_Discovery.nUpperBound & (0x0000800000000000) ? 0x0000400000000000 : 0 )
-				+ (m_Discovery.nLowerBound & (0x0000800000000000) ? 0x0000400000000000 : 0 );
+		port.statistics.nCollisions++;
+
+		port.discovery.nMidPosition = ((port.discovery.nLowerBound & (0x0000800000000000 - 1)) + (port.discovery.nUpperBound & (0x0000800000000000 - 1))) / 2
+				+ (port.discovery.nUpperBound & (0x0000800000000000) ? 0x0000400000000000 : 0 )
+				+ (port.discovery.nLowerBound & (0x0000800000000000) ? 0x0000400000000000 : 0 );
 
 
-		m_Discovery.stack.push(m_Discovery.nLowerBound, m_Discovery.nMidPosition);
-		m_Discovery.stack.push(m_Discovery.nMidPosition + 1, m_Discovery.nUpperBound);
+		port.discovery.stack.push(port.discovery.nLowerBound, port.discovery.nMidPosition);
+		port.discovery.stack.push(port.discovery.nMidPosition + 1, port.discovery.nUpperBound);
 
 		NEW_STATE(rdmdiscovery::State::DISCOVERY, true);
 		break;
 	case rdmdiscovery::State::QUICKFIND:	///< QUICKFIND
-		if (m_QuikFind.nCounter == 0) {
-			m_QuikFind.bCommandRunning = false;
+		if (port.quikFind.nCounter == 0) {
+			port.quikFind.bCommandRunning = false;
 			NEW_STATE(rdmdiscovery::State::QUICKFIND_DISCOVERY, false);
 			return;
 		}
 
-		if (!m_QuikFind.bCommandRunning) {
+		if (!port.quikFind.bCommandRunning) {
 #ifndef NDEBUG
 			printf("QuickFind : ");
-			rdmdiscovery::print_uid(m_QuikFind.uid);
+			rdmdiscovery::print_uid(port.quikFind.uid);
 			puts("");
 #endif
 
-			m_Message.SetCc(E120_DISCOVERY_COMMAND);
-			m_Message.SetPid(E120_DISC_MUTE);
-			m_Message.SetDstUid(m_QuikFind.uid);
-			m_Message.SetPd(nullptr, 0);
-			m_Message.Send(m_nPortIndex);
+			port.message.SetCc(E120_DISCOVERY_COMMAND);
+			port.message.SetPid(E120_DISC_MUTE);
+			port.message.SetDstUid(port.quikFind.uid);
+			port.message.SetPd(nullptr, 0);
+			port.message.Send(nPortIndex);
+			port.statistics.nMutes++;
 
-			m_QuikFind.nCounter = rdmdiscovery::QUIKFIND_COUNTER;
-			m_QuikFind.nMicros = Hardware::Get()->Micros();
-			m_QuikFind.bCommandRunning = true;
+			port.quikFind.nCounter = rdmdiscovery::QUIKFIND_COUNTER;
+			port.quikFind.nMicros = Hardware::Get()->Micros();
+			port.quikFind.bCommandRunning = true;
 			return;
 		}
 
-		m_pResponse = const_cast<uint8_t *>(m_Message.Receive(m_nPortIndex));
+		port.pResponse = const_cast<uint8_t *>(port.message.Receive(nPortIndex));
 
-		if ((m_pResponse != nullptr)) {
-			const auto pResponse = reinterpret_cast<struct TRdmMessage*>(m_pResponse);
+		if ((port.pResponse != nullptr)) {
+			const auto pResponse = reinterpret_cast<struct TRdmMessage*>(port.pResponse);
 
 			if ((pResponse->command_class != E120_DISCOVERY_COMMAND_RESPONSE) || ((static_cast<uint16_t>((pResponse->param_id[0] << 8) + pResponse->param_id[1])) != E120_DISC_MUTE)) {
 				puts("QUICKFIND invalid response");
@@ -527,83 +625,88 @@ void RDMDiscovery::Process() {
 				return;
 			}
 
-			if ((pResponse->command_class == E120_DISCOVERY_COMMAND_RESPONSE) && (memcmp(m_QuikFind.uid, pResponse->source_uid, RDM_UID_SIZE) == 0)) {
-				m_pRDMTod->AddUid(m_QuikFind.uid);
+			if ((pResponse->command_class == E120_DISCOVERY_COMMAND_RESPONSE) && (memcmp(port.quikFind.uid, pResponse->source_uid, RDM_UID_SIZE) == 0)) {
+				if (port.pRDMTod->AddUid(port.quikFind.uid)) {
+					port.statistics.nFound++;
+				}
 #ifndef NDEBUG
 				printf("AddUid : ");
-				rdmdiscovery::print_uid(m_QuikFind.uid);
+				rdmdiscovery::print_uid(port.quikFind.uid);
 				puts("");
 #endif
 			}
 
-			m_QuikFind.nCounter = rdmdiscovery::QUIKFIND_COUNTER;
-			m_QuikFind.bCommandRunning = false;
+			port.quikFind.nCounter = rdmdiscovery::QUIKFIND_COUNTER;
+			port.quikFind.bCommandRunning = false;
 			NEW_STATE(rdmdiscovery::State::QUICKFIND_DISCOVERY, false);
 			return;
 		}
 
-		if ((Hardware::Get()->Micros() - m_QuikFind.nMicros) > rdmdiscovery::RECEIVE_TIME_OUT) {
-			assert(m_QuikFind.nCounter > 0);
-			m_QuikFind.nCounter--;
-			m_QuikFind.bCommandRunning = false;
+		if ((Hardware::Get()->Micros() - port.quikFind.nMicros) > rdmdiscovery::RECEIVE_TIME_OUT) {
+			assert(port.quikFind.nCounter > 0);
+			port.quikFind.nCounter--;
+			port.quikFind.bCommandRunning = false;
 		}
 
 		return;
 		break;
 	case rdmdiscovery::State::QUICKFIND_DISCOVERY:	///< QUICKFIND_DISCOVERY
-		if (m_QuikFindDiscovery.nCounter == 0) {
-			m_QuikFindDiscovery.nCounter = rdmdiscovery::QUIKFIND_DISCOVERY_COUNTER;
-			m_QuikFindDiscovery.bCommandRunning = false;
+		if (port.quikFindDiscovery.nCounter == 0) {
+			port.quikFindDiscovery.nCounter = rdmdiscovery::QUIKFIND_DISCOVERY_COUNTER;
+			port.quikFindDiscovery.bCommandRunning = false;
 			NEW_STATE(rdmdiscovery::State::DISCOVERY, true);
 			return;
 		}
 
-		if (!m_QuikFindDiscovery.bCommandRunning) {
-			m_Message.SetDstUid(UID_ALL);
-			m_Message.SetCc(E120_DISCOVERY_COMMAND);
-			m_Message.SetPid(E120_DISC_UNIQUE_BRANCH);
-			m_Message.SetPd(reinterpret_cast<const uint8_t*>(m_Discovery.pdl), 2 * RDM_UID_SIZE);
-			m_Message.Send(m_nPortIndex);
+		if (!port.quikFindDiscovery.bCommandRunning) {
+			port.message.SetDstUid(UID_ALL);
+			port.message.SetCc(E120_DISCOVERY_COMMAND);
+			port.message.SetPid(E120_DISC_UNIQUE_BRANCH);
+			port.message.SetPd(reinterpret_cast<const uint8_t*>(port.discovery.pdl), 2 * RDM_UID_SIZE);
+			port.message.Send(nPortIndex);
+			port.statistics.nDiscUniqueBranch++;
 
-			m_QuikFindDiscovery.nMicros = Hardware::Get()->Micros();
-			m_QuikFindDiscovery.bCommandRunning = true;
+			port.quikFindDiscovery.nMicros = Hardware::Get()->Micros();
+			port.quikFindDiscovery.bCommandRunning = true;
 			return;
 		}
 
-		m_pResponse = const_cast<uint8_t *>(m_Message.Receive(m_nPortIndex));
+		port.pResponse = const_cast<uint8_t *>(port.message.Receive(nPortIndex));
 
-		if ((m_pResponse != nullptr) && (IsValidDiscoveryResponse(m_QuikFind.uid))) {
-			m_QuikFindDiscovery.nCounter = rdmdiscovery::QUIKFIND_DISCOVERY_COUNTER;
-			m_QuikFindDiscovery.bCommandRunning = false;
+		if ((port.pResponse != nullptr) && (IsValidDiscoveryResponse(port, port.quikFind.uid))) {
+			port.quikFindDiscovery.nCounter = rdmdiscovery::QUIKFIND_DISCOVERY_COUNTER;
+			port.quikFindDiscovery.bCommandRunning = false;
 			NEW_STATE(rdmdiscovery::State::QUICKFIND, true);
 			return;
 		}
 
-		if ((m_pResponse != nullptr) && (!IsValidDiscoveryResponse(m_QuikFind.uid))) {
-			m_QuikFindDiscovery.nCounter = rdmdiscovery::QUIKFIND_DISCOVERY_COUNTER;
-			m_QuikFindDiscovery.bCommandRunning = false;
+		if ((port.pResponse != nullptr) && (!IsValidDiscoveryResponse(port, port.quikFind.uid))) {
+			port.quikFindDiscovery.nCounter = rdmdiscovery::QUIKFIND_DISCOVERY_COUNTER;
+			port.quikFindDiscovery.bCommandRunning = false;
 			NEW_STATE(rdmdiscovery::State::DUB, false);
 			return;
 		}
 
-		if ((Hardware::Get()->Micros() - m_QuikFindDiscovery.nMicros) > rdmdiscovery::RECEIVE_TIME_OUT) {
-			assert(m_QuikFind.nCounter > 0);
-			m_QuikFindDiscovery.nCounter--;
-			m_QuikFindDiscovery.bCommandRunning = false;
+		if ((Hardware::Get()->Micros() - port.quikFindDiscovery.nMicros) > rdmdiscovery::RECEIVE_TIME_OUT) {
+			assert(port.quikFind.nCounter > 0);
+			port.quikFindDiscovery.nCounter--;
+			port.quikFindDiscovery.bCommandRunning = false;
 		}
 
 		return;
 		break;
 	case rdmdiscovery::State::FINISHED: ///< FINISHED
-		m_bIsFinished = true;
+		port.bIsFinished = true;
+		port.statistics.nMillisLast = Hardware::Get()->Millis() - port.nMillisStart;
+		port.statistics.nMillisMax = std::max(port.statistics.nMillisMax, port.statistics.nMillisLast);
 		NEW_STATE(rdmdiscovery::State::IDLE, false);
 #ifndef NDEBUG
-		m_pRDMTod->Dump();
+		port.pRDMTod->Dump();
 
-		printf("\nStack top %d\n\n", m_Discovery.stack.nDebugStackTopMax);
+		printf("\nStack top %d\n\n", port.discovery.stack.nDebugStackTopMax);
 
-		for (uint32_t i = 0; i < debug.nTreeIndex; i++) {
-			rdmdiscovery::print_uid(debug.tree[i].nLowerBound); printf(" "); rdmdiscovery::print_uid(debug.tree[i].nUpperBound); puts("");
+		for (uint32_t i = 0; i < port.debug.nTreeIndex; i++) {
+			rdmdiscovery::print_uid(port.debug.tree[i].nLowerBound); printf(" "); rdmdiscovery::print_uid(port.debug.tree[i].nUpperBound); puts("");
 		}
 #endif
 		break;
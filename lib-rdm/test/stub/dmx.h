@@ -0,0 +1,62 @@
+/**
+ * @file dmx.h
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef DMX_H_
+#define DMX_H_
+
+#include <cstdint>
+
+/**
+ * Stub of the DMX driver, the RDM transmit and receive are implemented by the test
+ */
+
+namespace dmx {
+enum class PortDirection {
+	OUTP, INP
+};
+namespace config::max {
+static constexpr uint32_t PORTS = 4;
+}  // namespace config::max
+}  // namespace dmx
+
+class Dmx {
+public:
+	static Dmx *Get() {
+		static Dmx s_Dmx;
+		return &s_Dmx;
+	}
+
+	void SetPortDirection(uint32_t, dmx::PortDirection, bool) {}
+
+	void RdmSendRaw(uint32_t nPortIndex, const uint8_t *pRdmData, uint32_t nLength);
+	void RdmSendDiscoveryRespondMessage(uint32_t, const uint8_t *, uint32_t) {}
+
+	const uint8_t *RdmReceive(uint32_t nPortIndex);
+	const uint8_t *RdmReceiveTimeOut(uint32_t nPortIndex, uint16_t) {
+		return RdmReceive(nPortIndex);
+	}
+};
+
+#endif /* DMX_H_ */
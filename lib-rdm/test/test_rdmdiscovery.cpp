@@ -0,0 +1,365 @@
+/**
+ * @file test_rdmdiscovery.cpp
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * The RDM responders are simulated per port, with the DMX timing of the
+ * requests and responses. Colliding discovery responses are corrupted.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include "rdmdiscovery.h"
+#include "rdmtod.h"
+#include "rdm_e120.h"
+#include "hardware.h"
+
+#include "test.h"
+
+volatile uint32_t gsv_RdmDataReceiveEnd;
+
+namespace {
+static constexpr uint32_t PORTS = rdmdiscovery::MAX_PORTS;
+static constexpr uint32_t DEVICES_MAX = rdmtod::TOD_TABLE_SIZE;
+
+struct Device {
+	uint64_t nUid;
+	bool bMuted;
+};
+
+struct Port {
+	Device devices[DEVICES_MAX];
+	uint32_t nDevices;
+	uint8_t response[64];
+	uint64_t nResponseMicros;
+	uint32_t nMutes;
+	bool bResponse;
+	bool bMuteLossy;	///< Every other DISC_MUTE is not answered
+} s_Ports[PORTS];
+
+uint64_t get_uid(const uint8_t *pUid) {
+	uint64_t nUid = 0;
+
+	for (uint32_t i = 0; i < RDM_UID_SIZE; i++) {
+		nUid = (nUid << 8) | pUid[i];
+	}
+
+	return nUid;
+}
+
+void set_uid(uint64_t nUid, uint8_t *pUid) {
+	for (int32_t i = RDM_UID_SIZE - 1; i >= 0; i--) {
+		pUid[i] = static_cast<uint8_t>(nUid);
+		nUid >>= 8;
+	}
+}
+
+/*
+ * Break, mark after break and the slots at 250 kbit/s
+ */
+uint64_t dmx_micros(const uint32_t nSlots) {
+	return 176U + 12U + nSlots * 44U;
+}
+}  // namespace
+
+void Dmx::RdmSendRaw(uint32_t nPortIndex, const uint8_t *pRdmData, uint32_t nLength) {
+	test::g_nMicros += dmx_micros(nLength);
+
+	const auto *pMessage = reinterpret_cast<const TRdmMessage *>(pRdmData);
+	const auto nParamId = static_cast<uint16_t>((pMessage->param_id[0] << 8) | pMessage->param_id[1]);
+	auto& port = s_Ports[nPortIndex];
+
+	port.bResponse = false;
+
+	if (nParamId == E120_DISC_UN_MUTE) {
+		for (uint32_t i = 0; i < port.nDevices; i++) {
+			port.devices[i].bMuted = false;
+		}
+		return;
+	}
+
+	if (nParamId == E120_DISC_MUTE) {
+		const auto nUid = get_uid(pMessage->destination_uid);
+
+		for (uint32_t i = 0; i < port.nDevices; i++) {
+			if (port.devices[i].nUid == nUid) {
+				port.devices[i].bMuted = true;
+
+				if (port.bMuteLossy && ((++port.nMutes & 1) != 0)) {
+					return;
+				}
+
+				memset(port.response, 0, sizeof(port.response));
+				auto *pResponse = reinterpret_cast<TRdmMessage *>(port.response);
+				pResponse->command_class = E120_DISCOVERY_COMMAND_RESPONSE;
+				memcpy(pResponse->source_uid, pMessage->destination_uid, RDM_UID_SIZE);
+				pResponse->param_id[0] = pMessage->param_id[0];
+				pResponse->param_id[1] = pMessage->param_id[1];
+
+				port.nResponseMicros = test::g_nMicros + dmx_micros(28);
+				port.bResponse = true;
+			}
+		}
+		return;
+	}
+
+	if (nParamId == E120_DISC_UNIQUE_BRANCH) {
+		const auto nLowerBound = get_uid(pMessage->param_data);
+		const auto nUpperBound = get_uid(pMessage->param_data + RDM_UID_SIZE);
+
+		uint32_t nResponders = 0;
+		uint64_t nUid = 0;
+
+		for (uint32_t i = 0; i < port.nDevices; i++) {
+			const auto& device = port.devices[i];
+
+			if ((!device.bMuted) && (device.nUid >= nLowerBound) && (device.nUid <= nUpperBound)) {
+				if (nResponders++ == 0) {
+					nUid = device.nUid;
+				}
+			}
+		}
+
+		if (nResponders == 0) {
+			return;
+		}
+
+		uint8_t uid[RDM_UID_SIZE];
+		set_uid(nUid, uid);
+
+		memset(port.response, 0xFE, 7);
+		port.response[7] = 0xAA;
+
+		uint16_t nChecksum = 0;
+
+		for (uint32_t i = 0; i < RDM_UID_SIZE; i++) {
+			port.response[8 + 2 * i] = uid[i] | 0xAA;
+			port.response[9 + 2 * i] = uid[i] | 0x55;
+			nChecksum = static_cast<uint16_t>(nChecksum + port.response[8 + 2 * i] + port.response[9 + 2 * i]);
+		}
+
+		port.response[20] = static_cast<uint8_t>((nChecksum >> 8) | 0xAA);
+		port.response[21] = static_cast<uint8_t>((nChecksum >> 8) | 0x55);
+		port.response[22] = static_cast<uint8_t>((nChecksum & 0xFF) | 0xAA);
+		port.response[23] = static_cast<uint8_t>((nChecksum & 0xFF) | 0x55);
+
+		if (nResponders > 1) {
+			port.response[9] ^= 0x11;	// Collision
+		}
+
+		port.nResponseMicros = test::g_nMicros + dmx_micros(24);
+		port.bResponse = true;
+	}
+}
+
+const uint8_t *Dmx::RdmReceive(uint32_t nPortIndex) {
+	auto& port = s_Ports[nPortIndex];
+
+	if (port.bResponse && (test::g_nMicros >= port.nResponseMicros)) {
+		port.bResponse = false;
+		return port.response;
+	}
+
+	return nullptr;
+}
+
+namespace {
+static constexpr uint8_t CONTROLLER_UID[RDM_UID_SIZE] = {0x7F, 0xF0, 0x00, 0x00, 0x00, 0x01};
+
+RDMTod s_Tod[PORTS];
+RDMDiscovery s_Discovery(CONTROLLER_UID);
+
+void add_devices(const uint32_t nPortIndex, const uint32_t nDevices, uint32_t nSeed) {
+	auto& port = s_Ports[nPortIndex];
+
+	for (uint32_t i = 0; i < nDevices; i++) {
+		nSeed = nSeed * 1664525U + 1013904223U;	// LCG
+		port.devices[port.nDevices++] = Device{(UINT64_C(0x7FF0) << 32) | nSeed, false};
+	}
+}
+
+bool tod_is_complete(const uint32_t nPortIndex) {
+	const auto& port = s_Ports[nPortIndex];
+
+	if (s_Tod[nPortIndex].GetUidCount() != port.nDevices) {
+		return false;
+	}
+
+	for (uint32_t i = 0; i < port.nDevices; i++) {
+		uint8_t uid[RDM_UID_SIZE];
+		set_uid(port.devices[i].nUid, uid);
+
+		if (!s_Tod[nPortIndex].Exist(uid)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+uint64_t run() {
+	const auto nStart = test::g_nMicros;
+
+	while (s_Discovery.IsRunning()) {
+		s_Discovery.Run();
+		test::g_nMicros += 10;
+	}
+
+	return test::g_nMicros - nStart;
+}
+
+void test_full() {
+	for (uint32_t nPortIndex = 0; nPortIndex < PORTS; nPortIndex++) {
+		add_devices(nPortIndex, 25 * (nPortIndex + 1), nPortIndex + 1);
+		CHECK(s_Discovery.Full(nPortIndex, &s_Tod[nPortIndex]));
+	}
+
+	const auto nMicros = run();
+
+	for (uint32_t nPortIndex = 0; nPortIndex < PORTS; nPortIndex++) {
+		CHECK(tod_is_complete(nPortIndex));
+	}
+
+	uint32_t nPortIndex;
+	bool bIsIncremental;
+	uint32_t nFinished = 0;
+
+	while (s_Discovery.IsFinished(nPortIndex, bIsIncremental)) {
+		CHECK(!bIsIncremental);
+		nFinished++;
+	}
+
+	CHECK(nFinished == PORTS);
+
+	printf("Full discovery of %u ports: %.2f s\n", static_cast<unsigned int>(PORTS), static_cast<double>(nMicros) / 1e6);
+}
+
+void test_incremental() {
+	auto& port = s_Ports[1];
+
+	// Remove the first 3 devices and add 2
+	memmove(&port.devices[0], &port.devices[3], (port.nDevices - 3) * sizeof(Device));
+	port.nDevices -= 3;
+	add_devices(1, 2, 0x1234);
+
+	CHECK(s_Discovery.Incremental(1, &s_Tod[1]));
+	run();
+
+	CHECK(tod_is_complete(1));
+
+	uint32_t nPortIndex;
+	bool bIsIncremental;
+	CHECK(s_Discovery.IsFinished(nPortIndex, bIsIncremental));
+	CHECK((nPortIndex == 1) && bIsIncremental);
+}
+
+/*
+ * A discovery stopped while running (ArtTodControl ATC_END) must not leave the
+ * port running in the idle state.
+ */
+void test_stop() {
+	CHECK(s_Discovery.Full(0, &s_Tod[0]));
+	CHECK(s_Discovery.Full(2, &s_Tod[2]));
+
+	for (uint32_t i = 0; i < 100; i++) {
+		s_Discovery.Run();
+		test::g_nMicros += 10;
+	}
+
+	// Stopped twice, the second time while receiving a late response
+	CHECK(s_Discovery.Stop(0));
+	CHECK(s_Discovery.Stop(0));
+
+	bool bIsIncremental;
+	CHECK(s_Discovery.IsRunning(2, bIsIncremental));
+
+	run();
+
+	CHECK(!s_Discovery.IsRunning(0, bIsIncremental));
+	CHECK(!s_Discovery.Stop(0));
+	CHECK(tod_is_complete(2));
+
+	uint32_t nPortIndex;
+	CHECK(s_Discovery.IsFinished(nPortIndex, bIsIncremental));
+	CHECK(nPortIndex == 2);
+	CHECK(!s_Discovery.IsFinished(nPortIndex, bIsIncremental));
+
+	// The port can be started again
+	CHECK(s_Discovery.Full(0, &s_Tod[0]));
+	run();
+	CHECK(tod_is_complete(0));
+}
+/*
+ * The time outs of the re-verify pass are counted per UID. Each device
+ * misses one DISC_MUTE, all of them must stay in the TOD.
+ */
+void test_mute_time_out() {
+	auto& port = s_Ports[2];
+	port.bMuteLossy = true;
+
+	CHECK(s_Discovery.Incremental(2, &s_Tod[2]));
+	run();
+
+	CHECK(port.nMutes >= 2 * port.nDevices);
+	CHECK(tod_is_complete(2));
+
+	uint32_t nPortIndex;
+	bool bIsIncremental;
+	CHECK(s_Discovery.IsFinished(nPortIndex, bIsIncremental));
+
+	port.bMuteLossy = false;
+}
+
+/*
+ * A full table on one port
+ */
+void test_table_size() {
+	auto& port = s_Ports[3];
+	port.nDevices = 0;
+	add_devices(3, DEVICES_MAX, 0x5678);
+
+	CHECK(s_Discovery.Full(3, &s_Tod[3]));
+	const auto nMicros = run();
+
+	CHECK(tod_is_complete(3));
+
+	uint32_t nPortIndex;
+	bool bIsIncremental;
+	CHECK(s_Discovery.IsFinished(nPortIndex, bIsIncremental));
+
+	printf("Full discovery of %u devices: %.2f s\n", static_cast<unsigned int>(DEVICES_MAX), static_cast<double>(nMicros) / 1e6);
+}
+}  // namespace
+
+int main() {
+	test_full();
+	test_incremental();
+	test_stop();
+	test_mute_time_out();
+	test_table_size();
+
+	return test::result();
+}
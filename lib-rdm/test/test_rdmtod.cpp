@@ -0,0 +1,237 @@
+/**
+ * @file test_rdmtod.cpp
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * Random adds and deletes are checked against std::set, followed by the
+ * UID order, the TOD paging and the mute flags.
+ * The benchmark is the fill and the Exist() lookups of a full table.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <set>
+#include <iterator>
+
+#include "rdmtod.h"
+
+#include "test.h"
+
+namespace {
+static constexpr uint32_t TOD_TABLE_SIZE = rdmtod::TOD_TABLE_SIZE;
+static constexpr uint32_t PAGE_UIDS = 200;	// ArtTodData
+
+static_assert(TOD_TABLE_SIZE >= 1000, "1000+ UIDs per port");
+
+uint64_t s_nSeed = 7;
+
+uint64_t random() {
+	s_nSeed ^= s_nSeed << 13;	// xorshift64
+	s_nSeed ^= s_nSeed >> 7;
+	s_nSeed ^= s_nSeed << 17;
+	return s_nSeed;
+}
+
+void set_uid(const uint64_t nKey, uint8_t *pUid) {
+	rdmtod::key_to_uid(nKey, pUid);
+}
+
+RDMTod s_Tod;
+std::set<uint64_t> s_Reference;
+
+void test_random() {
+	uint32_t nErrors = 0;
+
+	for (uint32_t i = 0; i < 200000; i++) {
+		uint8_t uid[RDM_UID_SIZE];
+
+		if ((random() % 3) != 0) {
+			// A small key space for duplicates
+			const auto nKey = (random() & UINT64_C(0xFFFFFFFFFFF0)) | (random() & 3);
+			set_uid(nKey, uid);
+
+			const auto bExpected = (s_Reference.size() < TOD_TABLE_SIZE) && (s_Reference.count(nKey) == 0);
+
+			if (s_Tod.AddUid(uid) != bExpected) {
+				nErrors++;
+			}
+
+			if (bExpected) {
+				s_Reference.insert(nKey);
+			}
+		} else if (!s_Reference.empty()) {
+			auto it = s_Reference.begin();
+			std::advance(it, static_cast<long>(random() % s_Reference.size()));
+			set_uid(*it, uid);
+
+			if (!s_Tod.Delete(uid)) {
+				nErrors++;
+			}
+
+			s_Reference.erase(it);
+		}
+	}
+
+	CHECK(nErrors == 0);
+	CHECK(s_Tod.GetUidCount() == s_Reference.size());
+
+	uint32_t nIndex = 0;
+	nErrors = 0;
+
+	for (const auto nKey : s_Reference) {
+		uint8_t uid[RDM_UID_SIZE];
+		uint8_t expected[RDM_UID_SIZE];
+		s_Tod.CopyUidEntry(nIndex++, uid);
+		set_uid(nKey, expected);
+
+		if (memcmp(uid, expected, RDM_UID_SIZE) != 0) {
+			nErrors++;
+		}
+	}
+
+	CHECK(nErrors == 0);
+
+	uint8_t uid[RDM_UID_SIZE];
+	CHECK(!s_Tod.CopyUidEntry(s_Tod.GetUidCount(), uid));
+}
+
+void test_full() {
+	while (s_Reference.size() < TOD_TABLE_SIZE) {
+		const auto nKey = random() & rdmtod::UID_MASK;
+
+		if (s_Reference.count(nKey) == 0) {
+			uint8_t uid[RDM_UID_SIZE];
+			set_uid(nKey, uid);
+			CHECK(s_Tod.AddUid(uid));
+			s_Reference.insert(nKey);
+		}
+	}
+
+	uint8_t uid[RDM_UID_SIZE];
+	set_uid(1, uid);
+	CHECK(!s_Tod.AddUid(uid));
+	CHECK(s_Tod.GetUidCount() == TOD_TABLE_SIZE);
+}
+
+void test_paging() {
+	static uint8_t page[PAGE_UIDS * RDM_UID_SIZE];
+	uint32_t nIndex = 0;
+	uint32_t nPages = 0;
+	uint32_t nErrors = 0;
+	auto it = s_Reference.begin();
+
+	while (nIndex < s_Tod.GetUidCount()) {
+		const auto nCount = s_Tod.Copy(page, nIndex, PAGE_UIDS);
+
+		for (uint32_t i = 0; i < nCount; i++, ++it) {
+			uint8_t expected[RDM_UID_SIZE];
+			set_uid(*it, expected);
+
+			if (memcmp(&page[i * RDM_UID_SIZE], expected, RDM_UID_SIZE) != 0) {
+				nErrors++;
+			}
+		}
+
+		nIndex += nCount;
+		nPages++;
+	}
+
+	CHECK(nErrors == 0);
+	CHECK(nPages == (TOD_TABLE_SIZE + PAGE_UIDS - 1) / PAGE_UIDS);
+	CHECK(s_Tod.Copy(page, nIndex, PAGE_UIDS) == 0);
+}
+
+void test_mute() {
+	uint8_t last[RDM_UID_SIZE];
+	set_uid(*s_Reference.rbegin(), last);
+
+	CHECK(s_Tod.Exist(last));
+	CHECK(!s_Tod.IsMuted());
+	s_Tod.Mute();
+
+	// The mute flag moves with the entry
+	uint8_t first[RDM_UID_SIZE];
+	set_uid(*s_Reference.begin(), first);
+	CHECK(s_Tod.Delete(first));
+	CHECK(s_Tod.AddUid(first));
+
+	CHECK(s_Tod.Exist(last));
+	CHECK(s_Tod.IsMuted());
+
+	s_Tod.UnMuteAll();
+	CHECK(s_Tod.Exist(last));
+	CHECK(!s_Tod.IsMuted());
+
+	uint8_t unknown[RDM_UID_SIZE];
+	set_uid(0, unknown);
+	CHECK(!s_Tod.Exist(unknown));
+	CHECK(s_Tod.IsMuted());
+}
+
+void benchmark() {
+	static constexpr uint32_t LOOKUPS = 2000000;
+	static uint64_t keys[TOD_TABLE_SIZE];
+	static RDMTod tod;
+
+	for (auto& nKey : keys) {
+		nKey = random() & UINT64_C(0xFFFFFFFFFFFE);
+	}
+
+	auto nStart = test::nanos();
+
+	for (const auto nKey : keys) {
+		uint8_t uid[RDM_UID_SIZE];
+		set_uid(nKey, uid);
+		tod.AddUid(uid);
+	}
+
+	const auto nFill = test::nanos() - nStart;
+
+	uint32_t nFound = 0;
+	nStart = test::nanos();
+
+	for (uint32_t i = 0; i < LOOKUPS; i++) {
+		uint8_t uid[RDM_UID_SIZE];
+		set_uid(keys[i % TOD_TABLE_SIZE] + (i & 1), uid);	// Half of the lookups miss
+		nFound += tod.Exist(uid) ? 1 : 0;
+	}
+
+	const auto nLookup = test::nanos() - nStart;
+
+	CHECK(nFound == LOOKUPS / 2);
+
+	printf("%u UIDs: fill %.2f ms, Exist() %.1f ns\n", static_cast<unsigned int>(TOD_TABLE_SIZE), static_cast<double>(nFill) / 1e6, static_cast<double>(nLookup) / LOOKUPS);
+}
+}  // namespace
+
+int main() {
+	test_random();
+	test_full();
+	test_paging();
+	test_mute();
+	benchmark();
+
+	return test::result();
+}
@@ -1,18 +1,33 @@
-static constexpr char default_js[] = {
-0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x72, 0x65, 0x73, 0x65, 0x74, 0x28, 0x73,
-0x65, 0x6C, 0x29, 0x20, 0x7B, 0x0A, 0x76, 0x61, 0x72, 0x20, 0x64, 0x20, 0x3D, 0x20, 0x7B, 0x7D,
-0x3B, 0x0A, 0x76, 0x61, 0x72, 0x20, 0x6F, 0x75, 0x74, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x3B, 0x0A,
-0x6F, 0x75, 0x74, 0x5B, 0x73, 0x65, 0x6C, 0x5D, 0x20, 0x3D, 0x20, 0x64, 0x3B, 0x0A, 0x76, 0x61,
-0x72, 0x20, 0x70, 0x61, 0x79, 0x6C, 0x6F, 0x61, 0x64, 0x20, 0x3D, 0x20, 0x4A, 0x53, 0x4F, 0x4E,
-0x2E, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x69, 0x66, 0x79, 0x28, 0x6F, 0x75, 0x74, 0x29, 0x3B,
-0x0A, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x6A, 0x73, 0x6F, 0x6E, 0x27, 0x2C, 0x20,
-0x7B, 0x0A, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x3A, 0x20, 0x27, 0x50, 0x4F, 0x53, 0x54, 0x27,
-0x2C, 0x0A, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x3A, 0x20, 0x7B, 0x0A, 0x27, 0x43, 0x6F,
-0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2D, 0x54, 0x79, 0x70, 0x65, 0x27, 0x3A, 0x20, 0x27, 0x61, 0x70,
-0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F, 0x6A, 0x73, 0x6F, 0x6E, 0x27, 0x0A,
-0x7D, 0x2C, 0x0A, 0x62, 0x6F, 0x64, 0x79, 0x3A, 0x20, 0x70, 0x61, 0x79, 0x6C, 0x6F, 0x61, 0x64,
-0x0A, 0x7D, 0x29, 0x20, 0x2E, 0x74, 0x68, 0x65, 0x6E, 0x28, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E,
-0x73, 0x65, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x69, 0x66, 0x20, 0x28, 0x72, 0x65, 0x73, 0x70, 0x6F,
-0x6E, 0x73, 0x65, 0x2E, 0x6F, 0x6B, 0x29, 0x20, 0x7B, 0x20, 0x67, 0x65, 0x74, 0x5F, 0x74, 0x78,
-0x74, 0x28, 0x73, 0x65, 0x6C, 0x29, 0x3B, 0x20, 0x7D, 0x7D, 0x29, 0x3B, 0x0A, 0x7D, 0x00
-};
+static constexpr char default_js[] =
+"\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x72\x65\x73\x65\x74\x28\x73"
+"\x65\x6C\x29\x20\x7B\x0A\x76\x61\x72\x20\x64\x20\x3D\x20\x7B\x7D"
+"\x3B\x0A\x76\x61\x72\x20\x6F\x75\x74\x20\x3D\x20\x7B\x7D\x3B\x0A"
+"\x6F\x75\x74\x5B\x73\x65\x6C\x5D\x20\x3D\x20\x64\x3B\x0A\x76\x61"
+"\x72\x20\x70\x61\x79\x6C\x6F\x61\x64\x20\x3D\x20\x4A\x53\x4F\x4E"
+"\x2E\x73\x74\x72\x69\x6E\x67\x69\x66\x79\x28\x6F\x75\x74\x29\x3B"
+"\x0A\x66\x65\x74\x63\x68\x28\x27\x2F\x6A\x73\x6F\x6E\x27\x2C\x20"
+"\x7B\x0A\x6D\x65\x74\x68\x6F\x64\x3A\x20\x27\x50\x4F\x53\x54\x27"
+"\x2C\x0A\x68\x65\x61\x64\x65\x72\x73\x3A\x20\x7B\x0A\x27\x43\x6F"
+"\x6E\x74\x65\x6E\x74\x2D\x54\x79\x70\x65\x27\x3A\x20\x27\x61\x70"
+"\x70\x6C\x69\x63\x61\x74\x69\x6F\x6E\x2F\x6A\x73\x6F\x6E\x27\x0A"
+"\x7D\x2C\x0A\x62\x6F\x64\x79\x3A\x20\x70\x61\x79\x6C\x6F\x61\x64"
+"\x0A\x7D\x29\x20\x2E\x74\x68\x65\x6E\x28\x72\x65\x73\x70\x6F\x6E"
+"\x73\x65\x20\x3D\x3E\x20\x7B\x69\x66\x20\x28\x72\x65\x73\x70\x6F"
+"\x6E\x73\x65\x2E\x6F\x6B\x29\x20\x7B\x20\x67\x65\x74\x5F\x74\x78"
+"\x74\x28\x73\x65\x6C\x29\x3B\x20\x7D\x7D\x29\x3B\x0A\x7D"
+;
+static constexpr char default_js_gz[] =
+"\x1F\x8B\x08\x00\x00\x00\x00\x00\x02\x03\x3D\x4F\x31\x8E\xC2\x30"
+"\x10\xEC\xFD\x8A\xED\x9C\x48\xB9\x5C\x9F\x08\x9A\xEB\xAE\x80\x93"
+"\xA0\x3B\x21\x64\xE2\x0D\x31\xE4\xBC\x56\xBC\x20\xA2\xC8\x7F\x67"
+"\x21\x70\xDD\xCC\xCE\x68\x76\xA6\xBD\xF8\x86\x1D\x79\x18\x30\x22"
+"\x67\x11\xFB\x1C\x26\x75\x35\x03\x58\x58\xC0\x94\xEA\x27\xA6\x0B"
+"\xBF\x98\xA0\x5F\x31\xED\x84\xDA\x59\x0B\x66\xEC\xC9\x3C\xDC\xDF"
+"\x9B\xF5\xAA\x8C\x3C\x38\x7F\x74\xED\x98\x89\x35\xAF\x55\x8B\xDC"
+"\x74\x99\xFE\x3C\x45\xF2\xBA\x90\xEC\x3F\xE4\x8E\x6C\x05\xFA\x67"
+"\xBD\xD9\xEA\x42\x75\x68\x2C\x0E\xB1\x12\x49\x7F\x91\x67\xF4\xFC"
+"\xB1\x1D\x03\x6A\xB1\x98\x10\x7A\xD7\x98\x47\xC1\x39\x40\xA5\x42"
+"\x1D\xC8\x8E\xD5\xFB\xAD\x4A\x39\x94\xDC\xA1\xCF\x64\x40\x20\x1F"
+"\x11\x16\x4B\x98\x5C\x0B\xFF\x87\x92\xCE\xB2\x09\x8E\xC8\x7B\xBE"
+"\xCD\x13\x6B\x48\x49\xBA\xA5\x3B\x57\x00\x60\x78\xFE\x00\x00\x00"
+;
@@ -1,88 +1,126 @@
-static constexpr char dmx_js[] = {
-0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x72,
-0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x74, 0x72, 0x79, 0x20, 0x7B,
-0x0A, 0x6C, 0x65, 0x74, 0x20, 0x64, 0x3D, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x67, 0x65, 0x74,
-0x4A, 0x53, 0x4F, 0x4E, 0x28, 0x27, 0x64, 0x6D, 0x78, 0x2F, 0x70, 0x6F, 0x72, 0x74, 0x73, 0x74,
-0x61, 0x74, 0x75, 0x73, 0x27, 0x29, 0x0A, 0x6C, 0x65, 0x74, 0x20, 0x68, 0x64, 0x72, 0x73, 0x3D,
-0x27, 0x3C, 0x74, 0x72, 0x3E, 0x27, 0x0A, 0x6C, 0x65, 0x74, 0x20, 0x74, 0x64, 0x64, 0x3D, 0x27,
-0x3C, 0x74, 0x72, 0x3E, 0x27, 0x0A, 0x64, 0x2E, 0x66, 0x6F, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28,
-0x69, 0x74, 0x65, 0x6D, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x68, 0x64, 0x72, 0x73, 0x2B, 0x3D,
-0x60, 0x3C, 0x74, 0x68, 0x3E, 0x24, 0x7B, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x70, 0x6F, 0x72, 0x74,
-0x7D, 0x3C, 0x2F, 0x74, 0x68, 0x3E, 0x60, 0x0A, 0x74, 0x64, 0x64, 0x2B, 0x3D, 0x60, 0x3C, 0x74,
-0x64, 0x3E, 0x24, 0x7B, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69,
-0x6F, 0x6E, 0x7D, 0x3C, 0x2F, 0x74, 0x64, 0x3E, 0x60, 0x0A, 0x7D, 0x29, 0x3B, 0x0A, 0x64, 0x6F,
-0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E,
-0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x69, 0x64, 0x53, 0x74, 0x61, 0x74, 0x73, 0x22, 0x29,
-0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x3D, 0x68, 0x64, 0x72, 0x73, 0x2B,
-0x27, 0x3C, 0x2F, 0x74, 0x72, 0x3E, 0x27, 0x2B, 0x74, 0x64, 0x64, 0x2B, 0x27, 0x3C, 0x2F, 0x74,
-0x72, 0x3E, 0x27, 0x0A, 0x6C, 0x65, 0x74, 0x20, 0x74, 0x72, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61,
-0x69, 0x74, 0x20, 0x50, 0x72, 0x6F, 0x6D, 0x69, 0x73, 0x65, 0x2E, 0x61, 0x6C, 0x6C, 0x28, 0x0A,
-0x64, 0x2E, 0x6D, 0x61, 0x70, 0x28, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x3D, 0x3E, 0x20, 0x67, 0x65,
-0x74, 0x4A, 0x53, 0x4F, 0x4E, 0x28, 0x27, 0x64, 0x6D, 0x78, 0x2F, 0x73, 0x74, 0x61, 0x74, 0x75,
-0x73, 0x3F, 0x27, 0x20, 0x2B, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x70, 0x6F, 0x72, 0x74, 0x29,
-0x2E, 0x74, 0x68, 0x65, 0x6E, 0x28, 0x72, 0x65, 0x73, 0x70, 0x20, 0x3D, 0x3E, 0x20, 0x28, 0x7B,
-0x0A, 0x70, 0x6F, 0x72, 0x74, 0x3A, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x70, 0x6F, 0x72, 0x74,
-0x2C, 0x0A, 0x64, 0x3A, 0x20, 0x7B, 0x20, 0x73, 0x65, 0x6E, 0x74, 0x3A, 0x20, 0x72, 0x65, 0x73,
-0x70, 0x2E, 0x64, 0x6D, 0x78, 0x2E, 0x73, 0x65, 0x6E, 0x74, 0x2C, 0x20, 0x72, 0x65, 0x63, 0x65,
-0x69, 0x76, 0x65, 0x64, 0x3A, 0x20, 0x72, 0x65, 0x73, 0x70, 0x2E, 0x64, 0x6D, 0x78, 0x2E, 0x72,
-0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x20, 0x7D, 0x2C, 0x0A, 0x72, 0x3A, 0x20, 0x7B, 0x0A,
-0x73, 0x65, 0x6E, 0x74, 0x3A, 0x20, 0x7B, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3A, 0x20, 0x72,
-0x65, 0x73, 0x70, 0x2E, 0x72, 0x64, 0x6D, 0x2E, 0x73, 0x65, 0x6E, 0x74, 0x2E, 0x63, 0x6C, 0x61,
-0x73, 0x73, 0x2C, 0x20, 0x64, 0x69, 0x73, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x3A, 0x20, 0x72,
-0x65, 0x73, 0x70, 0x2E, 0x72, 0x64, 0x6D, 0x2E, 0x73, 0x65, 0x6E, 0x74, 0x2E, 0x64, 0x69, 0x73,
-0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x20, 0x7D, 0x2C, 0x0A, 0x72, 0x65, 0x63, 0x65, 0x69, 0x76,
-0x65, 0x64, 0x3A, 0x20, 0x7B, 0x20, 0x67, 0x6F, 0x6F, 0x64, 0x3A, 0x20, 0x72, 0x65, 0x73, 0x70,
-0x2E, 0x72, 0x64, 0x6D, 0x2E, 0x72, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x2E, 0x67, 0x6F,
-0x6F, 0x64, 0x2C, 0x20, 0x62, 0x61, 0x64, 0x3A, 0x20, 0x72, 0x65, 0x73, 0x70, 0x2E, 0x72, 0x64,
-0x6D, 0x2E, 0x72, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x2E, 0x62, 0x61, 0x64, 0x2C, 0x20,
-0x64, 0x69, 0x73, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x3A, 0x20, 0x72, 0x65, 0x73, 0x70, 0x2E,
-0x72, 0x64, 0x6D, 0x2E, 0x72, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x2E, 0x64, 0x69, 0x73,
-0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x0A, 0x7D, 0x7D, 0x7D, 0x29, 0x29, 0x29, 0x29, 0x3B, 0x0A,
-0x74, 0x72, 0x2E, 0x73, 0x6F, 0x72, 0x74, 0x28, 0x28, 0x61, 0x2C, 0x20, 0x62, 0x29, 0x20, 0x3D,
-0x3E, 0x20, 0x7B, 0x0A, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x64, 0x2E, 0x66, 0x69, 0x6E,
-0x64, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x28, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x3D, 0x3E, 0x20, 0x69,
-0x74, 0x65, 0x6D, 0x2E, 0x70, 0x6F, 0x72, 0x74, 0x20, 0x3D, 0x3D, 0x3D, 0x20, 0x61, 0x2E, 0x70,
-0x6F, 0x72, 0x74, 0x29, 0x20, 0x2D, 0x20, 0x64, 0x2E, 0x66, 0x69, 0x6E, 0x64, 0x49, 0x6E, 0x64,
-0x65, 0x78, 0x28, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x3D, 0x3E, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x2E,
-0x70, 0x6F, 0x72, 0x74, 0x20, 0x3D, 0x3D, 0x3D, 0x20, 0x62, 0x2E, 0x70, 0x6F, 0x72, 0x74, 0x29,
-0x0A, 0x7D, 0x29, 0x3B, 0x0A, 0x68, 0x64, 0x72, 0x73, 0x3D, 0x27, 0x3C, 0x74, 0x72, 0x3E, 0x3C,
-0x74, 0x68, 0x20, 0x72, 0x6F, 0x77, 0x73, 0x70, 0x61, 0x6E, 0x3D, 0x22, 0x33, 0x22, 0x3E, 0x50,
-0x6F, 0x72, 0x74, 0x3C, 0x2F, 0x74, 0x68, 0x3E, 0x3C, 0x74, 0x68, 0x20, 0x63, 0x6F, 0x6C, 0x73,
-0x70, 0x61, 0x6E, 0x3D, 0x22, 0x32, 0x22, 0x3E, 0x44, 0x4D, 0x58, 0x3C, 0x2F, 0x74, 0x68, 0x3E,
-0x3C, 0x74, 0x68, 0x20, 0x63, 0x6F, 0x6C, 0x73, 0x70, 0x61, 0x6E, 0x3D, 0x22, 0x35, 0x22, 0x3E,
-0x52, 0x44, 0x4D, 0x3C, 0x2F, 0x74, 0x68, 0x3E, 0x3C, 0x2F, 0x74, 0x72, 0x3E, 0x3C, 0x74, 0x72,
-0x3E, 0x3C, 0x74, 0x68, 0x20, 0x72, 0x6F, 0x77, 0x73, 0x70, 0x61, 0x6E, 0x3D, 0x22, 0x32, 0x22,
-0x3E, 0x53, 0x65, 0x6E, 0x74, 0x3C, 0x2F, 0x74, 0x68, 0x3E, 0x3C, 0x74, 0x68, 0x20, 0x72, 0x6F,
-0x77, 0x73, 0x70, 0x61, 0x6E, 0x3D, 0x22, 0x32, 0x22, 0x3E, 0x52, 0x65, 0x63, 0x65, 0x69, 0x76,
-0x65, 0x64, 0x3C, 0x2F, 0x74, 0x68, 0x3E, 0x3C, 0x74, 0x68, 0x20, 0x63, 0x6F, 0x6C, 0x73, 0x70,
-0x61, 0x6E, 0x3D, 0x22, 0x32, 0x22, 0x3E, 0x53, 0x65, 0x6E, 0x74, 0x3C, 0x2F, 0x74, 0x68, 0x3E,
-0x3C, 0x74, 0x68, 0x20, 0x63, 0x6F, 0x6C, 0x73, 0x70, 0x61, 0x6E, 0x3D, 0x22, 0x33, 0x22, 0x3E,
-0x52, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x3C, 0x2F, 0x74, 0x68, 0x3E, 0x3C, 0x2F, 0x74,
-0x72, 0x3E, 0x3C, 0x74, 0x72, 0x3E, 0x3C, 0x74, 0x68, 0x3E, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x3C,
-0x2F, 0x74, 0x68, 0x3E, 0x3C, 0x74, 0x68, 0x3E, 0x44, 0x69, 0x73, 0x63, 0x6F, 0x76, 0x65, 0x72,
-0x79, 0x3C, 0x2F, 0x74, 0x68, 0x3E, 0x3C, 0x74, 0x68, 0x3E, 0x47, 0x6F, 0x6F, 0x64, 0x3C, 0x2F,
-0x74, 0x68, 0x3E, 0x3C, 0x74, 0x68, 0x3E, 0x42, 0x61, 0x64, 0x3C, 0x2F, 0x74, 0x68, 0x3E, 0x3C,
-0x74, 0x68, 0x3E, 0x44, 0x69, 0x73, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x3C, 0x2F, 0x74, 0x68,
-0x3E, 0x3C, 0x2F, 0x74, 0x72, 0x3E, 0x27, 0x0A, 0x74, 0x64, 0x64, 0x3D, 0x27, 0x27, 0x0A, 0x74,
-0x72, 0x2E, 0x66, 0x6F, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x70, 0x20, 0x3D, 0x3E, 0x20, 0x7B,
-0x0A, 0x74, 0x64, 0x64, 0x2B, 0x3D, 0x60, 0x3C, 0x74, 0x72, 0x3E, 0x3C, 0x74, 0x64, 0x3E, 0x24,
-0x7B, 0x70, 0x2E, 0x70, 0x6F, 0x72, 0x74, 0x7D, 0x3C, 0x2F, 0x74, 0x64, 0x3E, 0x3C, 0x74, 0x64,
-0x3E, 0x24, 0x7B, 0x70, 0x2E, 0x64, 0x2E, 0x73, 0x65, 0x6E, 0x74, 0x7D, 0x3C, 0x2F, 0x74, 0x64,
-0x3E, 0x3C, 0x74, 0x64, 0x3E, 0x24, 0x7B, 0x70, 0x2E, 0x64, 0x2E, 0x72, 0x65, 0x63, 0x65, 0x69,
-0x76, 0x65, 0x64, 0x7D, 0x3C, 0x2F, 0x74, 0x64, 0x3E, 0x3C, 0x74, 0x64, 0x3E, 0x24, 0x7B, 0x70,
-0x2E, 0x72, 0x2E, 0x73, 0x65, 0x6E, 0x74, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x7D, 0x3C, 0x2F,
-0x74, 0x64, 0x3E, 0x3C, 0x74, 0x64, 0x3E, 0x24, 0x7B, 0x70, 0x2E, 0x72, 0x2E, 0x73, 0x65, 0x6E,
-0x74, 0x2E, 0x64, 0x69, 0x73, 0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x7D, 0x3C, 0x2F, 0x74, 0x64,
-0x3E, 0x3C, 0x74, 0x64, 0x3E, 0x24, 0x7B, 0x70, 0x2E, 0x72, 0x2E, 0x72, 0x65, 0x63, 0x65, 0x69,
-0x76, 0x65, 0x64, 0x2E, 0x67, 0x6F, 0x6F, 0x64, 0x7D, 0x3C, 0x2F, 0x74, 0x64, 0x3E, 0x3C, 0x74,
-0x64, 0x3E, 0x24, 0x7B, 0x70, 0x2E, 0x72, 0x2E, 0x72, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64,
-0x2E, 0x62, 0x61, 0x64, 0x7D, 0x3C, 0x2F, 0x74, 0x64, 0x3E, 0x3C, 0x74, 0x64, 0x3E, 0x24, 0x7B,
-0x70, 0x2E, 0x72, 0x2E, 0x72, 0x65, 0x63, 0x65, 0x69, 0x76, 0x65, 0x64, 0x2E, 0x64, 0x69, 0x73,
-0x63, 0x6F, 0x76, 0x65, 0x72, 0x79, 0x7D, 0x3C, 0x2F, 0x74, 0x64, 0x3E, 0x3C, 0x2F, 0x74, 0x72,
-0x3E, 0x60, 0x3B, 0x0A, 0x7D, 0x29, 0x3B, 0x0A, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74,
-0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28,
-0x22, 0x69, 0x64, 0x50, 0x6F, 0x72, 0x74, 0x73, 0x22, 0x29, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72,
-0x48, 0x54, 0x4D, 0x4C, 0x3D, 0x68, 0x64, 0x72, 0x73, 0x2B, 0x74, 0x64, 0x64, 0x0A, 0x7D, 0x20,
-0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x28, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x29, 0x7B, 0x7D, 0x0A,
-0x7D, 0x00
-};
+static constexpr char dmx_js[] =
+"\x61\x73\x79\x6E\x63\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x72"
+"\x65\x66\x72\x65\x73\x68\x28\x29\x20\x7B\x0A\x74\x72\x79\x20\x7B"
+"\x0A\x6C\x65\x74\x20\x64\x3D\x61\x77\x61\x69\x74\x20\x67\x65\x74"
+"\x4A\x53\x4F\x4E\x28\x27\x64\x6D\x78\x2F\x70\x6F\x72\x74\x73\x74"
+"\x61\x74\x75\x73\x27\x29\x0A\x6C\x65\x74\x20\x68\x64\x72\x73\x3D"
+"\x27\x3C\x74\x72\x3E\x27\x0A\x6C\x65\x74\x20\x74\x64\x64\x3D\x27"
+"\x3C\x74\x72\x3E\x27\x0A\x64\x2E\x66\x6F\x72\x45\x61\x63\x68\x28"
+"\x69\x74\x65\x6D\x20\x3D\x3E\x20\x7B\x0A\x68\x64\x72\x73\x2B\x3D"
+"\x60\x3C\x74\x68\x3E\x24\x7B\x69\x74\x65\x6D\x2E\x70\x6F\x72\x74"
+"\x7D\x3C\x2F\x74\x68\x3E\x60\x0A\x74\x64\x64\x2B\x3D\x60\x3C\x74"
+"\x64\x3E\x24\x7B\x69\x74\x65\x6D\x2E\x64\x69\x72\x65\x63\x74\x69"
+"\x6F\x6E\x7D\x3C\x2F\x74\x64\x3E\x60\x0A\x7D\x29\x3B\x0A\x64\x6F"
+"\x63\x75\x6D\x65\x6E\x74\x2E\x67\x65\x74\x45\x6C\x65\x6D\x65\x6E"
+"\x74\x42\x79\x49\x64\x28\x22\x69\x64\x53\x74\x61\x74\x73\x22\x29"
+"\x2E\x69\x6E\x6E\x65\x72\x48\x54\x4D\x4C\x3D\x68\x64\x72\x73\x2B"
+"\x27\x3C\x2F\x74\x72\x3E\x27\x2B\x74\x64\x64\x2B\x27\x3C\x2F\x74"
+"\x72\x3E\x27\x0A\x6C\x65\x74\x20\x74\x72\x20\x3D\x20\x61\x77\x61"
+"\x69\x74\x20\x50\x72\x6F\x6D\x69\x73\x65\x2E\x61\x6C\x6C\x28\x0A"
+"\x64\x2E\x6D\x61\x70\x28\x69\x74\x65\x6D\x20\x3D\x3E\x20\x67\x65"
+"\x74\x4A\x53\x4F\x4E\x28\x27\x64\x6D\x78\x2F\x73\x74\x61\x74\x75"
+"\x73\x3F\x27\x20\x2B\x20\x69\x74\x65\x6D\x2E\x70\x6F\x72\x74\x29"
+"\x2E\x74\x68\x65\x6E\x28\x72\x65\x73\x70\x20\x3D\x3E\x20\x28\x7B"
+"\x0A\x70\x6F\x72\x74\x3A\x20\x69\x74\x65\x6D\x2E\x70\x6F\x72\x74"
+"\x2C\x0A\x64\x3A\x20\x7B\x20\x73\x65\x6E\x74\x3A\x20\x72\x65\x73"
+"\x70\x2E\x64\x6D\x78\x2E\x73\x65\x6E\x74\x2C\x20\x72\x65\x63\x65"
+"\x69\x76\x65\x64\x3A\x20\x72\x65\x73\x70\x2E\x64\x6D\x78\x2E\x72"
+"\x65\x63\x65\x69\x76\x65\x64\x20\x7D\x2C\x0A\x72\x3A\x20\x7B\x0A"
+"\x73\x65\x6E\x74\x3A\x20\x7B\x20\x63\x6C\x61\x73\x73\x3A\x20\x72"
+"\x65\x73\x70\x2E\x72\x64\x6D\x2E\x73\x65\x6E\x74\x2E\x63\x6C\x61"
+"\x73\x73\x2C\x20\x64\x69\x73\x63\x6F\x76\x65\x72\x79\x3A\x20\x72"
+"\x65\x73\x70\x2E\x72\x64\x6D\x2E\x73\x65\x6E\x74\x2E\x64\x69\x73"
+"\x63\x6F\x76\x65\x72\x79\x20\x7D\x2C\x0A\x72\x65\x63\x65\x69\x76"
+"\x65\x64\x3A\x20\x7B\x20\x67\x6F\x6F\x64\x3A\x20\x72\x65\x73\x70"
+"\x2E\x72\x64\x6D\x2E\x72\x65\x63\x65\x69\x76\x65\x64\x2E\x67\x6F"
+"\x6F\x64\x2C\x20\x62\x61\x64\x3A\x20\x72\x65\x73\x70\x2E\x72\x64"
+"\x6D\x2E\x72\x65\x63\x65\x69\x76\x65\x64\x2E\x62\x61\x64\x2C\x20"
+"\x64\x69\x73\x63\x6F\x76\x65\x72\x79\x3A\x20\x72\x65\x73\x70\x2E"
+"\x72\x64\x6D\x2E\x72\x65\x63\x65\x69\x76\x65\x64\x2E\x64\x69\x73"
+"\x63\x6F\x76\x65\x72\x79\x0A\x7D\x7D\x7D\x29\x29\x29\x29\x3B\x0A"
+"\x74\x72\x2E\x73\x6F\x72\x74\x28\x28\x61\x2C\x20\x62\x29\x20\x3D"
+"\x3E\x20\x7B\x0A\x72\x65\x74\x75\x72\x6E\x20\x64\x2E\x66\x69\x6E"
+"\x64\x49\x6E\x64\x65\x78\x28\x69\x74\x65\x6D\x20\x3D\x3E\x20\x69"
+"\x74\x65\x6D\x2E\x70\x6F\x72\x74\x20\x3D\x3D\x3D\x20\x61\x2E\x70"
+"\x6F\x72\x74\x29\x20\x2D\x20\x64\x2E\x66\x69\x6E\x64\x49\x6E\x64"
+"\x65\x78\x28\x69\x74\x65\x6D\x20\x3D\x3E\x20\x69\x74\x65\x6D\x2E"
+"\x70\x6F\x72\x74\x20\x3D\x3D\x3D\x20\x62\x2E\x70\x6F\x72\x74\x29"
+"\x0A\x7D\x29\x3B\x0A\x68\x64\x72\x73\x3D\x27\x3C\x74\x72\x3E\x3C"
+"\x74\x68\x20\x72\x6F\x77\x73\x70\x61\x6E\x3D\x22\x33\x22\x3E\x50"
+"\x6F\x72\x74\x3C\x2F\x74\x68\x3E\x3C\x74\x68\x20\x63\x6F\x6C\x73"
+"\x70\x61\x6E\x3D\x22\x32\x22\x3E\x44\x4D\x58\x3C\x2F\x74\x68\x3E"
+"\x3C\x74\x68\x20\x63\x6F\x6C\x73\x70\x61\x6E\x3D\x22\x35\x22\x3E"
+"\x52\x44\x4D\x3C\x2F\x74\x68\x3E\x3C\x2F\x74\x72\x3E\x3C\x74\x72"
+"\x3E\x3C\x74\x68\x20\x72\x6F\x77\x73\x70\x61\x6E\x3D\x22\x32\x22"
+"\x3E\x53\x65\x6E\x74\x3C\x2F\x74\x68\x3E\x3C\x74\x68\x20\x72\x6F"
+"\x77\x73\x70\x61\x6E\x3D\x22\x32\x22\x3E\x52\x65\x63\x65\x69\x76"
+"\x65\x64\x3C\x2F\x74\x68\x3E\x3C\x74\x68\x20\x63\x6F\x6C\x73\x70"
+"\x61\x6E\x3D\x22\x32\x22\x3E\x53\x65\x6E\x74\x3C\x2F\x74\x68\x3E"
+"\x3C\x74\x68\x20\x63\x6F\x6C\x73\x70\x61\x6E\x3D\x22\x33\x22\x3E"
+"\x52\x65\x63\x65\x69\x76\x65\x64\x3C\x2F\x74\x68\x3E\x3C\x2F\x74"
+"\x72\x3E\x3C\x74\x72\x3E\x3C\x74\x68\x3E\x43\x6C\x61\x73\x73\x3C"
+"\x2F\x74\x68\x3E\x3C\x74\x68\x3E\x44\x69\x73\x63\x6F\x76\x65\x72"
+"\x79\x3C\x2F\x74\x68\x3E\x3C\x74\x68\x3E\x47\x6F\x6F\x64\x3C\x2F"
+"\x74\x68\x3E\x3C\x74\x68\x3E\x42\x61\x64\x3C\x2F\x74\x68\x3E\x3C"
+"\x74\x68\x3E\x44\x69\x73\x63\x6F\x76\x65\x72\x79\x3C\x2F\x74\x68"
+"\x3E\x3C\x2F\x74\x72\x3E\x27\x0A\x74\x64\x64\x3D\x27\x27\x0A\x74"
+"\x72\x2E\x66\x6F\x72\x45\x61\x63\x68\x28\x70\x20\x3D\x3E\x20\x7B"
+"\x0A\x74\x64\x64\x2B\x3D\x60\x3C\x74\x72\x3E\x3C\x74\x64\x3E\x24"
+"\x7B\x70\x2E\x70\x6F\x72\x74\x7D\x3C\x2F\x74\x64\x3E\x3C\x74\x64"
+"\x3E\x24\x7B\x70\x2E\x64\x2E\x73\x65\x6E\x74\x7D\x3C\x2F\x74\x64"
+"\x3E\x3C\x74\x64\x3E\x24\x7B\x70\x2E\x64\x2E\x72\x65\x63\x65\x69"
+"\x76\x65\x64\x7D\x3C\x2F\x74\x64\x3E\x3C\x74\x64\x3E\x24\x7B\x70"
+"\x2E\x72\x2E\x73\x65\x6E\x74\x2E\x63\x6C\x61\x73\x73\x7D\x3C\x2F"
+"\x74\x64\x3E\x3C\x74\x64\x3E\x24\x7B\x70\x2E\x72\x2E\x73\x65\x6E"
+"\x74\x2E\x64\x69\x73\x63\x6F\x76\x65\x72\x79\x7D\x3C\x2F\x74\x64"
+"\x3E\x3C\x74\x64\x3E\x24\x7B\x70\x2E\x72\x2E\x72\x65\x63\x65\x69"
+"\x76\x65\x64\x2E\x67\x6F\x6F\x64\x7D\x3C\x2F\x74\x64\x3E\x3C\x74"
+"\x64\x3E\x24\x7B\x70\x2E\x72\x2E\x72\x65\x63\x65\x69\x76\x65\x64"
+"\x2E\x62\x61\x64\x7D\x3C\x2F\x74\x64\x3E\x3C\x74\x64\x3E\x24\x7B"
+"\x70\x2E\x72\x2E\x72\x65\x63\x65\x69\x76\x65\x64\x2E\x64\x69\x73"
+"\x63\x6F\x76\x65\x72\x79\x7D\x3C\x2F\x74\x64\x3E\x3C\x2F\x74\x72"
+"\x3E\x60\x3B\x0A\x7D\x29\x3B\x0A\x64\x6F\x63\x75\x6D\x65\x6E\x74"
+"\x2E\x67\x65\x74\x45\x6C\x65\x6D\x65\x6E\x74\x42\x79\x49\x64\x28"
+"\x22\x69\x64\x50\x6F\x72\x74\x73\x22\x29\x2E\x69\x6E\x6E\x65\x72"
+"\x48\x54\x4D\x4C\x3D\x68\x64\x72\x73\x2B\x74\x64\x64\x0A\x7D\x20"
+"\x63\x61\x74\x63\x68\x20\x28\x65\x72\x72\x6F\x72\x29\x7B\x7D\x0A"
+"\x7D"
+;
+static constexpr char dmx_js_gz[] =
+"\x1F\x8B\x08\x00\x00\x00\x00\x00\x02\x03\x8D\x54\x5D\x6F\x9B\x30"
+"\x14\x7D\xE7\x57\x5C\xA1\x49\x80\x92\x11\x69\xD5\x5E\x92\xC0\xA4"
+"\x2E\xD5\xD6\x69\xDD\xAA\x66\x0F\x7B\x8C\x8B\x9D\x82\x04\x36\xB2"
+"\x9D\xB6\x11\xE2\xBF\xEF\xDA\x0E\x6E\xC2\x12\x6D\x79\x88\xF0\x39"
+"\xE7\x7E\x70\x7D\x2E\x44\xED\x79\x01\xDB\x1D\x2F\x74\x25\x38\x48"
+"\xB6\x95\x4C\x95\x71\x02\x5D\xA0\xE5\x1E\xFF\x6B\xA6\x81\x66\xE4"
+"\x85\x54\x1A\x9E\x98\xFE\xB6\xFE\xF9\x23\x8E\x68\xF3\x3A\x6B\x85"
+"\xD4\x4A\x13\xBD\x53\x51\x62\x55\x25\x95\x2A\x8B\x96\x5A\xE6\x91"
+"\x3D\x6B\x4A\x87\x23\x4D\xB7\x42\xDE\x90\xA2\x8C\x2B\xCD\x1A\xC8"
+"\x72\x4C\x6C\xE4\x93\x6C\xB3\xD4\x65\xFE\xAE\x33\x70\x6A\x32\xF6"
+"\xCB\x19\x02\x9B\x00\x83\x2D\x49\x07\x92\x56\x92\xD9\x1E\x8D\x82"
+"\xA2\xA2\x4F\x16\x01\x15\xC5\xAE\x61\x5C\xA7\xD8\xD9\x4D\xCD\xCC"
+"\xE3\xF5\xFE\x96\xC6\x61\x45\xD7\xD8\x9A\x0A\x93\xB4\xE2\x9C\xC9"
+"\xAF\xBF\xEE\xBE\x67\xB6\x60\x84\xD1\xD8\xD1\xC4\xE4\x3F\x3C\xBB"
+"\x66\x25\x64\xE0\xDE\xF2\x5E\x8A\xA6\x52\x2C\x25\x75\x1D\x63\xE7"
+"\x0D\x69\x7D\xD7\x27\x03\x70\x2F\xFF\x29\x82\x09\xF8\xF6\x93\x54"
+"\x97\x8C\xC7\x38\xC3\xD6\xE8\xE3\x2E\x30\xE8\xFC\x4D\x30\x0D\xE8"
+"\x1C\x3A\x50\xD8\xE9\x1C\x8C\x2C\xC5\x54\xA9\x39\x4E\xF1\x58\xB0"
+"\xEA\x99\xD1\x23\x62\x80\xA0\x9F\x06\x12\x03\x03\x17\xD8\x41\x51"
+"\x13\xA5\x0E\x42\x49\x1B\x9B\x21\xB5\xE0\x14\x68\xA5\x0A\xF1\xCC"
+"\xE4\x7E\xCC\x7B\xC2\xA6\xF3\xD5\x3A\x78\x12\x82\x1E\x89\x07\x2A"
+"\x35\xF8\x14\x1E\xC9\x59\x12\xE1\xF3\xB5\xBC\xC2\x93\x41\xDF\xF7"
+"\x09\xFE\x16\x68\xAA\x54\xE1\x18\xE2\x98\x60\xDE\xC4\x39\x41\x32"
+"\xBD\x93\x1C\xD0\x24\x15\xA7\xB7\x9C\xB2\x57\x3F\x70\x3F\x37\xC8"
+"\x32\xBC\x1F\x37\x63\x78\xFF\x1F\xDA\x47\xA7\xB5\x36\x79\x73\x26"
+"\xBA\x0D\xA4\x78\x51\x2D\xE1\x59\x78\x15\xE6\xF7\xA8\xB1\x8E\x33"
+"\x44\x21\x6A\x47\x7C\x08\xF3\xD5\xDD\xEF\xBF\xF1\x8F\x61\xFE\xB0"
+"\xBA\x73\xF8\xCC\x66\x1B\x65\xC4\xC0\x35\x0E\xDA\x47\x1E\x13\x0F"
+"\x87\xA9\x9C\x2D\x77\x12\xE5\x89\xAB\x71\xD4\x51\xD1\xFC\xB3\xB9"
+"\xEC\x21\x26\x5F\x0D\xA3\xF6\xC8\x17\xBC\x3B\x7F\xB8\x26\xF4\x92"
+"\xD4\xED\x80\x5D\xD6\xC8\x5C\xCF\xB0\xA9\xAD\xBB\x9C\x61\x11\x4D"
+"\x51\xB3\x8C\xAD\x5F\x53\xEA\x11\x6A\xED\x35\xC6\x06\x1B\x9C\xE2"
+"\xF2\xC8\xAA\x67\x19\x6F\x9A\x31\x7B\xE2\xCA\x8B\x24\xBA\xF2\x22"
+"\x37\x4E\x6D\x5E\x7D\xB3\xF8\xD7\x97\xC4\x78\xE4\xCC\x97\x04\x07"
+"\x13\xF4\x50\x10\x5D\x94\x10\x33\x29\x85\x4C\xBA\x3E\xE8\xFF\x00"
+"\xD4\x61\x89\xD8\x51\x05\x00\x00"
+;
@@ -1,30 +1,49 @@
-static constexpr char dsa_html[] = {
-0x3C, 0x21, 0x44, 0x4F, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x0A,
-0x3C, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x0A, 0x3C, 0x68, 0x65, 0x61, 0x64, 0x3E, 0x0A, 0x3C, 0x6C,
-0x69, 0x6E, 0x6B, 0x20, 0x72, 0x65, 0x6C, 0x3D, 0x22, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x73, 0x68,
-0x65, 0x65, 0x74, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x73, 0x74, 0x79, 0x6C, 0x65,
-0x73, 0x2E, 0x63, 0x73, 0x73, 0x22, 0x20, 0x2F, 0x3E, 0x0A, 0x3C, 0x74, 0x69, 0x74, 0x6C, 0x65,
-0x3E, 0x3C, 0x2F, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x3E, 0x0A, 0x3C, 0x2F, 0x68, 0x65, 0x61, 0x64,
-0x3E, 0x0A, 0x3C, 0x62, 0x6F, 0x64, 0x79, 0x3E, 0x0A, 0x3C, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72,
-0x3E, 0x3C, 0x75, 0x6C, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x69, 0x64, 0x4C, 0x69, 0x73, 0x74, 0x22,
-0x3E, 0x3C, 0x2F, 0x75, 0x6C, 0x3E, 0x3C, 0x2F, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x3E, 0x0A,
-0x3C, 0x70, 0x3E, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69,
-0x63, 0x6B, 0x3D, 0x22, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x28, 0x29, 0x22, 0x3E, 0x52,
-0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x3C,
-0x2F, 0x70, 0x3E, 0x0A, 0x3C, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x69,
-0x64, 0x54, 0x78, 0x74, 0x22, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3D, 0x27, 0x31, 0x27,
-0x3E, 0x3C, 0x2F, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x3E, 0x0A, 0x3C, 0x66, 0x6F, 0x6F, 0x74, 0x65,
-0x72, 0x3E, 0x3C, 0x75, 0x6C, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x69, 0x64, 0x56, 0x65, 0x72, 0x73,
-0x69, 0x6F, 0x6E, 0x22, 0x3E, 0x3C, 0x2F, 0x75, 0x6C, 0x3E, 0x3C, 0x2F, 0x66, 0x6F, 0x6F, 0x74,
-0x65, 0x72, 0x3E, 0x0A, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D,
-0x22, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2E, 0x6A, 0x73, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65,
-0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2F, 0x6A, 0x61, 0x76, 0x61, 0x73, 0x63, 0x72, 0x69, 0x70,
-0x74, 0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x73, 0x63,
-0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D, 0x22, 0x64, 0x73, 0x61, 0x2E, 0x6A, 0x73,
-0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2F, 0x6A, 0x61, 0x76,
-0x61, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70,
-0x74, 0x3E, 0x0A, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x6C, 0x69, 0x73, 0x74, 0x28,
-0x29, 0x3B, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x3B, 0x72, 0x65, 0x66, 0x72,
-0x65, 0x73, 0x68, 0x28, 0x29, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C,
-0x2F, 0x62, 0x6F, 0x64, 0x79, 0x3E, 0x0A, 0x3C, 0x2F, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x0A, 0x00
-};
+static constexpr char dsa_html[] =
+"\x3C\x21\x44\x4F\x43\x54\x59\x50\x45\x20\x68\x74\x6D\x6C\x3E\x0A"
+"\x3C\x68\x74\x6D\x6C\x3E\x0A\x3C\x68\x65\x61\x64\x3E\x0A\x3C\x6C"
+"\x69\x6E\x6B\x20\x72\x65\x6C\x3D\x22\x73\x74\x79\x6C\x65\x73\x68"
+"\x65\x65\x74\x22\x20\x68\x72\x65\x66\x3D\x22\x73\x74\x79\x6C\x65"
+"\x73\x2E\x63\x73\x73\x22\x20\x2F\x3E\x0A\x3C\x74\x69\x74\x6C\x65"
+"\x3E\x3C\x2F\x74\x69\x74\x6C\x65\x3E\x0A\x3C\x2F\x68\x65\x61\x64"
+"\x3E\x0A\x3C\x62\x6F\x64\x79\x3E\x0A\x3C\x68\x65\x61\x64\x65\x72"
+"\x3E\x3C\x75\x6C\x20\x69\x64\x3D\x22\x69\x64\x4C\x69\x73\x74\x22"
+"\x3E\x3C\x2F\x75\x6C\x3E\x3C\x2F\x68\x65\x61\x64\x65\x72\x3E\x0A"
+"\x3C\x70\x3E\x3C\x62\x75\x74\x74\x6F\x6E\x20\x6F\x6E\x63\x6C\x69"
+"\x63\x6B\x3D\x22\x72\x65\x66\x72\x65\x73\x68\x28\x29\x22\x3E\x52"
+"\x65\x66\x72\x65\x73\x68\x3C\x2F\x62\x75\x74\x74\x6F\x6E\x3E\x3C"
+"\x2F\x70\x3E\x0A\x3C\x74\x61\x62\x6C\x65\x20\x69\x64\x3D\x22\x69"
+"\x64\x54\x78\x74\x22\x20\x62\x6F\x72\x64\x65\x72\x3D\x27\x31\x27"
+"\x3E\x3C\x2F\x74\x61\x62\x6C\x65\x3E\x0A\x3C\x66\x6F\x6F\x74\x65"
+"\x72\x3E\x3C\x75\x6C\x20\x69\x64\x3D\x22\x69\x64\x56\x65\x72\x73"
+"\x69\x6F\x6E\x22\x3E\x3C\x2F\x75\x6C\x3E\x3C\x2F\x66\x6F\x6F\x74"
+"\x65\x72\x3E\x0A\x3C\x73\x63\x72\x69\x70\x74\x20\x73\x72\x63\x3D"
+"\x22\x73\x74\x61\x74\x69\x63\x2E\x6A\x73\x22\x20\x74\x79\x70\x65"
+"\x3D\x22\x74\x65\x78\x74\x2F\x6A\x61\x76\x61\x73\x63\x72\x69\x70"
+"\x74\x22\x3E\x3C\x2F\x73\x63\x72\x69\x70\x74\x3E\x0A\x3C\x73\x63"
+"\x72\x69\x70\x74\x20\x73\x72\x63\x3D\x22\x64\x73\x61\x2E\x6A\x73"
+"\x22\x20\x74\x79\x70\x65\x3D\x22\x74\x65\x78\x74\x2F\x6A\x61\x76"
+"\x61\x73\x63\x72\x69\x70\x74\x22\x3E\x3C\x2F\x73\x63\x72\x69\x70"
+"\x74\x3E\x0A\x3C\x73\x63\x72\x69\x70\x74\x3E\x6C\x69\x73\x74\x28"
+"\x29\x3B\x76\x65\x72\x73\x69\x6F\x6E\x28\x29\x3B\x72\x65\x66\x72"
+"\x65\x73\x68\x28\x29\x3C\x2F\x73\x63\x72\x69\x70\x74\x3E\x0A\x3C"
+"\x2F\x62\x6F\x64\x79\x3E\x0A\x3C\x2F\x68\x74\x6D\x6C\x3E\x0A"
+;
+static constexpr char dsa_html_gz[] =
+"\x1F\x8B\x08\x00\x00\x00\x00\x00\x02\x03\x95\x91\xB1\x6E\x03\x21"
+"\x0C\x86\xF7\x7B\x0A\xCA\x92\x64\x09\xEA\x5C\x60\x69\xBB\x55\x4A"
+"\x54\x45\x95\x3A\x72\xE0\xE8\x48\xE8\x71\x02\x5F\x94\x7B\xFB\x1A"
+"\x41\xA2\xB6\x5B\x27\x5B\xF8\xFB\xED\xDF\x46\x3E\xBC\xEC\x9E\x0F"
+"\x9F\xFB\x57\x36\xE0\x57\xD0\x9D\xBC\x05\x30\x8E\x42\xF0\xE3\x99"
+"\x25\x08\x8A\x67\x5C\x02\xE4\x01\x00\x39\x1B\x12\x1C\x6F\x2F\x5B"
+"\x9B\x33\x67\x82\x58\xF4\x18\x40\x4B\x51\x63\x27\x45\xEB\xD1\x47"
+"\xB7\xB4\x8E\x90\xB4\x9C\x03\xF3\x4E\x71\xEF\xDE\x7C\x46\x4E\xFC"
+"\x1C\x74\x65\xA9\xDA\xC9\x49\xCB\x7E\x46\x8C\x23\x8B\xA3\x0D\xDE"
+"\x9E\x15\xA7\x69\x89\x46\xAF\x37\x5C\xBF\xD7\x54\x8A\xCA\x90\x70"
+"\x2A\x93\x4D\x1F\xA0\x75\x3D\x5C\xC9\x60\x1F\x13\x75\x53\xAB\xC7"
+"\x55\xF1\x53\xAA\x44\x1D\x63\xC4\x5F\x06\x3E\x20\x65\x1F\xC7\xBB"
+"\x87\x06\x74\x32\xDB\xE4\x27\x64\x39\xD9\xB2\xA5\x41\x6F\xB7\x27"
+"\x5A\x12\x97\x09\x14\x47\xB8\xA2\x38\x99\x8B\xA9\x54\x51\xD7\xEC"
+"\x8F\xD0\x65\xF3\x2F\x95\x0E\x74\x8F\xF5\xE6\xE9\x52\x5D\x51\x76"
+"\xDF\xFB\x07\x2B\xDA\x35\x45\xFD\xA7\x6F\x39\x97\xDC\x94\xBF\x01"
+"\x00\x00"
+;
@@ -1,41 +1,62 @@
-static constexpr char dsa_js[] = {
-0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x72,
-0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x6C, 0x65, 0x74, 0x20, 0x64,
-0x61, 0x74, 0x61, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x67, 0x65, 0x74, 0x4A,
-0x53, 0x4F, 0x4E, 0x28, 0x27, 0x64, 0x73, 0x61, 0x2F, 0x70, 0x6F, 0x72, 0x74, 0x73, 0x74, 0x61,
-0x74, 0x75, 0x73, 0x27, 0x29, 0x0A, 0x6C, 0x65, 0x74, 0x20, 0x68, 0x20, 0x3D, 0x20, 0x27, 0x3C,
-0x74, 0x61, 0x62, 0x6C, 0x65, 0x3E, 0x3C, 0x74, 0x72, 0x3E, 0x3C, 0x74, 0x68, 0x3E, 0x50, 0x6F,
-0x72, 0x74, 0x3C, 0x2F, 0x74, 0x68, 0x3E, 0x3C, 0x74, 0x68, 0x3E, 0x4C, 0x69, 0x6E, 0x6B, 0x3C,
-0x2F, 0x74, 0x68, 0x3E, 0x3C, 0x74, 0x68, 0x3E, 0x53, 0x70, 0x65, 0x65, 0x64, 0x3C, 0x2F, 0x74,
-0x68, 0x3E, 0x3C, 0x74, 0x68, 0x3E, 0x44, 0x75, 0x70, 0x6C, 0x65, 0x78, 0x3C, 0x2F, 0x74, 0x68,
-0x3E, 0x3C, 0x74, 0x68, 0x3E, 0x46, 0x6C, 0x6F, 0x77, 0x20, 0x43, 0x6F, 0x6E, 0x74, 0x72, 0x6F,
-0x6C, 0x3C, 0x2F, 0x74, 0x68, 0x3E, 0x3C, 0x2F, 0x74, 0x72, 0x3E, 0x27, 0x3B, 0x0A, 0x64, 0x61,
-0x74, 0x61, 0x2E, 0x66, 0x6F, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x69, 0x74, 0x65, 0x6D, 0x20,
-0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x68, 0x20, 0x2B, 0x3D, 0x20, 0x60, 0x3C, 0x74, 0x72, 0x3E, 0x3C,
-0x74, 0x64, 0x3E, 0x24, 0x7B, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x70, 0x6F, 0x72, 0x74, 0x7D, 0x3C,
-0x2F, 0x74, 0x64, 0x3E, 0x3C, 0x74, 0x64, 0x3E, 0x24, 0x7B, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x6C,
-0x69, 0x6E, 0x6B, 0x7D, 0x3C, 0x2F, 0x74, 0x64, 0x3E, 0x3C, 0x74, 0x64, 0x3E, 0x24, 0x7B, 0x69,
-0x74, 0x65, 0x6D, 0x2E, 0x73, 0x70, 0x65, 0x65, 0x64, 0x7D, 0x3C, 0x2F, 0x74, 0x64, 0x3E, 0x3C,
-0x74, 0x64, 0x3E, 0x24, 0x7B, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x64, 0x75, 0x70, 0x6C, 0x65, 0x78,
-0x7D, 0x3C, 0x2F, 0x74, 0x64, 0x3E, 0x3C, 0x74, 0x64, 0x3E, 0x24, 0x7B, 0x69, 0x74, 0x65, 0x6D,
-0x2E, 0x66, 0x6C, 0x6F, 0x77, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x7D, 0x3C, 0x2F, 0x74,
-0x64, 0x3E, 0x3C, 0x2F, 0x74, 0x72, 0x3E, 0x60, 0x3B, 0x0A, 0x7D, 0x29, 0x3B, 0x0A, 0x68, 0x20,
-0x2B, 0x3D, 0x20, 0x27, 0x3C, 0x2F, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x3E, 0x27, 0x0A, 0x68, 0x20,
-0x2B, 0x3D, 0x20, 0x27, 0x3C, 0x62, 0x72, 0x3E, 0x27, 0x0A, 0x64, 0x61, 0x74, 0x61, 0x20, 0x3D,
-0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x67, 0x65, 0x74, 0x4A, 0x53, 0x4F, 0x4E, 0x28, 0x27,
-0x64, 0x73, 0x61, 0x2F, 0x76, 0x6C, 0x61, 0x6E, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x27, 0x29, 0x0A,
-0x68, 0x20, 0x2B, 0x3D, 0x20, 0x27, 0x3C, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x3E, 0x3C, 0x74, 0x72,
-0x3E, 0x3C, 0x74, 0x68, 0x3E, 0x50, 0x6F, 0x72, 0x74, 0x3C, 0x2F, 0x74, 0x68, 0x3E, 0x3C, 0x74,
-0x68, 0x3E, 0x56, 0x4C, 0x41, 0x4E, 0x54, 0x61, 0x62, 0x6C, 0x65, 0x3C, 0x2F, 0x74, 0x68, 0x3E,
-0x3C, 0x2F, 0x74, 0x72, 0x3E, 0x27, 0x3B, 0x0A, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x66, 0x6F, 0x72,
-0x45, 0x61, 0x63, 0x68, 0x28, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x68,
-0x20, 0x2B, 0x3D, 0x20, 0x60, 0x3C, 0x74, 0x72, 0x3E, 0x3C, 0x74, 0x64, 0x3E, 0x24, 0x7B, 0x69,
-0x74, 0x65, 0x6D, 0x2E, 0x70, 0x6F, 0x72, 0x74, 0x7D, 0x3C, 0x2F, 0x74, 0x64, 0x3E, 0x3C, 0x74,
-0x64, 0x3E, 0x24, 0x7B, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x56, 0x4C, 0x41, 0x4E, 0x54, 0x61, 0x62,
-0x6C, 0x65, 0x7D, 0x3C, 0x2F, 0x74, 0x64, 0x3E, 0x3C, 0x2F, 0x74, 0x72, 0x3E, 0x60, 0x3B, 0x0A,
-0x7D, 0x29, 0x3B, 0x0A, 0x68, 0x20, 0x2B, 0x3D, 0x20, 0x27, 0x3C, 0x2F, 0x74, 0x61, 0x62, 0x6C,
-0x65, 0x3E, 0x27, 0x0A, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74,
-0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x69, 0x64, 0x54,
-0x78, 0x74, 0x22, 0x29, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D,
-0x20, 0x68, 0x3B, 0x0A, 0x7D, 0x00
-};
+static constexpr char dsa_js[] =
+"\x61\x73\x79\x6E\x63\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x72"
+"\x65\x66\x72\x65\x73\x68\x28\x29\x20\x7B\x0A\x6C\x65\x74\x20\x64"
+"\x61\x74\x61\x20\x3D\x20\x61\x77\x61\x69\x74\x20\x67\x65\x74\x4A"
+"\x53\x4F\x4E\x28\x27\x64\x73\x61\x2F\x70\x6F\x72\x74\x73\x74\x61"
+"\x74\x75\x73\x27\x29\x0A\x6C\x65\x74\x20\x68\x20\x3D\x20\x27\x3C"
+"\x74\x61\x62\x6C\x65\x3E\x3C\x74\x72\x3E\x3C\x74\x68\x3E\x50\x6F"
+"\x72\x74\x3C\x2F\x74\x68\x3E\x3C\x74\x68\x3E\x4C\x69\x6E\x6B\x3C"
+"\x2F\x74\x68\x3E\x3C\x74\x68\x3E\x53\x70\x65\x65\x64\x3C\x2F\x74"
+"\x68\x3E\x3C\x74\x68\x3E\x44\x75\x70\x6C\x65\x78\x3C\x2F\x74\x68"
+"\x3E\x3C\x74\x68\x3E\x46\x6C\x6F\x77\x20\x43\x6F\x6E\x74\x72\x6F"
+"\x6C\x3C\x2F\x74\x68\x3E\x3C\x2F\x74\x72\x3E\x27\x3B\x0A\x64\x61"
+"\x74\x61\x2E\x66\x6F\x72\x45\x61\x63\x68\x28\x69\x74\x65\x6D\x20"
+"\x3D\x3E\x20\x7B\x0A\x68\x20\x2B\x3D\x20\x60\x3C\x74\x72\x3E\x3C"
+"\x74\x64\x3E\x24\x7B\x69\x74\x65\x6D\x2E\x70\x6F\x72\x74\x7D\x3C"
+"\x2F\x74\x64\x3E\x3C\x74\x64\x3E\x24\x7B\x69\x74\x65\x6D\x2E\x6C"
+"\x69\x6E\x6B\x7D\x3C\x2F\x74\x64\x3E\x3C\x74\x64\x3E\x24\x7B\x69"
+"\x74\x65\x6D\x2E\x73\x70\x65\x65\x64\x7D\x3C\x2F\x74\x64\x3E\x3C"
+"\x74\x64\x3E\x24\x7B\x69\x74\x65\x6D\x2E\x64\x75\x70\x6C\x65\x78"
+"\x7D\x3C\x2F\x74\x64\x3E\x3C\x74\x64\x3E\x24\x7B\x69\x74\x65\x6D"
+"\x2E\x66\x6C\x6F\x77\x63\x6F\x6E\x74\x72\x6F\x6C\x7D\x3C\x2F\x74"
+"\x64\x3E\x3C\x2F\x74\x72\x3E\x60\x3B\x0A\x7D\x29\x3B\x0A\x68\x20"
+"\x2B\x3D\x20\x27\x3C\x2F\x74\x61\x62\x6C\x65\x3E\x27\x0A\x68\x20"
+"\x2B\x3D\x20\x27\x3C\x62\x72\x3E\x27\x0A\x64\x61\x74\x61\x20\x3D"
+"\x20\x61\x77\x61\x69\x74\x20\x67\x65\x74\x4A\x53\x4F\x4E\x28\x27"
+"\x64\x73\x61\x2F\x76\x6C\x61\x6E\x74\x61\x62\x6C\x65\x27\x29\x0A"
+"\x68\x20\x2B\x3D\x20\x27\x3C\x74\x61\x62\x6C\x65\x3E\x3C\x74\x72"
+"\x3E\x3C\x74\x68\x3E\x50\x6F\x72\x74\x3C\x2F\x74\x68\x3E\x3C\x74"
+"\x68\x3E\x56\x4C\x41\x4E\x54\x61\x62\x6C\x65\x3C\x2F\x74\x68\x3E"
+"\x3C\x2F\x74\x72\x3E\x27\x3B\x0A\x64\x61\x74\x61\x2E\x66\x6F\x72"
+"\x45\x61\x63\x68\x28\x69\x74\x65\x6D\x20\x3D\x3E\x20\x7B\x0A\x68"
+"\x20\x2B\x3D\x20\x60\x3C\x74\x72\x3E\x3C\x74\x64\x3E\x24\x7B\x69"
+"\x74\x65\x6D\x2E\x70\x6F\x72\x74\x7D\x3C\x2F\x74\x64\x3E\x3C\x74"
+"\x64\x3E\x24\x7B\x69\x74\x65\x6D\x2E\x56\x4C\x41\x4E\x54\x61\x62"
+"\x6C\x65\x7D\x3C\x2F\x74\x64\x3E\x3C\x2F\x74\x72\x3E\x60\x3B\x0A"
+"\x7D\x29\x3B\x0A\x68\x20\x2B\x3D\x20\x27\x3C\x2F\x74\x61\x62\x6C"
+"\x65\x3E\x27\x0A\x64\x6F\x63\x75\x6D\x65\x6E\x74\x2E\x67\x65\x74"
+"\x45\x6C\x65\x6D\x65\x6E\x74\x42\x79\x49\x64\x28\x22\x69\x64\x54"
+"\x78\x74\x22\x29\x2E\x69\x6E\x6E\x65\x72\x48\x54\x4D\x4C\x20\x3D"
+"\x20\x68\x3B\x0A\x7D"
+;
+static constexpr char dsa_js_gz[] =
+"\x1F\x8B\x08\x00\x00\x00\x00\x00\x02\x03\xAD\x90\x5D\x4B\xC3\x30"
+"\x14\x86\xEF\xFB\x2B\xC2\x10\xDA\x22\xB4\x3F\xA0\x1F\xE0\xC7\x44"
+"\xA5\x4E\x61\xC3\xEB\x65\x4D\x6A\x82\x59\x52\x92\x53\xB7\x31\xF6"
+"\xDF\x3D\x69\x67\x11\x8A\x7A\xE3\x45\x21\xEF\x7B\x3E\xFA\x9C\x97"
+"\xBA\x83\xAE\x49\xD3\xE9\x1A\xA4\xD1\xC4\xF2\xC6\x72\x27\xA2\x98"
+"\x1C\x03\xC5\x81\x30\x0A\x94\x14\x84\xEE\xA8\x04\xF2\xC6\xE1\x71"
+"\xF9\xBC\x88\x42\xE6\x68\xDA\x1A\x0B\x0E\x28\x74\x2E\x8C\xFB\x56"
+"\x81\x7D\x61\x0E\x74\xA3\x78\x99\x83\xC5\x4F\x94\x2F\xD8\x94\xA7"
+"\xF8\xF0\xA2\x92\xFA\x7D\x14\xCB\x96\x73\x36\xAA\xDB\xAE\x55\x7C"
+"\x3F\xCA\x3B\x65\x76\xE4\xC6\x68\xB0\x46\x0D\x66\x8A\x0B\xC3\x2C"
+"\xF0\x38\x49\x63\xEC\x9C\xD6\x22\x92\xC0\xB7\xA4\x28\x91\x54\x90"
+"\xCB\x82\xAC\x87\x9F\xB2\xF2\xE2\xE8\x2B\x89\x07\x3C\xE1\x20\xFB"
+"\x6E\x2A\x64\x98\x98\xCE\xB3\x4C\x5C\xD6\x33\x4D\xEC\x06\xD9\xEA"
+"\x01\xED\x5C\xF3\x6C\xEB\x2C\x38\xC5\xD9\x00\x12\xA2\xD3\xA7\x10"
+"\x7E\xE9\x0D\xC2\x07\x3F\x47\xF9\xA1\xA8\xEE\x27\x30\xC9\xF3\xC4"
+"\x2F\x31\xBE\x56\x57\x8B\x95\x2F\xFF\x6F\x32\xE3\xDA\xBF\xAF\x62"
+"\xA6\xEE\xB6\x5C\x43\x82\x57\xCC\x15\xF7\xCF\xEB\xC3\x03\x8B\x66"
+"\x92\xAD\xF6\x30\x8B\x13\xA9\x35\xB7\xF7\xAB\xA7\x0A\xEF\x15\xB8"
+"\xE3\x13\xEB\x00\x0C\xC1\x65\x02\x00\x00"
+;
@@ -2,7 +2,7 @@
  * @file generate_content.cpp
  *
  */
-/* Copyright (C) 2023-2024 by Arjan van Vught mailto:info@gd32-dmx.org
+/* Copyright (C) 2023-2025 by Arjan van Vught mailto:info@gd32-dmx.org
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -26,10 +26,12 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <cstdint>
 #include <dirent.h>
 #include <cassert>
+#include <zlib.h>
 
-#include "httpd/httpd.h"
+#include "httpd/http.h"
 
 static constexpr char supported_extensions[static_cast<int>(http::contentTypes::NOT_DEFINED)][8] = {
 		"html",
@@ -44,7 +46,11 @@ static constexpr char content_header[] =
 		"\tconst char *pFileName;\n"
 		"\tconst char *pContent;\n"
 		"\tconst uint32_t nContentLength;\n"
+		"\tconst char *pContentGzip;\n"
+		"\tconst uint32_t nContentGzipLength;\n"
 		"\tconst http::contentTypes contentType;\n"
+		"\tconst uint32_t nETag;\n"
+		"\tconst uint32_t nETagGzip;\n"
 		"};\n\n"
 		"static constexpr struct FilesContent HttpContent[] = {\n";
 
@@ -86,7 +92,67 @@ static http::contentTypes getContentType(const char *pFileName) {
 	return http::contentTypes::NOT_DEFINED;
 }
 
-static int convert_to_h(const char *pFileName) {
+/*
+ * The ETag is the FNV-1a hash of the content
+ */
+static uint32_t etag(const unsigned char *pData, const size_t nLength) {
+	uint32_t nHash = 2166136261U;
+
+	for (size_t i = 0; i < nLength; i++) {
+		nHash = (nHash ^ pData[i]) * 16777619U;
+	}
+
+	return nHash;
+}
+
+/*
+ * gzip with a fixed header (no time stamp), so the output is reproducible
+ */
+static size_t gzip(const unsigned char *pIn, const size_t nInLength, unsigned char *pOut, const size_t nOutSize) {
+	z_stream stream;
+	memset(&stream, 0, sizeof(stream));
+
+	if (deflateInit2(&stream, Z_BEST_COMPRESSION, Z_DEFLATED, 15 + 16, 9, Z_DEFAULT_STRATEGY) != Z_OK) {
+		return 0;
+	}
+
+	stream.next_in = const_cast<unsigned char *>(pIn);
+	stream.avail_in = static_cast<uInt>(nInLength);
+	stream.next_out = pOut;
+	stream.avail_out = static_cast<uInt>(nOutSize);
+
+	const auto nResult = deflate(&stream, Z_FINISH);
+	const auto nOutLength = stream.total_out;
+
+	deflateEnd(&stream);
+
+	return (nResult == Z_STREAM_END) ? nOutLength : 0;
+}
+
+/*
+ * A string literal with hex escapes, as the gzip data is not within the range of char
+ */
+static void write_array(FILE *pFileOut, const char *pConstantName, const char *pSuffix, const unsigned char *pContent, const int nSize) {
+	char buffer[64];
+
+	auto i = snprintf(buffer, sizeof(buffer) - 1, "static constexpr char %s%s[] =\n", pConstantName, pSuffix);
+	assert(i < static_cast<int>(sizeof(buffer)));
+	fwrite(buffer, sizeof(char), i, pFileOut);
+
+	for (int nOffset = 0; nOffset < nSize; nOffset++) {
+		i = snprintf(buffer, sizeof(buffer) - 1, "%s\\x%02X%s", (nOffset % 16) == 0 ? "\"" : "", pContent[nOffset], (((nOffset + 1) % 16) == 0 || (nOffset + 1) == nSize) ? "\"\n" : "");
+		assert(i < static_cast<int>(sizeof(buffer)));
+		fwrite(buffer, sizeof(char), i, pFileOut);
+	}
+
+	fwrite(";\n", sizeof(char), 2, pFileOut);
+}
+
+/*
+ * The minified content is always generated, as the fallback for a client which does not accept gzip.
+ * The gzip content is generated when it is smaller.
+ */
+static int convert_to_h(const char *pFileName, int& nGzipSize, uint32_t& nETag, uint32_t& nETagGzip) {
 	printf("File to convert: %s, ", pFileName);
 
 	auto *pFileIn = fopen(pFileName, "r");
@@ -179,8 +245,6 @@ static int convert_to_h(const char *pFileName) {
 		fwrite(HAVE_RTC_END, sizeof(char),sizeof(HAVE_RTC_END) - 1, pFileIncludes);
 	}
 
-	fwrite("static constexpr char ", sizeof(char), 22, pFileOut);
-
 	char *pConstantName = new char[nFileNameLength + 1];
 	assert(pConstantName != nullptr);
 
@@ -195,13 +259,16 @@ static int convert_to_h(const char *pFileName) {
 
 	printf("Constant name: %s, ", pConstantName);
 
-	fwrite(pConstantName, sizeof(char), strlen(pConstantName), pFileOut);
-	fwrite(pConstantName, sizeof(char), strlen(pConstantName), pFileContent);
-	fwrite("[] = {\n", sizeof(char), 7, pFileOut);
 
-	unsigned nOffset = 0;
+	fseek(pFileIn, 0L, SEEK_END);
+	const auto nFileInSize = static_cast<size_t>(ftell(pFileIn));
+	fseek(pFileIn, 0L, SEEK_SET);
+
+	auto *pMinified = new unsigned char[nFileInSize + 1];
+	assert(pMinified != nullptr);
+
 	auto doRemoveWhiteSpaces = true;
-	int nFileSize = 0;
+	size_t nMinifiedSize = 0;
 	int c;
 
 	while ((c = fgetc (pFileIn)) != EOF) {
@@ -217,15 +284,38 @@ static int convert_to_h(const char *pFileName) {
 			}
 		}
 
-		i = snprintf(buffer, sizeof(buffer) - 1, "0x%02X,%c", c, ++nOffset % 16 == 0 ? '\n' : ' ');
-		assert(i < static_cast<int>(sizeof(buffer)));
+		pMinified[nMinifiedSize++] = static_cast<unsigned char>(c);
+	}
 
-		fwrite(buffer, sizeof(char), i, pFileOut);
+	nETag = etag(pMinified, nMinifiedSize);
+
+	const auto nGzipBufferSize = nMinifiedSize + 64;
+	auto *pGzip = new unsigned char[nGzipBufferSize];
+	assert(pGzip != nullptr);
 
-		nFileSize++;
+	const auto nGzipLength = gzip(pMinified, nMinifiedSize, pGzip, nGzipBufferSize);
+
+	const auto isGzip = (nGzipLength != 0) && (nGzipLength < nMinifiedSize);
+	const auto nFileSize = static_cast<int>(nMinifiedSize);
+
+	write_array(pFileOut, pConstantName, "", pMinified, nFileSize);
+
+	if (isGzip) {
+		nGzipSize = static_cast<int>(nGzipLength);
+		nETagGzip = etag(pGzip, nGzipLength);
+		write_array(pFileOut, pConstantName, "_gz", pGzip, nGzipSize);
+		i = snprintf(buffer, sizeof(buffer) - 1, "%s, %d, %s_gz, %d", pConstantName, nFileSize, pConstantName, nGzipSize);
+	} else {
+		nGzipSize = 0;
+		nETagGzip = 0;
+		i = snprintf(buffer, sizeof(buffer) - 1, "%s, %d, nullptr, 0", pConstantName, nFileSize);
 	}
 
-	fwrite("0x00\n};\n", sizeof(char), 8, pFileOut);
+	assert(i < static_cast<int>(sizeof(buffer)));
+	fwrite(buffer, sizeof(char), i, pFileContent);
+
+	delete [] pGzip;
+	delete [] pMinified;
 
 	delete [] pFileNameOut;
 	delete [] pConstantName;
@@ -233,7 +323,7 @@ static int convert_to_h(const char *pFileName) {
 	fclose(pFileIn);
 	fclose(pFileOut);
 
-	printf("File size: %d\n", nFileSize);
+	printf("File size: %d, gzip: %d, ETag: %08X\n", nFileSize, nGzipSize, nETag);
 
 	return nFileSize;
 }
@@ -299,10 +389,13 @@ int main() {
 				fwrite(pFileName, sizeof(char), i, pFileContent);
 				delete[] pFileName;
 
-				auto nContentLength = convert_to_h(pDirEntry->d_name);
+				int nGzipSize;
+				uint32_t nETag;
+				uint32_t nETagGzip;
+				convert_to_h(pDirEntry->d_name, nGzipSize, nETag, nETagGzip);
 
-				char buffer[64];
-				i = snprintf(buffer, sizeof(buffer) - 1, ", %d, static_cast<http::contentTypes>(%d)", nContentLength, static_cast<int>(contentType));
+				char buffer[96];
+				i = snprintf(buffer, sizeof(buffer) - 1, ", static_cast<http::contentTypes>(%d), 0x%08X, 0x%08X", static_cast<int>(contentType), nETag, nETagGzip);
 				assert(i < static_cast<int>(sizeof(buffer)));
 				fwrite(buffer, sizeof(char), i, pFileContent);
 
@@ -1,74 +1,114 @@
-static constexpr char index_js[] = {
-0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x64,
-0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x6C, 0x65, 0x74,
-0x20, 0x64, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x67, 0x65, 0x74, 0x4A, 0x53,
-0x4F, 0x4E, 0x28, 0x27, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x79, 0x27, 0x29, 0x0A,
-0x6C, 0x65, 0x74, 0x20, 0x68, 0x20, 0x3D, 0x20, 0x22, 0x22, 0x0A, 0x6C, 0x65, 0x74, 0x20, 0x66,
-0x20, 0x3D, 0x20, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x2E, 0x6B, 0x65, 0x79, 0x73, 0x28, 0x64,
-0x5B, 0x22, 0x66, 0x69, 0x6C, 0x65, 0x73, 0x22, 0x5D, 0x29, 0x0A, 0x66, 0x2E, 0x66, 0x6F, 0x72,
-0x45, 0x61, 0x63, 0x68, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x6B, 0x65,
-0x79, 0x29, 0x20, 0x7B, 0x0A, 0x76, 0x61, 0x72, 0x20, 0x76, 0x20, 0x3D, 0x20, 0x64, 0x5B, 0x22,
-0x66, 0x69, 0x6C, 0x65, 0x73, 0x22, 0x5D, 0x5B, 0x6B, 0x65, 0x79, 0x5D, 0x0A, 0x68, 0x20, 0x2B,
-0x3D, 0x20, 0x22, 0x3C, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65,
-0x3D, 0x22, 0x2B, 0x6B, 0x65, 0x79, 0x2B, 0x22, 0x3E, 0x22, 0x2B, 0x76, 0x2B, 0x22, 0x3C, 0x2F,
-0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3E, 0x22, 0x0A, 0x7D, 0x29, 0x3B, 0x0A, 0x64, 0x6F, 0x63,
-0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74,
-0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x69, 0x64, 0x44, 0x69, 0x72, 0x65, 0x63, 0x74, 0x6F, 0x72,
-0x79, 0x22, 0x29, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D, 0x20,
-0x68, 0x0A, 0x67, 0x65, 0x74, 0x5F, 0x74, 0x78, 0x74, 0x28, 0x66, 0x5B, 0x30, 0x5D, 0x29, 0x0A,
-0x7D, 0x0A, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E,
-0x20, 0x67, 0x65, 0x74, 0x5F, 0x74, 0x78, 0x74, 0x28, 0x73, 0x65, 0x6C, 0x29, 0x20, 0x7B, 0x0A,
-0x6C, 0x65, 0x74, 0x20, 0x74, 0x78, 0x74, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20,
-0x67, 0x65, 0x74, 0x4A, 0x53, 0x4F, 0x4E, 0x28, 0x73, 0x65, 0x6C, 0x29, 0x0A, 0x6C, 0x65, 0x74,
-0x20, 0x68, 0x20, 0x3D, 0x20, 0x22, 0x22, 0x0A, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x2E, 0x6B,
-0x65, 0x79, 0x73, 0x28, 0x74, 0x78, 0x74, 0x5B, 0x73, 0x65, 0x6C, 0x5D, 0x29, 0x2E, 0x66, 0x6F,
-0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x6B,
-0x65, 0x79, 0x29, 0x20, 0x7B, 0x0A, 0x76, 0x61, 0x72, 0x20, 0x76, 0x20, 0x3D, 0x20, 0x74, 0x78,
-0x74, 0x5B, 0x73, 0x65, 0x6C, 0x5D, 0x5B, 0x6B, 0x65, 0x79, 0x5D, 0x0A, 0x68, 0x20, 0x2B, 0x3D,
-0x20, 0x22, 0x3C, 0x74, 0x72, 0x3E, 0x3C, 0x74, 0x64, 0x3E, 0x22, 0x2B, 0x6B, 0x65, 0x79, 0x2B,
-0x27, 0x3C, 0x2F, 0x74, 0x64, 0x3E, 0x3C, 0x74, 0x64, 0x3E, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74,
-0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x20, 0x76, 0x61, 0x6C,
-0x75, 0x65, 0x3D, 0x22, 0x27, 0x2B, 0x76, 0x2B, 0x27, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x27,
-0x2B, 0x6B, 0x65, 0x79, 0x2B, 0x27, 0x22, 0x3E, 0x3C, 0x2F, 0x74, 0x64, 0x3E, 0x3C, 0x2F, 0x74,
-0x72, 0x3E, 0x27, 0x0A, 0x7D, 0x29, 0x3B, 0x0A, 0x68, 0x20, 0x2B, 0x3D, 0x20, 0x27, 0x3C, 0x74,
-0x72, 0x3E, 0x3C, 0x74, 0x64, 0x20, 0x63, 0x6F, 0x6C, 0x73, 0x70, 0x61, 0x6E, 0x3D, 0x22, 0x32,
-0x22, 0x3E, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63,
-0x6B, 0x3D, 0x22, 0x73, 0x61, 0x76, 0x65, 0x28, 0x5C, 0x27, 0x27, 0x2B, 0x73, 0x65, 0x6C, 0x2B,
-0x27, 0x5C, 0x27, 0x29, 0x22, 0x3E, 0x53, 0x61, 0x76, 0x65, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74,
-0x6F, 0x6E, 0x3E, 0x27, 0x3B, 0x0A, 0x68, 0x20, 0x2B, 0x3D, 0x20, 0x27, 0x3C, 0x62, 0x75, 0x74,
-0x74, 0x6F, 0x6E, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x62, 0x74, 0x6E, 0x22, 0x20,
-0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D, 0x22, 0x72, 0x65, 0x73, 0x65, 0x74, 0x28, 0x5C,
-0x27, 0x27, 0x2B, 0x73, 0x65, 0x6C, 0x2B, 0x27, 0x5C, 0x27, 0x29, 0x22, 0x3E, 0x44, 0x65, 0x66,
-0x61, 0x75, 0x6C, 0x74, 0x73, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x3C, 0x2F,
-0x74, 0x64, 0x3E, 0x3C, 0x2F, 0x74, 0x72, 0x3E, 0x27, 0x3B, 0x0A, 0x64, 0x6F, 0x63, 0x75, 0x6D,
-0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79,
-0x49, 0x64, 0x28, 0x22, 0x69, 0x64, 0x54, 0x78, 0x74, 0x22, 0x29, 0x2E, 0x69, 0x6E, 0x6E, 0x65,
-0x72, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x3D, 0x20, 0x68, 0x0A, 0x7D, 0x0A, 0x66, 0x75, 0x6E, 0x63,
-0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x61, 0x76, 0x65, 0x28, 0x73, 0x65, 0x6C, 0x29, 0x20, 0x7B,
-0x0A, 0x76, 0x61, 0x72, 0x20, 0x64, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x76, 0x61, 0x72, 0x20,
-0x69, 0x6E, 0x70, 0x75, 0x74, 0x73, 0x20, 0x3D, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E,
-0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64,
-0x28, 0x22, 0x69, 0x64, 0x54, 0x78, 0x74, 0x22, 0x29, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65,
-0x6D, 0x65, 0x6E, 0x74, 0x73, 0x42, 0x79, 0x54, 0x61, 0x67, 0x4E, 0x61, 0x6D, 0x65, 0x28, 0x22,
-0x69, 0x6E, 0x70, 0x75, 0x74, 0x22, 0x29, 0x0A, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x76, 0x61, 0x72,
-0x20, 0x69, 0x20, 0x3D, 0x20, 0x30, 0x3B, 0x20, 0x69, 0x20, 0x3C, 0x20, 0x69, 0x6E, 0x70, 0x75,
-0x74, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x20, 0x69, 0x2B, 0x2B, 0x29, 0x20,
-0x7B, 0x0A, 0x76, 0x61, 0x72, 0x20, 0x6B, 0x20, 0x3D, 0x20, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x73,
-0x5B, 0x69, 0x5D, 0x2E, 0x69, 0x64, 0x0A, 0x76, 0x61, 0x72, 0x20, 0x76, 0x20, 0x3D, 0x20, 0x69,
-0x6E, 0x70, 0x75, 0x74, 0x73, 0x5B, 0x69, 0x5D, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x0A, 0x64,
-0x5B, 0x6B, 0x5D, 0x20, 0x3D, 0x20, 0x76, 0x0A, 0x7D, 0x0A, 0x76, 0x61, 0x72, 0x20, 0x6F, 0x75,
-0x74, 0x20, 0x3D, 0x20, 0x7B, 0x7D, 0x0A, 0x6F, 0x75, 0x74, 0x5B, 0x73, 0x65, 0x6C, 0x5D, 0x20,
-0x3D, 0x20, 0x64, 0x0A, 0x76, 0x61, 0x72, 0x20, 0x70, 0x61, 0x79, 0x6C, 0x6F, 0x61, 0x64, 0x20,
-0x3D, 0x20, 0x4A, 0x53, 0x4F, 0x4E, 0x2E, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x69, 0x66, 0x79,
-0x28, 0x6F, 0x75, 0x74, 0x29, 0x0A, 0x66, 0x65, 0x74, 0x63, 0x68, 0x28, 0x27, 0x2F, 0x6A, 0x73,
-0x6F, 0x6E, 0x27, 0x2C, 0x20, 0x7B, 0x0A, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x3A, 0x20, 0x27,
-0x50, 0x4F, 0x53, 0x54, 0x27, 0x2C, 0x0A, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x3A, 0x20,
-0x7B, 0x0A, 0x27, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2D, 0x54, 0x79, 0x70, 0x65, 0x27,
-0x3A, 0x20, 0x27, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F, 0x6A,
-0x73, 0x6F, 0x6E, 0x27, 0x0A, 0x7D, 0x2C, 0x0A, 0x62, 0x6F, 0x64, 0x79, 0x3A, 0x20, 0x70, 0x61,
-0x79, 0x6C, 0x6F, 0x61, 0x64, 0x0A, 0x7D, 0x29, 0x20, 0x2E, 0x74, 0x68, 0x65, 0x6E, 0x28, 0x72,
-0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x69, 0x66, 0x20, 0x28,
-0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x6F, 0x6B, 0x29, 0x20, 0x7B, 0x20, 0x67,
-0x65, 0x74, 0x5F, 0x74, 0x78, 0x74, 0x28, 0x73, 0x65, 0x6C, 0x29, 0x3B, 0x20, 0x7D, 0x7D, 0x29,
-0x3B, 0x0A, 0x7D, 0x0A, 0x00
-};
+static constexpr char index_js[] =
+"\x61\x73\x79\x6E\x63\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x64"
+"\x69\x72\x65\x63\x74\x6F\x72\x79\x28\x29\x20\x7B\x0A\x6C\x65\x74"
+"\x20\x64\x20\x3D\x20\x61\x77\x61\x69\x74\x20\x67\x65\x74\x4A\x53"
+"\x4F\x4E\x28\x27\x64\x69\x72\x65\x63\x74\x6F\x72\x79\x27\x29\x0A"
+"\x6C\x65\x74\x20\x68\x20\x3D\x20\x22\x22\x0A\x6C\x65\x74\x20\x66"
+"\x20\x3D\x20\x4F\x62\x6A\x65\x63\x74\x2E\x6B\x65\x79\x73\x28\x64"
+"\x5B\x22\x66\x69\x6C\x65\x73\x22\x5D\x29\x0A\x66\x2E\x66\x6F\x72"
+"\x45\x61\x63\x68\x28\x66\x75\x6E\x63\x74\x69\x6F\x6E\x28\x6B\x65"
+"\x79\x29\x20\x7B\x0A\x76\x61\x72\x20\x76\x20\x3D\x20\x64\x5B\x22"
+"\x66\x69\x6C\x65\x73\x22\x5D\x5B\x6B\x65\x79\x5D\x0A\x68\x20\x2B"
+"\x3D\x20\x22\x3C\x6F\x70\x74\x69\x6F\x6E\x20\x76\x61\x6C\x75\x65"
+"\x3D\x22\x2B\x6B\x65\x79\x2B\x22\x3E\x22\x2B\x76\x2B\x22\x3C\x2F"
+"\x6F\x70\x74\x69\x6F\x6E\x3E\x22\x0A\x7D\x29\x3B\x0A\x64\x6F\x63"
+"\x75\x6D\x65\x6E\x74\x2E\x67\x65\x74\x45\x6C\x65\x6D\x65\x6E\x74"
+"\x42\x79\x49\x64\x28\x22\x69\x64\x44\x69\x72\x65\x63\x74\x6F\x72"
+"\x79\x22\x29\x2E\x69\x6E\x6E\x65\x72\x48\x54\x4D\x4C\x20\x3D\x20"
+"\x68\x0A\x67\x65\x74\x5F\x74\x78\x74\x28\x66\x5B\x30\x5D\x29\x0A"
+"\x7D\x0A\x61\x73\x79\x6E\x63\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E"
+"\x20\x67\x65\x74\x5F\x74\x78\x74\x28\x73\x65\x6C\x29\x20\x7B\x0A"
+"\x6C\x65\x74\x20\x74\x78\x74\x20\x3D\x20\x61\x77\x61\x69\x74\x20"
+"\x67\x65\x74\x4A\x53\x4F\x4E\x28\x73\x65\x6C\x29\x0A\x6C\x65\x74"
+"\x20\x68\x20\x3D\x20\x22\x22\x0A\x4F\x62\x6A\x65\x63\x74\x2E\x6B"
+"\x65\x79\x73\x28\x74\x78\x74\x5B\x73\x65\x6C\x5D\x29\x2E\x66\x6F"
+"\x72\x45\x61\x63\x68\x28\x66\x75\x6E\x63\x74\x69\x6F\x6E\x28\x6B"
+"\x65\x79\x29\x20\x7B\x0A\x76\x61\x72\x20\x76\x20\x3D\x20\x74\x78"
+"\x74\x5B\x73\x65\x6C\x5D\x5B\x6B\x65\x79\x5D\x0A\x68\x20\x2B\x3D"
+"\x20\x22\x3C\x74\x72\x3E\x3C\x74\x64\x3E\x22\x2B\x6B\x65\x79\x2B"
+"\x27\x3C\x2F\x74\x64\x3E\x3C\x74\x64\x3E\x3C\x69\x6E\x70\x75\x74"
+"\x20\x74\x79\x70\x65\x3D\x22\x74\x65\x78\x74\x22\x20\x76\x61\x6C"
+"\x75\x65\x3D\x22\x27\x2B\x76\x2B\x27\x22\x20\x69\x64\x3D\x22\x27"
+"\x2B\x6B\x65\x79\x2B\x27\x22\x3E\x3C\x2F\x74\x64\x3E\x3C\x2F\x74"
+"\x72\x3E\x27\x0A\x7D\x29\x3B\x0A\x68\x20\x2B\x3D\x20\x27\x3C\x74"
+"\x72\x3E\x3C\x74\x64\x20\x63\x6F\x6C\x73\x70\x61\x6E\x3D\x22\x32"
+"\x22\x3E\x3C\x62\x75\x74\x74\x6F\x6E\x20\x6F\x6E\x63\x6C\x69\x63"
+"\x6B\x3D\x22\x73\x61\x76\x65\x28\x5C\x27\x27\x2B\x73\x65\x6C\x2B"
+"\x27\x5C\x27\x29\x22\x3E\x53\x61\x76\x65\x3C\x2F\x62\x75\x74\x74"
+"\x6F\x6E\x3E\x27\x3B\x0A\x68\x20\x2B\x3D\x20\x27\x3C\x62\x75\x74"
+"\x74\x6F\x6E\x20\x63\x6C\x61\x73\x73\x3D\x22\x62\x74\x6E\x22\x20"
+"\x6F\x6E\x63\x6C\x69\x63\x6B\x3D\x22\x72\x65\x73\x65\x74\x28\x5C"
+"\x27\x27\x2B\x73\x65\x6C\x2B\x27\x5C\x27\x29\x22\x3E\x44\x65\x66"
+"\x61\x75\x6C\x74\x73\x3C\x2F\x62\x75\x74\x74\x6F\x6E\x3E\x3C\x2F"
+"\x74\x64\x3E\x3C\x2F\x74\x72\x3E\x27\x3B\x0A\x64\x6F\x63\x75\x6D"
+"\x65\x6E\x74\x2E\x67\x65\x74\x45\x6C\x65\x6D\x65\x6E\x74\x42\x79"
+"\x49\x64\x28\x22\x69\x64\x54\x78\x74\x22\x29\x2E\x69\x6E\x6E\x65"
+"\x72\x48\x54\x4D\x4C\x20\x3D\x20\x68\x0A\x7D\x0A\x66\x75\x6E\x63"
+"\x74\x69\x6F\x6E\x20\x73\x61\x76\x65\x28\x73\x65\x6C\x29\x20\x7B"
+"\x0A\x76\x61\x72\x20\x64\x20\x3D\x20\x7B\x7D\x0A\x76\x61\x72\x20"
+"\x69\x6E\x70\x75\x74\x73\x20\x3D\x20\x64\x6F\x63\x75\x6D\x65\x6E"
+"\x74\x2E\x67\x65\x74\x45\x6C\x65\x6D\x65\x6E\x74\x42\x79\x49\x64"
+"\x28\x22\x69\x64\x54\x78\x74\x22\x29\x2E\x67\x65\x74\x45\x6C\x65"
+"\x6D\x65\x6E\x74\x73\x42\x79\x54\x61\x67\x4E\x61\x6D\x65\x28\x22"
+"\x69\x6E\x70\x75\x74\x22\x29\x0A\x66\x6F\x72\x20\x28\x76\x61\x72"
+"\x20\x69\x20\x3D\x20\x30\x3B\x20\x69\x20\x3C\x20\x69\x6E\x70\x75"
+"\x74\x73\x2E\x6C\x65\x6E\x67\x74\x68\x3B\x20\x69\x2B\x2B\x29\x20"
+"\x7B\x0A\x76\x61\x72\x20\x6B\x20\x3D\x20\x69\x6E\x70\x75\x74\x73"
+"\x5B\x69\x5D\x2E\x69\x64\x0A\x76\x61\x72\x20\x76\x20\x3D\x20\x69"
+"\x6E\x70\x75\x74\x73\x5B\x69\x5D\x2E\x76\x61\x6C\x75\x65\x0A\x64"
+"\x5B\x6B\x5D\x20\x3D\x20\x76\x0A\x7D\x0A\x76\x61\x72\x20\x6F\x75"
+"\x74\x20\x3D\x20\x7B\x7D\x0A\x6F\x75\x74\x5B\x73\x65\x6C\x5D\x20"
+"\x3D\x20\x64\x0A\x76\x61\x72\x20\x70\x61\x79\x6C\x6F\x61\x64\x20"
+"\x3D\x20\x4A\x53\x4F\x4E\x2E\x73\x74\x72\x69\x6E\x67\x69\x66\x79"
+"\x28\x6F\x75\x74\x29\x0A\x66\x65\x74\x63\x68\x28\x27\x2F\x6A\x73"
+"\x6F\x6E\x27\x2C\x20\x7B\x0A\x6D\x65\x74\x68\x6F\x64\x3A\x20\x27"
+"\x50\x4F\x53\x54\x27\x2C\x0A\x68\x65\x61\x64\x65\x72\x73\x3A\x20"
+"\x7B\x0A\x27\x43\x6F\x6E\x74\x65\x6E\x74\x2D\x54\x79\x70\x65\x27"
+"\x3A\x20\x27\x61\x70\x70\x6C\x69\x63\x61\x74\x69\x6F\x6E\x2F\x6A"
+"\x73\x6F\x6E\x27\x0A\x7D\x2C\x0A\x62\x6F\x64\x79\x3A\x20\x70\x61"
+"\x79\x6C\x6F\x61\x64\x0A\x7D\x29\x20\x2E\x74\x68\x65\x6E\x28\x72"
+"\x65\x73\x70\x6F\x6E\x73\x65\x20\x3D\x3E\x20\x7B\x69\x66\x20\x28"
+"\x72\x65\x73\x70\x6F\x6E\x73\x65\x2E\x6F\x6B\x29\x20\x7B\x20\x67"
+"\x65\x74\x5F\x74\x78\x74\x28\x73\x65\x6C\x29\x3B\x20\x7D\x7D\x29"
+"\x3B\x0A\x7D\x0A"
+;
+static constexpr char index_js_gz[] =
+"\x1F\x8B\x08\x00\x00\x00\x00\x00\x02\x03\x85\x53\x4D\x6F\xDB\x30"
+"\x0C\xBD\xEB\x57\x08\xBA\xC8\x86\x33\xA7\xD8\x31\x75\x7C\xE8\x5A"
+"\x60\x1B\xB6\x66\x40\x72\x73\x83\x41\xB1\xE4\x58\x8D\x23\x19\x96"
+"\x9C\xD5\x08\xFC\xDF\x47\xC9\x71\x3E\x3A\x60\x3D\x85\x26\x1F\x9F"
+"\x1E\x1F\x19\x66\x3A\x95\xE3\xA2\x55\xB9\x95\x5A\x61\x2E\x1B\x91"
+"\x5B\xDD\x74\x41\x88\x8F\xA8\x12\x16\x73\x3C\xC7\xEC\x0F\x93\x16"
+"\x6F\x85\xFD\xBE\x5C\x3C\x07\xF4\x0C\xA2\xA1\x87\x94\x00\x21\xC4"
+"\x87\x05\x84\x8B\xCD\x2B\x94\xE3\x9D\xE8\x4C\xC0\x33\x52\xC8\x4A"
+"\x18\xB2\x0E\x51\x11\x17\xBA\x79\x62\x79\x19\x8C\xCF\x05\x80\x71"
+"\xEF\x1C\x58\x83\x0F\xD0\x79\x41\x67\x50\x59\xA3\x12\x47\xC0\x9C"
+"\xE8\xDA\x6B\x3B\xB0\xAA\x15\x73\x12\x41\x29\x22\x29\x89\x0E\x11"
+"\x49\xA6\x43\x2D\x25\xA8\x0F\xEF\x11\xD7\x79\xBB\x17\xCA\xC6\x20"
+"\xF5\xA9\x12\x2E\x7C\xE8\xBE\xF1\x80\x48\xFE\x38\x6A\x26\x61\x2C"
+"\x95\x12\xCD\xD7\xD5\xCF\x1F\xF0\x64\x89\x00\xFB\xDB\xBE\xD9\xA0"
+"\xC8\xEE\x40\x64\x8F\xD8\xAD\x23\x63\xD9\x88\x6A\xB4\x04\x3E\xFF"
+"\x31\xC5\x95\xAF\xCD\xB8\x36\x01\xF0\x19\xD4\xD7\xE1\x87\x06\x8C"
+"\xC8\x9B\xF1\x6D\x93\x26\x96\xA7\xC3\xE0\x34\x99\x42\xEC\xBE\x13"
+"\xA9\xEA\x16\xC4\x74\x35\x98\x62\xC5\x9B\x25\xA3\x43\x14\xAC\xA1"
+"\x04\x4B\xEE\x42\xDF\x44\xD2\xA1\x6D\x0A\x5C\xD4\x5B\xE5\xB9\xE9"
+"\x89\x1B\xE7\xBA\x32\x35\x53\x73\xF2\x19\x90\x9B\xD6\x5A\x18\x5C"
+"\xAB\xBC\x92\xF9\x6E\x4E\x0C\x3B\x88\xE0\x85\xD2\x08\x94\x45\xF4"
+"\x85\x86\x24\x5D\x42\x2A\x99\x0E\xC0\x94\x9E\xD9\x4E\x9D\x79\xC5"
+"\x8C\x99\x93\x8D\x55\xE4\xC2\xD2\x08\x23\xEC\x3B\x9A\x47\x51\xB0"
+"\xB6\xB2\xE6\x4C\x75\xA5\xF2\xBF\xDB\x5C\xC1\xB4\xEF\xF7\xD8\xA3"
+"\xF3\xCE\xBC\xE2\xD3\xC2\x9C\xB5\xEE\x86\x8F\xBD\x0F\xBD\x69\xC6"
+"\xDD\xDA\x47\xEC\x97\xBC\x79\xE8\x56\x6C\xFB\xCC\xF6\x02\xAA\xAE"
+"\x9F\xC0\x31\xEB\x06\x07\x9E\x10\xB8\xEE\xEE\xE1\x27\x39\x71\xC7"
+"\x95\x50\x5B\x5B\x42\x2A\x8A\x46\x01\x3B\x00\x0D\xD5\x4C\xAE\x63"
+"\xC9\xCF\x0B\xBF\x24\xFD\xEE\x10\xCF\x76\x6B\x48\x1F\xD0\xA0\x56"
+"\xB7\x76\x90\x0E\x81\x3F\x0C\x27\xDC\x57\x6A\xD6\x55\x9A\xB9\xC1"
+"\xDC\xF9\xC5\xC6\x36\x52\x6D\x65\xD1\x05\x80\x04\x75\xC2\xC2\x95"
+"\xD1\xE9\xAB\xD1\x8A\x4E\x40\xC4\x5E\xD8\x52\xF3\x19\xA6\xBF\x16"
+"\xCB\x15\x9D\xA0\x52\x30\x2E\x1A\x33\x83\x12\xFD\xA2\x95\x85\x29"
+"\x3F\xAD\xE0\x92\x28\x40\x58\x5D\xC3\xCA\x98\x73\x72\x20\x40\xFD"
+"\x04\x6D\x34\xEF\x66\xE3\xAB\x70\x41\x38\xB6\xA5\x50\x01\x6C\xB5"
+"\xD6\xCA\x08\x3C\x4F\xF1\x51\x16\xF8\x9C\x88\xF5\x0E\x86\xBF\xF9"
+"\xF7\xDC\xE3\xDE\x5D\x5E\x8F\xFE\x02\x9C\xC6\xE0\xA0\x74\x04\x00"
+"\x00"
+;
@@ -1,64 +1,97 @@
-static constexpr char rdm_js[] = {
-0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x72,
-0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x74, 0x72, 0x79, 0x20, 0x7B,
-0x0A, 0x6C, 0x65, 0x74, 0x20, 0x64, 0x61, 0x74, 0x61, 0x3D, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20,
-0x67, 0x65, 0x74, 0x4A, 0x53, 0x4F, 0x4E, 0x28, 0x27, 0x72, 0x64, 0x6D, 0x2F, 0x70, 0x6F, 0x72,
-0x74, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x27, 0x29, 0x0A, 0x6C, 0x65, 0x74, 0x20, 0x68, 0x3D,
-0x27, 0x3C, 0x74, 0x72, 0x3E, 0x3C, 0x74, 0x68, 0x3E, 0x50, 0x6F, 0x72, 0x74, 0x3C, 0x2F, 0x74,
-0x68, 0x3E, 0x3C, 0x74, 0x68, 0x3E, 0x44, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x3C,
-0x2F, 0x74, 0x68, 0x3E, 0x3C, 0x74, 0x68, 0x3E, 0x53, 0x74, 0x61, 0x74, 0x75, 0x73, 0x3C, 0x2F,
-0x74, 0x68, 0x3E, 0x3C, 0x2F, 0x74, 0x72, 0x3E, 0x27, 0x0A, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x66,
-0x6F, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x3D, 0x3E, 0x20, 0x7B,
-0x0A, 0x68, 0x2B, 0x3D, 0x60, 0x3C, 0x74, 0x72, 0x3E, 0x3C, 0x74, 0x64, 0x3E, 0x24, 0x7B, 0x69,
-0x74, 0x65, 0x6D, 0x2E, 0x70, 0x6F, 0x72, 0x74, 0x7D, 0x3C, 0x2F, 0x74, 0x64, 0x3E, 0x3C, 0x74,
-0x64, 0x3E, 0x24, 0x7B, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x64, 0x69, 0x72, 0x65, 0x63, 0x74, 0x69,
-0x6F, 0x6E, 0x7D, 0x3C, 0x2F, 0x74, 0x64, 0x3E, 0x3C, 0x74, 0x64, 0x3E, 0x24, 0x7B, 0x69, 0x74,
-0x65, 0x6D, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x7D, 0x3C, 0x2F, 0x74, 0x64, 0x3E, 0x3C,
-0x2F, 0x74, 0x72, 0x3E, 0x60, 0x0A, 0x7D, 0x29, 0x3B, 0x0A, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65,
-0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49,
-0x64, 0x28, 0x22, 0x69, 0x64, 0x43, 0x66, 0x67, 0x22, 0x29, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72,
-0x48, 0x54, 0x4D, 0x4C, 0x3D, 0x68, 0x0A, 0x6C, 0x65, 0x74, 0x20, 0x74, 0x72, 0x3D, 0x61, 0x77,
-0x61, 0x69, 0x74, 0x20, 0x50, 0x72, 0x6F, 0x6D, 0x69, 0x73, 0x65, 0x2E, 0x61, 0x6C, 0x6C, 0x28,
-0x0A, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x6D, 0x61, 0x70, 0x28, 0x69, 0x74, 0x65, 0x6D, 0x20, 0x3D,
-0x3E, 0x20, 0x67, 0x65, 0x74, 0x4A, 0x53, 0x4F, 0x4E, 0x28, 0x27, 0x72, 0x64, 0x6D, 0x2F, 0x74,
-0x6F, 0x64, 0x3F, 0x27, 0x20, 0x2B, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x70, 0x6F, 0x72, 0x74,
-0x29, 0x2E, 0x74, 0x68, 0x65, 0x6E, 0x28, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x20,
-0x3D, 0x3E, 0x20, 0x28, 0x7B, 0x20, 0x70, 0x6F, 0x72, 0x74, 0x3A, 0x20, 0x69, 0x74, 0x65, 0x6D,
-0x2E, 0x70, 0x6F, 0x72, 0x74, 0x2C, 0x20, 0x74, 0x6F, 0x64, 0x3A, 0x20, 0x72, 0x65, 0x73, 0x70,
-0x6F, 0x6E, 0x73, 0x65, 0x2E, 0x74, 0x6F, 0x64, 0x20, 0x7D, 0x29, 0x29, 0x29, 0x0A, 0x29, 0x3B,
-0x0A, 0x74, 0x72, 0x79, 0x20, 0x7B, 0x0A, 0x6C, 0x65, 0x74, 0x20, 0x71, 0x3D, 0x61, 0x77, 0x61,
-0x69, 0x74, 0x20, 0x67, 0x65, 0x74, 0x4A, 0x53, 0x4F, 0x4E, 0x28, 0x27, 0x72, 0x64, 0x6D, 0x2F,
-0x71, 0x75, 0x65, 0x75, 0x65, 0x27, 0x29, 0x0A, 0x68, 0x3D, 0x27, 0x27, 0x3B, 0x0A, 0x71, 0x2E,
-0x75, 0x69, 0x64, 0x2E, 0x66, 0x6F, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x75, 0x69, 0x64, 0x20,
-0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x68, 0x2B, 0x3D, 0x60, 0x3C, 0x74, 0x72, 0x3E, 0x3C, 0x74, 0x64,
-0x20, 0x63, 0x6F, 0x6C, 0x73, 0x70, 0x61, 0x6E, 0x3D, 0x22, 0x33, 0x22, 0x3E, 0x24, 0x7B, 0x75,
-0x69, 0x64, 0x7D, 0x3C, 0x2F, 0x74, 0x64, 0x3E, 0x3C, 0x2F, 0x74, 0x72, 0x3E, 0x60, 0x0A, 0x7D,
-0x29, 0x3B, 0x0A, 0x7D, 0x20, 0x63, 0x61, 0x74, 0x63, 0x68, 0x20, 0x28, 0x65, 0x72, 0x72, 0x6F,
-0x72, 0x29, 0x7B, 0x68, 0x3D, 0x27, 0x27, 0x7D, 0x0A, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E,
-0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64,
-0x28, 0x22, 0x69, 0x64, 0x51, 0x75, 0x65, 0x22, 0x29, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48,
-0x54, 0x4D, 0x4C, 0x3D, 0x68, 0x0A, 0x74, 0x72, 0x2E, 0x73, 0x6F, 0x72, 0x74, 0x28, 0x28, 0x61,
-0x2C, 0x20, 0x62, 0x29, 0x20, 0x3D, 0x3E, 0x20, 0x7B, 0x0A, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E,
-0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x66, 0x69, 0x6E, 0x64, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x28,
-0x69, 0x74, 0x65, 0x6D, 0x20, 0x3D, 0x3E, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x70, 0x6F, 0x72,
-0x74, 0x20, 0x3D, 0x3D, 0x3D, 0x20, 0x61, 0x2E, 0x70, 0x6F, 0x72, 0x74, 0x29, 0x20, 0x2D, 0x20,
-0x64, 0x61, 0x74, 0x61, 0x2E, 0x66, 0x69, 0x6E, 0x64, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x28, 0x69,
-0x74, 0x65, 0x6D, 0x20, 0x3D, 0x3E, 0x20, 0x69, 0x74, 0x65, 0x6D, 0x2E, 0x70, 0x6F, 0x72, 0x74,
-0x20, 0x3D, 0x3D, 0x3D, 0x20, 0x62, 0x2E, 0x70, 0x6F, 0x72, 0x74, 0x29, 0x3B, 0x0A, 0x7D, 0x29,
-0x3B, 0x0A, 0x6C, 0x65, 0x74, 0x20, 0x68, 0x64, 0x72, 0x73, 0x3D, 0x27, 0x3C, 0x74, 0x72, 0x3E,
-0x27, 0x0A, 0x6C, 0x65, 0x74, 0x20, 0x74, 0x64, 0x64, 0x3D, 0x27, 0x3C, 0x74, 0x72, 0x3E, 0x27,
-0x0A, 0x74, 0x72, 0x2E, 0x66, 0x6F, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x72, 0x20, 0x3D, 0x3E,
-0x20, 0x7B, 0x0A, 0x68, 0x64, 0x72, 0x73, 0x2B, 0x3D, 0x60, 0x3C, 0x74, 0x68, 0x3E, 0x24, 0x7B,
-0x72, 0x2E, 0x70, 0x6F, 0x72, 0x74, 0x7D, 0x3C, 0x2F, 0x74, 0x68, 0x3E, 0x60, 0x3B, 0x0A, 0x74,
-0x64, 0x64, 0x2B, 0x3D, 0x27, 0x3C, 0x74, 0x64, 0x3E, 0x27, 0x3B, 0x0A, 0x72, 0x2E, 0x74, 0x6F,
-0x64, 0x2E, 0x66, 0x6F, 0x72, 0x45, 0x61, 0x63, 0x68, 0x28, 0x74, 0x6F, 0x64, 0x20, 0x3D, 0x3E,
-0x20, 0x7B, 0x0A, 0x74, 0x64, 0x64, 0x2B, 0x3D, 0x60, 0x24, 0x7B, 0x74, 0x6F, 0x64, 0x7D, 0x3C,
-0x62, 0x72, 0x2F, 0x3E, 0x60, 0x0A, 0x7D, 0x29, 0x3B, 0x0A, 0x74, 0x64, 0x64, 0x2B, 0x3D, 0x27,
-0x3C, 0x2F, 0x74, 0x64, 0x3E, 0x27, 0x0A, 0x7D, 0x29, 0x3B, 0x0A, 0x68, 0x64, 0x72, 0x73, 0x2B,
-0x3D, 0x27, 0x3C, 0x2F, 0x74, 0x72, 0x3E, 0x27, 0x0A, 0x74, 0x64, 0x64, 0x2B, 0x3D, 0x27, 0x3C,
-0x2F, 0x74, 0x72, 0x3E, 0x27, 0x0A, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67,
-0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x22, 0x69,
-0x64, 0x44, 0x69, 0x73, 0x22, 0x29, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C,
-0x3D, 0x68, 0x64, 0x72, 0x73, 0x20, 0x2B, 0x20, 0x74, 0x64, 0x64, 0x0A, 0x7D, 0x20, 0x63, 0x61,
-0x74, 0x63, 0x68, 0x20, 0x28, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x29, 0x7B, 0x7D, 0x0A, 0x7D, 0x00
-};
+static constexpr char rdm_js[] =
+"\x61\x73\x79\x6E\x63\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x72"
+"\x65\x66\x72\x65\x73\x68\x28\x29\x20\x7B\x0A\x74\x72\x79\x20\x7B"
+"\x0A\x6C\x65\x74\x20\x64\x61\x74\x61\x3D\x61\x77\x61\x69\x74\x20"
+"\x67\x65\x74\x4A\x53\x4F\x4E\x28\x27\x72\x64\x6D\x2F\x70\x6F\x72"
+"\x74\x73\x74\x61\x74\x75\x73\x27\x29\x0A\x6C\x65\x74\x20\x68\x3D"
+"\x27\x3C\x74\x72\x3E\x3C\x74\x68\x3E\x50\x6F\x72\x74\x3C\x2F\x74"
+"\x68\x3E\x3C\x74\x68\x3E\x44\x69\x72\x65\x63\x74\x69\x6F\x6E\x3C"
+"\x2F\x74\x68\x3E\x3C\x74\x68\x3E\x53\x74\x61\x74\x75\x73\x3C\x2F"
+"\x74\x68\x3E\x3C\x2F\x74\x72\x3E\x27\x0A\x64\x61\x74\x61\x2E\x66"
+"\x6F\x72\x45\x61\x63\x68\x28\x69\x74\x65\x6D\x20\x3D\x3E\x20\x7B"
+"\x0A\x68\x2B\x3D\x60\x3C\x74\x72\x3E\x3C\x74\x64\x3E\x24\x7B\x69"
+"\x74\x65\x6D\x2E\x70\x6F\x72\x74\x7D\x3C\x2F\x74\x64\x3E\x3C\x74"
+"\x64\x3E\x24\x7B\x69\x74\x65\x6D\x2E\x64\x69\x72\x65\x63\x74\x69"
+"\x6F\x6E\x7D\x3C\x2F\x74\x64\x3E\x3C\x74\x64\x3E\x24\x7B\x69\x74"
+"\x65\x6D\x2E\x73\x74\x61\x74\x75\x73\x7D\x3C\x2F\x74\x64\x3E\x3C"
+"\x2F\x74\x72\x3E\x60\x0A\x7D\x29\x3B\x0A\x64\x6F\x63\x75\x6D\x65"
+"\x6E\x74\x2E\x67\x65\x74\x45\x6C\x65\x6D\x65\x6E\x74\x42\x79\x49"
+"\x64\x28\x22\x69\x64\x43\x66\x67\x22\x29\x2E\x69\x6E\x6E\x65\x72"
+"\x48\x54\x4D\x4C\x3D\x68\x0A\x6C\x65\x74\x20\x74\x72\x3D\x61\x77"
+"\x61\x69\x74\x20\x50\x72\x6F\x6D\x69\x73\x65\x2E\x61\x6C\x6C\x28"
+"\x0A\x64\x61\x74\x61\x2E\x6D\x61\x70\x28\x69\x74\x65\x6D\x20\x3D"
+"\x3E\x20\x67\x65\x74\x4A\x53\x4F\x4E\x28\x27\x72\x64\x6D\x2F\x74"
+"\x6F\x64\x3F\x27\x20\x2B\x20\x69\x74\x65\x6D\x2E\x70\x6F\x72\x74"
+"\x29\x2E\x74\x68\x65\x6E\x28\x72\x65\x73\x70\x6F\x6E\x73\x65\x20"
+"\x3D\x3E\x20\x28\x7B\x20\x70\x6F\x72\x74\x3A\x20\x69\x74\x65\x6D"
+"\x2E\x70\x6F\x72\x74\x2C\x20\x74\x6F\x64\x3A\x20\x72\x65\x73\x70"
+"\x6F\x6E\x73\x65\x2E\x74\x6F\x64\x20\x7D\x29\x29\x29\x0A\x29\x3B"
+"\x0A\x74\x72\x79\x20\x7B\x0A\x6C\x65\x74\x20\x71\x3D\x61\x77\x61"
+"\x69\x74\x20\x67\x65\x74\x4A\x53\x4F\x4E\x28\x27\x72\x64\x6D\x2F"
+"\x71\x75\x65\x75\x65\x27\x29\x0A\x68\x3D\x27\x27\x3B\x0A\x71\x2E"
+"\x75\x69\x64\x2E\x66\x6F\x72\x45\x61\x63\x68\x28\x75\x69\x64\x20"
+"\x3D\x3E\x20\x7B\x0A\x68\x2B\x3D\x60\x3C\x74\x72\x3E\x3C\x74\x64"
+"\x20\x63\x6F\x6C\x73\x70\x61\x6E\x3D\x22\x33\x22\x3E\x24\x7B\x75"
+"\x69\x64\x7D\x3C\x2F\x74\x64\x3E\x3C\x2F\x74\x72\x3E\x60\x0A\x7D"
+"\x29\x3B\x0A\x7D\x20\x63\x61\x74\x63\x68\x20\x28\x65\x72\x72\x6F"
+"\x72\x29\x7B\x68\x3D\x27\x27\x7D\x0A\x64\x6F\x63\x75\x6D\x65\x6E"
+"\x74\x2E\x67\x65\x74\x45\x6C\x65\x6D\x65\x6E\x74\x42\x79\x49\x64"
+"\x28\x22\x69\x64\x51\x75\x65\x22\x29\x2E\x69\x6E\x6E\x65\x72\x48"
+"\x54\x4D\x4C\x3D\x68\x0A\x74\x72\x2E\x73\x6F\x72\x74\x28\x28\x61"
+"\x2C\x20\x62\x29\x20\x3D\x3E\x20\x7B\x0A\x72\x65\x74\x75\x72\x6E"
+"\x20\x64\x61\x74\x61\x2E\x66\x69\x6E\x64\x49\x6E\x64\x65\x78\x28"
+"\x69\x74\x65\x6D\x20\x3D\x3E\x20\x69\x74\x65\x6D\x2E\x70\x6F\x72"
+"\x74\x20\x3D\x3D\x3D\x20\x61\x2E\x70\x6F\x72\x74\x29\x20\x2D\x20"
+"\x64\x61\x74\x61\x2E\x66\x69\x6E\x64\x49\x6E\x64\x65\x78\x28\x69"
+"\x74\x65\x6D\x20\x3D\x3E\x20\x69\x74\x65\x6D\x2E\x70\x6F\x72\x74"
+"\x20\x3D\x3D\x3D\x20\x62\x2E\x70\x6F\x72\x74\x29\x3B\x0A\x7D\x29"
+"\x3B\x0A\x6C\x65\x74\x20\x68\x64\x72\x73\x3D\x27\x3C\x74\x72\x3E"
+"\x27\x0A\x6C\x65\x74\x20\x74\x64\x64\x3D\x27\x3C\x74\x72\x3E\x27"
+"\x0A\x74\x72\x2E\x66\x6F\x72\x45\x61\x63\x68\x28\x72\x20\x3D\x3E"
+"\x20\x7B\x0A\x68\x64\x72\x73\x2B\x3D\x60\x3C\x74\x68\x3E\x24\x7B"
+"\x72\x2E\x70\x6F\x72\x74\x7D\x3C\x2F\x74\x68\x3E\x60\x3B\x0A\x74"
+"\x64\x64\x2B\x3D\x27\x3C\x74\x64\x3E\x27\x3B\x0A\x72\x2E\x74\x6F"
+"\x64\x2E\x66\x6F\x72\x45\x61\x63\x68\x28\x74\x6F\x64\x20\x3D\x3E"
+"\x20\x7B\x0A\x74\x64\x64\x2B\x3D\x60\x24\x7B\x74\x6F\x64\x7D\x3C"
+"\x62\x72\x2F\x3E\x60\x0A\x7D\x29\x3B\x0A\x74\x64\x64\x2B\x3D\x27"
+"\x3C\x2F\x74\x64\x3E\x27\x0A\x7D\x29\x3B\x0A\x68\x64\x72\x73\x2B"
+"\x3D\x27\x3C\x2F\x74\x72\x3E\x27\x0A\x74\x64\x64\x2B\x3D\x27\x3C"
+"\x2F\x74\x72\x3E\x27\x0A\x64\x6F\x63\x75\x6D\x65\x6E\x74\x2E\x67"
+"\x65\x74\x45\x6C\x65\x6D\x65\x6E\x74\x42\x79\x49\x64\x28\x22\x69"
+"\x64\x44\x69\x73\x22\x29\x2E\x69\x6E\x6E\x65\x72\x48\x54\x4D\x4C"
+"\x3D\x68\x64\x72\x73\x20\x2B\x20\x74\x64\x64\x0A\x7D\x20\x63\x61"
+"\x74\x63\x68\x20\x28\x65\x72\x72\x6F\x72\x29\x7B\x7D\x0A\x7D"
+;
+static constexpr char rdm_js_gz[] =
+"\x1F\x8B\x08\x00\x00\x00\x00\x00\x02\x03\x8D\x93\xDD\x6E\xDB\x30"
+"\x0C\x85\xEF\xFD\x14\x44\x50\xC0\x12\xD2\x39\x17\xBB\x6B\x62\x0F"
+"\xD8\x5A\x60\x1D\xF6\xD3\xA1\x7B\x80\x28\x96\x52\x09\xB0\xE5\x84"
+"\x92\xB1\x05\x86\xDF\x7D\x94\xE4\xB8\xEB\xB2\x0D\xBB\x31\x24\x8A"
+"\x47\xA4\xBE\x43\x0B\x77\xB2\x35\xEC\x7B\x5B\x7B\xD3\x59\x40\xB5"
+"\x47\xE5\x34\xE3\x30\x64\x1E\x4F\xF4\x6D\x94\x07\x29\xBC\x28\xC5"
+"\x77\x61\x3C\x3C\x29\xFF\xE1\xF1\xCB\x67\x96\xA3\x6C\x57\x87\x0E"
+"\xBD\xF3\xC2\xF7\x2E\xE7\x31\x51\x97\xF9\xC6\x63\xB5\xF1\xBA\x7A"
+"\xA0\xB3\xCD\x8A\x16\x61\x73\x6B\x50\xC5\x02\x73\xE4\x31\xCA\xD2"
+"\x76\x45\x92\x3C\x0B\x45\x8A\x7D\x87\x77\xA2\xD6\xCC\x78\xD5\x42"
+"\x59\x51\x7D\xBD\x2C\xB7\xE9\x4E\x59\x5D\x0D\x21\x5E\x84\xB2\x23"
+"\xA9\xE4\xAF\x41\x79\x2E\x71\x71\x92\x3A\x9C\xC2\xA1\xD6\x36\x1B"
+"\xF9\x3A\x93\x5D\xDD\xB7\xCA\xFA\x82\x9E\x74\xD7\xA8\xB0\x7C\x7B"
+"\xBA\x97\x6C\x61\xE4\xBB\xFD\xD3\x82\x17\xC6\x5A\x85\xEF\xBF\x7D"
+"\xFA\x58\xEA\xF8\x38\x8F\x13\x83\x07\xEC\x5A\xE3\x54\x21\x9A\x86"
+"\xA5\xB6\x5B\x71\x98\x5B\x7E\x41\xC8\x77\xF2\x4D\x0E\x4B\x98\xFB"
+"\xE6\x85\xD7\xCA\x32\x82\x7C\xE8\xAC\x53\x41\xC0\x06\x08\x27\x37"
+"\xCF\x49\xD7\x40\xBA\x1B\x38\x27\x15\xB4\x83\x91\x73\x9E\x51\xDB"
+"\xCF\xAE\x1C\xFF\x64\xC9\xB1\x57\xBD\x22\x37\xC8\x89\x7C\x9D\x1D"
+"\x8B\xDE\xC8\x19\x2A\xAD\x2F\x98\x42\xDD\x35\xEE\x20\x6C\xB9\x78"
+"\xBD\x20\x60\x94\x72\x01\x6A\x84\x5A\xF8\x5A\x03\x53\x88\x1D\xF2"
+"\x21\x5C\x3D\xFE\x0B\xDF\xD7\x5E\xFD\x86\xCF\x63\xE1\xE8\x5D\x8C"
+"\x89\x6B\xD8\xF1\xD4\x04\x2A\xDF\xA3\x85\x64\xBB\xB1\xF2\xDE\x4A"
+"\xF5\x63\xA6\x38\xB3\x80\xB2\x2C\x41\x24\x76\xF0\xEA\xFF\xD2\x77"
+"\x29\x7D\x1D\xDB\x8F\x73\x29\xD1\xA5\xD1\xCC\x93\x95\x52\x9E\xB7"
+"\xD4\xDA\x99\x0F\x4E\x74\x28\x39\x02\xD2\x04\x04\xE7\x69\xD3\xD5"
+"\x96\xE8\x4B\xB9\x0C\x4A\x59\x11\x5D\x0C\xC6\xCC\xEA\x60\x52\xD4"
+"\xC7\x9C\xED\xD5\x40\x81\x71\xB3\xC3\xD5\x84\x71\x92\x06\xB8\x79"
+"\x0C\xA4\x3A\xF9\x34\xFE\xF3\x71\xFC\x17\xFE\x0E\xF7\xD6\xB8\x97"
+"\x70\xE9\x16\x1A\x30\x92\x5F\x18\x35\x66\xE3\x4F\x62\x61\x45\xD2"
+"\xDF\x03\x00\x00"
+;
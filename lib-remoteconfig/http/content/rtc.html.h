@@ -1,66 +1,97 @@
-static constexpr char rtc_html[] = {
-0x3C, 0x21, 0x44, 0x4F, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x0A,
-0x3C, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x0A, 0x3C, 0x68, 0x65, 0x61, 0x64, 0x3E, 0x3C, 0x6C, 0x69,
-0x6E, 0x6B, 0x20, 0x72, 0x65, 0x6C, 0x3D, 0x22, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x73, 0x68, 0x65,
-0x65, 0x74, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x73,
-0x2E, 0x63, 0x73, 0x73, 0x22, 0x20, 0x2F, 0x3E, 0x3C, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x3E, 0x52,
-0x65, 0x61, 0x6C, 0x2D, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x63, 0x6C, 0x6F, 0x63, 0x6B, 0x3C, 0x2F,
-0x74, 0x69, 0x74, 0x6C, 0x65, 0x3E, 0x3C, 0x2F, 0x68, 0x65, 0x61, 0x64, 0x3E, 0x0A, 0x3C, 0x62,
-0x6F, 0x64, 0x79, 0x3E, 0x0A, 0x3C, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x3E, 0x3C, 0x75, 0x6C,
-0x20, 0x69, 0x64, 0x3D, 0x22, 0x69, 0x64, 0x4C, 0x69, 0x73, 0x74, 0x22, 0x3E, 0x3C, 0x2F, 0x75,
-0x6C, 0x3E, 0x3C, 0x2F, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x3E, 0x0A, 0x3C, 0x70, 0x3E, 0x3C,
-0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D, 0x22,
-0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x28, 0x29, 0x22, 0x3E, 0x52, 0x65, 0x66, 0x72, 0x65,
-0x73, 0x68, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x3C, 0x2F, 0x70, 0x3E, 0x0A,
-0x3C, 0x70, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x69, 0x6D, 0x65, 0x22,
-0x3E, 0x4E, 0x6F, 0x64, 0x65, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20,
-0x62, 0x65, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x65, 0x64, 0x20, 0x68, 0x65, 0x72,
-0x65, 0x3C, 0x2F, 0x70, 0x3E, 0x0A, 0x3C, 0x70, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x72, 0x74, 0x63,
-0x54, 0x69, 0x6D, 0x65, 0x22, 0x3E, 0x52, 0x54, 0x43, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x77,
-0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x65, 0x64,
-0x20, 0x68, 0x65, 0x72, 0x65, 0x3C, 0x2F, 0x70, 0x3E, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x3E, 0x0A,
-0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D,
-0x22, 0x68, 0x63, 0x54, 0x6F, 0x53, 0x79, 0x73, 0x28, 0x29, 0x22, 0x3E, 0x53, 0x65, 0x74, 0x20,
-0x74, 0x68, 0x65, 0x20, 0x4E, 0x6F, 0x64, 0x65, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x66, 0x72,
-0x6F, 0x6D, 0x20, 0x74, 0x68, 0x65, 0x20, 0x52, 0x54, 0x43, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74,
-0x6F, 0x6E, 0x3E, 0x0A, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C,
-0x69, 0x63, 0x6B, 0x3D, 0x22, 0x73, 0x79, 0x73, 0x54, 0x6F, 0x48, 0x63, 0x28, 0x29, 0x22, 0x3E,
-0x53, 0x65, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x52, 0x54, 0x43, 0x20, 0x66, 0x72, 0x6F, 0x6D,
-0x20, 0x74, 0x68, 0x65, 0x20, 0x4E, 0x6F, 0x64, 0x65, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x3C, 0x2F,
-0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x3C,
-0x70, 0x3E, 0x0A, 0x3C, 0x66, 0x6F, 0x72, 0x6D, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x66, 0x6F, 0x72,
-0x6D, 0x22, 0x3E, 0x0A, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x22,
-0x61, 0x6C, 0x61, 0x72, 0x6D, 0x49, 0x6E, 0x70, 0x75, 0x74, 0x22, 0x3E, 0x52, 0x54, 0x43, 0x20,
-0x41, 0x6C, 0x61, 0x72, 0x6D, 0x3A, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x3C,
-0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x64, 0x61, 0x74, 0x65,
-0x74, 0x69, 0x6D, 0x65, 0x2D, 0x6C, 0x6F, 0x63, 0x61, 0x6C, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22,
-0x61, 0x6C, 0x61, 0x72, 0x6D, 0x49, 0x6E, 0x70, 0x75, 0x74, 0x22, 0x20, 0x6E, 0x61, 0x6D, 0x65,
-0x3D, 0x22, 0x61, 0x6C, 0x61, 0x72, 0x6D, 0x49, 0x6E, 0x70, 0x75, 0x74, 0x22, 0x20, 0x72, 0x65,
-0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x3E, 0x0A, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66,
-0x6F, 0x72, 0x3D, 0x22, 0x63, 0x68, 0x6B, 0x62, 0x6F, 0x78, 0x22, 0x3E, 0x45, 0x6E, 0x61, 0x62,
-0x6C, 0x65, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x0A, 0x3C, 0x69, 0x6E, 0x70, 0x75,
-0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78,
-0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x63, 0x68, 0x6B, 0x62, 0x6F, 0x78, 0x22, 0x20, 0x6E, 0x61,
-0x6D, 0x65, 0x3D, 0x22, 0x45, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x22, 0x3E, 0x0A, 0x3C, 0x62, 0x75,
-0x74, 0x74, 0x6F, 0x6E, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6F,
-0x6E, 0x22, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D, 0x22, 0x61, 0x6C, 0x61, 0x72,
-0x6D, 0x28, 0x29, 0x22, 0x3E, 0x53, 0x65, 0x74, 0x3C, 0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E,
-0x3E, 0x0A, 0x3C, 0x2F, 0x66, 0x6F, 0x72, 0x6D, 0x3E, 0x0A, 0x3C, 0x66, 0x6F, 0x6F, 0x74, 0x65,
-0x72, 0x3E, 0x3C, 0x75, 0x6C, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x69, 0x64, 0x56, 0x65, 0x72, 0x73,
-0x69, 0x6F, 0x6E, 0x22, 0x3E, 0x3C, 0x2F, 0x75, 0x6C, 0x3E, 0x3C, 0x2F, 0x66, 0x6F, 0x6F, 0x74,
-0x65, 0x72, 0x3E, 0x0A, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D,
-0x22, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2E, 0x6A, 0x73, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65,
-0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2F, 0x6A, 0x61, 0x76, 0x61, 0x73, 0x63, 0x72, 0x69, 0x70,
-0x74, 0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x73, 0x63,
-0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D, 0x22, 0x64, 0x61, 0x74, 0x65, 0x2E, 0x6A,
-0x73, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2F, 0x6A, 0x61,
-0x76, 0x61, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69,
-0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D,
-0x22, 0x72, 0x74, 0x63, 0x2E, 0x6A, 0x73, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74,
-0x65, 0x78, 0x74, 0x2F, 0x6A, 0x61, 0x76, 0x61, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x3E,
-0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70,
-0x74, 0x3E, 0x6C, 0x69, 0x73, 0x74, 0x28, 0x29, 0x3B, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E,
-0x28, 0x29, 0x3B, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x28, 0x29, 0x3C, 0x2F, 0x73, 0x63,
-0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x2F, 0x62, 0x6F, 0x64, 0x79, 0x3E, 0x0A, 0x3C, 0x2F,
-0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x00
-};
+static constexpr char rtc_html[] =
+"\x3C\x21\x44\x4F\x43\x54\x59\x50\x45\x20\x68\x74\x6D\x6C\x3E\x0A"
+"\x3C\x68\x74\x6D\x6C\x3E\x0A\x3C\x68\x65\x61\x64\x3E\x3C\x6C\x69"
+"\x6E\x6B\x20\x72\x65\x6C\x3D\x22\x73\x74\x79\x6C\x65\x73\x68\x65"
+"\x65\x74\x22\x20\x68\x72\x65\x66\x3D\x22\x73\x74\x79\x6C\x65\x73"
+"\x2E\x63\x73\x73\x22\x20\x2F\x3E\x3C\x74\x69\x74\x6C\x65\x3E\x52"
+"\x65\x61\x6C\x2D\x74\x69\x6D\x65\x20\x63\x6C\x6F\x63\x6B\x3C\x2F"
+"\x74\x69\x74\x6C\x65\x3E\x3C\x2F\x68\x65\x61\x64\x3E\x0A\x3C\x62"
+"\x6F\x64\x79\x3E\x0A\x3C\x68\x65\x61\x64\x65\x72\x3E\x3C\x75\x6C"
+"\x20\x69\x64\x3D\x22\x69\x64\x4C\x69\x73\x74\x22\x3E\x3C\x2F\x75"
+"\x6C\x3E\x3C\x2F\x68\x65\x61\x64\x65\x72\x3E\x0A\x3C\x70\x3E\x3C"
+"\x62\x75\x74\x74\x6F\x6E\x20\x6F\x6E\x63\x6C\x69\x63\x6B\x3D\x22"
+"\x72\x65\x66\x72\x65\x73\x68\x28\x29\x22\x3E\x52\x65\x66\x72\x65"
+"\x73\x68\x3C\x2F\x62\x75\x74\x74\x6F\x6E\x3E\x3C\x2F\x70\x3E\x0A"
+"\x3C\x70\x20\x69\x64\x3D\x22\x6E\x6F\x64\x65\x54\x69\x6D\x65\x22"
+"\x3E\x4E\x6F\x64\x65\x20\x74\x69\x6D\x65\x20\x77\x69\x6C\x6C\x20"
+"\x62\x65\x20\x64\x69\x73\x70\x6C\x61\x79\x65\x64\x20\x68\x65\x72"
+"\x65\x3C\x2F\x70\x3E\x0A\x3C\x70\x20\x69\x64\x3D\x22\x72\x74\x63"
+"\x54\x69\x6D\x65\x22\x3E\x52\x54\x43\x20\x74\x69\x6D\x65\x20\x77"
+"\x69\x6C\x6C\x20\x62\x65\x20\x64\x69\x73\x70\x6C\x61\x79\x65\x64"
+"\x20\x68\x65\x72\x65\x3C\x2F\x70\x3E\x0A\x3C\x64\x69\x76\x3E\x0A"
+"\x3C\x62\x75\x74\x74\x6F\x6E\x20\x6F\x6E\x63\x6C\x69\x63\x6B\x3D"
+"\x22\x68\x63\x54\x6F\x53\x79\x73\x28\x29\x22\x3E\x53\x65\x74\x20"
+"\x74\x68\x65\x20\x4E\x6F\x64\x65\x20\x74\x69\x6D\x65\x20\x66\x72"
+"\x6F\x6D\x20\x74\x68\x65\x20\x52\x54\x43\x3C\x2F\x62\x75\x74\x74"
+"\x6F\x6E\x3E\x0A\x3C\x62\x75\x74\x74\x6F\x6E\x20\x6F\x6E\x63\x6C"
+"\x69\x63\x6B\x3D\x22\x73\x79\x73\x54\x6F\x48\x63\x28\x29\x22\x3E"
+"\x53\x65\x74\x20\x74\x68\x65\x20\x52\x54\x43\x20\x66\x72\x6F\x6D"
+"\x20\x74\x68\x65\x20\x4E\x6F\x64\x65\x20\x74\x69\x6D\x65\x3C\x2F"
+"\x62\x75\x74\x74\x6F\x6E\x3E\x0A\x3C\x2F\x64\x69\x76\x3E\x0A\x3C"
+"\x70\x3E\x0A\x3C\x66\x6F\x72\x6D\x20\x69\x64\x3D\x22\x66\x6F\x72"
+"\x6D\x22\x3E\x0A\x3C\x6C\x61\x62\x65\x6C\x20\x66\x6F\x72\x3D\x22"
+"\x61\x6C\x61\x72\x6D\x49\x6E\x70\x75\x74\x22\x3E\x52\x54\x43\x20"
+"\x41\x6C\x61\x72\x6D\x3A\x3C\x2F\x6C\x61\x62\x65\x6C\x3E\x0A\x3C"
+"\x69\x6E\x70\x75\x74\x20\x74\x79\x70\x65\x3D\x22\x64\x61\x74\x65"
+"\x74\x69\x6D\x65\x2D\x6C\x6F\x63\x61\x6C\x22\x20\x69\x64\x3D\x22"
+"\x61\x6C\x61\x72\x6D\x49\x6E\x70\x75\x74\x22\x20\x6E\x61\x6D\x65"
+"\x3D\x22\x61\x6C\x61\x72\x6D\x49\x6E\x70\x75\x74\x22\x20\x72\x65"
+"\x71\x75\x69\x72\x65\x64\x3E\x0A\x3C\x6C\x61\x62\x65\x6C\x20\x66"
+"\x6F\x72\x3D\x22\x63\x68\x6B\x62\x6F\x78\x22\x3E\x45\x6E\x61\x62"
+"\x6C\x65\x3C\x2F\x6C\x61\x62\x65\x6C\x3E\x0A\x3C\x69\x6E\x70\x75"
+"\x74\x20\x74\x79\x70\x65\x3D\x22\x63\x68\x65\x63\x6B\x62\x6F\x78"
+"\x22\x20\x69\x64\x3D\x22\x63\x68\x6B\x62\x6F\x78\x22\x20\x6E\x61"
+"\x6D\x65\x3D\x22\x45\x6E\x61\x62\x6C\x65\x22\x3E\x0A\x3C\x62\x75"
+"\x74\x74\x6F\x6E\x20\x74\x79\x70\x65\x3D\x22\x62\x75\x74\x74\x6F"
+"\x6E\x22\x20\x6F\x6E\x63\x6C\x69\x63\x6B\x3D\x22\x61\x6C\x61\x72"
+"\x6D\x28\x29\x22\x3E\x53\x65\x74\x3C\x2F\x62\x75\x74\x74\x6F\x6E"
+"\x3E\x0A\x3C\x2F\x66\x6F\x72\x6D\x3E\x0A\x3C\x66\x6F\x6F\x74\x65"
+"\x72\x3E\x3C\x75\x6C\x20\x69\x64\x3D\x22\x69\x64\x56\x65\x72\x73"
+"\x69\x6F\x6E\x22\x3E\x3C\x2F\x75\x6C\x3E\x3C\x2F\x66\x6F\x6F\x74"
+"\x65\x72\x3E\x0A\x3C\x73\x63\x72\x69\x70\x74\x20\x73\x72\x63\x3D"
+"\x22\x73\x74\x61\x74\x69\x63\x2E\x6A\x73\x22\x20\x74\x79\x70\x65"
+"\x3D\x22\x74\x65\x78\x74\x2F\x6A\x61\x76\x61\x73\x63\x72\x69\x70"
+"\x74\x22\x3E\x3C\x2F\x73\x63\x72\x69\x70\x74\x3E\x0A\x3C\x73\x63"
+"\x72\x69\x70\x74\x20\x73\x72\x63\x3D\x22\x64\x61\x74\x65\x2E\x6A"
+"\x73\x22\x20\x74\x79\x70\x65\x3D\x22\x74\x65\x78\x74\x2F\x6A\x61"
+"\x76\x61\x73\x63\x72\x69\x70\x74\x22\x3E\x3C\x2F\x73\x63\x72\x69"
+"\x70\x74\x3E\x0A\x3C\x73\x63\x72\x69\x70\x74\x20\x73\x72\x63\x3D"
+"\x22\x72\x74\x63\x2E\x6A\x73\x22\x20\x74\x79\x70\x65\x3D\x22\x74"
+"\x65\x78\x74\x2F\x6A\x61\x76\x61\x73\x63\x72\x69\x70\x74\x22\x3E"
+"\x3C\x2F\x73\x63\x72\x69\x70\x74\x3E\x0A\x3C\x73\x63\x72\x69\x70"
+"\x74\x3E\x6C\x69\x73\x74\x28\x29\x3B\x76\x65\x72\x73\x69\x6F\x6E"
+"\x28\x29\x3B\x72\x65\x66\x72\x65\x73\x68\x28\x29\x3C\x2F\x73\x63"
+"\x72\x69\x70\x74\x3E\x0A\x3C\x2F\x62\x6F\x64\x79\x3E\x0A\x3C\x2F"
+"\x68\x74\x6D\x6C\x3E"
+;
+static constexpr char rtc_html_gz[] =
+"\x1F\x8B\x08\x00\x00\x00\x00\x00\x02\x03\x9D\x53\x4B\x6F\xDB\x30"
+"\x0C\xBE\xE7\x57\x68\x3A\xB5\x87\x56\xF7\x4D\x36\x30\x74\x05\x36"
+"\x60\xE8\x8A\xD6\x18\xB0\xA3\x2C\x31\xB0\x1A\xDA\x72\x25\x3A\xAD"
+"\xFF\xFD\xF4\x70\x12\xA7\x1D\x30\x6C\xA7\x50\xF4\xF7\x12\x43\xC9"
+"\x0F\x5F\x7E\xDC\x34\xBF\xEE\x6F\x59\x47\x3D\xD6\x1B\x79\xF8\x01"
+"\x65\x6A\x89\x76\xD8\x31\x0F\x58\xF1\x40\x33\x42\xE8\x00\x88\xB3"
+"\xCE\xC3\xF6\xD0\xB9\xD6\x21\x70\x26\x6A\x49\x96\x10\xEA\x07\x50"
+"\x78\x45\xB6\x07\xA6\xD1\xE9\x9D\x14\xA5\x2D\x45\xD6\xDB\xC8\xD6"
+"\x99\x79\x51\x07\x5F\xCB\x09\x99\x35\x15\xB7\xE6\xBB\x0D\xC4\x23"
+"\x6C\xC2\x05\x1B\xBF\x6E\xE4\x58\xCB\x76\x22\x72\x03\x73\x83\x46"
+"\xAB\x77\x15\x8F\xD6\x3E\xE6\xB8\xB8\xE4\xD1\x2B\x97\x52\x14\x4C"
+"\x24\x8E\x89\x93\x15\x07\x67\xA0\x89\x31\x78\x7D\x17\x2B\x96\x13"
+"\xBD\x58\x44\xD6\x02\x33\x36\x8C\xA8\x66\x30\xAC\x03\x0F\x6B\x96"
+"\x27\x5D\x48\x0F\xCD\xCD\xDF\x39\xC6\xEE\xD3\x8D\xDE\x04\xEC\x74"
+"\xE3\x1E\xE7\x90\x02\x3E\x02\x31\xEA\x80\x9D\x22\x6C\xBD\xEB\x73"
+"\x2B\x1A\x1C\x73\xBF\xD7\x08\x73\x68\xDC\x57\xBD\xD6\x48\x89\x8E"
+"\xEC\xA3\xE0\x4A\x43\x94\x38\x29\xD8\xD6\xF9\x3E\xDF\x27\x15\x3C"
+"\x36\x50\xB5\x80\x2C\x9E\x2A\xAE\x50\xF9\xFE\xDB\x30\x4E\x54\x6E"
+"\xF9\x39\x9D\x3F\x4A\x91\x21\x11\x6A\xD3\x27\x46\xF3\x08\x15\x37"
+"\x8A\x20\xB9\x5C\xC5\xBF\x52\x21\xCF\x92\x2B\x3E\x1B\x54\x0F\xE7"
+"\x1D\x0F\xCF\x93\xF5\x60\xCE\x3D\x75\xB7\x6B\xDD\x2B\xAF\x6F\x07"
+"\xD5\x22\xFC\xD9\x4B\x77\xA0\x33\x2A\xBB\x2C\x8C\xC5\xA1\xF0\xF8"
+"\x69\x50\x85\x52\x0E\xFC\x34\xB6\x9C\x64\x19\xDA\x7A\x32\x69\x0C"
+"\x79\x2C\x8E\xCE\x96\xEE\x27\xF8\x60\xA3\xC2\x61\xEF\x16\xC0\x46"
+"\x06\xED\xED\x48\x2C\x78\x9D\xD6\x5C\x91\xD5\xD7\x4F\x71\xCB\x8B"
+"\x2D\xC1\x2B\x89\x27\xB5\x57\x05\x95\xD8\xA5\x7A\x43\x4C\xD3\xFB"
+"\x0F\x5A\xDC\xC1\x7F\x62\xD5\x18\x9F\xCE\xC5\xE5\xA7\x7D\xB9\x4C"
+"\xAC\x8E\x4F\x64\x85\x15\xCB\xC3\x13\xF9\x79\xFF\x06\x50\x7D\x44"
+"\x0C\xF5\x03\x00\x00"
+;
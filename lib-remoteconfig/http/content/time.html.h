@@ -1,40 +1,62 @@
-static constexpr char time_html[] = {
-0x3C, 0x21, 0x44, 0x4F, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x0A,
-0x3C, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x0A, 0x3C, 0x68, 0x65, 0x61, 0x64, 0x3E, 0x3C, 0x6C, 0x69,
-0x6E, 0x6B, 0x20, 0x72, 0x65, 0x6C, 0x3D, 0x22, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x73, 0x68, 0x65,
-0x65, 0x74, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x73,
-0x2E, 0x63, 0x73, 0x73, 0x22, 0x20, 0x2F, 0x3E, 0x3C, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x3E, 0x4E,
-0x6F, 0x64, 0x65, 0x20, 0x54, 0x69, 0x6D, 0x65, 0x3C, 0x2F, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x3E,
-0x3C, 0x2F, 0x68, 0x65, 0x61, 0x64, 0x3E, 0x0A, 0x3C, 0x62, 0x6F, 0x64, 0x79, 0x3E, 0x0A, 0x3C,
-0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x3E, 0x3C, 0x75, 0x6C, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x69,
-0x64, 0x4C, 0x69, 0x73, 0x74, 0x22, 0x3E, 0x3C, 0x2F, 0x75, 0x6C, 0x3E, 0x3C, 0x2F, 0x68, 0x65,
-0x61, 0x64, 0x65, 0x72, 0x3E, 0x0A, 0x3C, 0x70, 0x3E, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E,
-0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3D, 0x22, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73,
-0x68, 0x28, 0x29, 0x22, 0x3E, 0x52, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x3C, 0x2F, 0x62, 0x75,
-0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x3C, 0x2F, 0x70, 0x3E, 0x0A, 0x3C, 0x70, 0x20, 0x69, 0x64, 0x3D,
-0x22, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x69, 0x6D, 0x65, 0x22, 0x3E, 0x4E, 0x6F, 0x64, 0x65, 0x20,
-0x74, 0x69, 0x6D, 0x65, 0x20, 0x77, 0x69, 0x6C, 0x6C, 0x20, 0x62, 0x65, 0x20, 0x64, 0x69, 0x73,
-0x70, 0x6C, 0x61, 0x79, 0x65, 0x64, 0x20, 0x68, 0x65, 0x72, 0x65, 0x3C, 0x2F, 0x70, 0x3E, 0x0A,
-0x3C, 0x70, 0x3E, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69,
-0x63, 0x6B, 0x3D, 0x22, 0x73, 0x79, 0x6E, 0x63, 0x57, 0x69, 0x74, 0x68, 0x4C, 0x6F, 0x63, 0x61,
-0x6C, 0x54, 0x69, 0x6D, 0x65, 0x28, 0x29, 0x22, 0x3E, 0x53, 0x79, 0x6E, 0x63, 0x20, 0x77, 0x69,
-0x74, 0x68, 0x20, 0x4C, 0x6F, 0x63, 0x61, 0x6C, 0x20, 0x54, 0x69, 0x6D, 0x65, 0x3C, 0x2F, 0x62,
-0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x3C, 0x2F, 0x70, 0x3E, 0x0A, 0x3C, 0x66, 0x6F, 0x6F, 0x74,
-0x65, 0x72, 0x3E, 0x3C, 0x75, 0x6C, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x69, 0x64, 0x56, 0x65, 0x72,
-0x73, 0x69, 0x6F, 0x6E, 0x22, 0x3E, 0x3C, 0x2F, 0x75, 0x6C, 0x3E, 0x3C, 0x2F, 0x66, 0x6F, 0x6F,
-0x74, 0x65, 0x72, 0x3E, 0x0A, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63,
-0x3D, 0x22, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x2E, 0x6A, 0x73, 0x22, 0x20, 0x74, 0x79, 0x70,
-0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2F, 0x6A, 0x61, 0x76, 0x61, 0x73, 0x63, 0x72, 0x69,
-0x70, 0x74, 0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x73,
-0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D, 0x22, 0x64, 0x61, 0x74, 0x65, 0x2E,
-0x6A, 0x73, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2F, 0x6A,
-0x61, 0x76, 0x61, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x63, 0x72,
-0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63,
-0x3D, 0x22, 0x74, 0x69, 0x6D, 0x65, 0x2E, 0x6A, 0x73, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D,
-0x22, 0x74, 0x65, 0x78, 0x74, 0x2F, 0x6A, 0x61, 0x76, 0x61, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74,
-0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x73, 0x63, 0x72,
-0x69, 0x70, 0x74, 0x3E, 0x6C, 0x69, 0x73, 0x74, 0x28, 0x29, 0x3B, 0x76, 0x65, 0x72, 0x73, 0x69,
-0x6F, 0x6E, 0x28, 0x29, 0x3B, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x28, 0x29, 0x3C, 0x2F,
-0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x2F, 0x62, 0x6F, 0x64, 0x79, 0x3E, 0x0A,
-0x3C, 0x2F, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x00
-};
+static constexpr char time_html[] =
+"\x3C\x21\x44\x4F\x43\x54\x59\x50\x45\x20\x68\x74\x6D\x6C\x3E\x0A"
+"\x3C\x68\x74\x6D\x6C\x3E\x0A\x3C\x68\x65\x61\x64\x3E\x3C\x6C\x69"
+"\x6E\x6B\x20\x72\x65\x6C\x3D\x22\x73\x74\x79\x6C\x65\x73\x68\x65"
+"\x65\x74\x22\x20\x68\x72\x65\x66\x3D\x22\x73\x74\x79\x6C\x65\x73"
+"\x2E\x63\x73\x73\x22\x20\x2F\x3E\x3C\x74\x69\x74\x6C\x65\x3E\x4E"
+"\x6F\x64\x65\x20\x54\x69\x6D\x65\x3C\x2F\x74\x69\x74\x6C\x65\x3E"
+"\x3C\x2F\x68\x65\x61\x64\x3E\x0A\x3C\x62\x6F\x64\x79\x3E\x0A\x3C"
+"\x68\x65\x61\x64\x65\x72\x3E\x3C\x75\x6C\x20\x69\x64\x3D\x22\x69"
+"\x64\x4C\x69\x73\x74\x22\x3E\x3C\x2F\x75\x6C\x3E\x3C\x2F\x68\x65"
+"\x61\x64\x65\x72\x3E\x0A\x3C\x70\x3E\x3C\x62\x75\x74\x74\x6F\x6E"
+"\x20\x6F\x6E\x63\x6C\x69\x63\x6B\x3D\x22\x72\x65\x66\x72\x65\x73"
+"\x68\x28\x29\x22\x3E\x52\x65\x66\x72\x65\x73\x68\x3C\x2F\x62\x75"
+"\x74\x74\x6F\x6E\x3E\x3C\x2F\x70\x3E\x0A\x3C\x70\x20\x69\x64\x3D"
+"\x22\x6E\x6F\x64\x65\x54\x69\x6D\x65\x22\x3E\x4E\x6F\x64\x65\x20"
+"\x74\x69\x6D\x65\x20\x77\x69\x6C\x6C\x20\x62\x65\x20\x64\x69\x73"
+"\x70\x6C\x61\x79\x65\x64\x20\x68\x65\x72\x65\x3C\x2F\x70\x3E\x0A"
+"\x3C\x70\x3E\x3C\x62\x75\x74\x74\x6F\x6E\x20\x6F\x6E\x63\x6C\x69"
+"\x63\x6B\x3D\x22\x73\x79\x6E\x63\x57\x69\x74\x68\x4C\x6F\x63\x61"
+"\x6C\x54\x69\x6D\x65\x28\x29\x22\x3E\x53\x79\x6E\x63\x20\x77\x69"
+"\x74\x68\x20\x4C\x6F\x63\x61\x6C\x20\x54\x69\x6D\x65\x3C\x2F\x62"
+"\x75\x74\x74\x6F\x6E\x3E\x3C\x2F\x70\x3E\x0A\x3C\x66\x6F\x6F\x74"
+"\x65\x72\x3E\x3C\x75\x6C\x20\x69\x64\x3D\x22\x69\x64\x56\x65\x72"
+"\x73\x69\x6F\x6E\x22\x3E\x3C\x2F\x75\x6C\x3E\x3C\x2F\x66\x6F\x6F"
+"\x74\x65\x72\x3E\x0A\x3C\x73\x63\x72\x69\x70\x74\x20\x73\x72\x63"
+"\x3D\x22\x73\x74\x61\x74\x69\x63\x2E\x6A\x73\x22\x20\x74\x79\x70"
+"\x65\x3D\x22\x74\x65\x78\x74\x2F\x6A\x61\x76\x61\x73\x63\x72\x69"
+"\x70\x74\x22\x3E\x3C\x2F\x73\x63\x72\x69\x70\x74\x3E\x0A\x3C\x73"
+"\x63\x72\x69\x70\x74\x20\x73\x72\x63\x3D\x22\x64\x61\x74\x65\x2E"
+"\x6A\x73\x22\x20\x74\x79\x70\x65\x3D\x22\x74\x65\x78\x74\x2F\x6A"
+"\x61\x76\x61\x73\x63\x72\x69\x70\x74\x22\x3E\x3C\x2F\x73\x63\x72"
+"\x69\x70\x74\x3E\x0A\x3C\x73\x63\x72\x69\x70\x74\x20\x73\x72\x63"
+"\x3D\x22\x74\x69\x6D\x65\x2E\x6A\x73\x22\x20\x74\x79\x70\x65\x3D"
+"\x22\x74\x65\x78\x74\x2F\x6A\x61\x76\x61\x73\x63\x72\x69\x70\x74"
+"\x22\x3E\x3C\x2F\x73\x63\x72\x69\x70\x74\x3E\x0A\x3C\x73\x63\x72"
+"\x69\x70\x74\x3E\x6C\x69\x73\x74\x28\x29\x3B\x76\x65\x72\x73\x69"
+"\x6F\x6E\x28\x29\x3B\x72\x65\x66\x72\x65\x73\x68\x28\x29\x3C\x2F"
+"\x73\x63\x72\x69\x70\x74\x3E\x0A\x3C\x2F\x62\x6F\x64\x79\x3E\x0A"
+"\x3C\x2F\x68\x74\x6D\x6C\x3E"
+;
+static constexpr char time_html_gz[] =
+"\x1F\x8B\x08\x00\x00\x00\x00\x00\x02\x03\x9D\x52\x31\x52\xC3\x30"
+"\x10\xEC\xFD\x8A\x43\x55\xD2\x44\x0F\x40\x56\x03\x74\x99\xC0\x40"
+"\x06\x86\x52\x96\x2E\x63\x25\x8A\xE5\x91\xCE\x01\xFF\x1E\xC9\x72"
+"\x32\x04\x2A\xA8\xBC\x73\xDA\xDD\xDB\xBB\xB3\xB8\xB9\x7F\xBC\xDB"
+"\xBE\x3F\x3D\x40\x4B\x47\x27\x2B\x71\xFE\xA0\x32\x52\x38\xDB\x1D"
+"\x20\xA0\xAB\x59\xA4\xD1\x61\x6C\x11\x89\x41\x1B\x70\x77\xAE\xAC"
+"\x74\x8C\x0C\xB8\x14\x64\xC9\xA1\xDC\x78\x83\xB0\xB5\x47\x14\xBC"
+"\x14\x04\x9F\x9C\x2A\xD1\x78\x33\xCE\xBE\x18\xA4\x18\x1C\x58\x53"
+"\x33\x6B\xD6\x36\x12\x4B\xB4\xC1\xCD\xDC\xF4\x5A\x89\x5E\x8A\x66"
+"\x20\xF2\x1D\xF8\x4E\x3B\xAB\x0F\x35\x4B\x4D\x43\x4A\xB0\x58\x32"
+"\xF9\x5C\xA0\xE0\x85\x93\x84\x7D\xD6\x4C\x8E\x5D\x4A\x90\x03\xB0"
+"\x92\x85\x12\x84\x0F\xEB\x1C\x34\x08\xC6\xC6\xDE\xA9\x11\x0D\xB4"
+"\x18\x70\x56\xFD\xEE\x14\xC7\x4E\xBF\x59\x6A\xD7\x5E\x2B\x97\xBD"
+"\x72\xCF\x97\x54\x4C\x46\xD4\xC2\x54\x9E\x87\xBC\x0A\xB0\xF3\x9E"
+"\xAE\x66\x7B\xC5\x10\xAD\xEF\x2E\xE3\xCD\x84\x4A\x44\x1D\x6C\x4F"
+"\x10\x83\xCE\x7B\x54\x64\xF5\x6A\x9F\xD6\x48\x63\x8F\x35\x23\xFC"
+"\x24\xBE\x57\x27\x55\x58\x59\x5D\xD0\x0F\xA1\x51\x84\xFF\x90\xE5"
+"\x8D\xFC\x49\x26\x5D\x3A\xD1\x62\x79\x7B\x2A\xD3\x24\x74\x39\xC5"
+"\x37\x2E\x9F\x0F\xCC\xA7\x1F\xE8\x0B\x70\xDD\x1A\x0D\x57\x02\x00"
+"\x00"
+;
@@ -1,27 +1,43 @@
-static constexpr char time_js[] = {
-0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x72,
-0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x6C, 0x65, 0x74, 0x20, 0x64,
-0x61, 0x74, 0x61, 0x20, 0x3D, 0x20, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20, 0x67, 0x65, 0x74, 0x4A,
-0x53, 0x4F, 0x4E, 0x28, 0x27, 0x74, 0x69, 0x6D, 0x65, 0x64, 0x61, 0x74, 0x65, 0x27, 0x29, 0x0A,
-0x63, 0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x66, 0x6F, 0x72,
-0x6D, 0x61, 0x74, 0x44, 0x61, 0x74, 0x65, 0x54, 0x69, 0x6D, 0x65, 0x28, 0x6E, 0x65, 0x77, 0x20,
-0x44, 0x61, 0x74, 0x65, 0x28, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x64, 0x61, 0x74, 0x65, 0x29, 0x29,
-0x0A, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65,
-0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x69,
-0x6D, 0x65, 0x27, 0x29, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74,
-0x20, 0x3D, 0x20, 0x60, 0x4E, 0x6F, 0x64, 0x65, 0x20, 0x54, 0x69, 0x6D, 0x65, 0x3A, 0x20, 0x24,
-0x7B, 0x6E, 0x6F, 0x64, 0x65, 0x7D, 0x60, 0x0A, 0x7D, 0x0A, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20,
-0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x79, 0x6E, 0x63, 0x57, 0x69, 0x74,
-0x68, 0x4C, 0x6F, 0x63, 0x61, 0x6C, 0x54, 0x69, 0x6D, 0x65, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x63,
-0x6F, 0x6E, 0x73, 0x74, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x66, 0x6F, 0x72, 0x6D,
-0x61, 0x74, 0x44, 0x61, 0x74, 0x65, 0x54, 0x69, 0x6D, 0x65, 0x28, 0x6E, 0x65, 0x77, 0x20, 0x44,
-0x61, 0x74, 0x65, 0x28, 0x29, 0x29, 0x0A, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E,
-0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x27,
-0x6E, 0x6F, 0x64, 0x65, 0x54, 0x69, 0x6D, 0x65, 0x27, 0x29, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x43,
-0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x60, 0x4E, 0x6F, 0x64, 0x65, 0x20, 0x54,
-0x69, 0x6D, 0x65, 0x3A, 0x20, 0x24, 0x7B, 0x6E, 0x6F, 0x64, 0x65, 0x7D, 0x60, 0x0A, 0x63, 0x6F,
-0x6E, 0x73, 0x74, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x3D, 0x20, 0x7B, 0x20, 0x64, 0x61, 0x74,
-0x65, 0x3A, 0x20, 0x6E, 0x6F, 0x64, 0x65, 0x20, 0x7D, 0x0A, 0x61, 0x77, 0x61, 0x69, 0x74, 0x20,
-0x70, 0x6F, 0x73, 0x74, 0x28, 0x64, 0x61, 0x74, 0x61, 0x29, 0x0A, 0x72, 0x65, 0x66, 0x72, 0x65,
-0x73, 0x68, 0x28, 0x29, 0x0A, 0x7D, 0x00
-};
+static constexpr char time_js[] =
+"\x61\x73\x79\x6E\x63\x20\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x72"
+"\x65\x66\x72\x65\x73\x68\x28\x29\x20\x7B\x0A\x6C\x65\x74\x20\x64"
+"\x61\x74\x61\x20\x3D\x20\x61\x77\x61\x69\x74\x20\x67\x65\x74\x4A"
+"\x53\x4F\x4E\x28\x27\x74\x69\x6D\x65\x64\x61\x74\x65\x27\x29\x0A"
+"\x63\x6F\x6E\x73\x74\x20\x6E\x6F\x64\x65\x20\x3D\x20\x66\x6F\x72"
+"\x6D\x61\x74\x44\x61\x74\x65\x54\x69\x6D\x65\x28\x6E\x65\x77\x20"
+"\x44\x61\x74\x65\x28\x64\x61\x74\x61\x2E\x64\x61\x74\x65\x29\x29"
+"\x0A\x64\x6F\x63\x75\x6D\x65\x6E\x74\x2E\x67\x65\x74\x45\x6C\x65"
+"\x6D\x65\x6E\x74\x42\x79\x49\x64\x28\x27\x6E\x6F\x64\x65\x54\x69"
+"\x6D\x65\x27\x29\x2E\x74\x65\x78\x74\x43\x6F\x6E\x74\x65\x6E\x74"
+"\x20\x3D\x20\x60\x4E\x6F\x64\x65\x20\x54\x69\x6D\x65\x3A\x20\x24"
+"\x7B\x6E\x6F\x64\x65\x7D\x60\x0A\x7D\x0A\x61\x73\x79\x6E\x63\x20"
+"\x66\x75\x6E\x63\x74\x69\x6F\x6E\x20\x73\x79\x6E\x63\x57\x69\x74"
+"\x68\x4C\x6F\x63\x61\x6C\x54\x69\x6D\x65\x28\x29\x20\x7B\x0A\x63"
+"\x6F\x6E\x73\x74\x20\x6E\x6F\x64\x65\x20\x3D\x20\x66\x6F\x72\x6D"
+"\x61\x74\x44\x61\x74\x65\x54\x69\x6D\x65\x28\x6E\x65\x77\x20\x44"
+"\x61\x74\x65\x28\x29\x29\x0A\x64\x6F\x63\x75\x6D\x65\x6E\x74\x2E"
+"\x67\x65\x74\x45\x6C\x65\x6D\x65\x6E\x74\x42\x79\x49\x64\x28\x27"
+"\x6E\x6F\x64\x65\x54\x69\x6D\x65\x27\x29\x2E\x74\x65\x78\x74\x43"
+"\x6F\x6E\x74\x65\x6E\x74\x20\x3D\x20\x60\x4E\x6F\x64\x65\x20\x54"
+"\x69\x6D\x65\x3A\x20\x24\x7B\x6E\x6F\x64\x65\x7D\x60\x0A\x63\x6F"
+"\x6E\x73\x74\x20\x64\x61\x74\x61\x20\x3D\x20\x7B\x20\x64\x61\x74"
+"\x65\x3A\x20\x6E\x6F\x64\x65\x20\x7D\x0A\x61\x77\x61\x69\x74\x20"
+"\x70\x6F\x73\x74\x28\x64\x61\x74\x61\x29\x0A\x72\x65\x66\x72\x65"
+"\x73\x68\x28\x29\x0A\x7D"
+;
+static constexpr char time_js_gz[] =
+"\x1F\x8B\x08\x00\x00\x00\x00\x00\x02\x03\xAD\x50\xBB\x0A\xC2\x40"
+"\x10\xEC\xEF\x2B\xB6\x10\x72\xD7\xE4\x03\x04\x1B\x1F\x85\x22\xB1"
+"\x50\xB0\xCD\x71\xD9\x98\x40\x72\x27\xC9\x86\x18\x42\xFE\xDD\xDD"
+"\x28\x82\x9D\x85\xDD\x2E\x33\x3B\x33\x3B\xB6\x1D\xBC\x83\xBC\xF3"
+"\x8E\xCA\xE0\xA1\xC1\xBC\xC1\xB6\xD0\x06\x46\x55\x21\x41\x66\xC9"
+"\xC2\x0A\x6C\x6F\x4B\x82\x1B\xD2\xE1\x7C\x4A\x74\x44\x65\x8D\x8C"
+"\x60\x64\x94\x0B\xBE\x25\xF0\x21\x43\xA6\xE5\xA1\xA9\x2D\x6D\x19"
+"\xB9\x30\x43\x7B\xEC\x41\x16\x2D\x2A\xB1\x1C\x18\xA3\xB2\xE0\xBA"
+"\x1A\x3D\xC5\xAC\xB6\xAB\x50\xC6\xF5\xB0\xCF\x74\x24\x1A\x72\x16"
+"\x99\x98\xF0\x41\x9B\xE0\x89\x31\x56\x4D\x13\x51\x17\x68\x09\x8B"
+"\x51\x68\x53\xAA\x26\x65\xBF\x93\xCB\x76\x2D\xA9\x38\x06\x67\xAB"
+"\xD9\x5E\x7E\xF8\x29\xDE\xFF\x52\xBD\xEC\xDE\xA5\x8D\x32\x30\x3A"
+"\xBB\x73\xDE\xB9\xC3\x7B\x68\x69\xEE\xC3\xA8\x4F\xD7\x6A\x7A\x02"
+"\x72\x97\x64\x6F\x86\x01\x00\x00"
+;
@@ -29,6 +29,7 @@
 namespace http {
 enum class Status {
 	OK = 200,
+	NOT_MODIFIED = 304,
 	BAD_REQUEST = 400,
 	NOT_FOUND = 404,
 	REQUEST_TIMEOUT = 408,
@@ -36,6 +36,7 @@
 #include "httpdhandlerequest.h"
 
 #include "network.h"
+#include "softwaretimers.h"
 
 #include "../../lib-network/config/net_config.h"
 
@@ -70,6 +71,11 @@ private:
 		handleRequest[nConnectionHandle].HandleRequest(nSize, const_cast<char *>(reinterpret_cast<const char *>(pBuffer)));
 	}
 
+	/**
+	 * Closes the idle connections, as there are only TCP_MAX_TCBS_ALLOWED.
+	 */
+	static void StaticCallbackFunctionIdle([[maybe_unused]] TimerHandle_t nHandle);
+
 	/**
 	 * https://www.gd32-dmx.org/memory.html
 	 */
@@ -84,6 +90,7 @@ private:
 	 */
 	static inline HttpDeamonHandleRequest handleRequest[TCP_MAX_TCBS_ALLOWED] __attribute__ ((aligned (4))) SECTION_HTTPD;
 	int32_t m_nHandle { -1 };
+	TimerHandle_t m_nTimerId { TIMER_ID_NONE };
 };
 
 #endif /* HTTPD_HTTPD_H_ */
@@ -2,7 +2,7 @@
  * @file httpdhandlerequest.h
  *
  */
-/* Copyright (C) 2024 by Arjan van Vught mailto:info@gd32-dmx.org
+/* Copyright (C) 2024-2025 by Arjan van Vught mailto:info@gd32-dmx.org
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -30,6 +30,7 @@
 #include <new>
 
 #include "http.h"
+#include "jsonwriter.h"
 #include "net/protocol/tcp.h"
 
 #include "debug.h"
@@ -39,6 +40,25 @@ namespace httpd {
 # define HTTPD_CONTENT_SIZE	TCP_DATA_SIZE
 #endif
 static constexpr uint32_t BUFSIZE = HTTPD_CONTENT_SIZE;
+#if !defined(CONFIG_HTTP_CACHE_MAX_AGE)
+# define CONFIG_HTTP_CACHE_MAX_AGE	604800
+#endif
+/*
+ * The static content is revalidated with the ETag when the max-age has expired.
+ */
+static constexpr uint32_t CACHE_MAX_AGE = CONFIG_HTTP_CACHE_MAX_AGE;
+#if !defined(CONFIG_HTTP_KEEP_ALIVE_TIMEOUT)
+# define CONFIG_HTTP_KEEP_ALIVE_TIMEOUT	5
+#endif
+#if !defined(CONFIG_HTTP_KEEP_ALIVE_MAX)
+# define CONFIG_HTTP_KEEP_ALIVE_MAX	32
+#endif
+/*
+ * There are only TCP_MAX_TCBS_ALLOWED connections. A connection is closed when it is idle
+ * for KEEP_ALIVE_TIMEOUT seconds. The reply to the KEEP_ALIVE_MAX-th request has "Connection: close".
+ */
+static constexpr uint32_t KEEP_ALIVE_TIMEOUT = CONFIG_HTTP_KEEP_ALIVE_TIMEOUT;
+static constexpr uint32_t KEEP_ALIVE_MAX = CONFIG_HTTP_KEEP_ALIVE_MAX;
 }  // namespace httpd
 
 class HttpDeamonHandleRequest {
@@ -56,6 +76,7 @@ public:
 	}
 
 	void HandleRequest(const uint32_t nBytesReceived, char *m_pReceiveBuffer);
+	void HandleIdle(const uint32_t nMillis);
 
 private:
 	http::Status ParseRequest();
@@ -66,6 +87,12 @@ private:
 	http::Status HandlePost(const bool hasDataOnly);
 	http::Status HandleDelete(const bool hasDataOnly);
 	http::Status HandlePostJSON();
+	http::Status HandleGetStream(JsonWriter& jsonWriter);
+	uint32_t ComposeHeader(const char *pStatusMsg, const bool isChunked);
+	void SendHeader(const char *pStatusMsg, const bool isChunked);
+	void StreamWrite(const char *pData, const uint32_t nLength);
+
+	static void StaticCallbackFunctionFlush(void *pContext, const char *pData, const uint32_t nLength);
 
 private:
 	uint32_t m_nConnectionHandle;
@@ -74,6 +101,10 @@ private:
 	uint32_t m_nRequestDataLength { 0 };
 	uint32_t m_nRequestContentLength { 0 };
 	uint32_t m_nBytesReceived { 0 };
+	uint32_t m_nETag { 0 };
+	uint32_t m_nIfNoneMatch { 0 };
+	uint32_t m_nRequests { 0 };
+	uint32_t m_nMillisActive { 0 };
 
 	char *m_pUri { nullptr };
 	char *m_pFileData { nullptr };
@@ -86,6 +117,14 @@ private:
 	http::contentTypes m_RequestContentType { http::contentTypes::NOT_DEFINED };
 
 	bool m_isAction { false };
+	bool m_isHeaderSent { false };
+	bool m_isStreamed { false };
+	bool m_isStreamAborted { false };
+	bool m_isGzip { false };
+	bool m_isGzipAccepted { false };
+	bool m_isKeepAlive { true };
+	bool m_isHttp11 { true };
+	bool m_isConnected { false };
 
 
 	char m_DynamicContent[httpd::BUFSIZE];
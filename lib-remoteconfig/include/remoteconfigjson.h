@@ -28,6 +28,8 @@
 
 #include <cstdint>
 
+class JsonWriter;
+
 namespace remoteconfig {
 uint32_t json_get_list(char *pOutBuffer, const uint32_t nOutBufferSize);
 uint32_t json_get_version(char *pOutBuffer, const uint32_t nOutBufferSize);
@@ -45,7 +47,7 @@ namespace rdm {
 uint32_t json_get_rdm(char *pOutBuffer, const uint32_t nOutBufferSize);
 uint32_t json_get_queue(char *pOutBuffer, const uint32_t nOutBufferSize);
 uint32_t json_get_portstatus(char *pOutBuffer, const uint32_t nOutBufferSize);
-uint32_t json_get_tod(const char cPort, char *pOutBuffer, const uint32_t nOutBufferSize);
+bool json_get_tod(const char cPort, JsonWriter& jsonWriter);
 }  // namespace rdm
 namespace storage {
 uint32_t json_get_directory(char *pOutBuffer, const uint32_t nOutBufferSize);
@@ -70,7 +72,7 @@ void json_set_rtc(const char *pBuffer, const uint32_t nBufferSize);
 }  // namespace rtc
 
 namespace artnet::controller {
-uint32_t json_get_polltable(char *pOutBuffer, const uint32_t nOutBufferSize);
+void json_get_polltable(JsonWriter& jsonWriter);
 } // namespace artnet::controller
 
 namespace pixel {
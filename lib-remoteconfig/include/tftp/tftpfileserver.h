@@ -41,7 +41,7 @@ namespace tftpfileserver {
 
 class TFTPFileServer final: public TFTPDaemon {
 public:
-	TFTPFileServer(uint8_t *pBuffer, uint32_t nSize);
+	TFTPFileServer();
 	~TFTPFileServer() override {}
 
 	bool FileOpen(const char *pFileName, tftp::Mode mode) override;
@@ -59,11 +59,15 @@ public:
 		return m_bDone;
 	}
 
+	bool isSuccess() const {
+		return m_bSuccess;
+	}
+
 private:
-	uint8_t *m_pBuffer;
-	uint32_t m_nSize;
 	uint32_t m_nFileSize { 0 };
+	uint32_t m_nBlockNumber { 0 };
 	bool m_bDone { false };
+	bool m_bSuccess { false };
 };
 
 #endif /* TFTPFILESERVER_H_ */
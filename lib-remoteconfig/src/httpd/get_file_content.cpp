@@ -2,7 +2,7 @@
  * @file get_file_content.cpp
  *
  */
-/* Copyright (C) 2021-2023 by Arjan van Vught mailto:info@gd32-dmx.org
+/* Copyright (C) 2021-2025 by Arjan van Vught mailto:info@gd32-dmx.org
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -110,10 +110,12 @@ uint32_t get_file_content(const char *fileName, char *pDst, http::contentTypes&
 
 static char s_StaticContent[httpd::BUFSIZE];
 
-const char *get_file_content(const char *pFileName, uint32_t& nSize, http::contentTypes& contentType) {
+const char *get_file_content(const char *pFileName, [[maybe_unused]] const bool isGzipAccepted, uint32_t& nSize, http::contentTypes& contentType, uint32_t& nETag, bool& isGzip) {
 	DEBUG_ENTRY
 	DEBUG_PUTS(pFileName);
 
+	nETag = 0;
+	isGzip = false;
 	nSize = get_file_content(pFileName, s_StaticContent, contentType);
 
 	if (nSize != 0) {
@@ -124,20 +126,36 @@ const char *get_file_content(const char *pFileName, uint32_t& nSize, http::conte
 	return nullptr;
 }
 #else
-const char *get_file_content(const char *pFileName, uint32_t& nSize, http::contentTypes& contentType) {
+/**
+ * The gzip content is returned only when the client accepts it, otherwise the minified content.
+ * Each representation has its own ETag.
+ */
+
+const char *get_file_content(const char *pFileName, const bool isGzipAccepted, uint32_t& nSize, http::contentTypes& contentType, uint32_t& nETag, bool& isGzip) {
 	DEBUG_ENTRY
 	DEBUG_PUTS(pFileName);
 
 	for (auto& content : HttpContent) {
 		if (strcmp(pFileName, content.pFileName) == 0) {
-			nSize = content.nContentLength;
 			contentType = content.contentType;
+			isGzip = isGzipAccepted && (content.pContentGzip != nullptr);
+
+			if (isGzip) {
+				nSize = content.nContentGzipLength;
+				nETag = content.nETagGzip;
+				return content.pContentGzip;
+			}
+
+			nSize = content.nContentLength;
+			nETag = content.nETag;
 			return content.pContent;
 		}
 	}
 
 	nSize = 0;
 	contentType = http::contentTypes::NOT_DEFINED;
+	nETag = 0;
+	isGzip = false;
 
 	DEBUG_EXIT
 	return nullptr;
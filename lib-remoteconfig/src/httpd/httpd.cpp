@@ -34,7 +34,9 @@
 
 #include "httpd/httpd.h"
 
+#include "hardware.h"
 #include "network.h"
+#include "softwaretimers.h"
 #include "net/tcp.h"
 #include "net/apps/mdns.h"
 
@@ -51,6 +53,8 @@ HttpDaemon::HttpDaemon() {
 		new (&handleRequest[nIndex]) HttpDeamonHandleRequest(nIndex, m_nHandle);
 	}
 
+	m_nTimerId = SoftwareTimerAdd(1000, StaticCallbackFunctionIdle);
+
 	mdns_service_record_add(nullptr, mdns::Services::HTTP);
 
 	DEBUG_EXIT
@@ -61,6 +65,8 @@ HttpDaemon::~HttpDaemon() {
 
 	mdns_service_record_delete(mdns::Services::HTTP);
 
+	SoftwareTimerDelete(m_nTimerId);
+
 	for (uint32_t nIndex = 0; nIndex < TCP_MAX_TCBS_ALLOWED; nIndex++) {
 		// Explicitly calling the destructor because objects were constructed with placement new.
 		handleRequest[nIndex].~HttpDeamonHandleRequest();
@@ -70,3 +76,11 @@ HttpDaemon::~HttpDaemon() {
 
 	DEBUG_EXIT
 }
+
+void HttpDaemon::StaticCallbackFunctionIdle([[maybe_unused]] TimerHandle_t nHandle) {
+	const auto nMillis = Hardware::Get()->Millis();
+
+	for (auto& request : handleRequest) {
+		request.HandleIdle(nMillis);
+	}
+}
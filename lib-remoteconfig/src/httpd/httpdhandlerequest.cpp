@@ -78,7 +78,7 @@
 #include "debug.h"
 
 #if defined ENABLE_CONTENT
-const char *get_file_content(const char *fileName, uint32_t& nSize, http::contentTypes& contentType);
+const char *get_file_content(const char *fileName, const bool isGzipAccepted, uint32_t& nSize, http::contentTypes& contentType, uint32_t& nETag, bool& isGzip);
 #endif
 
 #ifndef NDEBUG
@@ -88,12 +88,41 @@ static constexpr char s_request_method[][8] = {"GET", "POST", "DELETE", "UNKNOWN
 static constexpr char s_contentType[static_cast<uint32_t>(http::contentTypes::NOT_DEFINED)][32] =
 { "text/html", "text/css", "text/javascript", "application/json", "application/octet-stream" };
 
+/**
+ * "0", "0.", "0.0", "0.00" or "0.000"
+ */
+static bool is_quality_zero(const char *pQuality) {
+	if (*pQuality++ != '0') {
+		return false;
+	}
+
+	if (*pQuality == '.') {
+		pQuality++;
+	}
+
+	while (*pQuality == '0') {
+		pQuality++;
+	}
+
+	return *pQuality == '\0';
+}
+
 void HttpDeamonHandleRequest::HandleRequest(const uint32_t nBytesReceived, char *pReceiveBuffer) {
 	DEBUG_ENTRY
 
 	m_nBytesReceived = nBytesReceived;
 	m_pReceiveBuffer = pReceiveBuffer;
 
+	const auto nMillis = Hardware::Get()->Millis();
+
+	// A connection which was idle for too long has been closed, so this is a new connection
+	if (!m_isConnected || ((nMillis - m_nMillisActive) >= (httpd::KEEP_ALIVE_TIMEOUT * 1000U))) {
+		m_nRequests = 0;
+	}
+
+	m_isConnected = true;
+	m_nMillisActive = nMillis;
+
 	const char *pStatusMsg = "OK";
 
 	DEBUG_PRINTF("%u: m_Status=%u", m_nConnectionHandle, static_cast<uint32_t>(m_Status));
@@ -102,6 +131,10 @@ void HttpDeamonHandleRequest::HandleRequest(const uint32_t nBytesReceived, char
 		// This is an initial incoming HTTP request
 		m_Status = ParseRequest();
 
+		if (++m_nRequests >= httpd::KEEP_ALIVE_MAX) {
+			m_isKeepAlive = false;
+		}
+
 #ifndef NDEBUG
 		DEBUG_PRINTF("%s %s", s_request_method[static_cast<uint32_t>(m_RequestMethod)], m_RequestContentType < http::contentTypes::NOT_DEFINED ? s_contentType[static_cast<uint32_t>(m_RequestContentType)] : "Unknown");
 #endif
@@ -152,7 +185,12 @@ void HttpDeamonHandleRequest::HandleRequest(const uint32_t nBytesReceived, char
 	}
 #endif
 
-	if (m_Status != http::Status::OK) {
+	if (m_Status == http::Status::NOT_MODIFIED) {
+		pStatusMsg = "Not Modified";
+		m_nContentSize = 0;
+	} else if (m_Status != http::Status::OK) {
+		m_isKeepAlive = false;
+
 		switch (m_Status) {
 		case http::Status::BAD_REQUEST:
 			pStatusMsg = "Bad Request";
@@ -177,6 +215,7 @@ void HttpDeamonHandleRequest::HandleRequest(const uint32_t nBytesReceived, char
 			/* no break */
 		default:
 			net::tcp_abort(m_nHandle, m_nConnectionHandle);
+			m_isConnected = false;
 			m_Status = http::Status::UNKNOWN_ERROR;
 			m_RequestMethod = http::RequestMethod::UNKNOWN;
 			DEBUG_EXIT
@@ -185,6 +224,8 @@ void HttpDeamonHandleRequest::HandleRequest(const uint32_t nBytesReceived, char
 		}
 
 		m_RequestContentType = http::contentTypes::TEXT_HTML;
+		m_nETag = 0;
+		m_isGzip = false;
 		m_pContent = m_DynamicContent;
 		m_nContentSize = static_cast<uint32_t>(snprintf(m_DynamicContent, sizeof(m_DynamicContent) - 1U,
 				"<!DOCTYPE html>\n"
@@ -194,23 +235,150 @@ void HttpDeamonHandleRequest::HandleRequest(const uint32_t nBytesReceived, char
 				"</html>\n", static_cast<unsigned int>(m_Status), pStatusMsg, pStatusMsg));
 	}
 
-	const auto nHeaderLength = static_cast<uint32_t>(snprintf(m_pReceiveBuffer, sizeof(m_DynamicContent) - 1U,
+	if (m_isStreamed) {
+		// Header and content are already sent
+		m_isStreamed = false;
+	} else {
+		SendHeader(pStatusMsg, false);
+		if (m_nContentSize != 0) {
+			net::tcp_write(m_nHandle, reinterpret_cast<const uint8_t *>(m_pContent), m_nContentSize, m_nConnectionHandle);
+		}
+	}
+
+	DEBUG_PRINTF("m_nContentLength=%u", m_nContentSize);
+
+	m_Status = http::Status::UNKNOWN_ERROR;
+	m_RequestMethod = http::RequestMethod::UNKNOWN;
+
+	DEBUG_EXIT
+}
+
+uint32_t HttpDeamonHandleRequest::ComposeHeader(const char *pStatusMsg, const bool isChunked) {
+	auto *p = m_pReceiveBuffer;
+	const auto nSize = static_cast<int32_t>(sizeof(m_DynamicContent) - 1U);
+
+	auto nLength = snprintf(p, static_cast<size_t>(nSize),
 			"HTTP/1.1 %u %s\r\n"
 			"Server: %s\r\n"
-			"Content-Type: %s\r\n"
-			"Content-Length: %u\r\n"
-			"Connection: close\r\n"
-			"\r\n", static_cast<unsigned int>(m_Status), pStatusMsg, Network::Get()->GetHostName(), s_contentType[static_cast<uint32_t>(m_RequestContentType)], static_cast<unsigned int>(m_nContentSize)));
+			"Connection: %s\r\n",
+			static_cast<unsigned int>(m_Status), pStatusMsg, Network::Get()->GetHostName(), m_isKeepAlive ? "keep-alive" : "close");
+
+	if (m_isKeepAlive) {
+		nLength += snprintf(&p[nLength], static_cast<size_t>(nSize - nLength), "Keep-Alive: timeout=%u, max=%u\r\n",
+				static_cast<unsigned int>(httpd::KEEP_ALIVE_TIMEOUT), static_cast<unsigned int>(httpd::KEEP_ALIVE_MAX - m_nRequests));
+	}
+
+	if (m_nETag != 0) {
+		nLength += snprintf(&p[nLength], static_cast<size_t>(nSize - nLength),
+				"ETag: \"%08x\"\r\n"
+				"Cache-Control: max-age=%u\r\n"
+				"Vary: Accept-Encoding\r\n",
+				static_cast<unsigned int>(m_nETag), static_cast<unsigned int>(httpd::CACHE_MAX_AGE));
+	}
 
-	net::tcp_write(m_nHandle, reinterpret_cast<uint8_t *>(m_pReceiveBuffer), nHeaderLength, m_nConnectionHandle);
-	net::tcp_write(m_nHandle, reinterpret_cast<const uint8_t *>(m_pContent), m_nContentSize, m_nConnectionHandle);
+	if (m_Status != http::Status::NOT_MODIFIED) {
+		nLength += snprintf(&p[nLength], static_cast<size_t>(nSize - nLength), "Content-Type: %s\r\n", s_contentType[static_cast<uint32_t>(m_RequestContentType)]);
 
-	DEBUG_PRINTF("m_nContentLength=%u", m_nContentSize);
+		if (m_isGzip) {
+			nLength += snprintf(&p[nLength], static_cast<size_t>(nSize - nLength), "Content-Encoding: gzip\r\n");
+		}
+
+		if (isChunked) {
+			nLength += snprintf(&p[nLength], static_cast<size_t>(nSize - nLength), "Transfer-Encoding: chunked\r\n");
+		} else {
+			nLength += snprintf(&p[nLength], static_cast<size_t>(nSize - nLength), "Content-Length: %u\r\n", static_cast<unsigned int>(m_nContentSize));
+		}
+	}
+
+	p[nLength++] = '\r';
+	p[nLength++] = '\n';
+
+	assert(nLength <= nSize);
+
+	return static_cast<uint32_t>(nLength);
+}
+
+void HttpDeamonHandleRequest::SendHeader(const char *pStatusMsg, const bool isChunked) {
+	const auto nLength = ComposeHeader(pStatusMsg, isChunked);
+	net::tcp_write(m_nHandle, reinterpret_cast<uint8_t *>(m_pReceiveBuffer), nLength, m_nConnectionHandle);
+}
+
+/**
+ * The TCP stack cannot wait for an acknowledgment while the reply is streamed.
+ * When the data does not fit in the send window and the transmission queue,
+ * the connection is aborted instead of losing a chunk.
+ */
+
+void HttpDeamonHandleRequest::StreamWrite(const char *pData, const uint32_t nLength) {
+	if (m_isStreamAborted) {
+		return;
+	}
+
+	if (net::tcp_get_send_space(m_nHandle, m_nConnectionHandle) < nLength) {
+		DEBUG_PRINTF("Stream aborted %u", nLength);
+		net::tcp_abort(m_nHandle, m_nConnectionHandle);
+		m_isConnected = false;
+		m_isStreamAborted = true;
+		return;
+	}
+
+	net::tcp_write(m_nHandle, reinterpret_cast<const uint8_t *>(pData), nLength, m_nConnectionHandle);
+}
+
+/**
+ * Each chunk of a streamed JSON reply is sent directly. The header is sent with the first chunk.
+ */
+
+void HttpDeamonHandleRequest::StaticCallbackFunctionFlush(void *pContext, const char *pData, const uint32_t nLength) {
+	auto *pThis = reinterpret_cast<HttpDeamonHandleRequest *>(pContext);
+
+	if (!pThis->m_isHeaderSent) {
+		pThis->m_isHeaderSent = true;
+		pThis->m_Status = http::Status::OK;
+		pThis->StreamWrite(pThis->m_pReceiveBuffer, pThis->ComposeHeader("OK", true));
+	}
+
+	pThis->StreamWrite(pData, nLength);
+}
 
+/**
+ * The idle connection is closed, so it can be used by another client.
+ */
+
+void HttpDeamonHandleRequest::HandleIdle(const uint32_t nMillis) {
+	if (!m_isConnected || ((nMillis - m_nMillisActive) < (httpd::KEEP_ALIVE_TIMEOUT * 1000U))) {
+		return;
+	}
+
+	DEBUG_PRINTF("%u: idle", m_nConnectionHandle);
+
+	net::tcp_abort(m_nHandle, m_nConnectionHandle);
+
+	m_isConnected = false;
+	m_nRequests = 0;
 	m_Status = http::Status::UNKNOWN_ERROR;
 	m_RequestMethod = http::RequestMethod::UNKNOWN;
+}
 
-	DEBUG_EXIT
+http::Status HttpDeamonHandleRequest::HandleGetStream(JsonWriter& jsonWriter) {
+	m_nContentSize = jsonWriter.Finish();
+
+	if (!jsonWriter.IsChunked()) {
+		// HTTP/1.0 has no chunked transfer, the reply must fit in the buffer
+		if (jsonWriter.IsOverflow()) {
+			DEBUG_PUTS("Overflow");
+			return http::Status::INTERNAL_SERVER_ERROR;
+		}
+
+		return http::Status::OK;
+	}
+
+	m_isHeaderSent = false;
+	m_isStreamAborted = false;
+	m_isStreamed = true;
+
+	DEBUG_PRINTF("Streamed %u", m_nContentSize);
+	return http::Status::OK;
 }
 
 http::Status HttpDeamonHandleRequest::ParseRequest() {
@@ -221,6 +389,10 @@ http::Status HttpDeamonHandleRequest::ParseRequest() {
 	m_nRequestContentLength = 0;
 	m_nRequestDataLength = 0;
 	m_pFirmwareFilename = nullptr;
+	m_nIfNoneMatch = 0;
+	m_nETag = 0;
+	m_isGzip = false;
+	m_isGzipAccepted = false;
 
 	for (uint32_t i = 0; i < m_nBytesReceived; i++) {
 		if (m_pReceiveBuffer[i] == '\n') {
@@ -256,8 +428,9 @@ http::Status HttpDeamonHandleRequest::ParseRequest() {
 }
 
 /**
- * Supported: "METHOD uri HTTP/1.1"
+ * Supported: "METHOD uri HTTP/1.1" and "METHOD uri HTTP/1.0"
  * Where METHOD is "GET", "POST" or "DELETE"
+ * The connection is persistent for HTTP/1.1 only, unless the header has "Connection:"
  */
 
 http::Status HttpDeamonHandleRequest::ParseMethod(char *pLine) {
@@ -296,10 +469,16 @@ http::Status HttpDeamonHandleRequest::ParseMethod(char *pLine) {
 		return http::Status::BAD_REQUEST;
 	}
 
-	if (strcmp(pToken, "1.1") != 0) {
+	if (strcmp(pToken, "1.1") == 0) {
+		m_isHttp11 = true;
+	} else if (strcmp(pToken, "1.0") == 0) {
+		m_isHttp11 = false;
+	} else {
 		return http::Status::VERSION_NOT_SUPPORTED;
 	}
 
+	m_isKeepAlive = m_isHttp11;
+
 	return http::Status::OK;
 }
 
@@ -370,6 +549,75 @@ http::Status HttpDeamonHandleRequest::ParseHeaderField(char *pLine) {
 		DEBUG_EXIT
 		return http::Status::OK;
 	}
+	else if (strcasecmp(pToken, "If-None-Match") == 0) {
+		if ((pToken = strtok(nullptr, " ")) == nullptr) {
+			DEBUG_EXIT
+			return http::Status::OK;
+		}
+
+		// Weak validator W/"..." is accepted
+		if ((pToken[0] == 'W') && (pToken[1] == '/')) {
+			pToken += 2;
+		}
+
+		if (*pToken == '"') {
+			pToken++;
+		}
+
+		uint32_t nETag = 0;
+		uint32_t nDigits;
+
+		for (nDigits = 0; nDigits < 8; nDigits++) {
+			const auto c = static_cast<char>(pToken[nDigits] | 0x20);
+
+			if ((c >= '0') && (c <= '9')) {
+				nETag = (nETag << 4) | static_cast<uint32_t>(c - '0');
+			} else if ((c >= 'a') && (c <= 'f')) {
+				nETag = (nETag << 4) | static_cast<uint32_t>(c - 'a' + 10);
+			} else {
+				break;
+			}
+		}
+
+		if (nDigits == 8) {
+			m_nIfNoneMatch = nETag;
+		}
+
+		DEBUG_EXIT
+		return http::Status::OK;
+	} else if (strcasecmp(pToken, "Connection") == 0) {
+		while ((pToken = strtok(nullptr, " ,")) != nullptr) {
+			if (strcasecmp(pToken, "close") == 0) {
+				m_isKeepAlive = false;
+				break;
+			}
+
+			if (strcasecmp(pToken, "keep-alive") == 0) {
+				m_isKeepAlive = true;
+			}
+		}
+
+		DEBUG_EXIT
+		return http::Status::OK;
+	} else if (strcasecmp(pToken, "Accept-Encoding") == 0) {
+		// "gzip", "gzip;q=0.5" or "*", but not with "q=0"
+		while ((pToken = strtok(nullptr, " ,")) != nullptr) {
+			const auto isGzip = (strncasecmp(pToken, "gzip", 4) == 0) && ((pToken[4] == '\0') || (pToken[4] == ';'));
+			const auto isAny = (pToken[0] == '*') && ((pToken[1] == '\0') || (pToken[1] == ';'));
+
+			if (isGzip || isAny) {
+				const auto *pQuality = strstr(pToken, ";q=");
+				m_isGzipAccepted = (pQuality == nullptr) || !is_quality_zero(&pQuality[3]);
+
+				if (isGzip) {
+					break;
+				}
+			}
+		}
+
+		DEBUG_EXIT
+		return http::Status::OK;
+	}
 #if defined (ENABLE_FIRMWARE_UPLOAD)
 	else if (strcasecmp(pToken, "X-Filename") == 0) {
 		if ((pToken = strtok(nullptr, " ")) == nullptr) {
@@ -441,9 +689,11 @@ http::Status HttpDeamonHandleRequest::HandleGet() {
 			break;
 #endif
 #if defined (ARTNET_CONTROLLER)
-		case http::json::get::POLLTABLE:
-			nLength = remoteconfig::artnet::controller::json_get_polltable(m_DynamicContent, sizeof(m_DynamicContent));
-			break;
+		case http::json::get::POLLTABLE: {
+			JsonWriter jsonWriter(m_DynamicContent, sizeof(m_DynamicContent), m_isHttp11 ? StaticCallbackFunctionFlush : nullptr, this);
+			remoteconfig::artnet::controller::json_get_polltable(jsonWriter);
+			return HandleGetStream(jsonWriter);
+		}
 #endif
 #if defined (ENABLE_NET_PHYSTATUS)
 		case http::json::get::PHYSTATUS:
@@ -508,7 +758,10 @@ http::Status HttpDeamonHandleRequest::HandleGet() {
 						case http::json::get::TOD: {
 							const auto *pTod = &pRdm[4];
 							if (isQuestionMark && isalpha(static_cast<int>(pTod[0])))  {
-								nLength = remoteconfig::rdm::json_get_tod(pTod[0], m_DynamicContent, sizeof(m_DynamicContent));
+								JsonWriter jsonWriter(m_DynamicContent, sizeof(m_DynamicContent), m_isHttp11 ? StaticCallbackFunctionFlush : nullptr, this);
+								if (remoteconfig::rdm::json_get_tod(pTod[0], jsonWriter)) {
+									return HandleGetStream(jsonWriter);
+								}
 							}
 						}
 						break;
@@ -568,40 +821,40 @@ http::Status HttpDeamonHandleRequest::HandleGet() {
 	}
 #if defined (ENABLE_CONTENT)
 	else if (strcmp(m_pUri, "/") == 0) {
-		m_pContent = get_file_content("index.html", nLength, m_RequestContentType);
+		m_pContent = get_file_content("index.html", m_isGzipAccepted, nLength, m_RequestContentType, m_nETag, m_isGzip);
 	}
 #if defined (HAVE_DMX)
 	else if (strcmp(m_pUri, "/dmx") == 0) {
-		m_pContent = get_file_content("dmx.html", nLength, m_RequestContentType);
+		m_pContent = get_file_content("dmx.html", m_isGzipAccepted, nLength, m_RequestContentType, m_nETag, m_isGzip);
 	}
 #endif
 #if defined (RDM_CONTROLLER) && !defined (CONFIG_HTTP_HTML_NO_RDM)
 	else if (strcmp(m_pUri, "/rdm") == 0) {
-		m_pContent = get_file_content("rdm.html", nLength, m_RequestContentType);
+		m_pContent = get_file_content("rdm.html", m_isGzipAccepted, nLength, m_RequestContentType, m_nETag, m_isGzip);
 	}
 #endif
 #if defined (NODE_SHOWFILE)
 	else if (strcmp(m_pUri, "/showfile") == 0) {
-		m_pContent = get_file_content("showfile.html", nLength, m_RequestContentType);
+		m_pContent = get_file_content("showfile.html", m_isGzipAccepted, nLength, m_RequestContentType, m_nETag, m_isGzip);
 	}
 #endif
 #if defined (ENABLE_PHY_SWITCH)
 	else if (strcmp(m_pUri, "/dsa") == 0) {
-		m_pContent = get_file_content("dsa.html", nLength, m_RequestContentType);
+		m_pContent = get_file_content("dsa.html", m_isGzipAccepted, nLength, m_RequestContentType, m_nETag, m_isGzip);
 	}
 #endif
 #if !defined (CONFIG_HTTP_HTML_NO_TIME)
 	else if (strcmp(m_pUri, "/time") == 0) {
-		m_pContent = get_file_content("time.html", nLength, m_RequestContentType);
+		m_pContent = get_file_content("time.html", m_isGzipAccepted, nLength, m_RequestContentType, m_nETag, m_isGzip);
 	}
 #endif
 #if !defined (CONFIG_HTTP_HTML_NO_RTC) && !defined (DISABLE_RTC)
 	else if (strcmp(m_pUri, "/rtc") == 0) {
-		m_pContent = get_file_content("rtc.html", nLength, m_RequestContentType);
+		m_pContent = get_file_content("rtc.html", m_isGzipAccepted, nLength, m_RequestContentType, m_nETag, m_isGzip);
 	}
 #endif
 	else {
-		m_pContent = get_file_content(&m_pUri[1], nLength, m_RequestContentType);
+		m_pContent = get_file_content(&m_pUri[1], m_isGzipAccepted, nLength, m_RequestContentType, m_nETag, m_isGzip);
 	}
 #endif
 
@@ -612,6 +865,11 @@ http::Status HttpDeamonHandleRequest::HandleGet() {
 
 	m_nContentSize = nLength;
 
+	if ((m_nETag != 0) && (m_nETag == m_nIfNoneMatch)) {
+		DEBUG_EXIT
+		return http::Status::NOT_MODIFIED;
+	}
+
 	DEBUG_EXIT
 	return http::Status::OK;
 }
@@ -724,7 +982,8 @@ http::Status HttpDeamonHandleRequest::HandlePost(const bool hasDataOnly) {
 		return http::Status::BAD_REQUEST;
 	}
 
-	if (!firmware::firmware_install_end(reinterpret_cast<const uint8_t *>(m_pFileData), m_nBytesReceived)) {
+	// When the body came with the headers, it has already been passed to firmware_install_start
+	if (!firmware::firmware_install_end(reinterpret_cast<const uint8_t *>(m_pFileData), hasDataOnly ? m_nBytesReceived : 0)) {
 		DEBUG_EXIT
 		return http::Status::BAD_REQUEST;
 	}
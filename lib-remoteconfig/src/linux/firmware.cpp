@@ -1 +0,0 @@
-../../../lib-flashcodeinstall/src/firmware.cpp
\ No newline at end of file
@@ -36,20 +36,16 @@
 #include "remoteconfig.h"
 
 #include "tftp/tftpfileserver.h"
-#include "flashcodeinstall.h"
-#include "firmware.h"
 
 #include "display.h"
 
 #include "debug.h"
 
-static uint8_t s_TFTPBuffer[FIRMWARE_MAX_SIZE];
-
 void RemoteConfig::PlatformHandleTftpSet() {
 	DEBUG_ENTRY
 
 	if (m_bEnableTFTP && (m_pTFTPFileServer == nullptr)) {
-		m_pTFTPFileServer = new TFTPFileServer(s_TFTPBuffer, FIRMWARE_MAX_SIZE);
+		m_pTFTPFileServer = new TFTPFileServer;
 		assert(m_pTFTPFileServer != nullptr);
 		Display::Get()->TextStatus("TFTP On", CONSOLE_GREEN);
 	} else if (!m_bEnableTFTP && (m_pTFTPFileServer != nullptr)) {
@@ -58,8 +54,9 @@ void RemoteConfig::PlatformHandleTftpSet() {
 
 		bool bSucces = true;
 
+		// The firmware has been written while receiving
 		if (m_pTFTPFileServer->isDone()) {
-			bSucces = FlashCodeInstall::Get()->WriteFirmware(s_TFTPBuffer, nFileSize);
+			bSucces = m_pTFTPFileServer->isSuccess();
 
 			if (!bSucces) {
 				Display::Get()->TextStatus("Error: TFTP", CONSOLE_RED);
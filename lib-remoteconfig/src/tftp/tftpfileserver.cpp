@@ -41,12 +41,8 @@
 
 using namespace tftpfileserver;
 
-TFTPFileServer::TFTPFileServer(uint8_t *pBuffer, uint32_t nSize): m_pBuffer(pBuffer), m_nSize(nSize) {
+TFTPFileServer::TFTPFileServer() {
 	DEBUG_ENTRY
-
-	assert(m_pBuffer != nullptr);
-	assert(nSize != 0);
-
 	DEBUG_EXIT
 }
 
@@ -84,6 +80,8 @@ bool TFTPFileServer::FileCreate(const char* pFileName, tftp::Mode mode) {
 	Display::Get()->TextStatus("TFTP Started", CONSOLE_GREEN);
 
 	m_nFileSize = 0;
+	m_nBlockNumber = 0;
+	m_bSuccess = false;
 
 	DEBUG_EXIT
 	return (true);
@@ -94,6 +92,10 @@ bool TFTPFileServer::FileClose() {
 
 	m_bDone = true;
 
+	if (m_nBlockNumber != 0) {
+		m_bSuccess = firmware::firmware_install_end(nullptr, 0);
+	}
+
 	Display::Get()->TextStatus("TFTP Ended", CONSOLE_GREEN);
 
 	DEBUG_EXIT
@@ -108,28 +110,34 @@ size_t TFTPFileServer::FileRead([[maybe_unused]] void* pBuffer, [[maybe_unused]]
 }
 
 size_t TFTPFileServer::FileWrite(const void *pBuffer, size_t nCount, unsigned nBlockNumber) {
-	DEBUG_PRINTF("pBuffer=%p, nCount=%d, nBlockNumber=%d (%d)", pBuffer, nCount, nBlockNumber, m_nSize / 512);
+	DEBUG_PRINTF("pBuffer=%p, nCount=%d, nBlockNumber=%d", pBuffer, nCount, nBlockNumber);
+
+	assert(nBlockNumber != 0);
+
+	// A retransmitted block has already been written
+	if (nBlockNumber == m_nBlockNumber) {
+		return nCount;
+	}
 
-	if (nBlockNumber > (m_nSize / 512)) {
+	if (nBlockNumber != (m_nBlockNumber + 1U)) {
 		m_nFileSize = 0;
 		return 0;
 	}
 
-	assert(nBlockNumber != 0);
+	const auto *pData = reinterpret_cast<const uint8_t *>(pBuffer);
+	const auto nLength = static_cast<uint32_t>(nCount);
 
 	if (nBlockNumber == 1) {
-		if (!is_valid(pBuffer)) {
+		if (!is_valid(pBuffer) || !firmware::firmware_install_start(pData, nLength)) {
 			return 0;
 		}
+	} else if (!firmware::firmware_install_continue(pData, nLength)) {
+		m_nFileSize = 0;
+		return 0;
 	}
 
-	const auto nOffset = (nBlockNumber - 1) * 512U;
-
-	assert((nOffset + nCount) <= m_nSize);
-
-	memcpy(&m_pBuffer[nOffset], pBuffer, nCount);
-
-	m_nFileSize += nCount; //FIXME BUG When in retry ?
+	m_nBlockNumber = nBlockNumber;
+	m_nFileSize += nLength;
 
 	Display::Get()->Progress();
 
@@ -2,7 +2,7 @@
  * @file showfileformatola.h
  *
  */
-/* Copyright (C) 2020-2024 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2020-2025 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -31,7 +31,9 @@
 # pragma GCC optimize ("O2")
 #endif
 
+#include <cstdint>
 #include <cstdio>
+#include <cstring>
 #include <cassert>
 
 #include "showfileprotocol.h"
@@ -47,6 +49,63 @@ static constexpr uint32_t FILE_NAME_LENGTH = sizeof(SHOWFILE_PREFIX "NN" SHOWFIL
 static constexpr uint32_t FILE_MAX_NUMBER = 99;
 }  // namespace showfile
 
+#if !defined (CONFIG_SHOWFILE_DISABLE_RECORD)
+/**
+ * The recorded lines are not written to the file directly. They are stored
+ * in a RAM buffer, which is written to the file with at most one sector per
+ * ShowFileRun. A slow write to the card does not stall the receive of the
+ * next frames. When the buffer is full, the frame is kept as pending for its
+ * universe, and recorded as soon as the flush has made space. A newer frame
+ * of the universe replaces the pending one.
+ */
+# if !defined (CONFIG_SHOWFILE_RECORD_BUFFER_SIZE)
+#  define CONFIG_SHOWFILE_RECORD_BUFFER_SIZE	32768
+# endif
+# if !defined (CONFIG_SHOWFILE_RECORD_PENDING_UNIVERSES)
+#  define CONFIG_SHOWFILE_RECORD_PENDING_UNIVERSES	4
+# endif
+
+namespace showfile::recording {
+static constexpr uint32_t BUFFER_SIZE = CONFIG_SHOWFILE_RECORD_BUFFER_SIZE;
+static constexpr uint32_t CHUNK_SIZE = 512;		///< Written per ShowFileRun
+static constexpr uint32_t PENDING_UNIVERSES = CONFIG_SHOWFILE_RECORD_PENDING_UNIVERSES;
+static_assert((BUFFER_SIZE & (BUFFER_SIZE - 1)) == 0, "BUFFER_SIZE must be a power of 2");
+
+struct Statistics {
+	uint32_t nFrames;
+	uint32_t nDropped;		///< Buffer full
+	uint32_t nRecovered;	///< Dropped frames recorded later from pending
+	uint32_t nLost;			///< Dropped frames without a free pending entry
+	uint32_t nBufferMax;	///< Maximum bytes waiting in the buffer
+};
+}  // namespace showfile::recording
+#endif
+
+#if defined (CONFIG_SHOWFILE_ENABLE_TIMECODE)
+# if !defined (CONFIG_SHOWFILE_TIMECODE_UNIVERSES)
+#  define CONFIG_SHOWFILE_TIMECODE_UNIVERSES	8
+# endif
+
+namespace ltc {
+struct TimeCode;
+}  // namespace ltc
+
+namespace showfile::timecode {
+static constexpr uint32_t UNIVERSES = CONFIG_SHOWFILE_TIMECODE_UNIVERSES;
+static constexpr uint32_t INDEX_ENTRIES = 64;
+static constexpr uint32_t INDEX_INTERVAL_MILLIS = 1000;
+static constexpr uint32_t FREEWHEEL_MILLIS = 1000;
+static constexpr uint32_t JUMP_FORWARD_MILLIS = 2000;	///< A larger step forward seeks
+static constexpr uint32_t OFFSET_INVALID = UINT32_MAX;
+
+struct IndexEntry {
+	uint32_t nMillis;
+	uint32_t nOffset;								///< File offset of the first line at nMillis
+	uint32_t nUniverseOffset[UNIVERSES];			///< File offset of the latest line for each universe
+};
+}  // namespace showfile::timecode
+#endif
+
 class ShowFileFormat: ShowFileProtocol {
 public:
 	ShowFileFormat() {
@@ -76,12 +135,23 @@ public:
 
 		m_OlaState = OlaState::IDLE;
 
+#if defined (CONFIG_SHOWFILE_ENABLE_TIMECODE)
+		TimeCodeReset();
+#endif
+
 		DEBUG_EXIT
 	}
 
 	void ShowFileStop() {
 		DEBUG_ENTRY
 
+#if !defined (CONFIG_SHOWFILE_DISABLE_RECORD)
+		if ((m_OlaState == OlaState::RECORD_FIRST) || (m_OlaState == OlaState::RECORDING)) {
+			RecordFlush(true);
+			m_OlaState = OlaState::IDLE;
+		}
+#endif
+
 		DEBUG_EXIT
 	}
 
@@ -104,6 +174,15 @@ public:
 			perror("fputs");
 #endif
 			m_OlaState = OlaState::RECORD_FIRST;
+#if !defined (CONFIG_SHOWFILE_DISABLE_RECORD)
+			m_nRecordHead = 0;
+			m_nRecordTail = 0;
+			memset(&m_RecordStatistics, 0, sizeof(struct showfile::recording::Statistics));
+
+			for (auto& pending : m_Pending) {
+				pending.bPending = false;
+			}
+#endif
 		} else {
 			m_OlaState = OlaState::IDLE;
 		}
@@ -115,13 +194,29 @@ public:
 
 	void ShowFilePrint() {
 		puts(" Format: OLA");
+#if !defined (CONFIG_SHOWFILE_DISABLE_RECORD)
+		printf(" Record: %u frames, %u dropped (%u recovered, %u lost), buffer %u/%u\n", static_cast<unsigned int>(m_RecordStatistics.nFrames), static_cast<unsigned int>(m_RecordStatistics.nDropped), static_cast<unsigned int>(m_RecordStatistics.nRecovered), static_cast<unsigned int>(m_RecordStatistics.nLost), static_cast<unsigned int>(m_RecordStatistics.nBufferMax), static_cast<unsigned int>(showfile::recording::BUFFER_SIZE));
+#endif
 		ShowFileProtocol::Print();
 	}
 
 	void ShowFileRun(const bool doRun) {
 		if (doRun) {
+#if defined (CONFIG_SHOWFILE_ENABLE_TIMECODE)
+			if (m_bTimeCode) {
+				RunTimeCode();
+			} else {
+				Run();
+			}
+#else
 			Run();
+#endif
 		}
+#if !defined (CONFIG_SHOWFILE_DISABLE_RECORD)
+		else if (m_OlaState == OlaState::RECORDING) {
+			RecordFlush(false);
+		}
+#endif
 
 		ShowFileProtocol::Run();
 	}
@@ -130,43 +225,61 @@ public:
 		ShowFileProtocol::DoRunCleanupProcess(bDoRun);
 	}
 
+#if !defined (CONFIG_SHOWFILE_DISABLE_RECORD)
 	void ShowfileWrite(const uint8_t *pDmxData,const uint32_t nSize, const uint32_t nUniverse, const uint32_t nMillis) {
-		if (m_OlaState == OlaState::RECORD_FIRST) {
-			m_OlaState = OlaState::RECORDING;
-		} else {
-			auto *p = m_buffer;
-			p += fast_itoa_universe(nMillis - m_nLastMillis, p);
-			*p++ = '\n';
-			*p = '\0';
-			fputs(m_buffer, m_pShowFile);
-#ifndef NDEBUG
-			perror("fputs");
-			printf("[%s]", m_buffer);
-#endif
+		if ((m_OlaState != OlaState::RECORD_FIRST) && (m_OlaState != OlaState::RECORDING)) {
+			return;
 		}
 
-		m_nLastMillis = nMillis;
+		/*
+		 * The pending frames are older, they go first
+		 */
+		RecordPending();
 
-		auto *p = m_buffer;
+		if (RecordLine(pDmxData, nSize, nUniverse, nMillis)) {
+			for (auto& pending : m_Pending) {
+				if (pending.bPending && (pending.nUniverse == nUniverse)) {
+					pending.bPending = false;
+				}
+			}
 
-		p += fast_itoa_universe(nUniverse & 0xFFFF, p);
-		*p++ = ' ';
+			return;
+		}
 
-		for (uint32_t nIndex = 0; nIndex < nSize; nIndex++) {
-			p += fast_itoa_dmx(pDmxData[nIndex] & 0xFF, p);
-			*p++ = ',';
+		m_RecordStatistics.nDropped++;
+
+		Pending *pFree = nullptr;
+
+		for (auto& pending : m_Pending) {
+			if (pending.bPending && (pending.nUniverse == nUniverse)) {
+				pFree = &pending;
+				break;
+			}
+
+			if (!pending.bPending && (pFree == nullptr)) {
+				pFree = &pending;
+			}
 		}
 
-		*--p = '\n';
-		*++p = '\0';
+		if (pFree == nullptr) {
+			m_RecordStatistics.nLost++;
+			return;
+		}
 
-		fputs(m_buffer, m_pShowFile);
-#ifndef NDEBUG
-		perror("fputs");
-		printf("[%s]", m_buffer);
-#endif
+		const auto nLength = nSize < sizeof(pFree->data) ? nSize : static_cast<uint32_t>(sizeof(pFree->data));
+
+		memcpy(pFree->data, pDmxData, nLength);
+		pFree->nLength = static_cast<uint16_t>(nLength);
+		pFree->nUniverse = static_cast<uint16_t>(nUniverse);
+		pFree->nMillis = nMillis;
+		pFree->bPending = true;
 	}
 
+	const showfile::recording::Statistics& GetRecordStatistics() const {
+		return m_RecordStatistics;
+	}
+#endif
+
 	void BlackOut() {
 #if defined (CONFIG_SHOWFILE_ENABLE_MASTER)
 		ShowFileProtocol::DmxBlackout();
@@ -183,12 +296,158 @@ public:
 		return ShowFileProtocol::IsSyncDisabled();
 	}
 
+#if defined (CONFIG_SHOWFILE_ENABLE_TIMECODE)
+	/**
+	 * The playback position follows the timecode, instead of the time stamps in the show file.
+	 * @param nOffsetMillis Timecode at the start of the show file
+	 */
+	void ShowFileTimeCodeEnable(const bool bEnable, const uint32_t nOffsetMillis = 0) {
+		m_bTimeCode = bEnable;
+		m_nTimeCodeOffsetMillis = nOffsetMillis;
+		TimeCodeReset();
+	}
+
+	bool ShowFileIsTimeCodeEnabled() const {
+		return m_bTimeCode;
+	}
+
+	void ShowFileTimeCode(const struct ltc::TimeCode *pTimeCode);
+#endif
+
 	static ShowFileFormat *Get() {
 		return s_pThis;
 	}
 
 private:
 	void Run();
+#if !defined (CONFIG_SHOWFILE_DISABLE_RECORD)
+	/**
+	 * @brief Writes the buffered lines to the file, the pending frames are recorded in the space made.
+	 * @param bAll false: at most showfile::recording::CHUNK_SIZE bytes.
+	 */
+	void RecordFlush(const bool bAll) {
+		do {
+			RecordFlushBuffer(bAll);
+		} while (RecordPending() && bAll);
+	}
+
+	void RecordFlushBuffer(const bool bAll) {
+		while (m_nRecordHead != m_nRecordTail) {
+			const auto nTail = m_nRecordTail & (showfile::recording::BUFFER_SIZE - 1);
+			auto nLength = m_nRecordHead - m_nRecordTail;
+
+			if (nLength > (showfile::recording::BUFFER_SIZE - nTail)) {
+				nLength = showfile::recording::BUFFER_SIZE - nTail;
+			}
+
+			if (nLength > showfile::recording::CHUNK_SIZE) {
+				nLength = showfile::recording::CHUNK_SIZE;
+			}
+
+			if (fwrite(&s_RecordBuffer[nTail], 1, nLength, m_pShowFile) != nLength) {
+#ifndef NDEBUG
+				perror("fwrite");
+#endif
+			}
+
+			m_nRecordTail += nLength;
+
+			if (!bAll) {
+				return;
+			}
+		}
+	}
+
+	/**
+	 * @brief Adds a line to the buffer.
+	 * @return false when the buffer is full.
+	 */
+	bool RecordLine(const uint8_t *pDmxData,const uint32_t nSize, const uint32_t nUniverse, const uint32_t nMillis) {
+		auto *p = m_buffer;
+		uint32_t nDelayMillis = 0;
+
+		if (m_OlaState == OlaState::RECORDING) {
+			// A pending frame can be older than the last line
+			if (static_cast<int32_t>(nMillis - m_nLastMillis) > 0) {
+				nDelayMillis = nMillis - m_nLastMillis;
+			}
+
+			p += fast_itoa_millis(nDelayMillis, p);
+			*p++ = '\n';
+		}
+
+		p += fast_itoa_universe(nUniverse & 0xFFFF, p);
+		*p++ = ' ';
+
+		for (uint32_t nIndex = 0; nIndex < nSize; nIndex++) {
+			p += fast_itoa_dmx(pDmxData[nIndex] & 0xFF, p);
+			*p++ = ',';
+		}
+
+		*--p = '\n';
+		p++;
+
+		const auto nLength = static_cast<uint32_t>(p - m_buffer);
+		const auto nUsed = m_nRecordHead - m_nRecordTail;
+
+		if ((showfile::recording::BUFFER_SIZE - nUsed) < nLength) {
+			return false;
+		}
+
+		const auto nHead = m_nRecordHead & (showfile::recording::BUFFER_SIZE - 1);
+		const auto nFirst = nLength < (showfile::recording::BUFFER_SIZE - nHead) ? nLength : (showfile::recording::BUFFER_SIZE - nHead);
+
+		memcpy(&s_RecordBuffer[nHead], m_buffer, nFirst);
+		memcpy(s_RecordBuffer, &m_buffer[nFirst], nLength - nFirst);
+
+		m_nRecordHead += nLength;
+
+		if ((nUsed + nLength) > m_RecordStatistics.nBufferMax) {
+			m_RecordStatistics.nBufferMax = nUsed + nLength;
+		}
+
+		m_RecordStatistics.nFrames++;
+
+		if (m_OlaState == OlaState::RECORD_FIRST) {
+			m_nLastMillis = nMillis;
+			m_OlaState = OlaState::RECORDING;
+		} else {
+			m_nLastMillis += nDelayMillis;
+		}
+
+		return true;
+	}
+
+	/**
+	 * @brief Records the pending frames, as long as there is space in the buffer.
+	 * @return true when a pending frame was recorded.
+	 */
+	bool RecordPending() {
+		auto isRecorded = false;
+
+		for (auto& pending : m_Pending) {
+			if (pending.bPending) {
+				if (!RecordLine(pending.data, pending.nLength, pending.nUniverse, pending.nMillis)) {
+					break;
+				}
+
+				pending.bPending = false;
+				m_RecordStatistics.nRecovered++;
+				isRecorded = true;
+			}
+		}
+
+		return isRecorded;
+	}
+#endif
+#if defined (CONFIG_SHOWFILE_ENABLE_TIMECODE)
+	void RunTimeCode();
+	void TimeCodeReset();
+	void Seek(const uint32_t nMillis);
+	void IndexAdd();
+	void CacheStore();
+	void CacheFlush();
+#endif
 	/*
 	 * Using a lookup table to convert binary numbers from 0 to 99
 	 * into ascii characters as described by Andrei Alexandrescu in
@@ -236,6 +495,26 @@ private:
 		return n;
 	}
 
+	uint32_t fast_itoa_millis(uint32_t nMillis, char *pDestination) {
+		if (nMillis < 100000) {
+			return fast_itoa_universe(nMillis, pDestination);
+		}
+
+		char digits[10];
+		uint32_t n = 0;
+
+		do {
+			digits[n++] = '0' + static_cast<char>(nMillis % 10U);
+			nMillis /= 10U;
+		} while (nMillis != 0);
+
+		for (uint32_t i = 0; i < n; i++) {
+			pDestination[i] = digits[n - 1 - i];
+		}
+
+		return n;
+	}
+
 	uint32_t fast_itoa_dmx(uint32_t nDmxValue, char *pDestination) {
 		uint32_t n = 0;
 
@@ -293,7 +572,7 @@ private:
 private:
 	OlaParseCode m_OlaParseCode { OlaParseCode::FAILED };
 	OlaState m_OlaState { OlaState::IDLE };
-	char m_buffer[2048];
+	char m_buffer[2048 + 32];		///< A 512 slots line with delay and universe
 	char m_digitsTable[200];
 	uint32_t m_nDelayMillis { 0 };
 	uint32_t m_nLastMillis { 0 };
@@ -301,6 +580,47 @@ private:
 	uint16_t m_nUniverse { 0 };
 	uint8_t m_DmxData[512];
 
+#if !defined (CONFIG_SHOWFILE_DISABLE_RECORD)
+	uint32_t m_nRecordHead { 0 };
+	uint32_t m_nRecordTail { 0 };
+	showfile::recording::Statistics m_RecordStatistics;
+	static inline char s_RecordBuffer[showfile::recording::BUFFER_SIZE];
+
+	struct Pending {
+		uint32_t nMillis;
+		uint16_t nLength;
+		uint16_t nUniverse;
+		bool bPending;
+		uint8_t data[512];
+	};
+
+	Pending m_Pending[showfile::recording::PENDING_UNIVERSES];
+#endif
+
+#if defined (CONFIG_SHOWFILE_ENABLE_TIMECODE)
+	struct Cache {
+		uint32_t nLength;
+		uint16_t nUniverse;
+		bool bValid;
+		bool bDirty;
+		uint8_t data[512];
+	};
+
+	Cache m_Cache[showfile::timecode::UNIVERSES];
+	showfile::timecode::IndexEntry m_Index[showfile::timecode::INDEX_ENTRIES];
+	uint32_t m_nUniverseOffset[showfile::timecode::UNIVERSES];
+	uint32_t m_nIndexEntries { 0 };
+	uint32_t m_nIndexInterval { showfile::timecode::INDEX_INTERVAL_MILLIS };
+	uint32_t m_nLineOffset { 0 };
+	uint32_t m_nShowMillis { 0 };				///< Show time of the lines being parsed
+	uint32_t m_nTimeCodeMillis { 0 };
+	uint32_t m_nTimeCodeArrivalMillis { 0 };
+	uint32_t m_nTimeCodeOffsetMillis { 0 };
+	bool m_bTimeCode { false };
+	bool m_bTimeCodeValid { false };
+	bool m_bEndOfFile { false };
+#endif
+
 	static ShowFileFormat *s_pThis;
 };
 
@@ -146,6 +146,11 @@ public:
 		printf(" %s\n", m_bDoLoop ? "Looping" : "Not looping");
 #if defined (CONFIG_SHOWFILE_DISABLE_RECORD)
 		puts(" Recorder is disabled.");
+#endif
+#if defined (CONFIG_SHOWFILE_ENABLE_TIMECODE)
+		if (ShowFileFormat::ShowFileIsTimeCodeEnabled()) {
+			puts(" Timecode");
+		}
 #endif
 		ShowFileFormat::ShowFilePrint();
 #if defined (CONFIG_SHOWFILE_ENABLE_OSC)
@@ -228,6 +233,20 @@ public:
 		return ShowFileFormat::IsSyncDisabled();
 	}
 
+#if defined (CONFIG_SHOWFILE_ENABLE_TIMECODE)
+	void EnableTimeCode(const bool bEnable, const uint32_t nOffsetMillis = 0) {
+		ShowFileFormat::ShowFileTimeCodeEnable(bEnable, nOffsetMillis);
+	}
+
+	bool IsTimeCodeEnabled() const {
+		return ShowFileFormat::ShowFileIsTimeCodeEnabled();
+	}
+
+	void SetTimeCode(const struct ltc::TimeCode *pTimeCode) {
+		ShowFileFormat::ShowFileTimeCode(pTimeCode);
+	}
+#endif
+
 	void BlackOut() {
 #if defined (CONFIG_SHOWFILE_ENABLE_MASTER)
 		Stop();
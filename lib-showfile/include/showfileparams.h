@@ -53,6 +53,7 @@ struct Mask {
 	static constexpr uint32_t OPTION_AUTO_PLAY = (1U << 7);
 	static constexpr uint32_t OPTION_LOOP = (1U << 8);
 	static constexpr uint32_t OPTION_DISABLE_SYNC = (1U << 9);
+	static constexpr uint32_t OPTION_TIMECODE = (1U << 10);
 };
 }  // namespace showfileparams
 
@@ -33,6 +33,7 @@ struct ShowFileParamsConst {
 	static inline const char OPTION_AUTO_PLAY[] = "auto_play";
 	static inline const char OPTION_LOOP[] = "loop";
 	static inline const char OPTION_DISABLE_SYNC[] = "disable_sync";
+	static inline const char OPTION_TIMECODE[] = "timecode";
 	static inline const char SACN_SYNC_UNIVERSE[] = "sync_universe";
 	static inline const char ARTNET_DISABLE_UNICAST[] = "disable_unicast";
 };
@@ -2,7 +2,7 @@
  * @file showfile_record.cpp
  *
  */
-/* Copyright (C) 2024 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2024-2025 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -35,9 +35,11 @@
 #include "artnet.h"
 
 namespace showfile {
-void record(const struct artnet::ArtDmx *pArtDmx, const uint32_t nMillis) {
+void record([[maybe_unused]] const struct artnet::ArtDmx *pArtDmx, [[maybe_unused]] const uint32_t nMillis) {
+#if !defined (CONFIG_SHOWFILE_DISABLE_RECORD)
 	const auto nDmxSlots = static_cast<uint32_t>(((pArtDmx->LengthHi << 8) & 0xff00) | pArtDmx->Length);
 	ShowFileFormat::Get()->ShowfileWrite(pArtDmx->Data, nDmxSlots, pArtDmx->PortAddress, nMillis);
+#endif
 }
 
 void record([[maybe_unused]] const struct artnet::ArtSync *pArtSync, [[maybe_unused]] const uint32_t nMillis) {
@@ -50,11 +52,13 @@ void record([[maybe_unused]] const struct artnet::ArtSync *pArtSync, [[maybe_unu
 #include "e131packets.h"
 
 namespace showfile {
-void record(const struct TE131DataPacket *pE131DataPacket, const uint32_t nMillis) {
+void record([[maybe_unused]] const struct TE131DataPacket *pE131DataPacket, [[maybe_unused]] const uint32_t nMillis) {
+#if !defined (CONFIG_SHOWFILE_DISABLE_RECORD)
 	const auto *const pDmxData = &pE131DataPacket->DMPLayer.PropertyValues[1];
 	const auto nLength = __builtin_bswap16(pE131DataPacket->DMPLayer.PropertyValueCount) - 1U;
 	const auto Universe = __builtin_bswap16(pE131DataPacket->FrameLayer.Universe);
 	ShowFileFormat::Get()->ShowfileWrite(pDmxData, nLength, Universe, nMillis);
+#endif
 }
 
 void record([[maybe_unused]] const struct TE131SynchronizationPacket *pE131SynchronizationPacke, [[maybe_unused]] const uint32_t nMillis) {
@@ -0,0 +1,269 @@
+/**
+ * @file showfile_timecode.cpp
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#if defined (CONFIG_SHOWFILE_ENABLE_TIMECODE)
+#if defined (DEBUG_SHOWFILE_TIMECODE)
+# undef NDEBUG
+#endif
+
+#if defined(__GNUC__) && !defined(__clang__)
+# pragma GCC push_options
+# pragma GCC optimize ("O2")
+#endif
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cassert>
+
+#include "formats/showfileformatola.h"
+#include "ltc.h"
+
+#include "hardware.h"
+
+#include "debug.h"
+
+/*
+ * The show time follows the timecode. All lines up to the show time are parsed into
+ * a cache with the latest data for each universe, which is sent once per Run.
+ * This way a catch-up does not replay the intermediate frames.
+ *
+ * While playing, an index with a seek point every second is built. A seek point holds
+ * the file offset of the latest line for each universe, so that after a jump all
+ * universes are restored to their state at the jump target.
+ */
+
+namespace showfile::timecode {
+static constexpr uint32_t FPS[4] = { 24, 25, 30, 30 };
+static constexpr uint32_t JUMP_BACKWARD_MILLIS = 80;	///< A small step backward holds
+}  // namespace showfile::timecode
+
+using namespace showfile::timecode;
+
+void ShowFileFormat::TimeCodeReset() {
+	m_nIndexEntries = 0;
+	m_nIndexInterval = INDEX_INTERVAL_MILLIS;
+	m_nShowMillis = 0;
+	m_bEndOfFile = false;
+
+	for (uint32_t i = 0; i < UNIVERSES; i++) {
+		m_Cache[i].bValid = false;
+		m_Cache[i].bDirty = false;
+		m_nUniverseOffset[i] = OFFSET_INVALID;
+	}
+
+	if (m_pShowFile != nullptr) {
+		fseek(m_pShowFile, 0L, SEEK_SET);
+	}
+
+	m_OlaState = OlaState::IDLE;
+}
+
+void ShowFileFormat::ShowFileTimeCode(const struct ltc::TimeCode *pTimeCode) {
+	assert(pTimeCode != nullptr);
+
+	if (pTimeCode->nType >= (sizeof(FPS) / sizeof(FPS[0]))) {
+		return;
+	}
+
+	const auto nMillis = ((((pTimeCode->nHours * 60U) + pTimeCode->nMinutes) * 60U) + pTimeCode->nSeconds) * 1000U + (pTimeCode->nFrames * 1000U) / FPS[pTimeCode->nType];
+
+	m_nTimeCodeMillis = nMillis > m_nTimeCodeOffsetMillis ? nMillis - m_nTimeCodeOffsetMillis : 0;
+	m_nTimeCodeArrivalMillis = Hardware::Get()->Millis();
+	m_bTimeCodeValid = true;
+}
+
+void ShowFileFormat::CacheStore() {
+	for (uint32_t i = 0; i < UNIVERSES; i++) {
+		auto& cache = m_Cache[i];
+
+		if (!cache.bValid) {
+			cache.bValid = true;
+			cache.nUniverse = m_nUniverse;
+		} else if (cache.nUniverse != m_nUniverse) {
+			continue;
+		}
+
+		memcpy(cache.data, m_DmxData, m_nDmxDataLength);
+		cache.nLength = m_nDmxDataLength;
+		cache.bDirty = true;
+
+		m_nUniverseOffset[i] = m_nLineOffset;
+		return;
+	}
+
+	// No cache entry available
+	ShowFileProtocol::DmxOut(m_nUniverse, m_DmxData, m_nDmxDataLength);
+}
+
+void ShowFileFormat::CacheFlush() {
+	auto bSync = false;
+
+	for (auto& cache : m_Cache) {
+		if (cache.bDirty) {
+			cache.bDirty = false;
+
+			if (cache.nLength != 0) {
+				ShowFileProtocol::DmxOut(cache.nUniverse, cache.data, cache.nLength);
+				bSync = true;
+			}
+		}
+	}
+
+	if (bSync) {
+		ShowFileProtocol::DmxSync();
+	}
+}
+
+void ShowFileFormat::IndexAdd() {
+	if ((m_nIndexEntries != 0) && (m_nShowMillis < (m_Index[m_nIndexEntries - 1].nMillis + m_nIndexInterval))) {
+		return;
+	}
+
+	if (m_nIndexEntries == INDEX_ENTRIES) {
+		// Keep every other seek point
+		for (uint32_t i = 1; i < (INDEX_ENTRIES / 2); i++) {
+			m_Index[i] = m_Index[2 * i];
+		}
+
+		m_nIndexEntries = INDEX_ENTRIES / 2;
+		m_nIndexInterval *= 2;
+
+		if (m_nShowMillis < (m_Index[m_nIndexEntries - 1].nMillis + m_nIndexInterval)) {
+			return;
+		}
+	}
+
+	auto& entry = m_Index[m_nIndexEntries++];
+
+	entry.nMillis = m_nShowMillis;
+	entry.nOffset = static_cast<uint32_t>(ftell(m_pShowFile));
+	memcpy(entry.nUniverseOffset, m_nUniverseOffset, sizeof(entry.nUniverseOffset));
+}
+
+void ShowFileFormat::Seek(const uint32_t nMillis) {
+	int32_t nEntry = -1;
+
+	for (uint32_t i = 0; i < m_nIndexEntries; i++) {
+		if (m_Index[i].nMillis > nMillis) {
+			break;
+		}
+		nEntry = static_cast<int32_t>(i);
+	}
+
+	// Forward: only seek when the seek point is ahead of the current position
+	if ((nMillis >= m_nShowMillis) && !m_bEndOfFile) {
+		if ((nEntry < 0) || (m_Index[nEntry].nMillis <= m_nShowMillis)) {
+			return;
+		}
+	}
+
+	DEBUG_PRINTF("%u -> %u [%d]", m_nShowMillis, nMillis, nEntry);
+
+	for (auto& cache : m_Cache) {
+		cache.bDirty = false;
+	}
+
+	m_bEndOfFile = false;
+
+	if (nEntry < 0) {
+		for (auto& nOffset : m_nUniverseOffset) {
+			nOffset = OFFSET_INVALID;
+		}
+
+		fseek(m_pShowFile, 0L, SEEK_SET);
+		m_nShowMillis = 0;
+		m_OlaState = OlaState::IDLE;
+		return;
+	}
+
+	const auto& entry = m_Index[nEntry];
+
+	// Restore the latest state of each universe
+	for (uint32_t i = 0; i < UNIVERSES; i++) {
+		m_nUniverseOffset[i] = entry.nUniverseOffset[i];
+
+		if (entry.nUniverseOffset[i] != OFFSET_INVALID) {
+			m_nLineOffset = entry.nUniverseOffset[i];
+			fseek(m_pShowFile, static_cast<long>(m_nLineOffset), SEEK_SET);
+
+			if (GetNextLine() == OlaParseCode::DMX) {
+				CacheStore();
+			}
+		}
+	}
+
+	fseek(m_pShowFile, static_cast<long>(entry.nOffset), SEEK_SET);
+	m_nShowMillis = entry.nMillis;
+	m_OlaState = OlaState::PARSING_DMX;
+}
+
+void ShowFileFormat::RunTimeCode() {
+	if ((m_pShowFile == nullptr) || !m_bTimeCodeValid) {
+		return;
+	}
+
+	// Freewheel when the timecode stops
+	auto nElapsed = Hardware::Get()->Millis() - m_nTimeCodeArrivalMillis;
+
+	if (nElapsed > FREEWHEEL_MILLIS) {
+		nElapsed = FREEWHEEL_MILLIS;
+	}
+
+	const auto nTarget = m_nTimeCodeMillis + nElapsed;
+
+	if (((nTarget + JUMP_BACKWARD_MILLIS) < m_nShowMillis) || (nTarget > (m_nShowMillis + JUMP_FORWARD_MILLIS))) {
+		Seek(nTarget);
+	}
+
+	while (!m_bEndOfFile) {
+		if (m_OlaState == OlaState::TIME_WAITING) {
+			if ((m_nShowMillis + m_nDelayMillis) > nTarget) {
+				break;
+			}
+
+			m_nShowMillis += m_nDelayMillis;
+			m_OlaState = OlaState::PARSING_DMX;
+
+			IndexAdd();
+		}
+
+		m_nLineOffset = static_cast<uint32_t>(ftell(m_pShowFile));
+
+		const auto code = GetNextLine();
+
+		if (code == OlaParseCode::DMX) {
+			CacheStore();
+		} else if (code == OlaParseCode::TIME) {
+			m_OlaState = OlaState::TIME_WAITING;
+		} else if (code == OlaParseCode::EOFILE) {
+			// Hold at the end, a jump backward continues
+			m_bEndOfFile = true;
+		}
+	}
+
+	CacheFlush();
+}
+#endif
@@ -220,6 +220,13 @@ void ShowFileParams::callbackFunction(const char *pLine) {
 		SetBool(nValue8, showfileparams::Mask::OPTION_DISABLE_SYNC);
 		return;
 	}
+
+#if defined (CONFIG_SHOWFILE_ENABLE_TIMECODE)
+	if (Sscan::Uint8(pLine, ShowFileParamsConst::OPTION_TIMECODE, nValue8) == Sscan::OK) {
+		SetBool(nValue8, showfileparams::Mask::OPTION_TIMECODE);
+		return;
+	}
+#endif
 }
 
 void ShowFileParams::Builder(const struct TShowFileParams *ptShowFileParamss, char *pBuffer, uint32_t nLength, uint32_t& nSize) {
@@ -257,6 +264,9 @@ void ShowFileParams::Builder(const struct TShowFileParams *ptShowFileParamss, ch
 #if !defined (CONFIG_SHOWFILE_PROTOCOL_INTERNAL)
 	builder.Add(ShowFileParamsConst::OPTION_DISABLE_SYNC, isMaskSet(showfileparams::Mask::OPTION_DISABLE_SYNC), isMaskSet(showfileparams::Mask::OPTION_DISABLE_SYNC));
 #endif
+#if defined (CONFIG_SHOWFILE_ENABLE_TIMECODE)
+	builder.Add(ShowFileParamsConst::OPTION_TIMECODE, isMaskSet(showfileparams::Mask::OPTION_TIMECODE), isMaskSet(showfileparams::Mask::OPTION_TIMECODE));
+#endif
 
 #if defined (CONFIG_SHOWFILE_ENABLE_OSC)
 	builder.AddComment("OSC Server");
@@ -319,6 +329,12 @@ void ShowFileParams::Set() {
 		ShowFile::Get()->DoLoop(true);
 	}
 
+#if defined (CONFIG_SHOWFILE_ENABLE_TIMECODE)
+	if (isMaskSet(showfileparams::Mask::OPTION_TIMECODE)) {
+		ShowFile::Get()->EnableTimeCode(true);
+	}
+#endif
+
 #if !defined (CONFIG_SHOWFILE_PROTOCOL_INTERNAL)
 	if (isMaskSet(showfileparams::Mask::OPTION_DISABLE_SYNC)) {
 # if defined (CONFIG_SHOWFILE_PROTOCOL_E131)
@@ -377,6 +393,11 @@ void ShowFileParams::Dump() {
 		printf("  Synchronization is disabled\n");
 	}
 #endif
+#if defined (CONFIG_SHOWFILE_ENABLE_TIMECODE)
+	if (isMaskSet(showfileparams::Mask::OPTION_TIMECODE)) {
+		printf("  Timecode is enabled\n");
+	}
+#endif
 #if defined (CONFIG_SHOWFILE_ENABLE_OSC)
 	printf(" %s=%u\n", OscParamsConst::INCOMING_PORT, m_Params.nOscPortIncoming);
 	printf(" %s=%u\n", OscParamsConst::OUTGOING_PORT, m_Params.nOscPortOutgoing);
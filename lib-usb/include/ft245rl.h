@@ -2,7 +2,7 @@
  * @file ft245rl.h
  *
  */
-/* Copyright (C) 2016-2023 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2016-2025 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -35,5 +35,6 @@ uint8_t FT245RL_read_data();
 
 bool FT245RL_can_write();
 void FT245RL_write_data(uint8_t);
+void FT245RL_write_data(const uint8_t *, uint32_t);
 
 #endif /* FT245RL_H_ */
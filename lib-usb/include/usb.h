@@ -2,7 +2,7 @@
  * @file usb.h
  *
  */
-/* Copyright (C) 2015-2023 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2015-2025 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -32,6 +32,7 @@
 
 uint8_t usb_read_byte();
 void usb_send_byte(uint8_t);
+void usb_send_data(const uint8_t *, uint32_t);
 
 inline bool usb_read_is_byte_available() {
 	return FT245RL_data_available();
@@ -25,7 +25,7 @@
  * 22:GPIO02	<----	RXF#
  *
  */
-/* Copyright (C) 2018 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2018-2025 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -164,12 +164,8 @@ void FT245RL_init() {
 	h3_gpio_clr(WR);
 }
 
-/**
- * Write 8-bits to USB
- */
-void FT245RL_write_data(uint8_t data) {
+static void write_data(uint8_t data) {
 	uint8_t i;
-	data_gpio_fsel_output();
 	// Raise WR to start the write.
 	h3_gpio_set(WR);
 	i = NOP_COUNT_WRITE;
@@ -195,6 +191,27 @@ void FT245RL_write_data(uint8_t data) {
 	h3_gpio_clr(WR);
 }
 
+/**
+ * Write 8-bits to USB
+ */
+void FT245RL_write_data(uint8_t data) {
+	data_gpio_fsel_output();
+	write_data(data);
+}
+
+/**
+ * Write nLength bytes to USB, the data GPIOs are set to output once
+ */
+void FT245RL_write_data(const uint8_t *pData, uint32_t nLength) {
+	data_gpio_fsel_output();
+
+	for (uint32_t i = 0; i < nLength; i++) {
+		while (H3_PIO_PORTA->DAT & (1 << _TXE))
+			;
+		write_data(pData[i]);
+	}
+}
+
 /**
  * Read 8-bits from USB
  */
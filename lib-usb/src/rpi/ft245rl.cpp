@@ -25,7 +25,7 @@
  * 22:GPIO25	<----	RXF#
  *
  */
-/* Copyright (C) 2016-2017 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2016-2025 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -150,16 +150,8 @@ void FT245RL_init() {
 	dmb();
 }
 
-/**
- * @ingroup ft245rl
- *
- * Write 8-bits to USB
- *
- * @param data
- */
-void FT245RL_write_data(const uint8_t data) {
+static void write_data(const uint8_t data) {
 	uint8_t i;
-	data_gpio_fsel_output();
 	// Raise WR to start the write.
 	bcm2835_gpio_set(WR);
 	dmb();
@@ -181,6 +173,33 @@ void FT245RL_write_data(const uint8_t data) {
 	dmb();
 }
 
+/**
+ * @ingroup ft245rl
+ *
+ * Write 8-bits to USB
+ *
+ * @param data
+ */
+void FT245RL_write_data(const uint8_t data) {
+	data_gpio_fsel_output();
+	write_data(data);
+}
+
+/**
+ * @ingroup ft245rl
+ *
+ * Write nLength bytes to USB, the data GPIOs are set to output once
+ */
+void FT245RL_write_data(const uint8_t *pData, uint32_t nLength) {
+	data_gpio_fsel_output();
+
+	for (uint32_t i = 0; i < nLength; i++) {
+		while (BCM2835_GPIO->GPLEV0 & (1 << 24))
+			;
+		write_data(pData[i]);
+	}
+}
+
 /**
  * @ingroup ft245rl
  *
@@ -2,7 +2,7 @@
  * @file usb.cpp
  *
  */
-/* Copyright (C) 2015-2021 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2015-2025 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -39,3 +39,7 @@ void usb_send_byte(uint8_t byte) {
 		;
 	FT245RL_write_data(byte);
 }
+
+void usb_send_data(const uint8_t *pData, uint32_t nLength) {
+	FT245RL_write_data(pData, nLength);
+}
@@ -6,7 +6,7 @@
  * https://wiki.openlighting.org/index.php/USB_Protocol_Extensions
  *
  */
-/* Copyright (C) 2015-2020 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2015-2025 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -145,6 +145,7 @@ private:
 private:
 #define WIDGET_DATA_BUFFER_SIZE		600
 	uint8_t m_aData[WIDGET_DATA_BUFFER_SIZE];	///< Message between widget and the USB host
+	uint8_t m_DmxPrevious[dmx::buffer::SIZE] __attribute__ ((aligned (4)));	///< Last DMX frame reported with change of state
 	widget::Mode m_tMode { widget::Mode::DMX_RDM };
 	widget::SendState m_tReceiveDmxOnChange { widget::SendState::ALWAYS };
 	uint32_t m_nReceivedDmxPacketPeriodMillis { 0 };
@@ -6,7 +6,7 @@
  * https://wiki.openlighting.org/index.php/USB_Protocol_Extensions
  *
  */
-/* Copyright (C) 2015-2023 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2015-2025 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -29,6 +29,7 @@
 
 #include <cstdint>
 #include <cstddef>
+#include <cstring>
 #include <cassert>
 
 #include "widget.h"
@@ -61,6 +62,11 @@ enum {
 	GET_WIDGET_NAME_LABEL = 78				///< https://wiki.openlighting.org/index.php/USB_Protocol_Extensions
 };
 
+namespace widget::cos {
+static constexpr uint32_t BLOCK_SLOTS = 40;		///< Slots per change of state message
+static constexpr uint32_t CHANGED_BITS_SIZE = BLOCK_SLOTS / 8;
+}  // namespace widget::cos
+
 using namespace widget;
 using namespace widgetmonitor;
 using namespace dmx;
@@ -71,6 +77,8 @@ Widget::Widget() {
 	assert(s_pThis == nullptr);
 	s_pThis = this;
 
+	memset(m_DmxPrevious, 0, sizeof(m_DmxPrevious));
+
 	usb_init();
 
 	SetOutputStyle(0, dmx::OutputStyle::CONTINOUS);
@@ -323,6 +331,7 @@ void Widget::ReceiveDmxOnChange() {
 
 	Dmx::SetPortDirection(0, PortDirection::INP, false);
 	Dmx::ClearData(0);
+	memset(m_DmxPrevious, 0, sizeof(m_DmxPrevious));
 	Dmx::SetPortDirection(0, PortDirection::INP, true);
 
 	m_nReceivedDmxPacketStartMillis = Hardware::Get()->Millis();
@@ -335,6 +344,13 @@ void Widget::ReceiveDmxOnChange() {
  * The Widget sends one or more instances of this message to the PC unsolicited, whenever the
  * Widget receives a changed DMX packet from the DMX port, and the Receive DMX on Change
  * mode (\ref receive_dmx_on_change) is 'Send on data change only' (\ref SEND_ON_DATA_CHANGE_ONLY).
+ *
+ * A message covers a block of 40 slots, the start code included:
+ * - Start changed byte number, the first slot of the block divided by 8
+ * - Changed bit array, 5 bytes, bit 0 of the first byte is the first slot of the block
+ * - The value of each changed slot
+ *
+ * The frame is compared with the frame last reported to the host, a 32-bit word at a time.
  */
 void Widget::ReceivedDmxChangeOfStatePacket() {
 	if (m_tMode == widget::Mode::RDM_SNIFFER) {
@@ -347,12 +363,72 @@ void Widget::ReceivedDmxChangeOfStatePacket() {
 		return;
 	}
 
-	if (nullptr != Dmx::GetDmxChanged(0)) {
-		WidgetMonitor::Line(MonitorLine::INFO, "RECEIVED_DMX_COS_TYPE");
-		WidgetMonitor::Line(MonitorLine::STATUS, nullptr);
-		// TODO widget_received_dmx_change_of_state_packet
-		WidgetMonitor::Line(MonitorLine::INFO, "Sent changed DMX data to HOST");
+	const auto *pDmxData = GetDmxAvailable(0);
+
+	if (pDmxData == nullptr) {
+		return;
+	}
+
+	const auto nMillis = Hardware::Get()->Millis();
+
+	if (nMillis - m_nReceivedDmxPacketStartMillis < m_nReceivedDmxPacketPeriodMillis) {
+		return;
+	}
+
+	const auto *pDmxStatistics = reinterpret_cast<const struct Data *>(pDmxData);
+	const auto nLength = pDmxStatistics->Statistics.nSlotsInPacket + 1U;
+	const auto *pCurrent = reinterpret_cast<const uint32_t *>(pDmxData);
+	const auto *pPrevious = reinterpret_cast<const uint32_t *>(m_DmxPrevious);
+
+	uint8_t message[1 + cos::CHANGED_BITS_SIZE + cos::BLOCK_SLOTS];
+	uint32_t nMessages = 0;
+
+	for (uint32_t nBlock = 0; nBlock < nLength; nBlock += cos::BLOCK_SLOTS) {
+		const auto nBlockEnd = (nBlock + cos::BLOCK_SLOTS) < nLength ? (nBlock + cos::BLOCK_SLOTS) : nLength;
+		uint64_t nChanged = 0;
+		uint32_t nValues = 0;
+
+		for (auto nSlot = nBlock; nSlot < nBlockEnd; nSlot += 4) {
+			const auto nDiff = pCurrent[nSlot / 4] ^ pPrevious[nSlot / 4];
+
+			if (__builtin_expect((nDiff == 0), 1)) {
+				continue;
+			}
+
+			for (uint32_t i = 0; (i < 4) && ((nSlot + i) < nBlockEnd); i++) {
+				if (((nDiff >> (i * 8)) & 0xFF) != 0) {
+					nChanged |= static_cast<uint64_t>(1) << (nSlot + i - nBlock);
+					message[1 + cos::CHANGED_BITS_SIZE + nValues++] = pDmxData[nSlot + i];
+				}
+			}
+		}
+
+		if (nChanged == 0) {
+			continue;
+		}
+
+		message[0] = static_cast<uint8_t>(nBlock / 8);
+
+		for (uint32_t i = 0; i < cos::CHANGED_BITS_SIZE; i++) {
+			message[1 + i] = static_cast<uint8_t>(nChanged >> (i * 8));
+		}
+
+		SendMessage(RECEIVED_DMX_COS_TYPE, message, 1 + cos::CHANGED_BITS_SIZE + nValues);
+		nMessages++;
+	}
+
+	if (nMessages == 0) {
+		return;
 	}
+
+	memcpy(m_DmxPrevious, pDmxData, nLength);
+
+	m_nReceivedDmxPacketStartMillis = nMillis;
+	m_nReceivedDmxPacketCount++;
+
+	WidgetMonitor::Line(MonitorLine::LABEL, "RECEIVED_DMX_COS_TYPE");
+	WidgetMonitor::Line(MonitorLine::INFO, "Sent changed DMX data to HOST, %u messages", static_cast<unsigned int>(nMessages));
+	WidgetMonitor::Line(MonitorLine::STATUS, nullptr);
 }
 
 /**
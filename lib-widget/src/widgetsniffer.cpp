@@ -2,7 +2,7 @@
  * @file widgetsniffer.cpp
  *
  */
-/* Copyright (C) 2015-2021 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2015-2025 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -52,34 +52,31 @@
 using namespace widget;
 using namespace widgetmonitor;
 
-void Widget::UsbSendPackage(const uint8_t *pData, uint16_t Start, uint16_t nDataLength) {
-	uint32_t i;
+void Widget::UsbSendPackage(const uint8_t *pData, uint16_t nStart, uint16_t nDataLength) {
+	uint8_t package[SNIFFER_PACKET_SIZE];
 
-	if (nDataLength < (SNIFFER_PACKET_SIZE / 2)) {
-		SendHeader(SNIFFER_PACKET, SNIFFER_PACKET_SIZE);
+	for (;;) {
+		const uint32_t nLength = nDataLength < (SNIFFER_PACKET_SIZE / 2) ? nDataLength : (SNIFFER_PACKET_SIZE / 2);
+		uint32_t i;
 
-		for (i = 0; i < nDataLength; i++) {
-			usb_send_byte(DATA_MASK);
-			usb_send_byte(pData[i + Start]);
+		for (i = 0; i < nLength; i++) {
+			package[i * 2] = DATA_MASK;
+			package[i * 2 + 1] = pData[i + nStart];
 		}
 
-		for (i = nDataLength; i < SNIFFER_PACKET_SIZE / 2; i++) {
-			usb_send_byte(CONTROL_MASK);
-			usb_send_byte(0x02);
+		for (; i < SNIFFER_PACKET_SIZE / 2; i++) {
+			package[i * 2] = CONTROL_MASK;
+			package[i * 2 + 1] = 0x02;
 		}
 
-		SendFooter();
-	} else {
-		SendHeader(SNIFFER_PACKET, SNIFFER_PACKET_SIZE);
+		SendMessage(SNIFFER_PACKET, package, SNIFFER_PACKET_SIZE);
 
-		for (i = 0; i < SNIFFER_PACKET_SIZE / 2; i++) {
-			usb_send_byte(DATA_MASK);
-			usb_send_byte(pData[i + Start]);
+		if (nDataLength < (SNIFFER_PACKET_SIZE / 2)) {
+			return;
 		}
 
-		SendFooter();
-
-		UsbSendPackage(pData, static_cast<uint16_t>(Start + SNIFFER_PACKET_SIZE / 2), static_cast<uint16_t>(nDataLength - SNIFFER_PACKET_SIZE / 2));
+		nStart = static_cast<uint16_t>(nStart + SNIFFER_PACKET_SIZE / 2);
+		nDataLength = static_cast<uint16_t>(nDataLength - SNIFFER_PACKET_SIZE / 2);
 	}
 }
 
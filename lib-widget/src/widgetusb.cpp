@@ -2,7 +2,7 @@
  * @file widgetusb.cpp
  *
  */
-/* Copyright (C) 2015-2020 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2015-2025 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -31,16 +31,18 @@
 using namespace widget;
 
 void Widget::SendHeader(uint8_t nLabel, uint32_t nLength) {
-	usb_send_byte(static_cast<uint8_t>(Amf::START_CODE));
-	usb_send_byte(nLabel);
-	usb_send_byte(static_cast<uint8_t>(nLength & 0x00FF));
-	usb_send_byte(static_cast<uint8_t>(nLength >> 8));
+	const uint8_t header[] = {
+			static_cast<uint8_t>(Amf::START_CODE),
+			nLabel,
+			static_cast<uint8_t>(nLength & 0x00FF),
+			static_cast<uint8_t>(nLength >> 8)
+	};
+
+	usb_send_data(header, sizeof(header));
 }
 
 void Widget::SendData(const uint8_t *pData, uint32_t nLength) {
-	for (uint32_t i = 0; i < nLength; i++) {
-		usb_send_byte(pData[i]);
-	}
+	usb_send_data(pData, nLength);
 }
 
 void Widget::SendFooter() {
@@ -1,19 +0,0 @@
-// gamma=2.5, offset=0.5
-static constexpr uint8_t gamma25_5[256] = {
-   0,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,
-   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   1,   2,   2,   2,   2,
-   2,   2,   2,   2,   2,   3,   3,   3,   3,   3,   3,   3,   4,   4,   4,   4,
-   4,   5,   5,   5,   5,   6,   6,   6,   6,   7,   7,   7,   7,   8,   8,   8,
-   9,   9,   9,  10,  10,  10,  11,  11,  11,  12,  12,  12,  13,  13,  14,  14,
-  15,  15,  15,  16,  16,  17,  17,  18,  18,  19,  19,  20,  20,  21,  22,  22,
-  23,  23,  24,  24,  25,  26,  26,  27,  28,  28,  29,  30,  30,  31,  32,  32,
-  33,  34,  35,  35,  36,  37,  38,  38,  39,  40,  41,  42,  43,  43,  44,  45,
-  46,  47,  48,  49,  50,  51,  52,  53,  53,  54,  55,  56,  57,  58,  60,  61,
-  62,  63,  64,  65,  66,  67,  68,  69,  70,  72,  73,  74,  75,  76,  78,  79,
-  80,  81,  83,  84,  85,  86,  88,  89,  90,  92,  93,  94,  96,  97,  99, 100,
- 101, 103, 104, 106, 107, 109, 110, 112, 113, 115, 116, 118, 120, 121, 123, 124,
- 126, 128, 129, 131, 133, 134, 136, 138, 139, 141, 143, 145, 146, 148, 150, 152,
- 154, 156, 157, 159, 161, 163, 165, 167, 169, 171, 173, 175, 177, 179, 181, 183,
- 185, 187, 189, 191, 193, 195, 198, 200, 202, 204, 206, 208, 211, 213, 215, 217,
- 220, 222, 224, 227, 229, 231, 234, 236, 238, 241, 243, 246, 248, 251, 253, 255 
-};
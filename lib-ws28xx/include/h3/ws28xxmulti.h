@@ -2,7 +2,7 @@
  * @file ws28xxmulti.h
  *
  */
-/* Copyright (C) 2019-2024 by Arjan van Vught mailto:info@gd32-dmx.org
+/* Copyright (C) 2019-2025 by Arjan van Vught mailto:info@gd32-dmx.org
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -41,6 +41,7 @@
 #endif
 
 #include <cstdint>
+#include <cassert>
 
 #include "pixelconfiguration.h"
 
@@ -62,101 +63,24 @@ public:
 		SetColour(nPortIndex, nPixelIndex, nColour1, nColour2, nColour3);
 	}
 
-#define BIT_SET(a,b) 	((a) |= static_cast<uint8_t>((1<<(b))))
-#define BIT_CLEAR(a,b) 	((a) &= static_cast<uint8_t>(~(1<<(b))))
-
 	inline void SetColourRTZ(uint32_t nPortIndex, uint32_t nPixelIndex, uint8_t nRed, uint8_t nGreen, uint8_t nBlue, uint8_t nWhite) {
-		uint32_t localBuffer[32] __attribute__((aligned(32)));
-		const auto k = nPixelIndex * pixel::single::RGBW;
-
-	    for (uint32_t i = 0; i < 32; i++) {
-	        localBuffer[i] = m_pPixelDataBuffer[k + i];
-	    }
-
-		uint32_t j = 0;
-
-		for (uint8_t mask = 0x80; mask != 0; mask = static_cast<uint8_t>(mask >> 1)) {
-			// GRBW
-			if (mask & nGreen) {
-				BIT_SET(localBuffer[j], nPortIndex);
-			} else {
-				BIT_CLEAR(localBuffer[j], nPortIndex);
-			}
-
-			if (mask & nRed) {
-				BIT_SET(localBuffer[8 + j], nPortIndex);
-			} else {
-				BIT_CLEAR(localBuffer[8 + j], nPortIndex);
-			}
-
-			if (mask & nBlue) {
-				BIT_SET(localBuffer[16 + j], nPortIndex);
-			} else {
-				BIT_CLEAR(localBuffer[16 + j], nPortIndex);
-			}
-
-			if (mask & nWhite) {
-				BIT_SET(localBuffer[24 + j], nPortIndex);
-			} else {
-				BIT_CLEAR(localBuffer[24 + j], nPortIndex);
-			}
-
-			j++;
-		}
-
-	    // Write back to m_pBuffer1
-	    for (uint32_t i = 0; i < 32; i++) {
-	    	m_pPixelDataBuffer[k + i] = localBuffer[i];
-	    }
+		// GRBW
+		SetPixel4Bytes(nPortIndex, nPixelIndex, nGreen, nRed, nBlue, nWhite);
 	}
 
 	inline void SetColourWS2801(uint32_t nPortIndex, uint32_t nPixelIndex, uint8_t nColour1, uint8_t nColour2, uint8_t nColour3) {
 		SetColour(nPortIndex, nPixelIndex, nColour1, nColour2, nColour3);
 	}
 
-	inline void SetPixel4Bytes(uint32_t nPortIndex, uint32_t nPixelIndex, uint8_t nRed, uint8_t nGreen, uint8_t nBlue, uint8_t nWhite) {
-	    uint32_t localBuffer[32] __attribute__((aligned(32)));
-		const auto k = nPixelIndex * pixel::single::RGBW;
-
-	    for (uint32_t i = 0; i < 32; i++) {
-	        localBuffer[i] = m_pPixelDataBuffer[k + i];
-	    }
-
-		uint32_t j = 0;
-
-		for (uint8_t mask = 0x80; mask != 0; mask = static_cast<uint8_t>(mask >> 1)) {
-			// GRBW
-			if (mask & nGreen) {
-				BIT_SET(localBuffer[j], nPortIndex);
-			} else {
-				BIT_CLEAR(localBuffer[j], nPortIndex);
-			}
-
-			if (mask & nRed) {
-				BIT_SET(localBuffer[8 + j], nPortIndex);
-			} else {
-				BIT_CLEAR(localBuffer[8 + j], nPortIndex);
-			}
-
-			if (mask & nBlue) {
-				BIT_SET(localBuffer[16 + j], nPortIndex);
-			} else {
-				BIT_CLEAR(localBuffer[16 + j], nPortIndex);
-			}
-
-			if (mask & nWhite) {
-				BIT_SET(localBuffer[24 + j], nPortIndex);
-			} else {
-				BIT_CLEAR(localBuffer[24 + j], nPortIndex);
-			}
-
-			j++;
-		}
-
-	    // Write back to m_pBuffer1
-	    for (uint32_t i = 0; i < 32; i++) {
-	    	m_pPixelDataBuffer[k + i] = localBuffer[i];
-	    }
+	inline void SetPixel4Bytes(uint32_t nPortIndex, uint32_t nPixelIndex, uint8_t nCtrl, uint8_t nColour1, uint8_t nColour2, uint8_t nColour3) {
+		assert(nPortIndex < 8);
+		assert(nPixelIndex < (LANE_SIZE / 4));
+
+		auto *p = &s_Lanes[nPortIndex][nPixelIndex * 4];
+		p[0] = nCtrl;
+		p[1] = nColour1;
+		p[2] = nColour2;
+		p[3] = nColour3;
 	}
 
 	bool IsUpdating() {
@@ -178,6 +102,7 @@ public:
 	}
 
 private:
+	uint32_t GetCount(const uint32_t nPortIndex);
 	uint8_t ReverseBits(uint8_t nBits);
 	void SetupHC595(uint8_t nT0H, uint8_t nT1H);
 	void SetupSPI(uint32_t nSpeedHz);
@@ -185,43 +110,23 @@ private:
 	void SetupBuffers();
 
 	void SetColour(uint32_t nPortIndex, uint32_t nPixelIndex, uint8_t nColour1, uint8_t nColour2, uint8_t nColour3) {
-	    uint32_t localBuffer[24] __attribute__((aligned(32)));
-	    const uint32_t k = nPixelIndex * pixel::single::RGB;
-
-	    for (uint32_t i = 0; i < 24; i++) {
-	        localBuffer[i] = m_pPixelDataBuffer[k + i];
-	    }
-
-	    uint32_t j = 0;
-
-		for (uint8_t mask = 0x80; mask != 0; mask = static_cast<uint8_t>(mask >> 1)) {
-			if (mask & nColour1) {
-				BIT_SET(localBuffer[j], nPortIndex);
-			} else {
-				BIT_CLEAR(localBuffer[j], nPortIndex);
-			}
-			if (mask & nColour2) {
-				BIT_SET(localBuffer[8 + j], nPortIndex);
-			} else {
-				BIT_CLEAR(localBuffer[8 + j], nPortIndex);
-			}
-			if (mask & nColour3) {
-				BIT_SET(localBuffer[16 + j], nPortIndex);
-			} else {
-				BIT_CLEAR(localBuffer[16 + j], nPortIndex);
-			}
-
-			j++;
-		}
-
-	    // Write back to m_pBuffer1
-	    for (uint32_t i = 0; i < 24; i++) {
-	    	m_pPixelDataBuffer[k + i] = localBuffer[i];
-	    }
+		assert(nPortIndex < 8);
+		assert(nPixelIndex < (LANE_SIZE / 3));
+
+		auto *p = &s_Lanes[nPortIndex][nPixelIndex * 3];
+		p[0] = nColour1;
+		p[1] = nColour2;
+		p[2] = nColour3;
 	}
 
 private:
+	/*
+	 * The largest port: APA102 start frame, pixels and end frame
+	 */
+	static constexpr uint32_t LANE_SIZE = 4 * (pixel::max::ledcount::RGB + 2);
+
 	uint32_t m_nBufSize { 0 };
+	uint32_t m_nLaneBytes { 0 };
 
 	uint8_t *const m_pPixelDataBuffer { reinterpret_cast<uint8_t *>(H3_SRAM_A1_BASE + 512) };
 	uint8_t *m_pDmaBuffer { nullptr };
@@ -230,6 +135,10 @@ private:
 
 	bool m_hasCPLD { false };
 
+	/*
+	 * The ports in wire order, converted to the bit-plane buffer by Update()
+	 */
+	static inline uint8_t s_Lanes[8][LANE_SIZE];
 	static inline WS28xxMulti *s_pThis;
 };
 
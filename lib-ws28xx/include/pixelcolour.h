@@ -0,0 +1,192 @@
+/**
+ * @file pixelcolour.h
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef PIXELCOLOUR_H_
+#define PIXELCOLOUR_H_
+
+#include <cstdint>
+
+#include "pixeltype.h"
+
+/**
+ * Colour pipeline: gamma, white balance matrix and temporal dithering.
+ *
+ * Everything is precomputed by Build() into per channel tables with 8.8 fixed
+ * point values. The matrix is applied in linear light, after the gamma. With
+ * dithering enabled, the fraction is added with an ordered threshold that
+ * changes with the pixel index and with every output frame. Averaged over
+ * 8 frames, the output has 11 bits of resolution.
+ *
+ * The tables are in wire order, the map of the pixel type is taken into
+ * account at Build() time.
+ */
+
+#if !defined (CONFIG_PIXEL_COLOUR_PORTS)
+# if defined (CONFIG_PIXELDMX_MAX_PORTS)
+#  define CONFIG_PIXEL_COLOUR_PORTS	CONFIG_PIXELDMX_MAX_PORTS
+# else
+#  define CONFIG_PIXEL_COLOUR_PORTS	1
+# endif
+#endif
+
+namespace pixel::colour {
+static constexpr uint32_t PORTS = CONFIG_PIXEL_COLOUR_PORTS;	///< Ports with their own pipeline, default one per pixel port. The last one is shared by the remaining ports
+static constexpr uint32_t LUT_SIZE = 256;
+static constexpr uint32_t VALUE_MAX = 0xFF00;				///< 255.0 in 8.8 fixed point
+static constexpr uint32_t ROUND = 0x80;
+
+namespace gamma {
+static constexpr uint32_t MIN = 10;		///< 1.0
+static constexpr uint32_t MAX = 30;		///< 3.0
+static constexpr uint32_t LINEAR = 10;
+}  // namespace gamma
+
+/*
+ * Bit reversed, any 2^n consecutive frames are evenly spread
+ */
+static constexpr uint8_t DITHER[8] = { 0, 128, 64, 192, 32, 160, 96, 224 };
+
+static_assert(PORTS >= 1);
+static_assert((VALUE_MAX + DITHER[7]) >> 8 == 0xFF);
+
+/**
+ * @brief The gamma and the offset (8.8 fixed point) used when not set.
+ */
+uint32_t get_gamma_default(const pixel::Type type, uint32_t& nOffset);
+
+/**
+ * @brief x^(nGamma / 10) for x in [0, 1], without libm.
+ */
+float gamma_pow(const float x, const uint32_t nGamma);
+}  // namespace pixel::colour
+
+class PixelColour {
+public:
+	PixelColour();
+
+	/**
+	 * @brief Sets the gamma.
+	 * @param nGamma Gamma times 10, 0 is the default for the pixel type.
+	 */
+	void SetGamma(const uint32_t nGamma) {
+		m_nGamma = nGamma;
+	}
+
+	uint32_t GetGamma() const {
+		return m_nGamma;
+	}
+
+	/**
+	 * @brief Sets a diagonal matrix.
+	 */
+	void SetWhiteBalance(const float fRed, const float fGreen, const float fBlue);
+
+	/**
+	 * @brief Sets the colour matrix, rows are the output channels in RGB order.
+	 * Negative coefficients are not supported and are clamped to 0.
+	 */
+	void SetMatrix(const float matrix[3][3]);
+
+	void SetDither(const bool doDither) {
+		m_bDither = doDither;
+	}
+
+	bool IsDither() const {
+		return m_bDither;
+	}
+
+	/**
+	 * @brief Computes the tables. Call it after changing any of the settings.
+	 * @param type The pixel type for the default gamma.
+	 * @param map The colour order on the wire.
+	 * @param doGammaCorrection When false the gamma is linear.
+	 */
+	void Build(const pixel::Type type, const pixel::Map map, const bool doGammaCorrection);
+
+	/**
+	 * @brief Applies the pipeline to the colours in wire order.
+	 */
+	void Apply(const uint32_t nPixelIndex, uint8_t& nColour1, uint8_t& nColour2, uint8_t& nColour3) const {
+		const uint32_t nThreshold = m_bDither ? pixel::colour::DITHER[(s_nFrame + nPixelIndex) & 7] : pixel::colour::ROUND;
+
+		if (m_bDiagonal) {
+			nColour1 = static_cast<uint8_t>((m_Lut[0][0][nColour1] + nThreshold) >> 8);
+			nColour2 = static_cast<uint8_t>((m_Lut[1][1][nColour2] + nThreshold) >> 8);
+			nColour3 = static_cast<uint8_t>((m_Lut[2][2][nColour3] + nThreshold) >> 8);
+			return;
+		}
+
+		uint32_t nValue[3];
+
+		for (uint32_t i = 0; i < 3; i++) {
+			nValue[i] = static_cast<uint32_t>(m_Lut[i][0][nColour1]) + m_Lut[i][1][nColour2] + m_Lut[i][2][nColour3];
+
+			if (nValue[i] > pixel::colour::VALUE_MAX) {
+				nValue[i] = pixel::colour::VALUE_MAX;
+			}
+		}
+
+		nColour1 = static_cast<uint8_t>((nValue[0] + nThreshold) >> 8);
+		nColour2 = static_cast<uint8_t>((nValue[1] + nThreshold) >> 8);
+		nColour3 = static_cast<uint8_t>((nValue[2] + nThreshold) >> 8);
+	}
+
+	/**
+	 * @brief White channel, gamma only.
+	 */
+	uint8_t ApplyWhite(const uint32_t nPixelIndex, const uint8_t nWhite) const {
+		const uint32_t nThreshold = m_bDither ? pixel::colour::DITHER[(s_nFrame + nPixelIndex) & 7] : pixel::colour::ROUND;
+		return static_cast<uint8_t>((m_LutWhite[nWhite] + nThreshold) >> 8);
+	}
+
+	/**
+	 * @brief 8.8 fixed point table value, for the input channel in wire order.
+	 */
+	uint16_t GetValue(const uint32_t nOutput, const uint32_t nInput, const uint8_t nColour) const {
+		return m_Lut[nOutput][nInput][nColour];
+	}
+
+	void Print() const;
+
+	/**
+	 * @brief Next dither threshold. Call it once per output frame.
+	 */
+	static void NextFrame() {
+		s_nFrame++;
+	}
+
+private:
+	float m_Matrix[3][3];
+	uint32_t m_nGamma { 0 };
+	uint32_t m_nGammaActual { pixel::colour::gamma::LINEAR };
+	bool m_bDither { false };
+	bool m_bDiagonal { true };
+	uint16_t m_Lut[3][3][pixel::colour::LUT_SIZE];	///< [output][input][value], wire order
+	uint16_t m_LutWhite[pixel::colour::LUT_SIZE];
+
+	static inline uint32_t s_nFrame;
+};
+
+#endif /* PIXELCOLOUR_H_ */
@@ -2,7 +2,7 @@
  * @file pixelconfiguration.h
  *
  */
-/* Copyright (C) 2021-2024 by Arjan van Vught mailto:info@gd32-dmx.org
+/* Copyright (C) 2021-2025 by Arjan van Vught mailto:info@gd32-dmx.org
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -39,11 +39,35 @@
 #include "pixeltype.h"
 
 #if defined (CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
-# include "gamma/gamma_tables.h"
+# include "pixelcolour.h"
 #endif
 
 #include "debug.h"
 
+/**
+ * The multi port outputs can have a count and type per port. A port without
+ * its own count or type uses the global one. The ports share the clock and the
+ * T0H/T1H timing, so only the RTZ types can be mixed. The frame on the wire is
+ * as long as the longest port.
+ */
+
+namespace pixel::configuration {
+#if defined (CONFIG_PIXELDMX_MAX_PORTS)
+static constexpr uint32_t PORTS = CONFIG_PIXELDMX_MAX_PORTS;
+#else
+static constexpr uint32_t PORTS = 1;
+#endif
+
+struct Port {
+	uint32_t nCount;		///< 0 is the global count
+	uint32_t nCountActual;
+	uint32_t nLedsPerPixel;
+	pixel::Type type { pixel::Type::UNDEFINED };	///< UNDEFINED is the global type
+	pixel::Type typeActual;
+	pixel::Map map;
+};
+}  // namespace pixel::configuration
+
 class PixelConfiguration {
 public:
     PixelConfiguration() {
@@ -71,6 +95,59 @@ public:
 		return m_nCount;
 	}
 
+	/**
+	 * @param nCount 0 is the global count.
+	 */
+	void SetCount(const uint32_t nPortIndex, const uint32_t nCount) {
+		assert(nPortIndex < pixel::configuration::PORTS);
+		s_Port[nPortIndex].nCount = nCount;
+	}
+
+	/**
+	 * @brief The count of the port, valid after Validate().
+	 */
+	uint32_t GetCount(const uint32_t nPortIndex) const {
+		assert(nPortIndex < pixel::configuration::PORTS);
+		return s_Port[nPortIndex].nCountActual;
+	}
+
+	/**
+	 * @brief The count of the longest port, in pixels of the global type.
+	 */
+	uint32_t GetCountMax() const {
+		return m_nCountMax;
+	}
+
+	/**
+	 * @param type pixel::Type::UNDEFINED is the global type.
+	 */
+	void SetType(const uint32_t nPortIndex, const pixel::Type type) {
+		assert(nPortIndex < pixel::configuration::PORTS);
+		s_Port[nPortIndex].type = type;
+	}
+
+	pixel::Type GetType(const uint32_t nPortIndex) const {
+		assert(nPortIndex < pixel::configuration::PORTS);
+		return s_Port[nPortIndex].typeActual;
+	}
+
+	pixel::Map GetMap(const uint32_t nPortIndex) const {
+		assert(nPortIndex < pixel::configuration::PORTS);
+		return s_Port[nPortIndex].map;
+	}
+
+	uint32_t GetLedsPerPixel(const uint32_t nPortIndex) const {
+		assert(nPortIndex < pixel::configuration::PORTS);
+		return s_Port[nPortIndex].nLedsPerPixel;
+	}
+
+	/**
+	 * @brief The LEDs of the longest port, this is the length of the frame.
+	 */
+	uint32_t GetLedsMax() const {
+		return m_nLedsMax;
+	}
+
 	void SetMap(const pixel::Map tMap) {
 		m_map = tMap;
 	}
@@ -133,11 +210,28 @@ public:
 	}
 
 	void SetGammaTable(const uint32_t nValue) {
-		m_nGammaValue = static_cast<uint8_t>(nValue);
+		for (auto& colour : s_Colour) {
+			colour.SetGamma(nValue);
+		}
+	}
+
+	void SetWhiteBalance(const float fRed, const float fGreen, const float fBlue) {
+		for (auto& colour : s_Colour) {
+			colour.SetWhiteBalance(fRed, fGreen, fBlue);
+		}
+	}
+
+	void SetDither(const bool doDither) {
+		for (auto& colour : s_Colour) {
+			colour.SetDither(doDither);
+		}
 	}
 
-	const uint8_t *GetGammaTable() const {
-		return m_pGammaTable;
+	/**
+	 * @brief The colour pipeline of the port. Build() is done by Validate().
+	 */
+	static PixelColour& GetColour(const uint32_t nPortIndex) {
+		return s_Colour[nPortIndex < pixel::colour::PORTS ? nPortIndex : pixel::colour::PORTS - 1];
 	}
 #endif
 
@@ -186,15 +280,6 @@ public:
 					m_nClockSpeedHz = pixel::spi::speed::ws2801::max_hz;
 				}
 			}
-
-			const auto nLedTime = (8U * 1000000U) / m_nClockSpeedHz;
-			const auto nLedsTime = nLedTime * m_nCount * m_nLedsPerPixel;
-			if (nLedsTime > 0) {
-			    m_nRefreshRate = 1000000U / nLedsTime;
-			} else {
-			    m_nRefreshRate = 0;
-			    assert(0);
-			}
 		} else {
 			m_bIsRTZProtocol = true;
 
@@ -224,23 +309,30 @@ public:
 			}
 
 			m_nClockSpeedHz = 6400000;	// 6.4MHz / 8 bits = 800Hz
+		}
+
+		ValidatePorts();
 
+		if (!m_bIsRTZProtocol) {
+			const auto nLedTime = (8U * 1000000U) / m_nClockSpeedHz;
+			const auto nLedsTime = nLedTime * m_nLedsMax;
+			if (nLedsTime > 0) {
+			    m_nRefreshRate = 1000000U / nLedsTime;
+			} else {
+			    m_nRefreshRate = 0;
+			    assert(0);
+			}
+		} else {
 			//                  8 * 1000.000
 			// led time (us) =  ------------ * 8 = 10 us
 			//                   6.400.000
-			const auto nLedsTime = 10U * m_nCount * m_nLedsPerPixel;
+			const auto nLedsTime = 10U * m_nLedsMax;
 			m_nRefreshRate = 1000000U / nLedsTime;
 		}
 
 #if defined (CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
-		if (m_bEnableGammaCorrection) {
-			if (m_nGammaValue == 0) {
-				m_pGammaTable = gamma::get_table_default(m_type);
-			} else {
-				m_pGammaTable = gamma::get_table(m_nGammaValue);
-			}
-		} else {
-			m_pGammaTable = gamma10_0;
+		for (auto& colour : s_Colour) {
+			colour.Build(m_type, m_map, m_bEnableGammaCorrection);
 		}
 #endif
 
@@ -252,6 +344,13 @@ public:
 		printf(" Type    : %s [%d] <%d leds/pixel>\n", pixel::pixel_get_type(m_type), static_cast<int>(m_type), static_cast<int>(m_nLedsPerPixel));
 		printf(" Count   : %d\n", m_nCount);
 
+		for (uint32_t nPortIndex = 0; nPortIndex < pixel::configuration::PORTS; nPortIndex++) {
+			const auto& port = s_Port[nPortIndex];
+			if ((port.nCountActual != m_nCount) || (port.typeActual != m_type)) {
+				printf("  Port %u : %s %u\n", static_cast<unsigned int>(1 + nPortIndex), pixel::pixel_get_type(port.typeActual), static_cast<unsigned int>(port.nCountActual));
+			}
+		}
+
 		if (m_bIsRTZProtocol) {
 			printf(" Mapping : %s [%d]\n", pixel::pixel_get_map(m_map), static_cast<int>(m_map));
 			printf(" T0H     : %.2f [0x%X]\n", pixel::pixel_convert_TxH(m_nLowCode), m_nLowCode);
@@ -267,6 +366,11 @@ public:
 
 #if defined (CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
 		printf(" Gamma correction %s\n", m_bEnableGammaCorrection ? "Yes" :  "No");
+
+		for (uint32_t nPortIndex = 0; nPortIndex < pixel::colour::PORTS; nPortIndex++) {
+			printf(" Colour %u\n", static_cast<unsigned int>(nPortIndex));
+			s_Colour[nPortIndex].Print();
+		}
 #endif
 	}
 
@@ -275,8 +379,53 @@ public:
 		return *s_pThis;
 	}
 
+private:
+	void ValidatePorts() {
+		m_nCountMax = 0;
+		m_nLedsMax = 0;
+
+		for (auto& port : s_Port) {
+			port.typeActual = m_type;
+
+			if ((port.type != pixel::Type::UNDEFINED) && m_bIsRTZProtocol && IsRTZType(port.type)) {
+				port.typeActual = port.type;
+			}
+
+			port.nLedsPerPixel = (port.typeActual == pixel::Type::SK6812W) ? 4 : 3;
+
+			if (port.typeActual == m_type) {
+				port.map = m_map;
+			} else {
+				port.map = pixel::pixel_get_map(port.typeActual);
+			}
+
+			const auto nCountMax = (port.nLedsPerPixel == 4) ? pixel::max::ledcount::RGBW : pixel::max::ledcount::RGB;
+			const auto nCount = (port.nCount == 0) ? m_nCount : port.nCount;
+
+			port.nCountActual = nCount <= nCountMax ? nCount : nCountMax;
+
+			const auto nLeds = port.nCountActual * port.nLedsPerPixel;
+
+			if (nLeds > m_nLedsMax) {
+				m_nLedsMax = nLeds;
+			}
+		}
+
+		m_nCountMax = m_nLedsMax / m_nLedsPerPixel;
+
+		if ((m_nLedsMax % m_nLedsPerPixel) != 0) {
+			m_nCountMax++;
+		}
+	}
+
+	static bool IsRTZType(const pixel::Type type) {
+		return !((type == pixel::Type::WS2801) || (type == pixel::Type::APA102) || (type == pixel::Type::SK9822) || (type == pixel::Type::P9813) || (type == pixel::Type::UNDEFINED));
+	}
+
 private:
 	uint32_t m_nCount { pixel::defaults::COUNT };
+	uint32_t m_nCountMax { pixel::defaults::COUNT };
+	uint32_t m_nLedsMax { 3 * pixel::defaults::COUNT };
 	uint32_t m_nClockSpeedHz { 0 };
 	uint32_t m_nLedsPerPixel { 3 };
 	pixel::Type m_type { pixel::defaults::TYPE };
@@ -287,11 +436,13 @@ private:
 	uint8_t m_nGlobalBrightness { 0xFF };
 	uint32_t m_nRefreshRate { 0 };
 #if defined (CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
-	uint8_t m_nGammaValue { 0 };
 	bool m_bEnableGammaCorrection { false };
-	const uint8_t *m_pGammaTable { gamma10_0 };
+
+	static inline PixelColour s_Colour[pixel::colour::PORTS];
 #endif
 
+	static inline pixel::configuration::Port s_Port[pixel::configuration::PORTS];
+
 	static inline PixelConfiguration *s_pThis { nullptr };
 };
 
@@ -0,0 +1,67 @@
+/**
+ * @file pixeltranspose.h
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef PIXELTRANSPOSE_H_
+#define PIXELTRANSPOSE_H_
+
+#include <cstdint>
+
+/**
+ * Bit-plane conversion for the parallel outputs, where one output word
+ * drives one bit time on all the lanes at once.
+ *
+ * The data of each lane is written as plain bytes, in wire order. The
+ * conversion is done once per frame, 8 lanes at a time with an 8x8 bit
+ * matrix transpose. This replaces the read-modify-write of a bit in 24
+ * or 32 words for every pixel.
+ *
+ * Bit l of pOut[8 * i + k] is bit (7 - k) of byte i of lane l, so the most
+ * significant bit is sent first. The lanes are nLaneSize bytes apart.
+ */
+
+namespace pixel::transpose {
+/**
+ * @brief Transpose of an 8x8 bit matrix, byte r is row r, bit c is column c.
+ * Bit c of byte r is moved to bit r of byte c.
+ */
+inline uint64_t transpose8x8(uint64_t x) {
+	uint64_t t;
+
+	t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAULL;
+	x = x ^ t ^ (t << 7);
+	t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCULL;
+	x = x ^ t ^ (t << 14);
+	t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ULL;
+	x = x ^ t ^ (t << 28);
+
+	return x;
+}
+
+void to_bitplane(uint8_t *pOut, const uint8_t *pLanes, const uint32_t nLaneSize, const uint32_t nBytes);	///< 8 lanes
+void to_bitplane(uint16_t *pOut, const uint8_t *pLanes, const uint32_t nLaneSize, const uint32_t nBytes);	///< 16 lanes
+void to_bitplane(uint32_t *pOut, const uint8_t *pLanes, const uint32_t nLaneSize, const uint32_t nBytes);	///< 32 lanes
+}  // namespace pixel::transpose
+
+#endif /* PIXELTRANSPOSE_H_ */
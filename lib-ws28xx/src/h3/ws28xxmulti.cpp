@@ -2,7 +2,7 @@
  * @file ws28xxmulti.cpp
  *
  */
-/* Copyright (C) 2019-2024 by Arjan van Vught mailto:info@gd32-dmx.org
+/* Copyright (C) 2019-2025 by Arjan van Vught mailto:info@gd32-dmx.org
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -38,9 +38,11 @@
 #include <cstdint>
 #include <cstring>
 #include <cstdio>
+#include <algorithm>
 #include <cassert>
 
 #include "ws28xxmulti.h"
+#include "pixeltranspose.h"
 #include "pixelconfiguration.h"
 #include "pixeltype.h"
 
@@ -72,6 +74,11 @@ uint8_t WS28xxMulti::ReverseBits(uint8_t nBits) {
 }
 
 void WS28xxMulti::Update() {
+	/*
+	 * While the previous frame is still being sent
+	 */
+	pixel::transpose::to_bitplane(m_pPixelDataBuffer, &s_Lanes[0][0], LANE_SIZE, m_nLaneBytes);
+
 	do { // https://github.com/vanvught/rpidmx512/issues/281
 		__ISB();
 	} while (FUNC_PREFIX(spi_dma_tx_is_active()));
@@ -87,6 +94,9 @@ void WS28xxMulti::Update() {
 	FUNC_PREFIX(spi_dma_tx_start(m_pDmaBuffer, m_nBufSize));
 
 	sv_nUpdates = sv_nUpdates + 1;
+#if defined(CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
+	PixelColour::NextFrame();
+#endif
 }
 
 void WS28xxMulti::Blackout() {
@@ -95,14 +105,17 @@ void WS28xxMulti::Blackout() {
 	auto& pixelConfiguration = PixelConfiguration::Get();
 
 	const auto type = pixelConfiguration.GetType();
-	const auto nCount = pixelConfiguration.GetCount();
 
 	if ((type == pixel::Type::APA102) || (type == pixel::Type::SK9822) || (type == pixel::Type::P9813)) {
+		memset(s_Lanes, 0, sizeof(s_Lanes));
+
 		for (uint32_t nPortIndex = 0; nPortIndex < 8; nPortIndex++) {
+			const auto nCount = GetCount(nPortIndex);
+
 			SetPixel4Bytes(nPortIndex, 0, 0, 0, 0, 0);
 
 			for (uint32_t nPixelIndex = 1; nPixelIndex <= nCount; nPixelIndex++) {
-				SetPixel4Bytes(nPortIndex, nPixelIndex, 0, 0xE0, 0, 0);
+				SetPixel4Bytes(nPortIndex, nPixelIndex, 0xE0, 0, 0, 0);
 			}
 
 			if ((type == pixel::Type::APA102) || (type == pixel::Type::SK9822)) {
@@ -112,7 +125,7 @@ void WS28xxMulti::Blackout() {
 			}
 		}
 	} else {
-		memset(m_pPixelDataBuffer, 0, m_nBufSize);
+		memset(s_Lanes, 0, sizeof(s_Lanes));
 	}
 
 	// Can be called any time.
@@ -136,14 +149,17 @@ void WS28xxMulti::FullOn() {
 	auto& pixelConfiguration = PixelConfiguration::Get();
 
 	const auto type = pixelConfiguration.GetType();
-	const auto nCount = pixelConfiguration.GetCount();
 
 	if ((type == pixel::Type::APA102) || (type == pixel::Type::SK9822) || (type == pixel::Type::P9813)) {
+		memset(s_Lanes, 0, sizeof(s_Lanes));
+
 		for (uint32_t nPortIndex = 0; nPortIndex < 8; nPortIndex++) {
+			const auto nCount = GetCount(nPortIndex);
+
 			SetPixel4Bytes(nPortIndex, 0, 0, 0, 0, 0);
 
 			for (uint32_t nPixelIndex = 1; nPixelIndex <= nCount; nPixelIndex++) {
-				SetPixel4Bytes(nPortIndex, nPixelIndex, 0xFF, 0xE0, 0xFF, 0xFF);
+				SetPixel4Bytes(nPortIndex, nPixelIndex, 0xFF, 0xFF, 0xFF, 0xFF);
 			}
 
 			if ((type == pixel::Type::APA102) || (type == pixel::Type::SK9822)) {
@@ -153,7 +169,7 @@ void WS28xxMulti::FullOn() {
 			}
 		}
 	} else {
-		memset(m_pPixelDataBuffer, 0xFF, m_nBufSize);
+		memset(s_Lanes, 0xFF, sizeof(s_Lanes));
 	}
 
 	// Can be called any time.
@@ -171,6 +187,15 @@ void WS28xxMulti::FullOn() {
 	DEBUG_EXIT
 }
 
+uint32_t WS28xxMulti::GetCount(const uint32_t nPortIndex) {
+	if (nPortIndex < pixel::configuration::PORTS) {
+		return PixelConfiguration::Get().GetCount(nPortIndex);
+	}
+
+	const auto& pixelConfiguration = PixelConfiguration::Get();
+	return std::min(pixelConfiguration.GetCount(), pixelConfiguration.GetCountMax());
+}
+
 uint32_t  WS28xxMulti::GetUserData() {
 	return sv_nUpdatesPerSecond;
 }
@@ -189,16 +214,21 @@ WS28xxMulti::WS28xxMulti() {
 
 	pixelConfiguration.Validate();
 
-	const auto nCount = pixelConfiguration.GetCount();
-	m_nBufSize = nCount * pixelConfiguration.GetLedsPerPixel();
+	/*
+	 * The 8 ports are packed in the bits of each byte,
+	 * the buffer is as long as the longest port.
+	 */
+	m_nBufSize = pixelConfiguration.GetLedsMax();
 
 	const auto type = pixelConfiguration.GetType();
 
 	if ((type == pixel::Type::APA102) || (type == pixel::Type::SK9822) || (type == pixel::Type::P9813)) {
-		m_nBufSize += nCount;
+		m_nBufSize += pixelConfiguration.GetCountMax();
 		m_nBufSize += 8;
 	}
 
+	assert(m_nBufSize <= LANE_SIZE);
+	m_nLaneBytes = m_nBufSize;
 	m_nBufSize *= 8;
 
 	DEBUG_PRINTF("m_nBufSize=%d", m_nBufSize);
@@ -222,6 +252,9 @@ WS28xxMulti::WS28xxMulti() {
 
 	m_nBufSize++;
 
+	memset(s_Lanes, 0, sizeof(s_Lanes));
+	memset(m_pPixelDataBuffer, 0, m_nBufSize);
+
 	SetupBuffers();
 
 	sv_nUpdatesPerSecond = 0;
@@ -0,0 +1,246 @@
+/**
+ * @file pixelcolour.cpp
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#if defined (DEBUG_PIXEL)
+# undef NDEBUG
+#endif
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cassert>
+
+#include "pixelcolour.h"
+#include "pixeltype.h"
+
+#include "debug.h"
+
+namespace pixel::colour {
+static constexpr float LN2 = 0.693147181f;
+
+/*
+ * Wire slot -> DMX channel, same order as used by the DMX layer
+ */
+static constexpr uint8_t ORDER[6][3] = {
+		{0, 1, 2}, // RGB
+		{0, 2, 1}, // RBG
+		{1, 0, 2}, // GRB
+		{2, 0, 1}, // GBR
+		{1, 2, 0}, // BRG
+		{2, 1, 0}  // BGR
+};
+
+/*
+ * x = m * 2^e, with m in [1, 2)
+ * ln(m) = 2 * atanh((m - 1) / (m + 1))
+ */
+static float ln(const float x) {
+	assert(x > 0.0f);
+
+	uint32_t nBits;
+	memcpy(&nBits, &x, sizeof(float));
+
+	const auto nExponent = static_cast<int32_t>((nBits >> 23) & 0xFF) - 127;
+	nBits = (nBits & 0x007FFFFF) | 0x3F800000;
+
+	float m;
+	memcpy(&m, &nBits, sizeof(float));
+
+	const auto s = (m - 1.0f) / (m + 1.0f);
+	const auto s2 = s * s;
+	const auto f = 2.0f * s * (1.0f + s2 * (1.0f / 3 + s2 * (1.0f / 5 + s2 * (1.0f / 7 + s2 * (1.0f / 9 + s2 * (1.0f / 11))))));
+
+	return static_cast<float>(nExponent) * LN2 + f;
+}
+
+/*
+ * y = k * ln(2) + r, with |r| < ln(2)
+ * e^y = 2^k * e^r
+ */
+static float exp(const float y) {
+	assert(y <= 0.0f);
+
+	const auto k = static_cast<int32_t>(y / LN2);
+
+	if (k < -126) {
+		return 0.0f;
+	}
+
+	const auto r = y - static_cast<float>(k) * LN2;
+	auto f = 1.0f;
+
+	for (uint32_t i = 10; i > 0; i--) {
+		f = 1.0f + f * r / static_cast<float>(i);
+	}
+
+	const auto nBits = static_cast<uint32_t>(k + 127) << 23;
+	float fScale;
+	memcpy(&fScale, &nBits, sizeof(float));
+
+	return f * fScale;
+}
+
+float gamma_pow(const float x, const uint32_t nGamma) {
+	if (x <= 0.0f) {
+		return 0.0f;
+	}
+
+	if ((x >= 1.0f) || (nGamma == gamma::LINEAR)) {
+		return x < 1.0f ? x : 1.0f;
+	}
+
+	return exp(ln(x) * static_cast<float>(nGamma) / 10.0f);
+}
+
+uint32_t get_gamma_default(const pixel::Type type, uint32_t& nOffset) {
+	nOffset = 0;
+
+	if (type == pixel::Type::WS2801) {
+		return 25;
+	}
+
+	if ((type == pixel::Type::APA102) || (type == pixel::Type::SK9822)) {
+		nOffset = ROUND;
+		return 25;
+	}
+
+	if (type == pixel::Type::P9813) {
+		return gamma::LINEAR;
+	}
+
+	return 22;
+}
+
+static uint16_t to_fixed(const float f) {
+	if (f <= 0.0f) {
+		return 0;
+	}
+
+	if (f >= static_cast<float>(VALUE_MAX)) {
+		return static_cast<uint16_t>(VALUE_MAX);
+	}
+
+	return static_cast<uint16_t>(f + 0.5f);
+}
+}  // namespace pixel::colour
+
+using namespace pixel::colour;
+
+PixelColour::PixelColour() {
+	SetWhiteBalance(1.0f, 1.0f, 1.0f);
+	m_bDiagonal = true;
+
+	for (uint32_t i = 0; i < LUT_SIZE; i++) {
+		m_LutWhite[i] = static_cast<uint16_t>(i << 8);
+	}
+
+	memset(m_Lut, 0, sizeof(m_Lut));
+
+	for (uint32_t nChannel = 0; nChannel < 3; nChannel++) {
+		memcpy(m_Lut[nChannel][nChannel], m_LutWhite, sizeof(m_LutWhite));
+	}
+}
+
+void PixelColour::SetWhiteBalance(const float fRed, const float fGreen, const float fBlue) {
+	const float matrix[3][3] = {
+			{ fRed, 0.0f, 0.0f },
+			{ 0.0f, fGreen, 0.0f },
+			{ 0.0f, 0.0f, fBlue }
+	};
+
+	SetMatrix(matrix);
+}
+
+void PixelColour::SetMatrix(const float matrix[3][3]) {
+	for (uint32_t nOutput = 0; nOutput < 3; nOutput++) {
+		for (uint32_t nInput = 0; nInput < 3; nInput++) {
+			const auto f = matrix[nOutput][nInput];
+			m_Matrix[nOutput][nInput] = f > 0.0f ? f : 0.0f;
+		}
+	}
+}
+
+void PixelColour::Build(const pixel::Type type, const pixel::Map map, const bool doGammaCorrection) {
+	DEBUG_ENTRY
+
+	uint32_t nOffset = 0;
+
+	if (!doGammaCorrection) {
+		m_nGammaActual = gamma::LINEAR;
+	} else if ((m_nGamma < gamma::MIN) || (m_nGamma > gamma::MAX)) {
+		m_nGammaActual = get_gamma_default(type, nOffset);
+	} else {
+		m_nGammaActual = m_nGamma;
+	}
+
+	/*
+	 * The RGBW pixels are not mapped
+	 */
+	const auto nMap = ((type == pixel::Type::SK6812W) || (map >= pixel::Map::UNDEFINED)) ? 0 : static_cast<uint32_t>(map);
+	const auto& order = ORDER[nMap];
+
+	m_bDiagonal = true;
+
+	for (uint32_t nOutput = 0; nOutput < 3; nOutput++) {
+		for (uint32_t nInput = 0; nInput < 3; nInput++) {
+			if ((nOutput != nInput) && (m_Matrix[nOutput][nInput] != 0.0f)) {
+				m_bDiagonal = false;
+			}
+		}
+	}
+
+	for (uint32_t nValue = 0; nValue < LUT_SIZE; nValue++) {
+		auto fLinear = 0.0f;
+
+		if (nValue != 0) {
+			fLinear = static_cast<float>(nOffset) + static_cast<float>(VALUE_MAX - nOffset) * gamma_pow(static_cast<float>(nValue) / 255.0f, m_nGammaActual);
+		}
+
+		m_LutWhite[nValue] = to_fixed(fLinear);
+
+		for (uint32_t nOutput = 0; nOutput < 3; nOutput++) {
+			for (uint32_t nInput = 0; nInput < 3; nInput++) {
+				m_Lut[nOutput][nInput][nValue] = to_fixed(fLinear * m_Matrix[order[nOutput]][order[nInput]]);
+			}
+		}
+	}
+
+	DEBUG_PRINTF("nGamma=%u, nOffset=%u, m_bDiagonal=%d", static_cast<unsigned int>(m_nGammaActual), static_cast<unsigned int>(nOffset), m_bDiagonal);
+	DEBUG_EXIT
+}
+
+void PixelColour::Print() const {
+	printf("  Gamma   : %u.%u\n", static_cast<unsigned int>(m_nGammaActual / 10), static_cast<unsigned int>(m_nGammaActual % 10));
+
+	if (m_bDiagonal) {
+		printf("  Balance : %.2f %.2f %.2f\n", m_Matrix[0][0], m_Matrix[1][1], m_Matrix[2][2]);
+	} else {
+		for (uint32_t nOutput = 0; nOutput < 3; nOutput++) {
+			printf("  Matrix  : %.2f %.2f %.2f\n", m_Matrix[nOutput][0], m_Matrix[nOutput][1], m_Matrix[nOutput][2]);
+		}
+	}
+
+	printf("  Dither  : %s\n", m_bDither ? "Yes" : "No");
+}
@@ -0,0 +1,108 @@
+/**
+ * @file pixeltranspose.cpp
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#if defined (DEBUG_PIXEL)
+# undef NDEBUG
+#endif
+
+#if defined(__GNUC__) && !defined(__clang__)
+# pragma GCC push_options
+# pragma GCC optimize ("O3")
+# pragma GCC optimize ("no-tree-loop-distribute-patterns")
+#endif
+
+#include <cstdint>
+#include <cstring>
+#include <cassert>
+
+#include "pixeltranspose.h"
+
+namespace pixel::transpose {
+/*
+ * Row l of the matrix is byte i of lane l. After the transpose, row c holds
+ * bit c of all the lanes, which is the output word for bit time 7 - c.
+ */
+static uint64_t gather(const uint8_t *pLane, const uint32_t nLaneSize) {
+	uint64_t x = 0;
+
+	for (uint32_t l = 0; l < 8; l++) {
+		x |= static_cast<uint64_t>(pLane[l * nLaneSize]) << (8 * l);
+	}
+
+	return transpose8x8(x);
+}
+
+template<typename T>
+static void to_bitplane_words(T *pOut, const uint8_t *pLanes, const uint32_t nLaneSize, const uint32_t nBytes) {
+	constexpr auto GROUPS = sizeof(T);
+
+	assert(pOut != nullptr);
+	assert(pLanes != nullptr);
+	assert(nBytes <= nLaneSize);
+
+	for (uint32_t i = 0; i < nBytes; i++) {
+		uint64_t x[GROUPS];
+
+		for (uint32_t g = 0; g < GROUPS; g++) {
+			x[g] = gather(&pLanes[8 * g * nLaneSize + i], nLaneSize);
+		}
+
+		for (uint32_t k = 0; k < 8; k++) {
+			T nWord = 0;
+
+			for (uint32_t g = 0; g < GROUPS; g++) {
+				nWord = static_cast<T>(nWord | (static_cast<T>((x[g] >> (8 * (7 - k))) & 0xFF) << (8 * g)));
+			}
+
+			pOut[k] = nWord;
+		}
+
+		pOut += 8;
+	}
+}
+
+void to_bitplane(uint8_t *pOut, const uint8_t *pLanes, const uint32_t nLaneSize, const uint32_t nBytes) {
+	assert(pOut != nullptr);
+	assert(pLanes != nullptr);
+	assert(nBytes <= nLaneSize);
+
+	for (uint32_t i = 0; i < nBytes; i++) {
+		/*
+		 * Row 7 is the first bit time, byte reversed (little endian) the rows are in wire order.
+		 */
+		const auto x = __builtin_bswap64(gather(&pLanes[i], nLaneSize));
+		memcpy(pOut, &x, sizeof(uint64_t));
+		pOut += 8;
+	}
+}
+
+void to_bitplane(uint16_t *pOut, const uint8_t *pLanes, const uint32_t nLaneSize, const uint32_t nBytes) {
+	to_bitplane_words<uint16_t>(pOut, pLanes, nLaneSize, nBytes);
+}
+
+void to_bitplane(uint32_t *pOut, const uint8_t *pLanes, const uint32_t nLaneSize, const uint32_t nBytes) {
+	to_bitplane_words<uint32_t>(pOut, pLanes, nLaneSize, nBytes);
+}
+}  // namespace pixel::transpose
@@ -2,7 +2,7 @@
  * @file ws28xx.cpp
  *
  */
-/* Copyright (C) 2017-2023 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2017-2025 by Arjan van Vught mailto:info@gd32-dmx.org
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -41,7 +41,9 @@
 #include "ws28xx.h"
 #include "pixeltype.h"
 
-#include "gamma/gamma_tables.h"
+#if defined(CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
+# include "pixelcolour.h"
+#endif
 
 void WS28xx::SetColorWS28xx(uint32_t nOffset, uint8_t nValue) {
 	auto& pixelConfiguration = PixelConfiguration::Get();
@@ -69,11 +71,7 @@ void WS28xx::SetPixel(uint32_t nPixelIndex, uint8_t nRed, uint8_t nGreen, uint8_
 	assert(nPixelIndex < pixelConfiguration.GetCount());
 
 #if defined(CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
-	const auto pGammaTable = pixelConfiguration.GetGammaTable();
-
-	nRed = pGammaTable[nRed];
-	nGreen = pGammaTable[nGreen];
-	nBlue = pGammaTable[nBlue];
+	PixelConfiguration::GetColour(0).Apply(nPixelIndex, nRed, nGreen, nBlue);
 #endif
 
 	if (pixelConfiguration.IsRTZProtocol()) {
@@ -135,12 +133,10 @@ void WS28xx::SetPixel(uint32_t nPixelIndex, uint8_t nRed, uint8_t nGreen, uint8_
 	assert(PixelConfiguration::Get().GetType() == pixel::Type::SK6812W);
 
 #if defined(CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
-	const auto pGammaTable = pixelConfiguration.GetGammaTable();
+	const auto& colour = PixelConfiguration::GetColour(0);
 
-	nRed = pGammaTable[nRed];
-	nGreen = pGammaTable[nGreen];
-	nBlue = pGammaTable[nBlue];
-	nWhite = pGammaTable[nWhite];
+	colour.Apply(nPixelIndex, nRed, nGreen, nBlue);
+	nWhite = colour.ApplyWhite(nPixelIndex, nWhite);
 #endif
 
 	const auto nOffset = nPixelIndex * 32U;
@@ -0,0 +1,221 @@
+/**
+ * @file test_pixelcolour.cpp
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * The gamma tables are checked against std::pow. The histogram compares the
+ * distinct output levels without dithering with the levels averaged over
+ * 8 dithered frames, for the dark end and for the full input range.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cmath>
+#include <set>
+
+#include "pixelcolour.h"
+#include "pixeltype.h"
+
+#include "test.h"
+
+namespace {
+static constexpr uint32_t FRAMES = 8;
+
+static_assert(pixel::colour::PORTS == CONFIG_PIXELDMX_MAX_PORTS, "One pipeline per pixel port");
+
+double reference(const uint32_t nValue, const uint32_t nGamma) {
+	return 255.0 * std::pow(static_cast<double>(nValue) / 255.0, static_cast<double>(nGamma) / 10.0);
+}
+
+/*
+ * Sum of the output over 8 consecutive frames
+ */
+uint32_t sum_frames(const PixelColour& colour, const uint32_t nPixelIndex, const uint8_t nValue) {
+	uint32_t nSum = 0;
+
+	for (uint32_t nFrame = 0; nFrame < FRAMES; nFrame++) {
+		uint8_t nColour1 = nValue;
+		uint8_t nColour2 = nValue;
+		uint8_t nColour3 = nValue;
+		colour.Apply(nPixelIndex, nColour1, nColour2, nColour3);
+		nSum += nColour1;
+		PixelColour::NextFrame();
+	}
+
+	return nSum;
+}
+
+void test_gamma_pow() {
+	double fMaxError = 0;
+
+	for (uint32_t nGamma = pixel::colour::gamma::MIN; nGamma <= pixel::colour::gamma::MAX; nGamma++) {
+		for (uint32_t i = 0; i < 256; i++) {
+			const auto fValue = static_cast<double>(pixel::colour::gamma_pow(static_cast<float>(i) / 255.0f, nGamma));
+			const auto fError = std::fabs(fValue - reference(i, nGamma) / 255.0) * pixel::colour::VALUE_MAX;
+
+			if (fError > fMaxError) {
+				fMaxError = fError;
+			}
+		}
+	}
+
+	// Less than a half step of the 8.8 fixed point table
+	CHECK(fMaxError < 0.5);
+}
+
+void test_linear() {
+	PixelColour colour;
+	colour.Build(pixel::Type::WS2812B, pixel::Map::GRB, false);
+
+	uint32_t nErrors = 0;
+
+	for (uint32_t nDither = 0; nDither < 2; nDither++) {
+		colour.SetDither(nDither != 0);
+
+		for (uint32_t nFrame = 0; nFrame < FRAMES; nFrame++) {
+			for (uint32_t i = 0; i < 256; i++) {
+				uint8_t nColour1 = static_cast<uint8_t>(i);
+				uint8_t nColour2 = static_cast<uint8_t>(i);
+				uint8_t nColour3 = static_cast<uint8_t>(i);
+				colour.Apply(nFrame, nColour1, nColour2, nColour3);
+
+				if ((nColour1 != i) || (nColour2 != i) || (nColour3 != i)) {
+					nErrors++;
+				}
+			}
+
+			PixelColour::NextFrame();
+		}
+	}
+
+	CHECK(nErrors == 0);
+}
+
+void test_histogram() {
+	PixelColour colour;
+	colour.Build(pixel::Type::WS2812B, pixel::Map::RGB, true);
+
+	uint32_t nErrors = 0;
+	std::set<uint32_t> plain;
+
+	for (uint32_t i = 0; i < 256; i++) {
+		uint8_t nColour1 = static_cast<uint8_t>(i);
+		uint8_t nColour2 = static_cast<uint8_t>(i);
+		uint8_t nColour3 = static_cast<uint8_t>(i);
+		colour.Apply(0, nColour1, nColour2, nColour3);
+
+		if (std::fabs(nColour1 - reference(i, 22)) > 0.5 + 1e-3) {
+			nErrors++;
+		}
+
+		plain.insert(nColour1);
+	}
+
+	CHECK(nErrors == 0);
+
+	colour.SetDither(true);
+
+	std::set<uint32_t> dithered;
+	std::set<uint32_t> plainDark;
+	std::set<uint32_t> ditheredDark;
+	double fMaxError = 0;
+
+	for (uint32_t i = 0; i < 256; i++) {
+		const auto nSum = sum_frames(colour, i, static_cast<uint8_t>(i));
+		const auto fError = std::fabs(static_cast<double>(nSum) / FRAMES - reference(i, 22));
+
+		if (fError > fMaxError) {
+			fMaxError = fError;
+		}
+
+		dithered.insert(nSum);
+
+		if (i < 64) {
+			ditheredDark.insert(nSum);
+			plainDark.insert(static_cast<uint32_t>(reference(i, 22) + 0.5));
+		}
+	}
+
+	// 11 bits: the average is within 1/8 of a step
+	CHECK(fMaxError < 1.0 / FRAMES + 1e-3);
+	CHECK(ditheredDark.size() > 3 * plainDark.size());
+	CHECK(dithered.size() >= 240);
+	CHECK(dithered.size() > plain.size());
+
+	printf("gamma 2.2, inputs 0..63: %zu levels, dithered %zu levels\n", plainDark.size(), ditheredDark.size());
+	printf("gamma 2.2, inputs 0..255: %zu levels, dithered %zu levels, max error %.3f\n", plain.size(), dithered.size(), fMaxError);
+}
+
+void test_defaults() {
+	uint32_t nOffset = 0;
+	CHECK(pixel::colour::get_gamma_default(pixel::Type::APA102, nOffset) == 25);
+	CHECK(nOffset == pixel::colour::ROUND);
+
+	nOffset = 0;
+	CHECK(pixel::colour::get_gamma_default(pixel::Type::WS2812B, nOffset) == 22);
+	CHECK(nOffset == 0);
+
+	CHECK(pixel::colour::get_gamma_default(pixel::Type::P9813, nOffset) == pixel::colour::gamma::LINEAR);
+}
+
+void test_matrix() {
+	PixelColour colour;
+	colour.SetWhiteBalance(0.5f, 1.0f, 1.0f);
+	colour.Build(pixel::Type::WS2812B, pixel::Map::GRB, false);
+
+	// Wire order G, R, B
+	uint8_t nColour1 = 200;
+	uint8_t nColour2 = 200;
+	uint8_t nColour3 = 200;
+	colour.Apply(0, nColour1, nColour2, nColour3);
+
+	CHECK(nColour1 == 200);
+	CHECK(nColour2 == 100);
+	CHECK(nColour3 == 200);
+
+	// R = 0.5 R + 0.5 G
+	const float matrix[3][3] = { { 0.5f, 0.5f, 0.0f }, { 0.0f, 1.0f, 0.0f }, { 0.0f, 0.0f, 1.0f } };
+	colour.SetMatrix(matrix);
+	colour.Build(pixel::Type::WS2812B, pixel::Map::GRB, false);
+
+	nColour1 = 100;
+	nColour2 = 200;
+	nColour3 = 0;
+	colour.Apply(0, nColour1, nColour2, nColour3);
+
+	CHECK(nColour1 == 100);
+	CHECK(nColour2 == 150);
+	CHECK(nColour3 == 0);
+}
+}  // namespace
+
+int main() {
+	test_gamma_pow();
+	test_linear();
+	test_histogram();
+	test_defaults();
+	test_matrix();
+
+	return test::result();
+}
@@ -0,0 +1,134 @@
+/**
+ * @file test_pixeltranspose.cpp
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * The 8x8 transpose and the bit-plane conversion for 8, 16 and 32 lanes are
+ * checked against a bit by bit reference, with random lane data.
+ * The benchmark is a frame of 680 RGB pixels per lane.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include "pixeltranspose.h"
+
+#include "test.h"
+
+namespace {
+static constexpr uint32_t LANE_SIZE = 2728;		///< Not a multiple of 8
+static constexpr uint32_t BYTES = 680 * 3;
+static constexpr uint32_t LANES_MAX = 32;
+static constexpr uint32_t RUNS = 1000;
+
+uint8_t s_Lanes[LANES_MAX * LANE_SIZE];
+
+uint64_t s_nSeed = 7;
+
+uint64_t random() {
+	s_nSeed ^= s_nSeed << 13;	// xorshift64
+	s_nSeed ^= s_nSeed >> 7;
+	s_nSeed ^= s_nSeed << 17;
+	return s_nSeed;
+}
+
+void test_transpose8x8() {
+	uint32_t nErrors = 0;
+
+	for (uint32_t n = 0; n < 10000; n++) {
+		const auto x = random();
+		uint64_t expected = 0;
+
+		for (uint32_t r = 0; r < 8; r++) {
+			for (uint32_t c = 0; c < 8; c++) {
+				if ((x >> (8 * r + c)) & 1) {
+					expected |= static_cast<uint64_t>(1) << (8 * c + r);
+				}
+			}
+		}
+
+		if (pixel::transpose::transpose8x8(x) != expected) {
+			nErrors++;
+		}
+	}
+
+	CHECK(nErrors == 0);
+	CHECK(pixel::transpose::transpose8x8(0) == 0);
+	CHECK(pixel::transpose::transpose8x8(UINT64_MAX) == UINT64_MAX);
+}
+
+template<typename T>
+void test_to_bitplane() {
+	constexpr uint32_t LANES = 8 * sizeof(T);
+
+	static T out[8 * BYTES];
+	static T expected[8 * BYTES];
+
+	memset(expected, 0, sizeof(expected));
+
+	for (uint32_t l = 0; l < LANES; l++) {
+		for (uint32_t i = 0; i < BYTES; i++) {
+			for (uint32_t k = 0; k < 8; k++) {
+				if (s_Lanes[l * LANE_SIZE + i] & (0x80 >> k)) {
+					expected[8 * i + k] = static_cast<T>(expected[8 * i + k] | (static_cast<T>(1) << l));
+				}
+			}
+		}
+	}
+
+	// The words after nBytes are not written
+	memset(out, 0xA5, sizeof(out));
+	pixel::transpose::to_bitplane(out, s_Lanes, LANE_SIZE, BYTES - 1);
+
+	CHECK(memcmp(out, expected, 8 * (BYTES - 1) * sizeof(T)) == 0);
+	CHECK(out[8 * (BYTES - 1)] == static_cast<T>(0xA5A5A5A5));
+
+	const auto nStart = test::nanos();
+
+	for (uint32_t n = 0; n < RUNS; n++) {
+		pixel::transpose::to_bitplane(out, s_Lanes, LANE_SIZE, BYTES);
+		__asm__ volatile("" : : "r"(out) : "memory");
+	}
+
+	const auto nElapsed = test::nanos() - nStart;
+
+	CHECK(memcmp(out, expected, sizeof(expected)) == 0);
+
+	printf("%u lanes: %.1f us per frame of %u bytes per lane\n", static_cast<unsigned int>(LANES), static_cast<double>(nElapsed) / RUNS / 1e3, static_cast<unsigned int>(BYTES));
+}
+}  // namespace
+
+int main() {
+	for (auto& data : s_Lanes) {
+		data = static_cast<uint8_t>(random());
+	}
+
+	test_transpose8x8();
+	test_to_bitplane<uint8_t>();
+	test_to_bitplane<uint16_t>();
+	test_to_bitplane<uint32_t>();
+
+	return test::result();
+}
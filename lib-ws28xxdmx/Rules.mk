@@ -11,6 +11,9 @@ ifneq ($(MAKE_FLAGS),)
 	ifneq (,$(findstring OUTPUT_DMX_PIXEL_MULTI,$(MAKE_FLAGS)))
 		EXTRA_SRCDIR+=src/pixeldmxmulti
 	endif
+	ifneq (,$(findstring CONFIG_PIXELDMX_ENABLE_INTERPOLATION,$(MAKE_FLAGS)))
+		EXTRA_SRCDIR+=src/pixeldmxinterpolator
+	endif
 	ifneq (,$(findstring CONFIG_RDM_ENABLE_MANUFACTURER_PIDS,$(MAKE_FLAGS)))
 		EXTRA_INCLUDES+=../lib-rdm/include
 		EXTRA_SRCDIR+=src/rdm
@@ -21,6 +24,8 @@ else
 	DEFINES+=OUTPUT_DMX_PIXEL OUTPUT_DMX_PIXEL_MULTI
 	DEFINES+=CONFIG_RDM_ENABLE_MANUFACTURER_PIDS CONFIG_RDM_MANUFACTURER_PIDS_SET
 	EXTRA_INCLUDES+=../lib-rdm/include
+	DEFINES+=CONFIG_PIXELDMX_ENABLE_INTERPOLATION
 	EXTRA_SRCDIR+=src/pixeldmx src/pixeldmxmulti
+	EXTRA_SRCDIR+=src/pixeldmxinterpolator
 	EXTRA_SRCDIR+=src/rdm
 endif
\ No newline at end of file
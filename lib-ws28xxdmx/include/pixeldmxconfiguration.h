@@ -2,7 +2,7 @@
  * @file pixeldmxconfiguration.h
  *
  */
-/* Copyright (C) 2021-2024 by Arjan van Vught mailto:info@gd32-dmx.org
+/* Copyright (C) 2021-2025 by Arjan van Vught mailto:info@gd32-dmx.org
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -79,6 +79,17 @@ public:
 		return m_nGroups;
 	}
 
+	uint32_t GetGroups(const uint32_t nPortIndex) const {
+		return PixelConfiguration::GetCount(nPortIndex) / m_nGroupingCount;
+	}
+
+	/**
+	 * @brief The first group of the universe nSwitch of the port.
+	 */
+	uint32_t GetBeginIndex(const uint32_t nPortIndex, const uint32_t nSwitch) const {
+		return nSwitch * GetGroupsPerUniverse(nPortIndex);
+	}
+
 	uint32_t GetUniverses() const {
 		return m_nUniverses;
 	}
@@ -107,9 +118,8 @@ public:
 		if (!PixelConfiguration::IsRTZProtocol()) {
 			if (!((PixelConfiguration::GetType() == pixel::Type::WS2801) || (PixelConfiguration::GetType() == pixel::Type::APA102) || (PixelConfiguration::GetType() == pixel::Type::SK9822))) {
 				PixelConfiguration::SetType(pixel::Type::WS2801);
+				PixelConfiguration::Validate();
 			}
-
-			PixelConfiguration::Validate();
 		}
 
 		m_portInfo.nBeginIndexPort[0] = 0;
@@ -131,6 +141,17 @@ public:
 		m_nGroups = PixelConfiguration::GetCount() / m_nGroupingCount;
 		m_nOutputPorts = std::min(nPortsMax, m_nOutputPorts);
 		m_nUniverses = (1U + (m_nGroups  / (1U + m_portInfo.nBeginIndexPort[1])));
+
+		/*
+		 * Each output has the universes of the longest port
+		 */
+		const auto nPorts = std::min(m_nOutputPorts, pixel::configuration::PORTS);
+
+		for (uint32_t nPortIndex = 0; nPortIndex < nPorts; nPortIndex++) {
+			const auto nGroupsPerUniverse = GetGroupsPerUniverse(nPortIndex);
+			const auto nUniverses = (GetGroups(nPortIndex) + nGroupsPerUniverse - 1U) / nGroupsPerUniverse;
+			m_nUniverses = std::max(m_nUniverses, nUniverses);
+		}
 		m_nDmxFootprint = PixelConfiguration::GetLedsPerPixel() * m_nGroups;
 
 		if (nPortsMax == 1) {
@@ -160,6 +181,12 @@ public:
 #endif
 	}
 
+private:
+	uint32_t GetGroupsPerUniverse(const uint32_t nPortIndex) const {
+		return PixelConfiguration::GetLedsPerPixel(nPortIndex) == 4 ? 128U : 170U;
+	}
+
+public:
 	static PixelDmxConfiguration& Get() {
 		assert(s_pThis != nullptr); // Ensure that s_pThis is valid
 		return *s_pThis;
@@ -0,0 +1,143 @@
+/**
+ * @file pixeldmxinterpolator.h
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef PIXELDMXINTERPOLATOR_H_
+#define PIXELDMXINTERPOLATOR_H_
+
+#include <cstdint>
+
+#include "lightset.h"
+
+/**
+ * Interpolation between DMX frames, enabled with CONFIG_PIXELDMX_ENABLE_INTERPOLATION.
+ *
+ * A new frame is not sent to the pixels directly. The output fades from the
+ * frame on display to the new frame in the time between the previous two
+ * frames received. The intermediate frames are sent at the refresh rate the
+ * pixel string allows, limited to CONFIG_PIXELDMX_INTERPOLATION_HZ. The output
+ * lags one DMX frame.
+ *
+ * The interpolation is done on the DMX values, before the gamma correction,
+ * so the fade is perceptually linear.
+ */
+
+#if !defined (CONFIG_PIXELDMX_INTERPOLATION_HZ)
+# define CONFIG_PIXELDMX_INTERPOLATION_HZ	200
+#endif
+
+namespace pixeldmx::interpolator {
+#if defined (LIGHTSET_PORTS) && (LIGHTSET_PORTS > 0)
+static constexpr uint32_t PORTS = LIGHTSET_PORTS;
+#else
+static constexpr uint32_t PORTS = 1;
+#endif
+static constexpr uint32_t REFRESH_HZ_MAX = CONFIG_PIXELDMX_INTERPOLATION_HZ;
+static constexpr uint32_t ALPHA_ONE = 256;
+static constexpr uint32_t INTERVAL_MIN_US = 1000000 / REFRESH_HZ_MAX;
+static constexpr uint32_t INTERVAL_MAX_US = 100000;	///< Slower than 10 Hz is not interpolated
+
+struct Statistics {
+	uint32_t nFramesIn;
+	uint32_t nFramesOut;		///< Refresh frames sent to the pixels
+	uint32_t nKernelMicros;		///< Total time in the interpolation kernel
+	uint32_t nRenderMicros;		///< Total time for the refresh frames, kernel included
+};
+
+/**
+ * @brief pOut = pFrom + (pTo - pFrom) * nAlpha / 256, rounded.
+ * pOut may be the same as pFrom.
+ * @param nAlpha 0 is pFrom, 256 is pTo.
+ */
+void lerp(uint8_t *pOut, const uint8_t *pFrom, const uint8_t *pTo, const uint32_t nLength, const uint32_t nAlpha);
+}  // namespace pixeldmx::interpolator
+
+class PixelDmxInterpolator {
+public:
+	PixelDmxInterpolator();
+
+	/**
+	 * @brief Sets the refresh period from the refresh rate of the pixel string.
+	 */
+	void SetRefreshRate(const uint32_t nRefreshRate);
+
+	/**
+	 * @brief New DMX frame received.
+	 */
+	void Input(const uint32_t nPortIndex, const uint8_t *pData, const uint32_t nLength);
+
+	/**
+	 * @brief Keep sending refresh frames when there is no fade, for the temporal dithering.
+	 */
+	void SetKeepRefreshing(const bool bKeepRefreshing) {
+		m_bKeepRefreshing = bKeepRefreshing;
+	}
+
+	/**
+	 * @brief The refresh period has elapsed and there is a fade in progress,
+	 * or keep refreshing is set.
+	 */
+	bool IsFrameDue();
+
+	/**
+	 * @brief The interpolated frame for the port, valid until the next call.
+	 */
+	const uint8_t *GetFrame(const uint32_t nPortIndex, uint32_t& nLength);
+
+	/**
+	 * @brief To be called when all the ports of the refresh frame have been set.
+	 */
+	void FrameDone(const uint32_t nRenderMicros);
+
+	const pixeldmx::interpolator::Statistics& GetStatistics() const {
+		return m_Statistics;
+	}
+
+	void Print() const;
+
+private:
+	uint32_t GetAlpha(const uint32_t nPortIndex, const uint32_t nMicros) const;
+
+private:
+	uint32_t m_nRefreshMicros { pixeldmx::interpolator::INTERVAL_MIN_US };
+	uint32_t m_nFrameMicros { 0 };
+	bool m_bKeepRefreshing { false };
+	bool m_bFading { false };
+	bool m_bStillFading { false };		///< A port in the refresh frame has not reached the new frame
+
+	pixeldmx::interpolator::Statistics m_Statistics;
+
+	struct Port {
+		uint32_t nMicros;		///< Time the last frame has been received
+		uint32_t nInterval;		///< Estimated time between the frames
+		uint32_t nLength;
+		uint8_t From[lightset::dmx::UNIVERSE_SIZE];
+		uint8_t To[lightset::dmx::UNIVERSE_SIZE];
+	};
+
+	static inline Port s_Port[pixeldmx::interpolator::PORTS];
+	static inline uint8_t s_Frame[lightset::dmx::UNIVERSE_SIZE];
+};
+
+#endif /* PIXELDMXINTERPOLATOR_H_ */
@@ -2,7 +2,7 @@
  * @file pixeldmxparams.h
  *
  */
-/* Copyright (C) 2017-2024 by Arjan van Vught mailto:info@gd32-dmx.org
+/* Copyright (C) 2017-2025 by Arjan van Vught mailto:info@gd32-dmx.org
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"); to deal
@@ -27,6 +27,7 @@
 #define PIXELDMXPARAMS_H_
 
 #include <cstdint>
+#include <cassert>
 
 #include "pixeldmxconfiguration.h"
 #include "configstore.h"
@@ -37,6 +38,7 @@
 
 namespace pixeldmxparams {
 static constexpr auto MAX_PORTS = CONFIG_PIXELDMX_MAX_PORTS;
+static constexpr uint32_t PIXEL_PORTS = MAX_PORTS <= 8 ? MAX_PORTS : 1;	///< Ports with their own count and type, the store has no room for 16
 
 struct Params {
     uint32_t nSetList;										///< 4	   4
@@ -53,6 +55,9 @@ struct Params {
 	uint8_t nLowCode;										///< 1	  21
 	uint8_t nHighCode;										///< 1	  22
 	uint16_t nStartUniverse[pixeldmxparams::MAX_PORTS];		///< 16   38
+	uint8_t nWhiteBalance[3];								///< 3    41
+	uint16_t nCountPort[pixeldmxparams::PIXEL_PORTS];		///< 16   57	0 is led_count
+	uint8_t nTypePort[(pixeldmxparams::PIXEL_PORTS + 1) / 2];	///< 4    61	Nibble per port, type + 1, 0 is led_type
 }__attribute__((packed));
 
 static_assert(sizeof(struct Params) <= 64, "struct Params is too large");
@@ -71,7 +76,13 @@ struct Mask {
 	static constexpr auto LOW_CODE = (1U << 10);
 	static constexpr auto HIGH_CODE = (1U << 11);
 	static constexpr auto START_UNI_PORT_1 = (1U << 12);
+	static constexpr auto COUNT_PORT = (1U << 28);
+	static constexpr auto TYPE_PORT = (1U << 29);
+	static constexpr auto WHITE_BALANCE = (1U << 30);
+	static constexpr auto DITHER = (1U << 31);
 };
+
+static_assert((12 + MAX_PORTS) <= 28, "START_UNI_PORT overlaps COUNT_PORT");
 }  // pixeldmxparams
 
 class PixelDmxParamsStore {
@@ -110,6 +121,12 @@ public:
 		return 0;
 	}
 
+	pixel::Type GetTypePort(const uint32_t nPortIndex) const {
+		assert(nPortIndex < pixeldmxparams::PIXEL_PORTS);
+		const auto nType = (m_Params.nTypePort[nPortIndex / 2] >> ((nPortIndex & 0x1) * 4)) & 0x0F;
+		return nType == 0 ? pixel::Type::UNDEFINED : static_cast<pixel::Type>(nType - 1);
+	}
+
 	uint8_t GetTestPattern() const {
 		return m_Params.nTestPattern;
 	}
@@ -117,6 +134,12 @@ public:
 	static void StaticCallbackFunction(void *p, const char *s);
 
 private:
+	void SetTypePort(const uint32_t nPortIndex, const pixel::Type type) {
+		const auto nShift = (nPortIndex & 0x1) * 4;
+		const auto nType = (type == pixel::Type::UNDEFINED) ? 0U : (1U + static_cast<uint32_t>(type));
+		auto& nTypePort = m_Params.nTypePort[nPortIndex / 2];
+		nTypePort = static_cast<uint8_t>((nTypePort & ~(0x0F << nShift)) | (nType << nShift));
+	}
 	void Dump();
     void callbackFunction(const char *pLine);
     bool isMaskSet(uint32_t nMask) const {
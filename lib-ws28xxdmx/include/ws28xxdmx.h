@@ -2,7 +2,7 @@
  * @file ws28xxdmx.h
  *
  */
-/* Copyright (C) 2016-2024 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2016-2025 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -51,6 +51,11 @@
 #include "pixeldmxconfiguration.h"
 #include "pixeldmxstore.h"
 
+#if defined (CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+# include "pixeldmxinterpolator.h"
+# include "hardware.h"
+#endif
+
 #if defined (PIXELDMXSTARTSTOP_GPIO)
 # include "hal_gpio.h"
 #endif
@@ -90,119 +95,20 @@ public:
 		assert(pData != nullptr);
 		assert(nLength <= lightset::dmx::UNIVERSE_SIZE);
 
+#if defined (CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+		m_Interpolator.Input(nPortIndex, pData, nLength);
+		return;
+#endif
+
 		if (m_pWS28xx->IsUpdating()) {
 			return;
 		}
 
-		auto &pixelDmxConfiguration = PixelDmxConfiguration::Get();
-		auto &portInfo = pixelDmxConfiguration.GetPortInfo();
-		uint32_t d = 0;
+		SetPixels(nPortIndex, pData, nLength);
 
-#if !defined(LIGHTSET_PORTS)
-		static constexpr uint32_t nSwitch = 0;
-#else
-		const auto nSwitch = nPortIndex & 0x03;
+#if defined(LIGHTSET_PORTS)
+		auto &portInfo = PixelDmxConfiguration::Get().GetPortInfo();
 #endif
-		const auto nGroups = pixelDmxConfiguration.GetGroups();
-#if !defined(LIGHTSET_PORTS)
-		static constexpr uint32_t beginIndex = 0;
-#else
-		const auto beginIndex = portInfo.nBeginIndexPort[nSwitch];
-#endif
-		const auto nChannelsPerPixel = pixelDmxConfiguration.GetLedsPerPixel();
-		const auto endIndex = std::min(nGroups,
-				(beginIndex + (nLength / nChannelsPerPixel)));
-
-		if ((nSwitch == 0) && (nGroups < portInfo.nBeginIndexPort[1])) {
-			d = (pixelDmxConfiguration.GetDmxStartAddress() - 1U);
-		}
-
-		const auto nGroupingCount = pixelDmxConfiguration.GetGroupingCount();
-
-		if (nChannelsPerPixel == 3) {
-			switch (pixelDmxConfiguration.GetMap()) {
-			case pixel::Map::RGB:
-				for (uint32_t j = beginIndex; (j < endIndex) && (d < nLength);
-						j++) {
-					auto const nPixelIndexStart = (j * nGroupingCount);
-					for (uint32_t k = 0; k < nGroupingCount; k++) {
-						m_pWS28xx->SetPixel(nPixelIndexStart + k, pData[d + 0],
-								pData[d + 1], pData[d + 2]);
-					}
-					d = d + 3;
-				}
-				break;
-			case pixel::Map::RBG:
-				for (uint32_t j = beginIndex; (j < endIndex) && (d < nLength);
-						j++) {
-					auto const nPixelIndexStart = (j * nGroupingCount);
-					for (uint32_t k = 0; k < nGroupingCount; k++) {
-						m_pWS28xx->SetPixel(nPixelIndexStart + k, pData[d + 0],
-								pData[d + 2], pData[d + 1]);
-					}
-					d = d + 3;
-				}
-				break;
-			case pixel::Map::GRB:
-				for (uint32_t j = beginIndex; (j < endIndex) && (d < nLength);
-						j++) {
-					auto const nPixelIndexStart = (j * nGroupingCount);
-					for (uint32_t k = 0; k < nGroupingCount; k++) {
-						m_pWS28xx->SetPixel(nPixelIndexStart + k, pData[d + 1],
-								pData[d + 0], pData[d + 2]);
-					}
-					d = d + 3;
-				}
-				break;
-			case pixel::Map::GBR:
-				for (uint32_t j = beginIndex; (j < endIndex) && (d < nLength);
-						j++) {
-					auto const nPixelIndexStart = (j * nGroupingCount);
-					for (uint32_t k = 0; k < nGroupingCount; k++) {
-						m_pWS28xx->SetPixel(nPixelIndexStart + k, pData[d + 2],
-								pData[d + 0], pData[d + 1]);
-					}
-					d = d + 3;
-				}
-				break;
-			case pixel::Map::BRG:
-				for (uint32_t j = beginIndex; (j < endIndex) && (d < nLength);
-						j++) {
-					auto const nPixelIndexStart = (j * nGroupingCount);
-					for (uint32_t k = 0; k < nGroupingCount; k++) {
-						m_pWS28xx->SetPixel(nPixelIndexStart + k, pData[d + 1],
-								pData[d + 2], pData[d + 0]);
-					}
-					d = d + 3;
-				}
-				break;
-			case pixel::Map::BGR:
-				for (uint32_t j = beginIndex; (j < endIndex) && (d < nLength);
-						j++) {
-					auto const nPixelIndexStart = (j * nGroupingCount);
-					for (uint32_t k = 0; k < nGroupingCount; k++) {
-						m_pWS28xx->SetPixel(nPixelIndexStart + k, pData[d + 2],
-								pData[d + 1], pData[d + 0]);
-					}
-					d = d + 3;
-				}
-				break;
-			default:
-				assert(0);
-				__builtin_unreachable();
-				break;
-			}
-		} else {
-			assert(nChannelsPerPixel == 4);
-			for (auto j = beginIndex; (j < endIndex) && (d < nLength); j++) {
-				auto const nPixelIndexStart = (j * nGroupingCount);
-				for (uint32_t k = 0; k < nGroupingCount; k++) {
-					m_pWS28xx->SetPixel(nPixelIndexStart + k, pData[d],
-							pData[d + 1], pData[d + 2], pData[d + 3]);
-				}
-				d = d + 4;
-			}
-		}
 
 #if !defined(LIGHTSET_PORTS)
 		if (doUpdate) {
@@ -253,6 +159,41 @@ public:
 
 	void Print() override {
 		PixelDmxConfiguration::Get().Print();
+#if defined (CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+		m_Interpolator.Print();
+#endif
+	}
+
+	/**
+	 * @brief Sends the interpolated frames, when enabled. Call it once per superloop iteration.
+	 */
+	void Run() {
+#if defined (CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+		if (__builtin_expect((m_bBlackout), 0) || m_pWS28xx->IsUpdating()) {
+			return;
+		}
+
+		if (!m_Interpolator.IsFrameDue()) {
+			return;
+		}
+
+		const auto nMicros = Hardware::Get()->Micros();
+#if !defined(LIGHTSET_PORTS)
+		static constexpr uint32_t nProtocolPortIndexLast = 0;
+#else
+		const auto nProtocolPortIndexLast = PixelDmxConfiguration::Get().GetPortInfo().nProtocolPortIndexLast;
+#endif
+
+		for (uint32_t nIndex = 0 ; nIndex <= nProtocolPortIndexLast; nIndex++) {
+			uint32_t nLength;
+			const auto *pFrame = m_Interpolator.GetFrame(nIndex, nLength);
+			SetPixels(nIndex, pFrame, nLength);
+		}
+
+		m_Interpolator.FrameDone(Hardware::Get()->Micros() - nMicros);
+
+		m_pWS28xx->Update();
+#endif
 	}
 
 	// RDM
@@ -323,8 +264,124 @@ public:
 		return s_pThis;
 	}
 
+private:
+	void SetPixels([[maybe_unused]] const uint32_t nPortIndex, const uint8_t *pData, const uint32_t nLength) {
+		auto &pixelDmxConfiguration = PixelDmxConfiguration::Get();
+		auto &portInfo = pixelDmxConfiguration.GetPortInfo();
+		uint32_t d = 0;
+
+#if !defined(LIGHTSET_PORTS)
+		static constexpr uint32_t nSwitch = 0;
+#else
+		const auto nSwitch = nPortIndex & 0x03;
+#endif
+		const auto nGroups = pixelDmxConfiguration.GetGroups();
+#if !defined(LIGHTSET_PORTS)
+		static constexpr uint32_t beginIndex = 0;
+#else
+		const auto beginIndex = portInfo.nBeginIndexPort[nSwitch];
+#endif
+		const auto nChannelsPerPixel = pixelDmxConfiguration.GetLedsPerPixel();
+		const auto endIndex = std::min(nGroups,
+				(beginIndex + (nLength / nChannelsPerPixel)));
+
+		if ((nSwitch == 0) && (nGroups < portInfo.nBeginIndexPort[1])) {
+			d = (pixelDmxConfiguration.GetDmxStartAddress() - 1U);
+		}
+
+		const auto nGroupingCount = pixelDmxConfiguration.GetGroupingCount();
+
+		if (nChannelsPerPixel == 3) {
+			switch (pixelDmxConfiguration.GetMap()) {
+			case pixel::Map::RGB:
+				for (uint32_t j = beginIndex; (j < endIndex) && (d < nLength);
+						j++) {
+					auto const nPixelIndexStart = (j * nGroupingCount);
+					for (uint32_t k = 0; k < nGroupingCount; k++) {
+						m_pWS28xx->SetPixel(nPixelIndexStart + k, pData[d + 0],
+								pData[d + 1], pData[d + 2]);
+					}
+					d = d + 3;
+				}
+				break;
+			case pixel::Map::RBG:
+				for (uint32_t j = beginIndex; (j < endIndex) && (d < nLength);
+						j++) {
+					auto const nPixelIndexStart = (j * nGroupingCount);
+					for (uint32_t k = 0; k < nGroupingCount; k++) {
+						m_pWS28xx->SetPixel(nPixelIndexStart + k, pData[d + 0],
+								pData[d + 2], pData[d + 1]);
+					}
+					d = d + 3;
+				}
+				break;
+			case pixel::Map::GRB:
+				for (uint32_t j = beginIndex; (j < endIndex) && (d < nLength);
+						j++) {
+					auto const nPixelIndexStart = (j * nGroupingCount);
+					for (uint32_t k = 0; k < nGroupingCount; k++) {
+						m_pWS28xx->SetPixel(nPixelIndexStart + k, pData[d + 1],
+								pData[d + 0], pData[d + 2]);
+					}
+					d = d + 3;
+				}
+				break;
+			case pixel::Map::GBR:
+				for (uint32_t j = beginIndex; (j < endIndex) && (d < nLength);
+						j++) {
+					auto const nPixelIndexStart = (j * nGroupingCount);
+					for (uint32_t k = 0; k < nGroupingCount; k++) {
+						m_pWS28xx->SetPixel(nPixelIndexStart + k, pData[d + 2],
+								pData[d + 0], pData[d + 1]);
+					}
+					d = d + 3;
+				}
+				break;
+			case pixel::Map::BRG:
+				for (uint32_t j = beginIndex; (j < endIndex) && (d < nLength);
+						j++) {
+					auto const nPixelIndexStart = (j * nGroupingCount);
+					for (uint32_t k = 0; k < nGroupingCount; k++) {
+						m_pWS28xx->SetPixel(nPixelIndexStart + k, pData[d + 1],
+								pData[d + 2], pData[d + 0]);
+					}
+					d = d + 3;
+				}
+				break;
+			case pixel::Map::BGR:
+				for (uint32_t j = beginIndex; (j < endIndex) && (d < nLength);
+						j++) {
+					auto const nPixelIndexStart = (j * nGroupingCount);
+					for (uint32_t k = 0; k < nGroupingCount; k++) {
+						m_pWS28xx->SetPixel(nPixelIndexStart + k, pData[d + 2],
+								pData[d + 1], pData[d + 0]);
+					}
+					d = d + 3;
+				}
+				break;
+			default:
+				assert(0);
+				__builtin_unreachable();
+				break;
+			}
+		} else {
+			assert(nChannelsPerPixel == 4);
+			for (auto j = beginIndex; (j < endIndex) && (d < nLength); j++) {
+				auto const nPixelIndexStart = (j * nGroupingCount);
+				for (uint32_t k = 0; k < nGroupingCount; k++) {
+					m_pWS28xx->SetPixel(nPixelIndexStart + k, pData[d],
+							pData[d + 1], pData[d + 2], pData[d + 3]);
+				}
+				d = d + 4;
+			}
+		}
+	}
+
 private:
 	WS28xx *m_pWS28xx { nullptr };
+#if defined (CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+	PixelDmxInterpolator m_Interpolator;
+#endif
 
 	bool m_bIsStarted { false };
 	bool m_bBlackout { false };
@@ -2,7 +2,7 @@
  * @file ws28xxdmxmulti.h
  *
  */
-/* Copyright (C) 2019-2024 by Arjan van Vught mailto:info@gd32-dmx.org
+/* Copyright (C) 2019-2025 by Arjan van Vught mailto:info@gd32-dmx.org
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -51,6 +51,11 @@
 
 #include "pixeldmxconfiguration.h"
 
+#if defined (CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+# include "pixeldmxinterpolator.h"
+# include "hardware.h"
+#endif
+
 #if defined (PIXELDMXSTARTSTOP_GPIO)
 # include "hal_gpio.h"
 #endif
@@ -63,6 +68,111 @@ namespace ws28xxdmxmulti {
 # error
 #endif
 static constexpr auto MAX_PORTS = CONFIG_PIXELDMX_MAX_PORTS;
+static constexpr uint32_t MAX_UNIVERSES = 4 * MAX_PORTS;
+
+static constexpr uint8_t MAP[6][3] = {
+		{0, 1, 2}, // RGB
+		{0, 2, 1}, // RBG
+		{1, 0, 2}, // GRB
+		{2, 0, 1}, // GBR
+		{1, 2, 0}, // BRG
+		{2, 1, 0}  // BGR
+};
+
+enum class Protocol {
+	RTZ, WS2801, APA102, P9813
+};
+
+struct Descriptor;
+using Kernel = void (*)(WS28xxMulti *, const Descriptor&, const uint8_t *, const uint32_t);
+
+/**
+ * Precomputed at configuration time for each universe,
+ * so SetData has no lookups and no branches on the pixel type.
+ */
+struct Descriptor {
+	Kernel pKernel;
+	uint16_t nPixelIndex;		///< First pixel of the universe
+	uint16_t nGroups;			///< Groups of the universe on the port, 0 when not used
+	uint16_t nGroupingCount;
+	uint8_t nOutIndex;
+	uint8_t nBrightness;		///< APA102 and SK9822
+};
+
+namespace kernel {
+template<Protocol protocol>
+inline void set_pixel(WS28xxMulti *pOutput, const Descriptor& descriptor, const uint32_t nPixelIndex, uint8_t nColour1, uint8_t nColour2, uint8_t nColour3) {
+#if defined(CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
+	PixelConfiguration::GetColour(descriptor.nOutIndex).Apply(nPixelIndex, nColour1, nColour2, nColour3);
+#endif
+	if constexpr (protocol == Protocol::RTZ) {
+		pOutput->SetColourRTZ(descriptor.nOutIndex, nPixelIndex, nColour1, nColour2, nColour3);
+	} else if constexpr (protocol == Protocol::WS2801) {
+		pOutput->SetColourWS2801(descriptor.nOutIndex, nPixelIndex, nColour1, nColour2, nColour3);
+	} else if constexpr (protocol == Protocol::APA102) {
+		pOutput->SetPixel4Bytes(descriptor.nOutIndex, 1 + nPixelIndex, descriptor.nBrightness, nColour3, nColour2, nColour1);
+	} else {
+		const auto nFlag = static_cast<uint8_t>(0xC0 | ((~nColour3 & 0xC0) >> 2) | ((~nColour2 & 0xC0) >> 4) | ((~nColour1 & 0xC0) >> 6));
+		pOutput->SetPixel4Bytes(descriptor.nOutIndex, 1 + nPixelIndex, nFlag, nColour3, nColour2, nColour1);
+	}
+}
+
+/**
+ * @brief 3 channels per pixel. Without grouping, one pixel per 3 slots.
+ */
+template<Protocol protocol, uint32_t nMap, bool isGrouping>
+void pixels3(WS28xxMulti *pOutput, const Descriptor& descriptor, const uint8_t *pData, const uint32_t nLength) {
+	constexpr auto& map = MAP[nMap];
+	const auto nGroups = std::min(static_cast<uint32_t>(descriptor.nGroups), nLength / 3);
+	auto nPixelIndex = static_cast<uint32_t>(descriptor.nPixelIndex);
+
+	for (uint32_t j = 0; j < nGroups; j++) {
+		const auto nColour1 = pData[map[0]];
+		const auto nColour2 = pData[map[1]];
+		const auto nColour3 = pData[map[2]];
+
+		if constexpr (isGrouping) {
+			for (uint32_t k = 0; k < descriptor.nGroupingCount; k++) {
+				set_pixel<protocol>(pOutput, descriptor, nPixelIndex++, nColour1, nColour2, nColour3);
+			}
+		} else {
+			set_pixel<protocol>(pOutput, descriptor, nPixelIndex++, nColour1, nColour2, nColour3);
+		}
+
+		pData += 3;
+	}
+}
+
+/**
+ * @brief 4 channels per pixel, RTZ only. The RGBW pixels are not mapped.
+ */
+template<bool isGrouping>
+void pixels4(WS28xxMulti *pOutput, const Descriptor& descriptor, const uint8_t *pData, const uint32_t nLength) {
+	const auto nGroups = std::min(static_cast<uint32_t>(descriptor.nGroups), nLength / 4);
+	const auto nGroupingCount = isGrouping ? static_cast<uint32_t>(descriptor.nGroupingCount) : 1U;
+	auto nPixelIndex = static_cast<uint32_t>(descriptor.nPixelIndex);
+#if defined(CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
+	const auto& colour = PixelConfiguration::GetColour(descriptor.nOutIndex);
+#endif
+
+	for (uint32_t j = 0; j < nGroups; j++) {
+		for (uint32_t k = 0; k < nGroupingCount; k++) {
+#if defined(CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
+			auto r = pData[0];
+			auto g = pData[1];
+			auto b = pData[2];
+			colour.Apply(nPixelIndex, r, g, b);
+			pOutput->SetColourRTZ(descriptor.nOutIndex, nPixelIndex, r, g, b, colour.ApplyWhite(nPixelIndex, pData[3]));
+#else
+			pOutput->SetColourRTZ(descriptor.nOutIndex, nPixelIndex, pData[0], pData[1], pData[2], pData[3]);
+#endif
+			nPixelIndex++;
+		}
+
+		pData += 4;
+	}
+}
+}  // namespace kernel
 }  // namespace ws28xxdmxmulti
 
 class WS28xxDmxMulti final: public LightSet {
@@ -109,6 +219,10 @@ public:
 	}
 
 	inline void SetData(const uint32_t nPortIndex, const uint8_t *pData, const uint32_t nLength, const bool doUpdate) override {
+#if defined (CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+		m_Interpolator.Input(nPortIndex, pData, nLength);
+		return;
+#endif
 		logic_analyzer::ch0_set();
 
 		SetData(nPortIndex, pData, nLength);
@@ -187,6 +301,41 @@ public:
 
 	void Print() override {
 		PixelDmxConfiguration::Get().Print();
+#if defined (CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+		m_Interpolator.Print();
+#endif
+	}
+
+	/**
+	 * @brief Sends the interpolated frames, when enabled. Call it once per superloop iteration.
+	 */
+	void Run() {
+#if defined (CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+		if (__builtin_expect((m_bBlackout), 0) || m_pWS28xxMulti->IsUpdating()) {
+			return;
+		}
+
+		if (!m_Interpolator.IsFrameDue()) {
+			return;
+		}
+
+		logic_analyzer::ch1_set();
+
+		const auto nMicros = Hardware::Get()->Micros();
+		const auto& portInfo = PixelDmxConfiguration::Get().GetPortInfo();
+
+		for (uint32_t nIndex = 0 ; nIndex <= portInfo.nProtocolPortIndexLast; nIndex++) {
+			uint32_t nLength;
+			const auto *pFrame = m_Interpolator.GetFrame(nIndex, nLength);
+			SetData(nIndex, pFrame, nLength);
+		}
+
+		m_Interpolator.FrameDone(Hardware::Get()->Micros() - nMicros);
+
+		m_pWS28xxMulti->Update();
+
+		logic_analyzer::ch1_clear();
+#endif
 	}
 
 	// Optional
@@ -217,119 +366,27 @@ private:
 		assert(pData != nullptr);
 		assert(nLength <= lightset::dmx::UNIVERSE_SIZE);
 
-		auto &pixelDmxConfiguration = PixelDmxConfiguration::Get();
-
-#if defined (NODE_DDP_DISPLAY)
-		const auto nOutIndex = (nPortIndex / 4);
-		const auto nSwitch = nPortIndex - (nOutIndex * 4);
-#else
-		const auto nUniverses = pixelDmxConfiguration.GetUniverses();
-		const auto nOutIndex = (nPortIndex / nUniverses);
-		const auto nSwitch = nPortIndex - (nOutIndex * nUniverses);
-#endif
-		auto &portInfo = pixelDmxConfiguration.GetPortInfo();
-
-		const auto nGroups = pixelDmxConfiguration.GetGroups();
-		const auto beginIndex = portInfo.nBeginIndexPort[nSwitch];
-		const auto nChannelsPerPixel = pixelDmxConfiguration.GetLedsPerPixel();
-		const auto endIndex = std::min(nGroups, (beginIndex + (nLength / nChannelsPerPixel)));
-		const auto nGroupingCount = pixelDmxConfiguration.GetGroupingCount();
-		const auto pixelType = pixelDmxConfiguration.GetType();
-		const auto isRTZProtocol = pixelDmxConfiguration.IsRTZProtocol();
-
-		uint32_t d = 0;
-
-		if (nChannelsPerPixel == 3) {
-			// Define a lambda to handle pixel setting based on color order
-			auto setPixelsColourRTZ = [&](const uint32_t nPortIndex, const uint32_t nPixelIndex, const uint32_t r, const uint32_t g, const uint32_t b) {
-#if defined(CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
-				const auto pGammaTable = m_pWS28xxMulti->m_PixelConfiguration.GetGammaTable();
-				r = pGammaTable[r];
-				g = pGammaTable[g];
-				b = pGammaTable[b];
-#endif
-				m_pWS28xxMulti->SetColourRTZ(nPortIndex, nPixelIndex, r, g, b);
-			};
-
-			// Define a lambda to handle pixel setting based on color order
-			auto setPixelsColour3 = [&](const uint32_t nPortIndex, const uint32_t nPixelIndex, const uint32_t r, const uint32_t g, const uint32_t b) {
-#if defined(CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
-				const auto pGammaTable = m_pWS28xxMulti->m_PixelConfiguration.GetGammaTable();
-				r = pGammaTable[r];
-				g = pGammaTable[g];
-				b = pGammaTable[b];
-#endif
-
-				switch (pixelType) {
-				case pixel::Type::WS2801:
-					m_pWS28xxMulti->SetColourWS2801(nPortIndex, nPixelIndex, r, g, b);
-					break;
-				case pixel::Type::APA102:
-				case pixel::Type::SK9822:
-					m_pWS28xxMulti->SetPixel4Bytes(nPortIndex, 1 + nPixelIndex, pixelDmxConfiguration.GetGlobalBrightness(), b, g, r);
-					break;
-				case pixel::Type::P9813: {
-					const auto nFlag = static_cast<uint8_t>(0xC0 | ((~b & 0xC0) >> 2) | ((~r & 0xC0) >> 4) | ((~r & 0xC0) >> 6));
-					m_pWS28xxMulti->SetPixel4Bytes(nPortIndex, 1 + nPixelIndex, nFlag, b, g, r);
-				}
-				break;
-				default:
-					assert(0);
-					__builtin_unreachable();
-					break;
-				}
-			};
-
-			constexpr uint32_t channelMap[6][3] = {
-					{0, 1, 2}, // RGB
-					{0, 2, 1}, // RBG
-					{1, 0, 2}, // GRB
-					{2, 0, 1}, // GBR
-					{1, 2, 0}, // BRG
-					{2, 1, 0}  // BGR
-			};
-
-			const auto mapIndex = static_cast<uint32_t>(pixelDmxConfiguration.GetMap());
-			// Ensure mapIndex is within valid bounds
-			assert(mapIndex < sizeof(channelMap) / sizeof(channelMap[0]));  // Runtime check
-			auto const& map = channelMap[mapIndex];
-
-			if (isRTZProtocol) {
-				for (uint32_t j = beginIndex; (j < endIndex) && (d < nLength); j++) {
-					auto const nPixelIndexStart = j * nGroupingCount;
-					for (uint32_t k = 0; k < nGroupingCount; k++) {
-						setPixelsColourRTZ(nOutIndex, nPixelIndexStart + k, pData[d + map[0]], pData[d + map[1]], pData[d + map[2]]);
-					}
-					d += 3; // Increment by 3 since we're processing 3 channels per pixel
-				}
-			} else {
-				for (uint32_t j = beginIndex; (j < endIndex) && (d < nLength); j++) {
-					auto const nPixelIndexStart = j * nGroupingCount;
-					for (uint32_t k = 0; k < nGroupingCount; k++) {
-						setPixelsColour3(nOutIndex, nPixelIndexStart + k, pData[d + map[0]], pData[d + map[1]], pData[d + map[2]]);
-					}
-					d += 3; // Increment by 3 since we're processing 3 channels per pixel
-				}
-			}
-		} else {
-			assert(nChannelsPerPixel == 4);
-			assert(isRTZProtocol);
-			for (uint32_t j = beginIndex; (j < endIndex) && (d < nLength); j++) {
-				auto const nPixelIndexStart = (j * nGroupingCount);
-				for (uint32_t k = 0; k < nGroupingCount; k++) {
-					m_pWS28xxMulti->SetColourRTZ(nOutIndex, nPixelIndexStart + k, pData[d], pData[d + 1], pData[d + 2], pData[d + 3]);
-				}
-				d = d + 4; // Increment by 4 since we're processing 4 channels per pixel
-			}
+		if (__builtin_expect((nPortIndex >= ws28xxdmxmulti::MAX_UNIVERSES), 0)) {
+			return;
 		}
+
+		const auto& descriptor = s_Descriptor[nPortIndex];
+		descriptor.pKernel(m_pWS28xxMulti, descriptor, pData, nLength);
 	}
 
+	void SetDescriptors();
+
 private:
 	WS28xxMulti *m_pWS28xxMulti { nullptr };
+#if defined (CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+	PixelDmxInterpolator m_Interpolator;
+#endif
 
 	uint32_t m_bIsStarted[2];		///< Support for 16x4 = 64 ports.
 	bool m_bBlackout { false };
 	bool m_bNeedSync { false };
+
+	static inline ws28xxdmxmulti::Descriptor s_Descriptor[ws28xxdmxmulti::MAX_UNIVERSES];
 };
 
 #if defined(__GNUC__) && !defined(__clang__)
@@ -2,7 +2,7 @@
  * @file ws28xxdmx.cpp
  *
  */
-/* Copyright (C) 2016-2024 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2016-2025 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -50,6 +50,13 @@ WS28xxDmx::WS28xxDmx() {
 		assert(m_pWS28xx != nullptr);
 		m_pWS28xx->Blackout();
 
+#if defined (CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+		m_Interpolator.SetRefreshRate(PixelConfiguration::Get().GetRefreshRate());
+# if defined (CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
+		m_Interpolator.SetKeepRefreshing(PixelConfiguration::GetColour(0).IsDither());
+# endif
+#endif
+
 #if defined (PIXELDMXSTARTSTOP_GPIO)
 		FUNC_PREFIX(gpio_fsel(PIXELDMXSTARTSTOP_GPIO, GPIO_FSEL_OUTPUT));
 		FUNC_PREFIX(gpio_clr(PIXELDMXSTARTSTOP_GPIO));
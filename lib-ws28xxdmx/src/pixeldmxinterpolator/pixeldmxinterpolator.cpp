@@ -0,0 +1,230 @@
+/**
+ * @file pixeldmxinterpolator.cpp
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#if defined (DEBUG_PIXELDMX)
+# undef NDEBUG
+#endif
+
+#if defined(__GNUC__) && !defined(__clang__)
+# pragma GCC push_options
+# pragma GCC optimize ("O3")
+# pragma GCC optimize ("no-tree-loop-distribute-patterns")
+#endif
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <cassert>
+
+#if defined (__ARM_NEON)
+# include <arm_neon.h>
+#endif
+
+#include "pixeldmxinterpolator.h"
+
+#include "hardware.h"
+
+#include "debug.h"
+
+using namespace pixeldmx::interpolator;
+
+namespace pixeldmx::interpolator {
+void lerp(uint8_t *pOut, const uint8_t *pFrom, const uint8_t *pTo, const uint32_t nLength, const uint32_t nAlpha) {
+	if (nAlpha == 0) {
+		if (pOut != pFrom) {
+			memcpy(pOut, pFrom, nLength);
+		}
+		return;
+	}
+
+	if (nAlpha >= ALPHA_ONE) {
+		memcpy(pOut, pTo, nLength);
+		return;
+	}
+
+	const auto nBeta = ALPHA_ONE - nAlpha;
+	uint32_t i = 0;
+
+#if defined (__ARM_NEON)
+	const auto vAlpha = vdup_n_u8(static_cast<uint8_t>(nAlpha));
+	const auto vBeta = vdup_n_u8(static_cast<uint8_t>(nBeta));
+
+	for (; (i + 16) <= nLength; i += 16) {
+		const auto vFrom = vld1q_u8(&pFrom[i]);
+		const auto vTo = vld1q_u8(&pTo[i]);
+
+		auto vLow = vmull_u8(vget_low_u8(vFrom), vBeta);
+		vLow = vmlal_u8(vLow, vget_low_u8(vTo), vAlpha);
+		auto vHigh = vmull_u8(vget_high_u8(vFrom), vBeta);
+		vHigh = vmlal_u8(vHigh, vget_high_u8(vTo), vAlpha);
+
+		vst1q_u8(&pOut[i], vcombine_u8(vrshrn_n_u16(vLow, 8), vrshrn_n_u16(vHigh, 8)));
+	}
+#else
+	/*
+	 * Two 16-bit lanes per word. The weights add up to 256,
+	 * so a lane never exceeds 255 * 256 + 128.
+	 */
+	for (; (i + 4) <= nLength; i += 4) {
+		uint32_t nFrom;
+		uint32_t nTo;
+
+		memcpy(&nFrom, &pFrom[i], sizeof(uint32_t));
+		memcpy(&nTo, &pTo[i], sizeof(uint32_t));
+
+		const auto nEven = ((nFrom & 0x00FF00FF) * nBeta + (nTo & 0x00FF00FF) * nAlpha + 0x00800080) >> 8;
+		const auto nOdd = ((nFrom >> 8) & 0x00FF00FF) * nBeta + ((nTo >> 8) & 0x00FF00FF) * nAlpha + 0x00800080;
+		const uint32_t nResult = (nEven & 0x00FF00FF) | (nOdd & 0xFF00FF00);
+
+		memcpy(&pOut[i], &nResult, sizeof(uint32_t));
+	}
+#endif
+
+	for (; i < nLength; i++) {
+		pOut[i] = static_cast<uint8_t>((static_cast<uint32_t>(pFrom[i]) * nBeta + static_cast<uint32_t>(pTo[i]) * nAlpha + 0x80) >> 8);
+	}
+}
+}  // namespace pixeldmx::interpolator
+
+PixelDmxInterpolator::PixelDmxInterpolator() {
+	DEBUG_ENTRY
+
+	memset(s_Port, 0, sizeof(s_Port));
+	memset(&m_Statistics, 0, sizeof(struct Statistics));
+
+	DEBUG_EXIT
+}
+
+void PixelDmxInterpolator::SetRefreshRate(const uint32_t nRefreshRate) {
+	if (nRefreshRate == 0) {
+		m_nRefreshMicros = INTERVAL_MIN_US;
+	} else {
+		m_nRefreshMicros = std::max(1000000U / nRefreshRate, INTERVAL_MIN_US);
+	}
+
+	DEBUG_PRINTF("nRefreshRate=%u, m_nRefreshMicros=%u", static_cast<unsigned int>(nRefreshRate), static_cast<unsigned int>(m_nRefreshMicros));
+}
+
+uint32_t PixelDmxInterpolator::GetAlpha(const uint32_t nPortIndex, const uint32_t nMicros) const {
+	const auto& port = s_Port[nPortIndex];
+
+	if (port.nInterval == 0) {
+		return ALPHA_ONE;
+	}
+
+	const auto nElapsed = nMicros - port.nMicros;
+
+	if (nElapsed >= port.nInterval) {
+		return ALPHA_ONE;
+	}
+
+	return (nElapsed * ALPHA_ONE) / port.nInterval;
+}
+
+void PixelDmxInterpolator::Input(const uint32_t nPortIndex, const uint8_t *pData, const uint32_t nLength) {
+	assert(nPortIndex < PORTS);
+	assert(pData != nullptr);
+	assert(nLength <= lightset::dmx::UNIVERSE_SIZE);
+
+	const auto nMicros = Hardware::Get()->Micros();
+	auto& port = s_Port[nPortIndex];
+
+	/*
+	 * The fade continues from what is on display now
+	 */
+	lerp(port.From, port.From, port.To, std::max(port.nLength, nLength), GetAlpha(nPortIndex, nMicros));
+
+	const auto nElapsed = nMicros - port.nMicros;
+
+	if (nElapsed > INTERVAL_MAX_US) {
+		port.nInterval = 0;
+	} else if (port.nInterval == 0) {
+		port.nInterval = nElapsed;
+	} else {
+		port.nInterval = (3 * port.nInterval + nElapsed) / 4;
+	}
+
+	memcpy(port.To, pData, nLength);
+	port.nLength = nLength;
+	port.nMicros = nMicros;
+
+	m_Statistics.nFramesIn++;
+	m_bFading = true;
+}
+
+bool PixelDmxInterpolator::IsFrameDue() {
+	if (!m_bFading && !m_bKeepRefreshing) {
+		return false;
+	}
+
+	const auto nMicros = Hardware::Get()->Micros();
+
+	if ((nMicros - m_nFrameMicros) < m_nRefreshMicros) {
+		return false;
+	}
+
+	m_nFrameMicros = nMicros;
+	return true;
+}
+
+const uint8_t *PixelDmxInterpolator::GetFrame(const uint32_t nPortIndex, uint32_t& nLength) {
+	assert(nPortIndex < PORTS);
+
+	const auto& port = s_Port[nPortIndex];
+	const auto nAlpha = GetAlpha(nPortIndex, m_nFrameMicros);
+
+	if (nAlpha < ALPHA_ONE) {
+		m_bStillFading = true;
+	}
+
+	nLength = port.nLength;
+
+	const auto nMicros = Hardware::Get()->Micros();
+
+	lerp(s_Frame, port.From, port.To, nLength, nAlpha);
+
+	m_Statistics.nKernelMicros += Hardware::Get()->Micros() - nMicros;
+
+	return s_Frame;
+}
+
+void PixelDmxInterpolator::FrameDone(const uint32_t nRenderMicros) {
+	m_bFading = m_bStillFading;
+	m_bStillFading = false;
+
+	m_Statistics.nFramesOut++;
+	m_Statistics.nRenderMicros += nRenderMicros;
+}
+
+void PixelDmxInterpolator::Print() const {
+	const auto nFramesOut = m_Statistics.nFramesOut == 0 ? 1 : m_Statistics.nFramesOut;
+
+	puts("Interpolation");
+	printf(" Refresh : %u Hz (max %u Hz)\n", static_cast<unsigned int>(1000000U / m_nRefreshMicros), static_cast<unsigned int>(REFRESH_HZ_MAX));
+	printf(" Frames  : %u in, %u out\n", static_cast<unsigned int>(m_Statistics.nFramesIn), static_cast<unsigned int>(m_Statistics.nFramesOut));
+	printf(" Dither  : %s\n", m_bKeepRefreshing ? "Yes" : "No");
+	printf(" Time    : %u us kernel, %u us SetData per frame\n", static_cast<unsigned int>(m_Statistics.nKernelMicros / nFramesOut), static_cast<unsigned int>((m_Statistics.nRenderMicros - m_Statistics.nKernelMicros) / nFramesOut));
+}
@@ -2,7 +2,7 @@
  * @file ws28xxdmxmulti.cpp
  *
  */
-/* Copyright (C) 2019-2024 by Arjan van Vught mailto:info@gd32-dmx.org
+/* Copyright (C) 2019-2025 by Arjan van Vught mailto:info@gd32-dmx.org
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -27,6 +27,8 @@
 # undef NDEBUG
 #endif
 
+#include <cstdint>
+#include <algorithm>
 #include <cassert>
 
 #include "ws28xxdmxmulti.h"
@@ -38,6 +40,53 @@
 
 #include "debug.h"
 
+using namespace ws28xxdmxmulti;
+
+template<Protocol protocol, bool isGrouping>
+static constexpr Kernel KERNEL3[6] = {
+		&kernel::pixels3<protocol, 0, isGrouping>,
+		&kernel::pixels3<protocol, 1, isGrouping>,
+		&kernel::pixels3<protocol, 2, isGrouping>,
+		&kernel::pixels3<protocol, 3, isGrouping>,
+		&kernel::pixels3<protocol, 4, isGrouping>,
+		&kernel::pixels3<protocol, 5, isGrouping>
+};
+
+template<Protocol protocol>
+static Kernel get_kernel3(const uint32_t nMap, const bool isGrouping) {
+	return isGrouping ? KERNEL3<protocol, true>[nMap] : KERNEL3<protocol, false>[nMap];
+}
+
+static Kernel get_kernel(const uint32_t nOutIndex, const bool isGrouping) {
+	const auto& pixelDmxConfiguration = PixelDmxConfiguration::Get();
+
+	if (pixelDmxConfiguration.GetLedsPerPixel(nOutIndex) == 4) {
+		assert(pixelDmxConfiguration.IsRTZProtocol());
+		return isGrouping ? &kernel::pixels4<true> : &kernel::pixels4<false>;
+	}
+
+	auto nMap = static_cast<uint32_t>(pixelDmxConfiguration.GetMap(nOutIndex));
+	assert(nMap < sizeof(MAP) / sizeof(MAP[0]));
+
+	if (nMap >= sizeof(MAP) / sizeof(MAP[0])) {
+		nMap = 0;
+	}
+
+	if (pixelDmxConfiguration.IsRTZProtocol()) {
+		return get_kernel3<Protocol::RTZ>(nMap, isGrouping);
+	}
+
+	switch (pixelDmxConfiguration.GetType(nOutIndex)) {
+	case pixel::Type::APA102:
+	case pixel::Type::SK9822:
+		return get_kernel3<Protocol::APA102>(nMap, isGrouping);
+	case pixel::Type::P9813:
+		return get_kernel3<Protocol::P9813>(nMap, isGrouping);
+	default:
+		return get_kernel3<Protocol::WS2801>(nMap, isGrouping);
+	}
+}
+
 WS28xxDmxMulti::WS28xxDmxMulti() {
 	DEBUG_ENTRY
 
@@ -50,6 +99,15 @@ WS28xxDmxMulti::WS28xxDmxMulti() {
 	assert(m_pWS28xxMulti != nullptr);
 	m_pWS28xxMulti->Blackout();
 
+	SetDescriptors();
+
+#if defined (CONFIG_PIXELDMX_ENABLE_INTERPOLATION)
+	m_Interpolator.SetRefreshRate(PixelConfiguration::Get().GetRefreshRate());
+# if defined (CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
+	m_Interpolator.SetKeepRefreshing(PixelConfiguration::GetColour(0).IsDither());
+# endif
+#endif
+
 #if defined (PIXELDMXSTARTSTOP_GPIO)
 	FUNC_PREFIX(gpio_fsel(PIXELDMXSTARTSTOP_GPIO, GPIO_FSEL_OUTPUT));
 	FUNC_PREFIX(gpio_clr(PIXELDMXSTARTSTOP_GPIO));
@@ -66,3 +124,44 @@ WS28xxDmxMulti::~WS28xxDmxMulti() {
 
 	DEBUG_EXIT
 }
+
+void WS28xxDmxMulti::SetDescriptors() {
+	DEBUG_ENTRY
+
+	auto& pixelDmxConfiguration = PixelDmxConfiguration::Get();
+	const auto nProtocolPortIndexLast = pixelDmxConfiguration.GetPortInfo().nProtocolPortIndexLast;
+	const auto nGroupingCount = pixelDmxConfiguration.GetGroupingCount();
+	const auto isGrouping = (nGroupingCount != 1);
+#if !defined (NODE_DDP_DISPLAY)
+	const auto nUniverses = pixelDmxConfiguration.GetUniverses();
+#endif
+
+	for (uint32_t nPortIndex = 0; nPortIndex < MAX_UNIVERSES; nPortIndex++) {
+#if defined (NODE_DDP_DISPLAY)
+		const auto nOutIndex = std::min(nPortIndex / 4, static_cast<uint32_t>(MAX_PORTS - 1));
+		const auto nSwitch = nPortIndex - (nOutIndex * 4);
+#else
+		const auto nOutIndex = std::min(nPortIndex / nUniverses, static_cast<uint32_t>(MAX_PORTS - 1));
+		const auto nSwitch = nPortIndex - (nOutIndex * nUniverses);
+#endif
+		const auto nGroups = pixelDmxConfiguration.GetGroups(nOutIndex);
+		const auto nBeginIndex = pixelDmxConfiguration.GetBeginIndex(nOutIndex, nSwitch);
+
+		auto& descriptor = s_Descriptor[nPortIndex];
+
+		descriptor.pKernel = get_kernel(nOutIndex, isGrouping);
+		descriptor.nPixelIndex = static_cast<uint16_t>(nBeginIndex * nGroupingCount);
+		descriptor.nGroups = 0;
+		descriptor.nGroupingCount = static_cast<uint16_t>(nGroupingCount);
+		descriptor.nOutIndex = static_cast<uint8_t>(nOutIndex);
+		descriptor.nBrightness = pixelDmxConfiguration.GetGlobalBrightness();
+
+		if ((nPortIndex <= nProtocolPortIndexLast) && (nBeginIndex < nGroups)) {
+			descriptor.nGroups = static_cast<uint16_t>(nGroups - nBeginIndex);
+		}
+
+		DEBUG_PRINTF("%u: %u:%u %u+%u", nPortIndex, nOutIndex, nSwitch, descriptor.nPixelIndex, descriptor.nGroups);
+	}
+
+	DEBUG_EXIT
+}
@@ -2,7 +2,7 @@
  * @file pixeldmxparams.cpp
  *
  */
-/* Copyright (C) 2016-2024 by Arjan van Vught mailto:info@gd32-dmx.org
+/* Copyright (C) 2016-2025 by Arjan van Vught mailto:info@gd32-dmx.org
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -40,7 +40,7 @@
 #include "pixelpatterns.h"
 #include "pixelconfiguration.h"
 
-#include "gamma/gamma_tables.h"
+#include "pixelcolour.h"
 
 #include "lightset.h"
 #include "lightsetparamsconst.h"
@@ -69,11 +69,17 @@ PixelDmxParams::PixelDmxParams() {
 	m_Params.nLowCode = 0;
 	m_Params.nHighCode = 0;
 	m_Params.nGammaValue = 0;
+	m_Params.nWhiteBalance[0] = 100;
+	m_Params.nWhiteBalance[1] = 100;
+	m_Params.nWhiteBalance[2] = 100;
 	m_Params.nTestPattern = 0;
 
 	for (uint32_t nPortIndex = 0; nPortIndex < pixeldmxparams::MAX_PORTS; nPortIndex++) {
 		m_Params.nStartUniverse[nPortIndex] = static_cast<uint16_t>(1 + (nPortIndex * 4));
 	}
+
+	memset(m_Params.nCountPort, 0, sizeof(m_Params.nCountPort));
+	memset(m_Params.nTypePort, 0, sizeof(m_Params.nTypePort));
 }
 
 void PixelDmxParams::Load() {
@@ -249,6 +255,27 @@ void PixelDmxParams::callbackFunction(const char *pLine) {
 	}
 
 #if defined(OUTPUT_DMX_PIXEL_MULTI)
+	for (uint32_t i = 0; i < pixeldmxparams::PIXEL_PORTS; i++) {
+		if (Sscan::Uint16(pLine, DevicesParamsConst::COUNT_PORT[i], nValue16) == Sscan::OK) {
+			if (nValue16 <= std::max(max::ledcount::RGB, max::ledcount::RGBW)) {
+				m_Params.nCountPort[i] = nValue16;
+			} else {
+				m_Params.nCountPort[i] = 0;
+			}
+			m_Params.nSetList |= pixeldmxparams::Mask::COUNT_PORT;
+			return;
+		}
+
+		nLength = TYPES_MAX_NAME_LENGTH;
+
+		if (Sscan::Char(pLine, DevicesParamsConst::TYPE_PORT[i], cBuffer, nLength) == Sscan::OK) {
+			cBuffer[nLength] = '\0';
+			SetTypePort(i, pixel::pixel_get_type(cBuffer));
+			m_Params.nSetList |= pixeldmxparams::Mask::TYPE_PORT;
+			return;
+		}
+	}
+
 	if (Sscan::Uint8(pLine, DevicesParamsConst::ACTIVE_OUT, nValue8) == Sscan::OK) {
 		if ((nValue8 > 0) &&  (nValue8 <= pixeldmxparams::MAX_PORTS) &&  (nValue8 != pixel::defaults::OUTPUT_PORTS)) {
 			m_Params.nActiveOutputs = nValue8;
@@ -283,14 +310,34 @@ void PixelDmxParams::callbackFunction(const char *pLine) {
 	}
 
 	if (Sscan::Float(pLine, DevicesParamsConst::GAMMA_VALUE, fValue) == Sscan::OK) {
-		const auto nValue = static_cast<uint8_t>(fValue * 10);
-		if ((nValue < gamma::MIN) || (nValue > gamma::MAX)) {
+		const auto nValue = static_cast<uint8_t>((fValue * 10) + 0.5f);
+		if ((nValue < colour::gamma::MIN) || (nValue > colour::gamma::MAX)) {
 			m_Params.nGammaValue = 0;
 		} else {
 			m_Params.nGammaValue = nValue;
 		}
 		return;
 	}
+
+	for (uint32_t i = 0; i < 3; i++) {
+		if (Sscan::Uint8(pLine, DevicesParamsConst::WHITE_BALANCE[i], nValue8) == Sscan::OK) {
+			if (!isMaskSet(pixeldmxparams::Mask::WHITE_BALANCE)) {
+				memset(m_Params.nWhiteBalance, 100, sizeof(m_Params.nWhiteBalance));
+			}
+			m_Params.nWhiteBalance[i] = (nValue8 < 100) ? nValue8 : 100;
+			m_Params.nSetList |= pixeldmxparams::Mask::WHITE_BALANCE;
+			return;
+		}
+	}
+
+	if (Sscan::Uint8(pLine, DevicesParamsConst::DITHER, nValue8) == Sscan::OK) {
+		if (nValue8 != 0) {
+			m_Params.nSetList |= pixeldmxparams::Mask::DITHER;
+		} else {
+			m_Params.nSetList &= ~pixeldmxparams::Mask::DITHER;
+		}
+		return;
+	}
 #endif
 }
 
@@ -316,6 +363,16 @@ void PixelDmxParams::Builder(const struct pixeldmxparams::Params *ptWS28xxParams
 	} else {
 		builder.Add(DevicesParamsConst::GAMMA_VALUE, static_cast<float>(m_Params.nGammaValue) / 10, true);
 	}
+
+	builder.AddComment("White balance (%)");
+	for (uint32_t i = 0; i < 3; i++) {
+		if (!isMaskSet(pixeldmxparams::Mask::WHITE_BALANCE)) {
+			m_Params.nWhiteBalance[i] = 100;
+		}
+		builder.Add(DevicesParamsConst::WHITE_BALANCE[i], m_Params.nWhiteBalance[i], isMaskSet(pixeldmxparams::Mask::WHITE_BALANCE));
+	}
+
+	builder.Add(DevicesParamsConst::DITHER, isMaskSet(pixeldmxparams::Mask::DITHER));
 #endif
 
 	builder.AddComment("Overwrite datasheet");
@@ -362,6 +419,18 @@ void PixelDmxParams::Builder(const struct pixeldmxparams::Params *ptWS28xxParams
 	}
 #if defined(OUTPUT_DMX_PIXEL_MULTI)
 	builder.Add(DevicesParamsConst::ACTIVE_OUT, m_Params.nActiveOutputs, isMaskSet(pixeldmxparams::Mask::ACTIVE_OUT));
+
+	builder.AddComment("Per port, RTZ types only");
+	for (uint32_t i = 0; i < pixeldmxparams::PIXEL_PORTS; i++) {
+		const auto isSet = isMaskSet(pixeldmxparams::Mask::COUNT_PORT) && (m_Params.nCountPort[i] != 0);
+		builder.Add(DevicesParamsConst::COUNT_PORT[i], isSet ? m_Params.nCountPort[i] : m_Params.nCount, isSet);
+	}
+
+	for (uint32_t i = 0; i < pixeldmxparams::PIXEL_PORTS; i++) {
+		const auto type = isMaskSet(pixeldmxparams::Mask::TYPE_PORT) ? GetTypePort(i) : pixel::Type::UNDEFINED;
+		const auto isSet = (type != pixel::Type::UNDEFINED);
+		builder.Add(DevicesParamsConst::TYPE_PORT[i], pixel::pixel_get_type(isSet ? type : static_cast<pixel::Type>(m_Params.nType)), isSet);
+	}
 #endif
 
 	builder.AddComment("Test pattern");
@@ -411,6 +480,12 @@ void PixelDmxParams::Set() {
 			pixelConfiguration.SetGammaTable(m_Params.nGammaValue);
 		}
 	}
+
+	if (isMaskSet(pixeldmxparams::Mask::WHITE_BALANCE)) {
+		pixelConfiguration.SetWhiteBalance(static_cast<float>(m_Params.nWhiteBalance[0]) / 100, static_cast<float>(m_Params.nWhiteBalance[1]) / 100, static_cast<float>(m_Params.nWhiteBalance[2]) / 100);
+	}
+
+	pixelConfiguration.SetDither(isMaskSet(pixeldmxparams::Mask::DITHER));
 #endif
 
 	// Dmx
@@ -428,6 +503,16 @@ void PixelDmxParams::Set() {
 	if (isMaskSet(pixeldmxparams::Mask::ACTIVE_OUT)) {
 		pixelDmxConfiguration.SetOutputPorts(m_Params.nActiveOutputs);
 	}
+
+	for (uint32_t i = 0; i < pixeldmxparams::PIXEL_PORTS; i++) {
+		if (isMaskSet(pixeldmxparams::Mask::COUNT_PORT)) {
+			pixelConfiguration.SetCount(i, m_Params.nCountPort[i]);
+		}
+
+		if (isMaskSet(pixeldmxparams::Mask::TYPE_PORT)) {
+			pixelConfiguration.SetType(i, GetTypePort(i));
+		}
+	}
 #endif
 }
 
@@ -451,6 +536,11 @@ void PixelDmxParams::Dump() {
 	}
 
 	printf(" %s=%d\n", DevicesParamsConst::ACTIVE_OUT, m_Params.nActiveOutputs);
+#if defined(OUTPUT_DMX_PIXEL_MULTI)
+	for (uint32_t i = 0; i < pixeldmxparams::PIXEL_PORTS; i++) {
+		printf(" %s=%d, %s=%s\n", DevicesParamsConst::COUNT_PORT[i], m_Params.nCountPort[i], DevicesParamsConst::TYPE_PORT[i], pixel::pixel_get_type(GetTypePort(i)));
+	}
+#endif
 	printf(" %s=%d\n", DevicesParamsConst::GROUPING_COUNT, m_Params.nGroupingCount);
 	printf(" %s=%u\n", DevicesParamsConst::SPI_SPEED_HZ, static_cast<unsigned int>(m_Params.nSpiSpeedHz));
 	printf(" %s=%d\n", DevicesParamsConst::GLOBAL_BRIGHTNESS, m_Params.nGlobalBrightness);
@@ -459,5 +549,9 @@ void PixelDmxParams::Dump() {
 #if defined(CONFIG_PIXELDMX_ENABLE_GAMMATABLE)
 	printf(" %s=%d\n", DevicesParamsConst::GAMMA_CORRECTION, isMaskSet(pixeldmxparams::Mask::GAMMA_CORRECTION));
 	printf(" %s=%1.1f [%u]\n", DevicesParamsConst::GAMMA_VALUE, static_cast<float>(m_Params.nGammaValue) / 10, m_Params.nGammaValue);
+	for (uint32_t i = 0; i < 3; i++) {
+		printf(" %s=%u\n", DevicesParamsConst::WHITE_BALANCE[i], m_Params.nWhiteBalance[i]);
+	}
+	printf(" %s=%d\n", DevicesParamsConst::DITHER, isMaskSet(pixeldmxparams::Mask::DITHER));
 #endif
 }
@@ -0,0 +1,65 @@
+/**
+ * @file configstore.h
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef CONFIGSTORE_H_
+#define CONFIGSTORE_H_
+
+#include <cstdint>
+#include <cstring>
+#include <cassert>
+
+/**
+ * Stub with the store of the pixel parameters in RAM
+ */
+
+namespace configstore {
+enum class Store {
+	WS28XXDMX
+};
+}  // namespace configstore
+
+namespace test {
+inline uint8_t g_Store[64];
+}  // namespace test
+
+class ConfigStore {
+public:
+	static ConfigStore *Get() {
+		static ConfigStore s_ConfigStore;
+		return &s_ConfigStore;
+	}
+
+	void Update([[maybe_unused]] configstore::Store store, const void *pData, uint32_t nDataLength) {
+		assert(nDataLength <= sizeof(test::g_Store));
+		memcpy(test::g_Store, pData, nDataLength);
+	}
+
+	void Copy([[maybe_unused]] const configstore::Store store, void *pData, uint32_t nDataLength) {
+		assert(nDataLength <= sizeof(test::g_Store));
+		memcpy(pData, test::g_Store, nDataLength);
+	}
+};
+
+#endif /* CONFIGSTORE_H_ */
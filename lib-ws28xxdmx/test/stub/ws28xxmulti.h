@@ -0,0 +1,107 @@
+/**
+ * @file ws28xxmulti.h
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef WS28XXMULTI_H_
+#define WS28XXMULTI_H_
+
+#include <cstdint>
+#include <cstring>
+
+#include "pixelconfiguration.h"
+
+/**
+ * Stub with the pixel buffer of the H3 driver, the ports in wire order.
+ * The kernels of WS28xxDmxMulti write the same bytes as on the target.
+ * The last setter called per port and the updates are recorded.
+ */
+
+namespace test {
+enum class Setter {
+	NONE, RTZ, RTZ_RGBW, WS2801, BYTES4
+};
+
+static constexpr uint32_t LANE_SIZE = 4 * (pixel::max::ledcount::RGB + 2);
+inline uint8_t g_Lanes[8][LANE_SIZE];
+inline Setter g_Setter[8];
+inline uint32_t g_nUpdates;
+}  // namespace test
+
+class WS28xxMulti {
+public:
+	void SetColourRTZ(uint32_t nPortIndex, uint32_t nPixelIndex, uint8_t nColour1, uint8_t nColour2, uint8_t nColour3) {
+		test::g_Setter[nPortIndex] = test::Setter::RTZ;
+		SetColour(nPortIndex, nPixelIndex, nColour1, nColour2, nColour3);
+	}
+
+	void SetColourRTZ(uint32_t nPortIndex, uint32_t nPixelIndex, uint8_t nRed, uint8_t nGreen, uint8_t nBlue, uint8_t nWhite) {
+		SetPixel4Bytes(nPortIndex, nPixelIndex, nGreen, nRed, nBlue, nWhite);
+		test::g_Setter[nPortIndex] = test::Setter::RTZ_RGBW;
+	}
+
+	void SetColourWS2801(uint32_t nPortIndex, uint32_t nPixelIndex, uint8_t nColour1, uint8_t nColour2, uint8_t nColour3) {
+		test::g_Setter[nPortIndex] = test::Setter::WS2801;
+		SetColour(nPortIndex, nPixelIndex, nColour1, nColour2, nColour3);
+	}
+
+	void SetPixel4Bytes(uint32_t nPortIndex, uint32_t nPixelIndex, uint8_t nCtrl, uint8_t nColour1, uint8_t nColour2, uint8_t nColour3) {
+		test::g_Setter[nPortIndex] = test::Setter::BYTES4;
+
+		auto *p = &test::g_Lanes[nPortIndex][nPixelIndex * 4];
+		p[0] = nCtrl;
+		p[1] = nColour1;
+		p[2] = nColour2;
+		p[3] = nColour3;
+	}
+
+	bool IsUpdating() {
+		return false;
+	}
+
+	void Update() {
+		test::g_nUpdates++;
+	}
+
+	void Blackout() {
+		memset(test::g_Lanes, 0, sizeof(test::g_Lanes));
+	}
+
+	void FullOn() {
+		memset(test::g_Lanes, 0xFF, sizeof(test::g_Lanes));
+	}
+
+	uint32_t GetUserData() {
+		return 0;
+	}
+
+private:
+	void SetColour(uint32_t nPortIndex, uint32_t nPixelIndex, uint8_t nColour1, uint8_t nColour2, uint8_t nColour3) {
+		auto *p = &test::g_Lanes[nPortIndex][nPixelIndex * 3];
+		p[0] = nColour1;
+		p[1] = nColour2;
+		p[2] = nColour3;
+	}
+};
+
+#endif /* WS28XXMULTI_H_ */
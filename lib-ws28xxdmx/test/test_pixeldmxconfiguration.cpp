@@ -0,0 +1,309 @@
+/**
+ * @file test_pixeldmxconfiguration.cpp
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * The validation of the pixel configuration of the multi port outputs:
+ * the count and type per port, the fallback to the global type, the clock
+ * and type of the SPI pixels, the universes per output and the first group
+ * of each universe.
+ */
+
+#include <cstdint>
+#include <cstdio>
+
+#include "pixeldmxconfiguration.h"
+#include "pixelconfiguration.h"
+#include "pixeltype.h"
+
+#include "test.h"
+
+namespace {
+static constexpr uint32_t PORTS = pixel::configuration::PORTS;
+
+PixelDmxConfiguration *s_pConfiguration;
+
+PixelDmxConfiguration& reset() {
+	auto& configuration = *s_pConfiguration;
+
+	configuration.SetType(pixel::Type::WS2812B);
+	configuration.SetCount(pixel::defaults::COUNT);
+	configuration.SetMap(pixel::Map::UNDEFINED);
+	configuration.SetClockSpeedHz(0);
+	configuration.SetLowCode(0);
+	configuration.SetHighCode(0);
+	configuration.SetGlobalBrightness(0xFF);
+	configuration.SetGroupingCount(1);
+	configuration.SetOutputPorts(PORTS);
+
+	for (uint32_t nPortIndex = 0; nPortIndex < PORTS; nPortIndex++) {
+		configuration.SetCount(nPortIndex, 0);
+		configuration.SetType(nPortIndex, pixel::Type::UNDEFINED);
+	}
+
+	return configuration;
+}
+
+bool is_port(const uint32_t nPortIndex, const pixel::Type type, const uint32_t nCount, const uint32_t nLedsPerPixel, const pixel::Map map) {
+	const auto& configuration = *s_pConfiguration;
+
+	if ((configuration.GetType(nPortIndex) == type) && (configuration.GetCount(nPortIndex) == nCount) && (configuration.GetLedsPerPixel(nPortIndex) == nLedsPerPixel) && (configuration.GetMap(nPortIndex) == map)) {
+		return true;
+	}
+
+	printf("Port %u: %s %u %u %s\n", static_cast<unsigned int>(nPortIndex), pixel::pixel_get_type(configuration.GetType(nPortIndex)), static_cast<unsigned int>(configuration.GetCount(nPortIndex)),
+			static_cast<unsigned int>(configuration.GetLedsPerPixel(nPortIndex)), pixel::pixel_get_map(configuration.GetMap(nPortIndex)));
+	return false;
+}
+
+void test_ports() {
+	auto& configuration = reset();
+
+	configuration.SetCount(100);
+	configuration.SetMap(pixel::Map::BGR);
+	configuration.SetOutputPorts(4);
+	configuration.SetCount(0, 680);
+	configuration.SetType(0, pixel::Type::SK6812W);
+	configuration.SetCount(1, 100);
+	configuration.SetType(1, pixel::Type::WS2812B);
+	configuration.SetCount(2, 300);
+	configuration.SetType(2, pixel::Type::APA102);
+	configuration.Validate(PORTS);
+
+	CHECK(configuration.IsRTZProtocol());
+	CHECK(is_port(0, pixel::Type::SK6812W, pixel::max::ledcount::RGBW, 4, pixel::Map::GRB));
+	CHECK(is_port(1, pixel::Type::WS2812B, 100, 3, pixel::Map::BGR));
+	// An SPI type on a port of an RTZ configuration is the global type
+	CHECK(is_port(2, pixel::Type::WS2812B, 300, 3, pixel::Map::BGR));
+
+	for (uint32_t nPortIndex = 3; nPortIndex < PORTS; nPortIndex++) {
+		CHECK(is_port(nPortIndex, pixel::Type::WS2812B, 100, 3, pixel::Map::BGR));
+	}
+
+	// The frame is as long as the SK6812W port, in WS2812B pixels rounded up
+	CHECK(configuration.GetLedsMax() == 4 * pixel::max::ledcount::RGBW);
+	CHECK(configuration.GetCountMax() == 683);
+	CHECK(configuration.GetRefreshRate() == 1000000U / (10U * 4 * pixel::max::ledcount::RGBW));
+
+	CHECK(configuration.GetUniverses() == 4);
+	CHECK(configuration.GetPortInfo().nProtocolPortIndexLast == (4 * 4) - 1);
+	CHECK(configuration.GetGroups(0) == pixel::max::ledcount::RGBW);
+	CHECK(configuration.GetBeginIndex(0, 1) == 128);
+	CHECK(configuration.GetBeginIndex(0, 3) == 384);
+	CHECK(configuration.GetBeginIndex(2, 1) == 170);
+	CHECK(configuration.GetBeginIndex(2, 3) == 510);
+
+	// A WS2812B port longer than the SK6812W global count
+	reset();
+	configuration.SetType(pixel::Type::SK6812W);
+	configuration.SetCount(0, 680);
+	configuration.SetType(0, pixel::Type::WS2812B);
+	configuration.Validate(PORTS);
+
+	CHECK(is_port(0, pixel::Type::WS2812B, 680, 3, pixel::Map::GRB));
+	CHECK(is_port(1, pixel::Type::SK6812W, pixel::defaults::COUNT, 4, pixel::Map::GRB));
+	CHECK(configuration.GetLedsMax() == 3 * 680);
+	CHECK(configuration.GetCountMax() == (3 * 680) / 4);
+	CHECK(configuration.GetUniverses() == 4);
+	CHECK(configuration.GetBeginIndex(0, 1) == 170);
+	CHECK(configuration.GetBeginIndex(1, 1) == 128);
+
+	// The count is capped per type
+	reset();
+	configuration.SetCount(0, 1000);
+	configuration.SetCount(1, 600);
+	configuration.SetType(1, pixel::Type::SK6812W);
+	configuration.Validate(PORTS);
+
+	CHECK(is_port(0, pixel::Type::WS2812B, pixel::max::ledcount::RGB, 3, pixel::Map::GRB));
+	CHECK(is_port(1, pixel::Type::SK6812W, pixel::max::ledcount::RGBW, 4, pixel::Map::GRB));
+}
+
+void test_spi() {
+	auto& configuration = reset();
+
+	// The types per port are RTZ only
+	configuration.SetType(pixel::Type::APA102);
+	configuration.SetGlobalBrightness(0x10);
+	configuration.SetCount(0, 300);
+	configuration.SetType(0, pixel::Type::SK6812W);
+	configuration.SetType(1, pixel::Type::WS2812B);
+	configuration.Validate(PORTS);
+
+	CHECK(!configuration.IsRTZProtocol());
+	CHECK(configuration.GetType() == pixel::Type::APA102);
+	CHECK(configuration.GetGlobalBrightness() == 0xF0);
+
+	configuration.SetGlobalBrightness(0x20);
+	configuration.Validate(PORTS);
+
+	CHECK(configuration.GetGlobalBrightness() == 0xFF);
+	CHECK(is_port(0, pixel::Type::APA102, 300, 3, pixel::Map::RGB));
+	CHECK(is_port(1, pixel::Type::APA102, pixel::defaults::COUNT, 3, pixel::Map::RGB));
+	CHECK(configuration.GetClockSpeedHz() == pixel::spi::speed::ws2801::default_hz);
+
+	// 8 bits of 3 LEDs at 4 MHz
+	reset();
+	configuration.SetType(pixel::Type::WS2801);
+	configuration.Validate(PORTS);
+
+	CHECK(configuration.GetRefreshRate() == 1000000U / (2U * 3 * pixel::defaults::COUNT));
+
+	reset();
+	configuration.SetType(pixel::Type::SK9822);
+	configuration.Validate(PORTS);
+
+	CHECK(configuration.GetType() == pixel::Type::SK9822);
+	CHECK(is_port(0, pixel::Type::SK9822, pixel::defaults::COUNT, 3, pixel::Map::RGB));
+}
+
+void test_clock() {
+	auto& configuration = reset();
+
+	struct {
+		pixel::Type type;
+		uint32_t nClockSpeedHz;
+		pixel::Type typeExpected;
+		uint32_t nClockSpeedHzExpected;
+	} const tests[] = {
+			{ pixel::Type::WS2801, 0, pixel::Type::WS2801, pixel::spi::speed::ws2801::default_hz },
+			{ pixel::Type::WS2801, 10000000, pixel::Type::WS2801, 10000000 },
+			{ pixel::Type::WS2801, 30000000, pixel::Type::WS2801, pixel::spi::speed::ws2801::max_hz },
+			{ pixel::Type::APA102, 30000000, pixel::Type::APA102, pixel::spi::speed::ws2801::max_hz },
+			// The multi port outputs have no P9813, it is sent as WS2801 at the P9813 clock
+			{ pixel::Type::P9813, 0, pixel::Type::WS2801, pixel::spi::speed::p9813::default_hz },
+			{ pixel::Type::P9813, 20000000, pixel::Type::WS2801, pixel::spi::speed::p9813::max_hz },
+			{ pixel::Type::P9813, 10000000, pixel::Type::WS2801, 10000000 },
+			{ pixel::Type::WS2812B, 0, pixel::Type::WS2812B, 6400000 },
+			{ pixel::Type::SK6812W, 10000000, pixel::Type::SK6812W, 6400000 },
+			{ pixel::Type::UNDEFINED, 0, pixel::Type::WS2812B, 6400000 },
+	};
+
+	for (const auto& test : tests) {
+		reset();
+		configuration.SetType(test.type);
+		configuration.SetClockSpeedHz(test.nClockSpeedHz);
+		configuration.Validate(PORTS);
+
+		if (!CHECK((configuration.GetType() == test.typeExpected) && (configuration.GetClockSpeedHz() == test.nClockSpeedHzExpected))) {
+			printf("%s %u: %s %u\n", pixel::pixel_get_type(test.type), static_cast<unsigned int>(test.nClockSpeedHz), pixel::pixel_get_type(configuration.GetType()), static_cast<unsigned int>(configuration.GetClockSpeedHz()));
+		}
+	}
+
+	// The timing of the RTZ types
+	reset();
+	configuration.SetType(pixel::Type::UCS1903);
+	configuration.Validate(PORTS);
+
+	CHECK(configuration.GetMap() == pixel::Map::BRG);
+	CHECK((configuration.GetLowCode() == 0xC0) && (configuration.GetHighCode() == 0xFC));
+
+	reset();
+	configuration.SetLowCode(0xF0);
+	configuration.SetHighCode(0xC0);
+	configuration.Validate(PORTS);
+
+	CHECK((configuration.GetLowCode() == 0xC0) && (configuration.GetHighCode() == 0xF8));
+}
+
+void test_universes() {
+	auto& configuration = reset();
+
+	struct {
+		pixel::Type type;
+		uint32_t nCount;
+		uint32_t nGroupingCount;
+		uint32_t nUniverses;
+	} const tests[] = {
+			{ pixel::Type::WS2812B, 1, 1, 1 },
+			{ pixel::Type::WS2812B, 170, 1, 1 },
+			{ pixel::Type::WS2812B, 171, 1, 2 },
+			{ pixel::Type::WS2812B, 340, 1, 2 },
+			{ pixel::Type::WS2812B, 341, 1, 3 },
+			{ pixel::Type::WS2812B, 680, 1, 4 },
+			{ pixel::Type::WS2812B, 680, 2, 2 },
+			{ pixel::Type::WS2812B, 341, 2, 1 },
+			{ pixel::Type::WS2812B, 342, 2, 2 },
+			{ pixel::Type::WS2812B, 341, 3, 1 },
+			{ pixel::Type::WS2812B, 100, 200, 1 },
+			{ pixel::Type::SK6812W, 128, 1, 1 },
+			{ pixel::Type::SK6812W, 129, 1, 2 },
+			{ pixel::Type::SK6812W, 512, 1, 4 },
+			{ pixel::Type::WS2801, 341, 1, 3 },
+	};
+
+	for (const auto& test : tests) {
+		for (const uint32_t nOutputs : { 1U, 3U, PORTS }) {
+			reset();
+			configuration.SetType(test.type);
+			configuration.SetCount(test.nCount);
+			configuration.SetGroupingCount(static_cast<uint16_t>(test.nGroupingCount));
+			configuration.SetOutputPorts(static_cast<uint16_t>(nOutputs));
+			configuration.Validate(PORTS);
+
+			const auto nLast = configuration.GetPortInfo().nProtocolPortIndexLast;
+
+			if (!CHECK((configuration.GetUniverses() == test.nUniverses) && (nLast == (nOutputs * test.nUniverses) - 1))) {
+				printf("%s %u/%u x%u: %u universes, last %u\n", pixel::pixel_get_type(test.type), static_cast<unsigned int>(test.nCount), static_cast<unsigned int>(test.nGroupingCount),
+						static_cast<unsigned int>(nOutputs), static_cast<unsigned int>(configuration.GetUniverses()), static_cast<unsigned int>(nLast));
+			}
+		}
+	}
+
+	// Each output has the universes of the longest port
+	reset();
+	configuration.SetOutputPorts(2);
+	configuration.SetCount(1, 341);
+	configuration.Validate(PORTS);
+
+	CHECK(configuration.GetUniverses() == 3);
+	CHECK(configuration.GetPortInfo().nProtocolPortIndexLast == 5);
+
+	// A port that is not an output does not count
+	configuration.SetCount(2, 680);
+	configuration.Validate(PORTS);
+
+	CHECK(configuration.GetUniverses() == 3);
+
+	// The outputs are limited to the ports
+	reset();
+	configuration.SetOutputPorts(PORTS + 4);
+	configuration.Validate(PORTS);
+
+	CHECK(configuration.GetOutputPorts() == PORTS);
+	CHECK(configuration.GetPortInfo().nProtocolPortIndexLast == PORTS - 1);
+}
+}  // namespace
+
+int main() {
+	PixelDmxConfiguration pixelDmxConfiguration;
+	s_pConfiguration = &pixelDmxConfiguration;
+
+	test_ports();
+	test_spi();
+	test_clock();
+	test_universes();
+
+	return test::result();
+}
@@ -0,0 +1,244 @@
+/**
+ * @file test_pixeldmxinterpolator.cpp
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * The interpolation kernel is checked against a floating point reference,
+ * rounded half up: the endpoints, all the 256x256 byte pairs for a few
+ * weights, unaligned buffers, the tail lengths and in place.
+ * On Arm the NEON loop is checked, otherwise the SWAR loop.
+ * The benchmark is a refresh frame of 32 universes: the cost of the kernel
+ * next to the cost of SetData, which converts the universes to the pixels.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+
+#include "pixeldmxinterpolator.h"
+#include "ws28xxdmxmulti.h"
+#include "pixeldmxconfiguration.h"
+
+#include "test.h"
+
+namespace {
+static constexpr uint32_t PAIRS = 256 * 256;
+static constexpr uint32_t UNIVERSES = 32;
+static constexpr uint32_t RUNS = 1000;
+
+uint8_t s_From[PAIRS + 8];
+uint8_t s_To[PAIRS + 8];
+uint8_t s_Out[PAIRS + 8];
+
+uint8_t s_Universe[2][UNIVERSES][lightset::dmx::UNIVERSE_SIZE];
+uint8_t s_Frame[UNIVERSES][lightset::dmx::UNIVERSE_SIZE];
+
+uint64_t s_nSeed = 7;
+
+uint64_t random() {
+	s_nSeed ^= s_nSeed << 13;	// xorshift64
+	s_nSeed ^= s_nSeed >> 7;
+	s_nSeed ^= s_nSeed << 17;
+	return s_nSeed;
+}
+
+uint8_t reference(const uint8_t nFrom, const uint8_t nTo, const uint32_t nAlpha) {
+	const auto nAlphaClamped = nAlpha > pixeldmx::interpolator::ALPHA_ONE ? pixeldmx::interpolator::ALPHA_ONE : nAlpha;
+	return static_cast<uint8_t>(floor(nFrom + (nTo - nFrom) * (nAlphaClamped / 256.0) + 0.5));
+}
+
+uint32_t check(const uint8_t *pOut, const uint8_t *pFrom, const uint8_t *pTo, const uint32_t nLength, const uint32_t nAlpha) {
+	uint32_t nErrors = 0;
+
+	for (uint32_t i = 0; i < nLength; i++) {
+		const auto nExpected = reference(pFrom[i], pTo[i], nAlpha);
+
+		if (pOut[i] != nExpected) {
+			if (nErrors++ == 0) {
+				printf("alpha=%u from=%u to=%u: %u, expected %u\n", static_cast<unsigned int>(nAlpha), pFrom[i], pTo[i], pOut[i], nExpected);
+			}
+		}
+	}
+
+	return nErrors;
+}
+
+void test_endpoints() {
+	for (uint32_t i = 0; i < lightset::dmx::UNIVERSE_SIZE; i++) {
+		s_From[i] = static_cast<uint8_t>(random());
+		s_To[i] = static_cast<uint8_t>(random());
+	}
+
+	pixeldmx::interpolator::lerp(s_Out, s_From, s_To, lightset::dmx::UNIVERSE_SIZE, 0);
+	CHECK(memcmp(s_Out, s_From, lightset::dmx::UNIVERSE_SIZE) == 0);
+
+	pixeldmx::interpolator::lerp(s_Out, s_From, s_To, lightset::dmx::UNIVERSE_SIZE, pixeldmx::interpolator::ALPHA_ONE);
+	CHECK(memcmp(s_Out, s_To, lightset::dmx::UNIVERSE_SIZE) == 0);
+
+	pixeldmx::interpolator::lerp(s_Out, s_From, s_To, lightset::dmx::UNIVERSE_SIZE, 1000);
+	CHECK(memcmp(s_Out, s_To, lightset::dmx::UNIVERSE_SIZE) == 0);
+
+	// Equal endpoints stay put for every weight
+	for (uint32_t nAlpha = 0; nAlpha <= pixeldmx::interpolator::ALPHA_ONE; nAlpha++) {
+		pixeldmx::interpolator::lerp(s_Out, s_From, s_From, lightset::dmx::UNIVERSE_SIZE, nAlpha);
+		CHECK(memcmp(s_Out, s_From, lightset::dmx::UNIVERSE_SIZE) == 0);
+	}
+}
+
+void test_rounding() {
+	const uint8_t from[] = { 0, 255, 0, 1, 0, 255, 100 };
+	const uint8_t to[]   = { 255, 0, 1, 0, 255, 254, 101 };
+	const uint8_t half[] = { 128, 128, 1, 1, 128, 255, 101 };	// Half up
+	uint8_t out[sizeof(from)];
+
+	pixeldmx::interpolator::lerp(out, from, to, sizeof(from), 128);
+	CHECK(memcmp(out, half, sizeof(half)) == 0);
+
+	// The smallest step is not lost
+	const uint8_t first[] = { 1, 254, 0, 1, 1, 255, 100 };
+
+	pixeldmx::interpolator::lerp(out, from, to, sizeof(from), 1);
+	CHECK(memcmp(out, first, sizeof(first)) == 0);
+
+	const uint8_t last[] = { 254, 1, 1, 0, 254, 254, 101 };
+
+	pixeldmx::interpolator::lerp(out, from, to, sizeof(from), 255);
+	CHECK(memcmp(out, last, sizeof(last)) == 0);
+}
+
+void test_pairs() {
+	for (uint32_t i = 0; i < PAIRS; i++) {
+		s_From[i] = static_cast<uint8_t>(i);
+		s_To[i] = static_cast<uint8_t>(i >> 8);
+	}
+
+	for (const uint32_t nAlpha : { 1U, 2U, 64U, 127U, 128U, 129U, 192U, 254U, 255U }) {
+		pixeldmx::interpolator::lerp(s_Out, s_From, s_To, PAIRS, nAlpha);
+		CHECK(check(s_Out, s_From, s_To, PAIRS, nAlpha) == 0);
+	}
+}
+
+void test_alignment() {
+	for (auto& data : s_From) {
+		data = static_cast<uint8_t>(random());
+	}
+
+	for (auto& data : s_To) {
+		data = static_cast<uint8_t>(random());
+	}
+
+	uint32_t nErrors = 0;
+
+	for (uint32_t nOffset = 0; nOffset < 4; nOffset++) {
+		for (uint32_t nLength = 0; nLength <= 40; nLength++) {
+			const auto nAlpha = 1 + static_cast<uint32_t>(random() % 255);
+
+			// The bytes after nLength are not written
+			memset(s_Out, 0xA5, sizeof(s_Out));
+			pixeldmx::interpolator::lerp(&s_Out[nOffset], &s_From[3 - nOffset], &s_To[nOffset], nLength, nAlpha);
+
+			nErrors += check(&s_Out[nOffset], &s_From[3 - nOffset], &s_To[nOffset], nLength, nAlpha);
+
+			if (s_Out[nOffset + nLength] != 0xA5) {
+				nErrors++;
+			}
+		}
+	}
+
+	CHECK(nErrors == 0);
+
+	// In place, as PixelDmxInterpolator::Input does
+	uint8_t from[lightset::dmx::UNIVERSE_SIZE];
+	memcpy(from, s_From, sizeof(from));
+
+	pixeldmx::interpolator::lerp(s_From, s_From, s_To, sizeof(from), 77);
+	CHECK(check(s_From, from, s_To, sizeof(from), 77) == 0);
+}
+
+void fill_universes() {
+	for (auto& universe : s_Universe) {
+		for (auto& port : universe) {
+			for (auto& data : port) {
+				data = static_cast<uint8_t>(random());
+			}
+		}
+	}
+}
+
+void benchmark(const char *pName, const pixel::Type type, const uint32_t nCount) {
+	auto& pixelDmxConfiguration = PixelDmxConfiguration::Get();
+
+	pixelDmxConfiguration.SetType(type);
+	pixelDmxConfiguration.SetCount(nCount);
+	pixelDmxConfiguration.SetOutputPorts(ws28xxdmxmulti::MAX_PORTS);
+
+	WS28xxDmxMulti pixelDmxMulti;
+
+	const auto nUniverses = pixelDmxConfiguration.GetPortInfo().nProtocolPortIndexLast + 1U;
+	const auto nLength = pixelDmxConfiguration.GetLedsPerPixel() == 4 ? 512U : 510U;
+
+	CHECK(nUniverses == UNIVERSES);
+
+	auto nStart = test::nanos();
+
+	for (uint32_t n = 0; n < RUNS; n++) {
+		for (uint32_t i = 0; i < nUniverses; i++) {
+			pixeldmx::interpolator::lerp(s_Frame[i], s_Universe[0][i], s_Universe[1][i], nLength, 1 + (n & 0xFF));
+		}
+		__asm__ volatile("" : : "r"(s_Frame) : "memory");
+	}
+
+	const auto nKernel = test::nanos() - nStart;
+
+	nStart = test::nanos();
+
+	for (uint32_t n = 0; n < RUNS; n++) {
+		for (uint32_t i = 0; i < nUniverses; i++) {
+			pixelDmxMulti.SetData(i, s_Frame[i], nLength, false);
+		}
+		__asm__ volatile("" : : "r"(test::g_Lanes) : "memory");
+	}
+
+	const auto nSetData = test::nanos() - nStart;
+
+	printf("%s: %.1f us kernel, %.1f us SetData per frame of %u universes\n", pName, static_cast<double>(nKernel) / RUNS / 1e3, static_cast<double>(nSetData) / RUNS / 1e3, static_cast<unsigned int>(nUniverses));
+}
+}  // namespace
+
+int main() {
+	test_endpoints();
+	test_rounding();
+	test_pairs();
+	test_alignment();
+
+	fill_universes();
+
+	PixelDmxConfiguration pixelDmxConfiguration;
+
+	benchmark("WS2812B", pixel::Type::WS2812B, 680);
+	benchmark("SK6812W", pixel::Type::SK6812W, 512);
+
+	return test::result();
+}
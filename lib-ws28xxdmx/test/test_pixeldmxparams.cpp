@@ -0,0 +1,170 @@
+/**
+ * @file test_pixeldmxparams.cpp
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * The type per port is stored as a nibble, type + 1 with 0 for the global
+ * type. Every type on every port is loaded from the properties, copied from
+ * the store and checked, as is the round trip through Save() and Load().
+ * Set() is followed by the validation of the configuration.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include "pixeldmxparams.h"
+#include "pixeldmxconfiguration.h"
+#include "pixeltype.h"
+
+#include "test.h"
+
+namespace {
+static constexpr uint32_t PORTS = pixeldmxparams::PIXEL_PORTS;
+static constexpr uint32_t TYPES = 1 + static_cast<uint32_t>(pixel::Type::UNDEFINED);
+
+static_assert(PORTS == 8, "The nibbles of all the ports");
+static_assert(TYPES <= 16, "type + 1 fits a nibble");
+
+char s_Buffer[4096];
+
+uint32_t properties(const pixel::Type *pTypes) {
+	uint32_t nLength = 0;
+
+	for (uint32_t nPortIndex = 0; nPortIndex < PORTS; nPortIndex++) {
+		nLength += static_cast<uint32_t>(snprintf(&s_Buffer[nLength], sizeof(s_Buffer) - nLength, "led_type_port_%u=%s\n", static_cast<unsigned int>(1 + nPortIndex), pixel::pixel_get_type(pTypes[nPortIndex])));
+	}
+
+	return nLength;
+}
+
+void test_nibbles() {
+	PixelDmxParams pixelDmxParams;
+	uint32_t nErrors = 0;
+
+	// The nibbles are overwritten with each load
+	for (uint32_t nOffset = 0; nOffset < TYPES; nOffset++) {
+		pixel::Type types[PORTS];
+
+		// The neighbour nibble has another type, UNDEFINED included
+		for (uint32_t nPortIndex = 0; nPortIndex < PORTS; nPortIndex++) {
+			types[nPortIndex] = static_cast<pixel::Type>((nOffset + 7 * nPortIndex) % TYPES);
+		}
+
+		pixelDmxParams.Load(s_Buffer, properties(types));
+
+		PixelDmxParams stored;
+		stored.Load();
+
+		for (uint32_t nPortIndex = 0; nPortIndex < PORTS; nPortIndex++) {
+			if ((pixelDmxParams.GetTypePort(nPortIndex) != types[nPortIndex]) || (stored.GetTypePort(nPortIndex) != types[nPortIndex])) {
+				if (nErrors++ == 0) {
+					printf("Port %u: %s, stored %s, expected %s\n", static_cast<unsigned int>(nPortIndex), pixel::pixel_get_type(pixelDmxParams.GetTypePort(nPortIndex)),
+							pixel::pixel_get_type(stored.GetTypePort(nPortIndex)), pixel::pixel_get_type(types[nPortIndex]));
+				}
+			}
+		}
+	}
+
+	CHECK(nErrors == 0);
+
+	// A type that is not known is the global type
+	const char properties[] = "led_type_port_1=WS2801\nled_type_port_2=SK6812W\nled_type_port_2=Foo\n";
+
+	PixelDmxParams unknown;
+	unknown.Load(properties, sizeof(properties) - 1);
+
+	CHECK(unknown.GetTypePort(0) == pixel::Type::WS2801);
+	CHECK(unknown.GetTypePort(1) == pixel::Type::UNDEFINED);
+	CHECK(unknown.GetTypePort(2) == pixel::Type::UNDEFINED);
+}
+
+const char MIXED[] =
+		"led_type=WS2812B\n"
+		"led_count=100\n"
+		"active_out=4\n"
+		"led_count_port_1=680\n"
+		"led_type_port_1=SK6812W\n"
+		"led_count_port_3=300\n"
+		"led_type_port_3=APA102\n"
+		"led_type_port_8=P9813\n";
+
+void test_save() {
+	PixelDmxParams pixelDmxParams;
+	pixelDmxParams.Load(MIXED, sizeof(MIXED) - 1);
+
+	uint8_t store[sizeof(test::g_Store)];
+	memcpy(store, test::g_Store, sizeof(store));
+
+	uint32_t nSize;
+	pixelDmxParams.Save(s_Buffer, sizeof(s_Buffer), nSize);
+	s_Buffer[nSize] = '\0';
+
+	CHECK(strstr(s_Buffer, "\nled_type_port_1=SK6812W\n") != nullptr);
+	CHECK(strstr(s_Buffer, "\n#led_type_port_2=WS2812B\n") != nullptr);
+	CHECK(strstr(s_Buffer, "\nled_type_port_3=APA102\n") != nullptr);
+	CHECK(strstr(s_Buffer, "\nled_type_port_8=P9813\n") != nullptr);
+	CHECK(strstr(s_Buffer, "\nled_count_port_1=680\n") != nullptr);
+	CHECK(strstr(s_Buffer, "\n#led_count_port_2=100\n") != nullptr);
+
+	memset(test::g_Store, 0, sizeof(test::g_Store));
+
+	PixelDmxParams saved;
+	saved.Load(s_Buffer, nSize);
+
+	CHECK(memcmp(store, test::g_Store, sizeof(pixeldmxparams::Params)) == 0);
+}
+
+void test_set() {
+	auto& pixelDmxConfiguration = PixelDmxConfiguration::Get();
+
+	PixelDmxParams pixelDmxParams;
+	pixelDmxParams.Load(MIXED, sizeof(MIXED) - 1);
+	pixelDmxParams.Set();
+
+	pixelDmxConfiguration.Validate(pixeldmxparams::MAX_PORTS);
+
+	CHECK(pixelDmxConfiguration.GetOutputPorts() == 4);
+	CHECK(pixelDmxConfiguration.GetType(0) == pixel::Type::SK6812W);
+	CHECK(pixelDmxConfiguration.GetCount(0) == pixel::max::ledcount::RGBW);
+	CHECK(pixelDmxConfiguration.GetType(1) == pixel::Type::WS2812B);
+	CHECK(pixelDmxConfiguration.GetCount(1) == 100);
+	// An SPI type on a port of an RTZ configuration is the global type
+	CHECK(pixelDmxConfiguration.GetType(2) == pixel::Type::WS2812B);
+	CHECK(pixelDmxConfiguration.GetCount(2) == 300);
+	CHECK(pixelDmxConfiguration.GetType(7) == pixel::Type::WS2812B);
+	CHECK(pixelDmxConfiguration.GetUniverses() == 4);
+	CHECK(pixelDmxConfiguration.GetPortInfo().nProtocolPortIndexLast == 15);
+}
+}  // namespace
+
+int main() {
+	PixelDmxConfiguration pixelDmxConfiguration;
+
+	test_nibbles();
+	test_save();
+	test_set();
+
+	return test::result();
+}
@@ -0,0 +1,369 @@
+/**
+ * @file test_ws28xxdmxmulti.cpp
+ *
+ */
+/* Copyright (C) 2025 by Arjan van Vught mailto:info@gd32-dmx.org
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+/*
+ * The descriptors and kernels of WS28xxDmxMulti are checked against a
+ * reference that converts the universes to the bytes on the wire, for
+ * type x map x grouping x count x universe length, and for the count and
+ * type per port. The universes after nProtocolPortIndexLast and after the
+ * last group of a port are not written. The WS28xxMulti stub records the
+ * bytes of each port and the setter used.
+ * The P9813 flag byte is checked against the colour bytes on the wire.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include "ws28xxdmxmulti.h"
+#include "pixeldmxconfiguration.h"
+#include "pixeltype.h"
+#include "lightsetdata.h"
+
+#include "test.h"
+
+namespace {
+static constexpr uint32_t PORTS = ws28xxdmxmulti::MAX_PORTS;
+static constexpr uint32_t UNIVERSES = ws28xxdmxmulti::MAX_UNIVERSES;
+static constexpr uint8_t BRIGHTNESS = 0x05;
+static constexpr uint8_t FILL = 0xA5;
+
+uint8_t s_Data[UNIVERSES][lightset::dmx::UNIVERSE_SIZE];
+uint8_t s_Lanes[PORTS][test::LANE_SIZE];
+test::Setter s_Setter[PORTS];
+
+uint64_t s_nSeed = 7;
+
+uint64_t random() {
+	s_nSeed ^= s_nSeed << 13;	// xorshift64
+	s_nSeed ^= s_nSeed >> 7;
+	s_nSeed ^= s_nSeed << 17;
+	return s_nSeed;
+}
+
+void fill_data() {
+	for (auto& universe : s_Data) {
+		for (auto& data : universe) {
+			data = static_cast<uint8_t>(random());
+		}
+	}
+}
+
+/*
+ * The slot of each colour byte on the wire, as the single port WS28xxDmx
+ */
+constexpr uint32_t CHANNELS[6][3] = {
+		{ 0, 1, 2 },	// RGB
+		{ 0, 2, 1 },	// RBG
+		{ 1, 0, 2 },	// GRB
+		{ 2, 0, 1 },	// GBR
+		{ 1, 2, 0 },	// BRG
+		{ 2, 1, 0 }		// BGR
+};
+
+/*
+ * The universe as the pixels on the wire, from the configuration only
+ */
+void reference(const uint32_t nUniverse, const uint8_t *pData, const uint32_t nLength) {
+	auto& configuration = PixelDmxConfiguration::Get();
+
+	if (nUniverse > configuration.GetPortInfo().nProtocolPortIndexLast) {
+		return;
+	}
+
+	const auto nPortIndex = nUniverse / configuration.GetUniverses();
+	const auto nSwitch = nUniverse % configuration.GetUniverses();
+	const auto type = configuration.GetType(nPortIndex);
+	const auto nLedsPerPixel = configuration.GetLedsPerPixel(nPortIndex);
+	const auto nGroupsPerUniverse = (nLedsPerPixel == 4) ? 128U : 170U;
+	const auto nGroupingCount = configuration.GetGroupingCount();
+	const auto nGroups = configuration.GetCount(nPortIndex) / nGroupingCount;
+	const auto& map = CHANNELS[static_cast<uint32_t>(configuration.GetMap(nPortIndex))];
+
+	for (uint32_t j = 0; (j < nGroupsPerUniverse) && ((nSwitch * nGroupsPerUniverse + j) < nGroups) && ((j + 1) * nLedsPerPixel <= nLength); j++) {
+		const auto *p = &pData[j * nLedsPerPixel];
+		uint8_t colour[3];
+
+		for (uint32_t i = 0; i < 3; i++) {
+			colour[i] = p[map[i]];
+		}
+
+		for (uint32_t k = 0; k < nGroupingCount; k++) {
+			const auto nPixelIndex = (nSwitch * nGroupsPerUniverse + j) * nGroupingCount + k;
+			auto *pLane = s_Lanes[nPortIndex];
+
+			if (nLedsPerPixel == 4) {
+				// GRBW
+				const uint8_t pixel[] = { p[1], p[0], p[2], p[3] };
+				memcpy(&pLane[nPixelIndex * 4], pixel, 4);
+				s_Setter[nPortIndex] = test::Setter::RTZ_RGBW;
+			} else if ((type == pixel::Type::APA102) || (type == pixel::Type::SK9822)) {
+				// Start frame, the colours in reverse
+				const uint8_t pixel[] = { static_cast<uint8_t>(0xE0 | BRIGHTNESS), colour[2], colour[1], colour[0] };
+				memcpy(&pLane[(1 + nPixelIndex) * 4], pixel, 4);
+				s_Setter[nPortIndex] = test::Setter::BYTES4;
+			} else {
+				memcpy(&pLane[nPixelIndex * 3], colour, 3);
+				s_Setter[nPortIndex] = (type == pixel::Type::WS2801) ? test::Setter::WS2801 : test::Setter::RTZ;
+			}
+		}
+	}
+}
+
+void clear() {
+	memset(test::g_Lanes, FILL, sizeof(test::g_Lanes));
+	memset(s_Lanes, FILL, sizeof(s_Lanes));
+
+	for (uint32_t nPortIndex = 0; nPortIndex < PORTS; nPortIndex++) {
+		test::g_Setter[nPortIndex] = test::Setter::NONE;
+		s_Setter[nPortIndex] = test::Setter::NONE;
+	}
+}
+
+bool is_equal(const char *pName) {
+	for (uint32_t nPortIndex = 0; nPortIndex < PORTS; nPortIndex++) {
+		if ((memcmp(test::g_Lanes[nPortIndex], s_Lanes[nPortIndex], test::LANE_SIZE) != 0) || (test::g_Setter[nPortIndex] != s_Setter[nPortIndex])) {
+			uint32_t i = 0;
+			while ((i < test::LANE_SIZE) && (test::g_Lanes[nPortIndex][i] == s_Lanes[nPortIndex][i])) {
+				i++;
+			}
+
+			printf("%s: port %u, byte %u: 0x%.2X expected 0x%.2X, setter %d expected %d\n", pName, static_cast<unsigned int>(nPortIndex), static_cast<unsigned int>(i),
+					i < test::LANE_SIZE ? test::g_Lanes[nPortIndex][i] : 0, i < test::LANE_SIZE ? s_Lanes[nPortIndex][i] : 0,
+					static_cast<int>(test::g_Setter[nPortIndex]), static_cast<int>(s_Setter[nPortIndex]));
+			return false;
+		}
+	}
+
+	return true;
+}
+
+struct Config {
+	pixel::Type type;
+	pixel::Map map;
+	uint32_t nCount;
+	uint32_t nGroupingCount;
+	uint32_t nOutputs;
+	uint32_t nCountPort[PORTS];		///< 0 is the global count
+	pixel::Type typePort[PORTS];	///< WS2801, the zero value, is the global type
+};
+
+void configure(const Config& config) {
+	auto& configuration = PixelDmxConfiguration::Get();
+
+	configuration.SetType(config.type);
+	configuration.SetMap(config.map);
+	configuration.SetCount(config.nCount);
+	configuration.SetClockSpeedHz(0);
+	configuration.SetGlobalBrightness(BRIGHTNESS);
+	configuration.SetGroupingCount(static_cast<uint16_t>(config.nGroupingCount));
+	configuration.SetOutputPorts(static_cast<uint16_t>(config.nOutputs));
+
+	for (uint32_t nPortIndex = 0; nPortIndex < PORTS; nPortIndex++) {
+		configuration.SetCount(nPortIndex, config.nCountPort[nPortIndex]);
+		configuration.SetType(nPortIndex, config.typePort[nPortIndex] == pixel::Type::WS2801 ? pixel::Type::UNDEFINED : config.typePort[nPortIndex]);
+	}
+}
+
+/*
+ * All the universes with the same length, then the replay of the backup
+ * by the last universe with doUpdate
+ */
+uint32_t check(const Config& config, const char *pName) {
+	configure(config);
+
+	WS28xxDmxMulti pixelDmxMulti;
+
+	const auto nLast = PixelDmxConfiguration::Get().GetPortInfo().nProtocolPortIndexLast;
+	uint32_t nErrors = 0;
+
+	for (const uint32_t nLength : { 512U, 510U, 100U, 4U, 3U, 0U }) {
+		clear();
+
+		for (uint32_t nUniverse = 0; nUniverse < UNIVERSES; nUniverse++) {
+			pixelDmxMulti.SetData(nUniverse, s_Data[nUniverse], nLength, false);
+			reference(nUniverse, s_Data[nUniverse], nLength);
+		}
+
+		if (!is_equal(pName)) {
+			nErrors++;
+			break;
+		}
+	}
+
+	clear();
+
+	for (uint32_t nUniverse = 0; nUniverse <= nLast; nUniverse++) {
+		lightset::Data::SetSourceA(nUniverse, s_Data[nUniverse], 510);
+		reference(nUniverse, s_Data[nUniverse], 510);
+	}
+
+	const auto nUpdates = test::g_nUpdates;
+
+	if (nLast != 0) {
+		pixelDmxMulti.SetData(0, s_Data[0], 510, true);
+		nErrors += (test::g_nUpdates != nUpdates) ? 1 : 0;
+	}
+
+	pixelDmxMulti.SetData(nLast, s_Data[nLast], 510, true);
+	nErrors += (test::g_nUpdates != (nUpdates + 1)) ? 1 : 0;
+
+	if (!is_equal(pName)) {
+		nErrors++;
+	}
+
+	return nErrors;
+}
+
+void test_types() {
+	static constexpr pixel::Type TYPES[] = { pixel::Type::WS2812B, pixel::Type::SK6812W, pixel::Type::UCS1903, pixel::Type::WS2801, pixel::Type::APA102, pixel::Type::SK9822 };
+	uint32_t nErrors = 0;
+	uint32_t nConfigs = 0;
+
+	for (const auto type : TYPES) {
+		for (uint32_t nMap = 0; nMap <= static_cast<uint32_t>(pixel::Map::UNDEFINED); nMap++) {
+			for (const uint32_t nGroupingCount : { 1U, 3U }) {
+				for (const uint32_t nCount : { 1U, 170U, 341U, 680U }) {
+					for (const uint32_t nOutputs : { 1U, 3U, PORTS }) {
+						const Config config = { type, static_cast<pixel::Map>(nMap), nCount, nGroupingCount, nOutputs, {}, {} };
+						char name[64];
+						snprintf(name, sizeof(name), "%s %s %u/%u x%u", pixel::pixel_get_type(type), pixel::pixel_get_map(static_cast<pixel::Map>(nMap)),
+								static_cast<unsigned int>(nCount), static_cast<unsigned int>(nGroupingCount), static_cast<unsigned int>(nOutputs));
+						nErrors += check(config, name);
+						nConfigs++;
+					}
+				}
+			}
+		}
+	}
+
+	printf("%u configurations\n", static_cast<unsigned int>(nConfigs));
+	CHECK(nErrors == 0);
+}
+
+void test_ports() {
+	using pixel::Type;
+	constexpr auto GLOBAL = Type::WS2801;
+
+	const Config configs[] = {
+			{ Type::WS2812B, pixel::Map::BGR, 100, 1, PORTS, { 680, 0, 300, 0, 512, 0, 171, 1 }, { Type::SK6812W, GLOBAL, Type::APA102, GLOBAL, Type::SK6812W, GLOBAL, Type::UCS1903, GLOBAL } },
+			{ Type::WS2812B, pixel::Map::BGR, 100, 1, 3, { 680, 0, 300, 0, 512, 0, 171, 1 }, { Type::SK6812W, GLOBAL, Type::APA102, GLOBAL, Type::SK6812W, GLOBAL, Type::UCS1903, GLOBAL } },
+			{ Type::SK6812W, pixel::Map::UNDEFINED, 170, 2, PORTS, { 0, 680, 0, 129, 0, 0, 0, 0 }, { GLOBAL, Type::WS2812B, GLOBAL, GLOBAL, Type::CS8812, GLOBAL, GLOBAL, GLOBAL } },
+			{ Type::APA102, pixel::Map::GRB, 170, 1, PORTS, { 680, 0, 0, 0, 0, 0, 0, 20 }, { Type::SK6812W, GLOBAL, GLOBAL, GLOBAL, GLOBAL, GLOBAL, GLOBAL, GLOBAL } },
+	};
+
+	uint32_t nErrors = 0;
+
+	for (const auto& config : configs) {
+		nErrors += check(config, "Ports");
+	}
+
+	CHECK(nErrors == 0);
+
+	// A short port has no pixels in the second universe, a long port has
+	configure(configs[0]);
+	WS28xxDmxMulti pixelDmxMulti;
+
+	auto& configuration = PixelDmxConfiguration::Get();
+	const auto nUniverses = configuration.GetUniverses();
+
+	CHECK(nUniverses == 4);
+	CHECK(configuration.GetPortInfo().nProtocolPortIndexLast == (PORTS * 4) - 1);
+
+	clear();
+	pixelDmxMulti.SetData(1 * nUniverses + 1, s_Data[0], 510, false);
+	CHECK(test::g_Setter[1] == test::Setter::NONE);
+
+	pixelDmxMulti.SetData(0 * nUniverses + 3, s_Data[0], 512, false);
+	CHECK(test::g_Setter[0] == test::Setter::RTZ_RGBW);
+	CHECK(memcmp(&test::g_Lanes[0][384 * 4], s_Data[0] + 1, 1) == 0);
+
+	pixelDmxMulti.SetData(7 * nUniverses + 0, s_Data[0], 510, false);
+	CHECK(test::g_Setter[7] == test::Setter::RTZ);
+	CHECK(test::g_Lanes[7][3] == FILL);
+}
+
+void test_p9813() {
+	// The P9813 is sent as WS2801 by the multi port outputs, the kernel is called directly
+	WS28xxMulti output;
+	ws28xxdmxmulti::Descriptor descriptor;
+	memset(&descriptor, 0, sizeof(descriptor));
+	descriptor.nGroups = 170;
+	descriptor.nGroupingCount = 1;
+
+	for (uint32_t nMap = 0; nMap < static_cast<uint32_t>(pixel::Map::UNDEFINED); nMap++) {
+		uint8_t data[3 * 64];
+
+		// All the combinations of the 2 upper bits
+		for (uint32_t i = 0; i < 64; i++) {
+			data[3 * i + 0] = static_cast<uint8_t>(((i >> 4) << 6) | (random() & 0x3F));
+			data[3 * i + 1] = static_cast<uint8_t>((((i >> 2) & 0x3) << 6) | (random() & 0x3F));
+			data[3 * i + 2] = static_cast<uint8_t>(((i & 0x3) << 6) | (random() & 0x3F));
+		}
+
+		clear();
+
+		const ws28xxdmxmulti::Kernel kernels[] = {
+				&ws28xxdmxmulti::kernel::pixels3<ws28xxdmxmulti::Protocol::P9813, 0, false>,
+				&ws28xxdmxmulti::kernel::pixels3<ws28xxdmxmulti::Protocol::P9813, 1, false>,
+				&ws28xxdmxmulti::kernel::pixels3<ws28xxdmxmulti::Protocol::P9813, 2, false>,
+				&ws28xxdmxmulti::kernel::pixels3<ws28xxdmxmulti::Protocol::P9813, 3, false>,
+				&ws28xxdmxmulti::kernel::pixels3<ws28xxdmxmulti::Protocol::P9813, 4, false>,
+				&ws28xxdmxmulti::kernel::pixels3<ws28xxdmxmulti::Protocol::P9813, 5, false>
+		};
+
+		kernels[nMap](&output, descriptor, data, sizeof(data));
+
+		uint32_t nErrors = 0;
+
+		for (uint32_t i = 0; i < 64; i++) {
+			const auto *pPixel = &test::g_Lanes[0][(1 + i) * 4];
+			// 1 1 ~B7 ~B6 ~G7 ~G6 ~R7 ~R6, with the colours in the order sent: B G R
+			const auto nFlag = static_cast<uint8_t>(0xC0 | ((~pPixel[1] >> 6) & 0x3) << 4 | ((~pPixel[2] >> 6) & 0x3) << 2 | ((~pPixel[3] >> 6) & 0x3));
+			const auto *pMap = ws28xxdmxmulti::MAP[nMap];
+
+			if ((pPixel[0] != nFlag) || (pPixel[3] != data[3 * i + pMap[0]]) || (pPixel[2] != data[3 * i + pMap[1]]) || (pPixel[1] != data[3 * i + pMap[2]])) {
+				if (nErrors++ == 0) {
+					printf("P9813 %s %u: %.2X %.2X %.2X %.2X, flag expected %.2X\n", pixel::pixel_get_map(static_cast<pixel::Map>(nMap)), static_cast<unsigned int>(i), pPixel[0], pPixel[1], pPixel[2], pPixel[3], nFlag);
+				}
+			}
+		}
+
+		CHECK(nErrors == 0);
+	}
+}
+}  // namespace
+
+int main() {
+	PixelDmxConfiguration pixelDmxConfiguration;
+
+	fill_data();
+
+	test_types();
+	test_ports();
+	test_p9813();
+
+	return test::result();
+}
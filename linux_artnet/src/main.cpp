@@ -50,6 +50,7 @@
 #include "dmxmonitorparams.h"
 
 #include "configstore.h"
+#include "flashcodeinstall.h"
 
 #include "remoteconfig.h"
 #include "remoteconfigparams.h"
@@ -59,6 +60,10 @@
 # include "showfileparams.h"
 #endif
 
+#if defined (CONFIG_SHOWFILE_ENABLE_TIMECODE)
+# include "ltc.h"
+#endif
+
 #include "firmwareversion.h"
 #include "software_version.h"
 
@@ -76,6 +81,12 @@ void intHandler(int) {
     keepRunning = false;
 }
 
+#if defined (CONFIG_SHOWFILE_ENABLE_TIMECODE)
+static void timecode_handler(const struct artnet::TimeCode *pTimeCode) {
+	ShowFile::Get()->SetTimeCode(reinterpret_cast<const struct ltc::TimeCode *>(pTimeCode));
+}
+#endif
+
 int main(int argc, char **argv) {
     struct sigaction act;
     act.sa_handler = intHandler;
@@ -83,6 +94,7 @@ int main(int argc, char **argv) {
 	Hardware hw;
 	Display display;
 	ConfigStore configStore;
+	FlashCodeInstall spiFlashInstall;
 	Network nw(argc, argv);
 	FirmwareVersion fw(SOFTWARE_VERSION, __DATE__, __TIME__);
 
@@ -158,6 +170,10 @@ int main(int argc, char **argv) {
 		showFile.Play();
 	}
 
+#if defined (CONFIG_SHOWFILE_ENABLE_TIMECODE)
+	node.SetArtTimeCodeCallbackFunction(timecode_handler);
+#endif
+
 	showFile.Print();
 #endif
 
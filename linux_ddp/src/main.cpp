@@ -53,6 +53,7 @@
 #include "remoteconfigparams.h"
 
 #include "configstore.h"
+#include "flashcodeinstall.h"
 
 #include "firmwareversion.h"
 #include "software_version.h"
@@ -70,6 +71,7 @@ int main(int argc, char **argv) {
 	Hardware hw;
 	Display display;
 	ConfigStore configStore;
+	FlashCodeInstall spiFlashInstall;
 	Network nw(argc, argv);
 	FirmwareVersion fw(SOFTWARE_VERSION, __DATE__, __TIME__);
 
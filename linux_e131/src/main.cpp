@@ -50,6 +50,7 @@
 #include "factorydefaults.h"
 
 #include "configstore.h"
+#include "flashcodeinstall.h"
 
 #include "remoteconfig.h"
 #include "remoteconfigparams.h"
@@ -90,6 +91,7 @@ int main(int argc, char **argv) {
 	Hardware hw;
 	Display display;
 	ConfigStore configStore;
+	FlashCodeInstall spiFlashInstall;
 	Network nw(argc, argv);
 	FirmwareVersion fw(SOFTWARE_VERSION, __DATE__, __TIME__, DEVICE_SOFTWARE_VERSION_ID);
 
@@ -55,6 +55,7 @@
 #include "remoteconfigparams.h"
 
 #include "configstore.h"
+#include "flashcodeinstall.h"
 
 #include "firmwareversion.h"
 #include "software_version.h"
@@ -72,6 +73,7 @@ int main(int argc, char **argv) {
 	Hardware hw;
 	Display display;
 	ConfigStore configStore;
+	FlashCodeInstall spiFlashInstall;
 	Network nw(argc, argv);
 	FirmwareVersion fw(SOFTWARE_VERSION, __DATE__, __TIME__);
 
@@ -131,8 +133,11 @@ int main(int argc, char **argv) {
 
 	while (keepRunning) {
 		nw.Run();
+		server.Run();
 		hw.Run();
 	}
 
+	server.Print();
+
 	return 0;
 }
@@ -52,6 +52,7 @@
 #include "remoteconfigparams.h"
 
 #include "configstore.h"
+#include "flashcodeinstall.h"
 
 #include "firmwareversion.h"
 #include "software_version.h"
@@ -69,6 +70,7 @@ int main(int argc, char **argv) {
 	Hardware hw;
 	Display display;
 	ConfigStore configStore;
+	FlashCodeInstall spiFlashInstall;
 	Network nw(argc, argv);
 //	MDNS mDns;
 	FirmwareVersion fw(SOFTWARE_VERSION, __DATE__, __TIME__);
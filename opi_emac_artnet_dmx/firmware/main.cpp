@@ -2,7 +2,7 @@
  * @file main.cpp
  *
  */
-/* Copyright (C) 2018-2024 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2018-2025 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -40,6 +40,9 @@
 
 #include "dmxparams.h"
 #include "dmxsend.h"
+#if defined (CONFIG_DMX_ENABLE_CAPTURE)
+# include "dmxcapture.h"
+#endif
 #include "rdmdeviceparams.h"
 
 #if defined (NODE_SHOWFILE)
@@ -94,6 +97,11 @@ int main() {
 	DmxSend dmxSend;
 	dmxSend.Print();
 
+#if defined (CONFIG_DMX_ENABLE_CAPTURE)
+	DmxCapture dmxCapture;
+	dmxCapture.Print();
+#endif
+
 	node.SetOutput(&dmxSend);
 
 	ArtNetRdmController artNetRdmController;
@@ -155,6 +163,9 @@ int main() {
 		hw.WatchdogFeed();
 		nw.Run();
 		node.Run();
+#if defined (CONFIG_DMX_ENABLE_CAPTURE)
+		dmxCapture.Run();
+#endif
 #if defined (NODE_SHOWFILE)
 		showFile.Run();
 #endif
@@ -2,7 +2,7 @@
  * @file main.cpp
  *
  */
-/* Copyright (C) 2021-2024 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2021-2025 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -176,6 +176,7 @@ int main() {
 		nw.Run();
 		ddpDisplay.Run();
 		pixelTestPattern.Run();
+		pixelDmxMulti.Run();
 		display.Run();
 		hw.Run();
 	}
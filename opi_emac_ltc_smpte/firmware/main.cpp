@@ -55,6 +55,9 @@
 #include "midi.h"
 #include "net/rtpmidi.h"
 #include "midiparams.h"
+#if defined (CONFIG_LTC_ENABLE_MIDI_BRIDGE)
+# include "net/midibridge.h"
+#endif
 
 #include "tcnet.h"
 #include "tcnetparams.h"
@@ -343,11 +346,25 @@ int main() {
 
 	Midi midi;
 
-	if ((ltcSource != ltc::Source::MIDI) && ltc::Destination::IsEnabled(ltc::Destination::Output::MIDI)) {
+	/**
+	 * The MIDI bridge runs when neither the MIDI interface nor the RTP-MIDI session is used for the timecode
+	 */
+
+#if defined (CONFIG_LTC_ENABLE_MIDI_BRIDGE)
+	MidiBridge midiBridge;
+
+	const auto bRunMidiBridge = (ltcSource != ltc::Source::MIDI) && (ltcSource != ltc::Source::APPLEMIDI) && !ltc::Destination::IsEnabled(ltc::Destination::Output::MIDI);
+#else
+	constexpr auto bRunMidiBridge = false;
+#endif
+
+	if (bRunMidiBridge) {
+		midi.Init(static_cast<midi::Direction>(static_cast<uint32_t>(midi::Direction::INPUT) | static_cast<uint32_t>(midi::Direction::OUTPUT)));
+	} else if ((ltcSource != ltc::Source::MIDI) && ltc::Destination::IsEnabled(ltc::Destination::Output::MIDI)) {
 		midi.Init(midi::Direction::OUTPUT);
 	}
 
-	if ((ltcSource == ltc::Source::MIDI) || ltc::Destination::IsEnabled(ltc::Destination::Output::MIDI)) {
+	if ((ltcSource == ltc::Source::MIDI) || ltc::Destination::IsEnabled(ltc::Destination::Output::MIDI) || bRunMidiBridge) {
 		midi.Print();
 	}
 
@@ -357,15 +374,26 @@ int main() {
 
 	RtpMidi rtpMidi;
 
-	if ((ltcSource == ltc::Source::APPLEMIDI) || ltc::Destination::IsEnabled(ltc::Destination::Output::RTPMIDI)) {
+	if ((ltcSource == ltc::Source::APPLEMIDI) || ltc::Destination::IsEnabled(ltc::Destination::Output::RTPMIDI) || bRunMidiBridge) {
 		if (ltcSource == ltc::Source::APPLEMIDI) {
 			rtpMidi.SetHandler(&rtpMidiReader);
 		}
+#if defined (CONFIG_LTC_ENABLE_MIDI_BRIDGE)
+		if (bRunMidiBridge) {
+			rtpMidi.SetHandler(&midiBridge);
+		}
+#endif
 
 		rtpMidi.Start();
 		rtpMidi.Print();
 	}
 
+#if defined (CONFIG_LTC_ENABLE_MIDI_BRIDGE)
+	if (bRunMidiBridge) {
+		midiBridge.Print();
+	}
+#endif
+
 	/**
 	 * ETC
 	 */
@@ -590,6 +618,11 @@ int main() {
 		if (bRunTCNet) {
 			tcnet.Run();
 		}
+#if defined (CONFIG_LTC_ENABLE_MIDI_BRIDGE)
+		if (bRunMidiBridge) {
+			midiBridge.Run();
+		}
+#endif
 
 		if (ltc::Destination::IsEnabled(ltc::Destination::Output::DISPLAY_OLED)) {
 			display.Run();
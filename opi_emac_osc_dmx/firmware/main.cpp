@@ -117,6 +117,7 @@ int main() {
 	for (;;) {
 		hw.WatchdogFeed();
 		nw.Run();
+		server.Run();
 		display.Run();
 		hw.Run();
 	}
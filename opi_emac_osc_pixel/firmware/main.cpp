@@ -2,7 +2,7 @@
  * @file main.cpp
  *
  */
-/* Copyright (C) 2019-2024 by Arjan van Vught mailto:info@orangepi-dmx.nl
+/* Copyright (C) 2019-2025 by Arjan van Vught mailto:info@orangepi-dmx.nl
  *
  * Permission is hereby granted, free of charge, to any person obtaining a copy
  * of this software and associated documentation files (the "Software"), to deal
@@ -128,7 +128,9 @@ int main() {
 	for (;;) {
 		hw.WatchdogFeed();
 		nw.Run();
+		server.Run();
 		pixelTestPattern.Run();
+		pixelDmx.Run();
 		display.Run();
 		hw.Run();
 	}
@@ -144,6 +144,7 @@ int main() {
 	for (;;) {
 		hw.WatchdogFeed();
 		nw.Run();
+		server.Run();
 		hw.Run();
 	}
 }
@@ -215,6 +215,7 @@ int main() {
 	for (;;) {
 		hw.WatchdogFeed();
 		nw.Run();
+		server.Run();
 		hw.Run();
 	}
 }
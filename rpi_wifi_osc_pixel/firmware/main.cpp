@@ -167,6 +167,7 @@ int main() {
 	for (;;) {
 		hw.WatchdogFeed();
 		nw.Run();
+		server.Run();
 		hw.Run();
 	}
 }